@@ -2,6 +2,14 @@
 /*! 
    \file
    \brief      Hardware simulation ( Windows PC CAN BUS implementation )
+   \details    ESP32 TWAI driver. The task "can_rx" (priority configMAX_PRIORITIES - 2,
+               core 1 while app_main() runs on core 0) drains the driver queue into a
+               lock-free single-producer single-consumer ring of CAN_RX_RING_SIZE messages
+               with receive time stamps and notifies the application task (hw_CanWaitRx());
+               hw_CanReadMsgs() reads the ring. Bursts during the pool upload are buffered
+               by the ring and the driver queue. hw_CanGetRxStatus() adds the ring to the
+               pending and dropped counts; hw_CanClose() logs the ring overflows and the
+               maximum delay between reception and hw_CanReadMsgs().
    \author     Wegscheider Peter
    \date       Created XX.02.15
    \copyright  Wegscheider Hammerl Ingenieure Partnerschaft
@@ -19,8 +27,13 @@
 /* ************************************************************************ */
 
 #include <stdio.h>
+#include <atomic>
 #include "AppHW.h"
+#include "AppLog.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "driver/can.h"
+#include "esp_timer.h"
 #include "esp_err.h"
 #include "esp_log.h"
 
@@ -32,11 +45,42 @@
 /* ************************************************************************ */
 
 static void HW_CanMsgPrint(uint8_t canNode_u8, can_message_t* can_msg_ps, uint8_t isRX);
+static void HW_CanRxTask(void* param_pv);
+static const can_message_t* HW_CanRxPeek(void);
+static void HW_CanRxPop(void);
 
 
 #define CANBUS_TAG              "CAN Master"
 #define TX_GPIO_NUM             21
 #define RX_GPIO_NUM             22
+#define CAN_TX_QUEUE_LEN        150
+#define CAN_RX_RING_SIZE        256u     /* power of two */
+#define CAN_RX_TASK_STACK       3072
+#define CAN_RX_TASK_PRIO        (configMAX_PRIORITIES - 2)
+#define CAN_RX_TASK_PERIOD_MS   100      /* can_receive() timeout: checks m_RxTaskRun */
+#if (portNUM_PROCESSORS > 1)
+   #define CAN_RX_TASK_CORE     1        /* app_main() runs on core 0 */
+#else
+   #define CAN_RX_TASK_CORE     0
+#endif
+
+/* Received message and its receive time in the RX task */
+typedef struct
+{
+   can_message_t msg;
+   int64_t       timeUs_s64;      /* esp_timer_get_time() */
+} CanRxEntry_t;
+
+/* Single producer (HW_CanRxTask) single consumer (application task) ring buffer:
+   only the producer writes m_RxHead, only the consumer writes m_RxTail. */
+static CanRxEntry_t          m_RxRing[CAN_RX_RING_SIZE];
+static std::atomic<uint32_t> m_RxHead(0u);
+static std::atomic<uint32_t> m_RxTail(0u);
+static std::atomic<uint32_t> m_RxRingDropped(0u);   /* ring full */
+static volatile bool         m_RxTaskRun = false;
+static TaskHandle_t          m_RxTask = NULL;
+static TaskHandle_t          m_AppTask = NULL;      /* notified by the RX task (hw_CanWaitRx()) */
+static int64_t               m_RxMaxDelayUs = 0;    /* receive in the RX task -> read by the application */
 
 static const can_timing_config_t t_config = CAN_TIMING_CONFIG_250KBITS();
 static const can_filter_config_t f_config = CAN_FILTER_CONFIG_ACCEPT_ALL();
@@ -44,7 +88,7 @@ static const can_filter_config_t f_config = CAN_FILTER_CONFIG_ACCEPT_ALL();
 static const can_general_config_t g_config = {.mode = CAN_MODE_NORMAL,
                                               .tx_io = (gpio_num_t)TX_GPIO_NUM, .rx_io = (gpio_num_t)RX_GPIO_NUM,
                                               .clkout_io = (gpio_num_t)CAN_IO_UNUSED, .bus_off_io = (gpio_num_t)CAN_IO_UNUSED,
-                                              .tx_queue_len = 150, .rx_queue_len = 120,
+                                              .tx_queue_len = CAN_TX_QUEUE_LEN, .rx_queue_len = 120,
                                               .alerts_enabled = CAN_ALERT_NONE,
                                               .clkout_divider = 0};
 
@@ -60,10 +104,26 @@ void hw_CanInit(uint8_t maxCanNodes_u8)
 
     ESP_ERROR_CHECK(can_start());
     ESP_LOGI(CANBUS_TAG, "Driver started");
+
+    m_AppTask = xTaskGetCurrentTaskHandle();
+    m_RxTaskRun = true;
+    if (xTaskCreatePinnedToCore(HW_CanRxTask, "can_rx", CAN_RX_TASK_STACK, NULL, CAN_RX_TASK_PRIO, &m_RxTask, CAN_RX_TASK_CORE) != pdPASS)
+    {
+       m_RxTaskRun = false;
+       m_RxTask = NULL;
+       ESP_LOGE(CANBUS_TAG, "RX task not created");
+    }
 }
 
 void hw_CanClose(void)
 {
+    m_RxTaskRun = false;
+    while (m_RxTask != NULL)
+    {  /* the RX task ends after its current can_receive() */
+       vTaskDelay(1);
+    }
+    ESP_LOGI(CANBUS_TAG, "RX: %u dropped in ring, max. delay %d us", (unsigned)m_RxRingDropped.load(), (int)m_RxMaxDelayUs);
+
     //Uninstall CAN driver
     ESP_ERROR_CHECK(can_stop());
     ESP_LOGI(CANBUS_TAG, "Driver stopped");
@@ -90,7 +150,8 @@ int16_t hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canD
    
 
    
-   if (can_transmit(&can_msg_send, pdMS_TO_TICKS(1)) == ESP_OK)
+   /* the ISOBUS driver checks hw_CanGetFreeSendMsgBufferSize() before sending: never wait here */
+   if (can_transmit(&can_msg_send, 0) == ESP_OK)
    {
        HW_CanMsgPrint(canNode_u8, &can_msg_send, 0u);
    }
@@ -102,42 +163,164 @@ int16_t hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canD
    return ret_16;
 }
 
+void hw_CanFlushSendMsgs(uint8_t canNode_u8)
+{  /* can_transmit() queues the message in the driver */
+   (void)canNode_u8;
+}
+
 int16_t hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_pau8[], uint8_t *canDataLength_pu8)
 {
-   can_message_t can_msg_read;
-
+   hw_CanMsg_t can_msg;
+   if (hw_CanReadMsgs(canNode_u8, &can_msg, 1) > 0)
+   {
+      *canId_pu32 = can_msg.canId_u32;
+      *canDataLength_pu8 = can_msg.canDataLength_u8;
+      for (uint8_t i_u8 = 0u; i_u8 < can_msg.canDataLength_u8; i_u8++)
+      {
+         canData_pau8[i_u8] = can_msg.canData_au8[i_u8];
+      }
+      return 1;
+   }
+   return 0;
+}
 
+int16_t hw_CanReadMsgs(uint8_t canNode_u8, hw_CanMsg_t canMsgs_as[], int16_t maxMsgs_s16)
+{
+   const can_message_t* can_msg_ps;
+   int16_t count_s16 = 0;
 
-   if (can_receive(&can_msg_read, pdMS_TO_TICKS(1)) == ESP_OK)
+   /* drain the ring buffer filled by the RX task */
+   while ((count_s16 < maxMsgs_s16) && ((can_msg_ps = HW_CanRxPeek()) != NULL))
    {
-      if (can_msg_read.identifier != 0xCCCCCCCCuL)
+      if (can_msg_ps->identifier != 0xCCCCCCCCuL)
       {
-         HW_CanMsgPrint(canNode_u8, &can_msg_read, 1u);
-         *canId_pu32 = can_msg_read.identifier;
-         *canDataLength_pu8 = can_msg_read.data_length_code;
-         for (uint8_t i_u8 = 0u; i_u8 < can_msg_read.data_length_code; i_u8++)
+         hw_CanMsg_t* msg_ps = &canMsgs_as[count_s16];
+         HW_CanMsgPrint(canNode_u8, (can_message_t*)can_msg_ps, 1u);
+         msg_ps->canId_u32 = can_msg_ps->identifier;
+         /* a DLC above 8 (non-compliant frame) still carries 8 data bytes */
+         msg_ps->canDataLength_u8 = (can_msg_ps->data_length_code > 8u) ? 8u : (uint8_t)can_msg_ps->data_length_code;
+         for (uint8_t i_u8 = 0u; i_u8 < msg_ps->canDataLength_u8; i_u8++)
          {
-            canData_pau8[i_u8] = can_msg_read.data[i_u8];
+            msg_ps->canData_au8[i_u8] = can_msg_ps->data[i_u8];
          }
-         return 1;
+         count_s16++;
       }
+      HW_CanRxPop();
    }
+   return count_s16;
+}
+
+int16_t hw_CanGetRxStatus(uint8_t canNode_u8, hw_CanRxStatus_t* rxStatus_ps)
+{
+   can_status_info_t status_info;
+   (void)canNode_u8;
+   if (can_get_status_info(&status_info) != ESP_OK)
+   {
+      return -1;
+   }
+   /* messages in the ring and still in the driver queue; lost in the driver or the ring */
+   rxStatus_ps->pending_u32 = (m_RxHead.load(std::memory_order_acquire) - m_RxTail.load(std::memory_order_relaxed)) + status_info.msgs_to_rx;
+   rxStatus_ps->dropped_u32 = status_info.rx_missed_count + m_RxRingDropped.load(std::memory_order_relaxed);
    return 0;
 }
 
 int16_t  hw_CanGetFreeSendMsgBufferSize(uint8_t canNode_u8)
-{  /* we return always 20 free buffer entries.... */
-   return 20;
+{
+   can_status_info_t status_info;
+   (void)canNode_u8;
+   if ((can_get_status_info(&status_info) != ESP_OK) || (status_info.state != CAN_STATE_RUNNING))
+   {  /* stopped, bus off or recovering: can_transmit() would fail */
+      return 0;
+   }
+   return (status_info.msgs_to_tx < CAN_TX_QUEUE_LEN) ? (int16_t)(CAN_TX_QUEUE_LEN - status_info.msgs_to_tx) : 0;
+}
+
+int16_t hw_CanWaitRx(uint32_t timeoutMs_u32)
+{
+   TickType_t ticks;
+
+   if (m_RxTask == NULL)
+   {  /* no RX task: the caller sleeps */
+      return -1;
+   }
+   if (HW_CanRxPeek() != NULL)
+   {
+      return 1;
+   }
+
+   /* a message written after HW_CanRxPeek() has already given the notification; at least one tick */
+   ticks = pdMS_TO_TICKS(timeoutMs_u32);
+   ticks = (ticks > 0u) ? ticks : 1u;
+   (void)ulTaskNotifyTake(pdTRUE, ticks);
+   return (HW_CanRxPeek() != NULL) ? 1 : 0;
+}
+
+/* ************************************************************************ */
+
+/* Drains the TWAI driver queue into the ring buffer */
+static void HW_CanRxTask(void* param_pv)
+{
+   (void)param_pv;
+   while (m_RxTaskRun)
+   {
+      can_message_t can_msg;
+      if (can_receive(&can_msg, pdMS_TO_TICKS(CAN_RX_TASK_PERIOD_MS)) == ESP_OK)
+      {
+         uint32_t head_u32 = m_RxHead.load(std::memory_order_relaxed);
+         if ((head_u32 - m_RxTail.load(std::memory_order_acquire)) >= CAN_RX_RING_SIZE)
+         {  /* the application does not keep up: drop the newest message */
+            m_RxRingDropped.fetch_add(1u, std::memory_order_relaxed);
+         }
+         else
+         {
+            CanRxEntry_t* entry_ps = &m_RxRing[head_u32 & (CAN_RX_RING_SIZE - 1u)];
+            entry_ps->msg = can_msg;
+            entry_ps->timeUs_s64 = esp_timer_get_time();
+            m_RxHead.store(head_u32 + 1u, std::memory_order_release);
+            xTaskNotifyGive(m_AppTask);
+         }
+      }
+   }
+
+   m_RxTask = NULL;
+   vTaskDelete(NULL);
+}
+
+/* Oldest message of the ring buffer; NULL: empty */
+static const can_message_t* HW_CanRxPeek(void)
+{
+   uint32_t tail_u32 = m_RxTail.load(std::memory_order_relaxed);
+   if (tail_u32 == m_RxHead.load(std::memory_order_acquire))
+   {
+      return NULL;
+   }
+   return &m_RxRing[tail_u32 & (CAN_RX_RING_SIZE - 1u)].msg;
+}
+
+/* Releases the message returned by HW_CanRxPeek() */
+static void HW_CanRxPop(void)
+{
+   uint32_t tail_u32 = m_RxTail.load(std::memory_order_relaxed);
+   int64_t delayUs_s64 = esp_timer_get_time() - m_RxRing[tail_u32 & (CAN_RX_RING_SIZE - 1u)].timeUs_s64;
+   if (delayUs_s64 > m_RxMaxDelayUs)
+   {
+      m_RxMaxDelayUs = delayUs_s64;
+   }
+   m_RxTail.store(tail_u32 + 1u, std::memory_order_release);
 }
 
 static void HW_CanMsgPrint(uint8_t canNode_u8, can_message_t* can_msg_ps, uint8_t isRX)
 {
-   return; //disable CANPrint.
    const char_t *pcMsgTxt;
    const char_t *pcRxTx;
    /* printf hw_DebugPrint hw_DebugTrace */
    #define CAN_PRINT hw_DebugTrace
 
+   if (!APP_LOG_ENABLED(APP_LOG_MOD_CAN, APP_LOG_LEVEL_TRACE))
+   {  /* removed by the compiler below APP_LOG_LEVEL_TRACE; run time: Log.CAN=5 */
+      return;
+   }
+
    pcRxTx = (isRX > 0u) ? "Rx" : "Tx";
    CAN_PRINT("%2u %2s %8x %1u ", canNode_u8, pcRxTx, can_msg_ps->identifier, can_msg_ps->data_length_code);
 
@@ -0,0 +1,534 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Linux SocketCAN implementation of the hw_Can functions
+   \details    Each CAN node is a non-blocking CAN_RAW socket. Frames are received in
+               batches with recvmmsg() including the kernel receive time stamp and sent
+               in batches with sendmmsg() by hw_CanFlushSendMsgs() at the end of
+               AppIso_Cyclic(). While the socket does not accept frames (EAGAIN/ENOBUFS),
+               hw_CanGetFreeSendMsgBufferSize() reports no free slot.
+               hw_CanGetRxStatus() tops up the receive batch and reports the buffered frames.
+               hw_CanWaitRx() waits with epoll for the sockets of all nodes.
+               hw_CanClose() prints frames, batches and receive rate per node.
+               The interfaces are read from the settings, section "CanDriver",
+               keys "Interface0" .. "Interface3" (default "vcan0" .. "vcan3"). \n
+               Virtual test bus: \n
+               sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+*/
+/* ************************************************************************ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#include "AppHW.h"
+#include "AppLog.h"
+#include "settings.h"
+
+#define USE_APP_OUTPUT
+#if defined(USE_APP_OUTPUT)
+   #include "AppOutput.h"
+#endif /* defined(USE_APP_OUTPUT) */
+
+/* ************************************************************************ */
+
+#define CAN_MAX_NODES      4u       /* maximum number of CAN nodes */
+#define CAN_BATCH_SIZE     32u      /* frames per recvmmsg() / sendmmsg() call */
+#define CAN_TX_QUEUE_LEN   150u     /* same as tx_queue_len of the ESP32 driver */
+
+typedef struct
+{
+   struct can_frame frame;
+   struct timespec  timestamp;      /* kernel receive time (SO_TIMESTAMPNS) */
+} CanRxFrame_t;
+
+typedef struct
+{
+   int               socket_i;
+   /* receive batch */
+   CanRxFrame_t      rxFrames[CAN_BATCH_SIZE];
+   uint32_t          rxCount_u32;
+   uint32_t          rxIndex_u32;
+   uint32_t          rxDropped_u32;    /* socket receive queue overflows (SO_RXQ_OVFL) */
+   /* transmit queue (ring buffer) */
+   struct can_frame  txFrames[CAN_TX_QUEUE_LEN];
+   uint32_t          txHead_u32;
+   uint32_t          txCount_u32;
+   uint8_t           txBlocked_u8;     /* 1: the socket did not accept the last batch; retried by the next flush */
+   /* statistics */
+   uint32_t          rxFrameCount_u32;
+   uint32_t          rxBatchCount_u32;
+   uint32_t          txFrameCount_u32;
+   uint32_t          txBatchCount_u32;
+   uint32_t          txOverflowCount_u32;
+   struct timespec   rxFirst;
+   struct timespec   rxLast;
+} CanNode_t;
+
+/* ************************************************************************ */
+
+static CanNode_t m_CanNodes[CAN_MAX_NODES];
+static uint8_t   m_MaxCanNodes_u8 = 0u;
+static int       m_Epoll_i = -1;        /* receive readiness of all sockets */
+
+/* ************************************************************************ */
+
+static void HW_CanReceiveBatch(CanNode_t* node_ps);
+static const struct can_frame* HW_CanNextRxFrame(uint8_t canNode_u8);
+static void HW_CanSendBatch(CanNode_t* node_ps);
+static double HW_CanTimeDiffS(const struct timespec* from_ps, const struct timespec* to_ps);
+static void HW_CanMsgPrint(uint8_t canNode_u8, const struct can_frame* can_msg_ps, const struct timespec* timestamp_ps, uint8_t isRX);
+
+/* ################### CAN Functions ################ */
+
+#if !defined(CCI_CAN_API)  // the implementation is not required if CAN is out sourced into a DLL
+void hw_CanInit(uint8_t maxCanNodes_u8)
+{
+   uint8_t i_u8;
+
+   m_MaxCanNodes_u8 = (maxCanNodes_u8 > CAN_MAX_NODES) ? CAN_MAX_NODES : maxCanNodes_u8;
+   m_Epoll_i = epoll_create1(0);
+   if (m_Epoll_i < 0)
+   {
+      hw_LogError("CAN init: epoll_create1 (%s)\n", strerror(errno));
+   }
+
+   for (i_u8 = 0u; i_u8 < m_MaxCanNodes_u8; i_u8++)
+   {
+      CanNode_t* node_ps = &m_CanNodes[i_u8];
+      char key[16];
+      char defaultName[IFNAMSIZ];
+      char interfaceName[IFNAMSIZ + 1];
+      struct ifreq ifr;
+      struct sockaddr_can addr;
+      const int enable_i = 1;
+
+      memset(node_ps, 0, sizeof(CanNode_t));
+      snprintf(key, sizeof(key), "Interface%u", i_u8);
+      snprintf(defaultName, sizeof(defaultName), "vcan%u", i_u8);
+      getString("CanDriver", key, defaultName, interfaceName, sizeof(interfaceName));
+
+      node_ps->socket_i = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);
+      if (node_ps->socket_i < 0)
+      {
+         hw_LogError("CAN init failed: socket (%s)\n", strerror(errno));
+         continue;
+      }
+
+      memset(&ifr, 0, sizeof(ifr));
+      strncpy(ifr.ifr_name, interfaceName, IFNAMSIZ - 1);
+      memset(&addr, 0, sizeof(addr));
+      addr.can_family = AF_CAN;
+      if ((ioctl(node_ps->socket_i, SIOCGIFINDEX, &ifr) < 0)
+         || (setsockopt(node_ps->socket_i, SOL_SOCKET, SO_TIMESTAMPNS, &enable_i, sizeof(enable_i)) < 0)
+         || (setsockopt(node_ps->socket_i, SOL_SOCKET, SO_RXQ_OVFL, &enable_i, sizeof(enable_i)) < 0)
+         || ((addr.can_ifindex = ifr.ifr_ifindex), (bind(node_ps->socket_i, (struct sockaddr*)&addr, sizeof(addr)) < 0)))
+      {
+         hw_LogError("CAN init failed: %s (%s)\n", interfaceName, strerror(errno));
+         close(node_ps->socket_i);
+         node_ps->socket_i = -1;
+         continue;
+      }
+
+      if (m_Epoll_i >= 0)
+      {
+         struct epoll_event event;
+         event.events = EPOLLIN;
+         event.data.u32 = i_u8;
+         if (epoll_ctl(m_Epoll_i, EPOLL_CTL_ADD, node_ps->socket_i, &event) < 0)
+         {
+            hw_LogError("CAN init: epoll_ctl %s (%s)\n", interfaceName, strerror(errno));
+         }
+      }
+
+      hw_DebugPrint("CAN node %u: %s\n", i_u8, interfaceName);
+   }
+}
+
+void hw_CanClose(void)
+{
+   uint8_t i_u8;
+
+   for (i_u8 = 0u; i_u8 < m_MaxCanNodes_u8; i_u8++)
+   {
+      CanNode_t* node_ps = &m_CanNodes[i_u8];
+      if (node_ps->socket_i < 0)
+      {
+         continue;
+      }
+
+      hw_CanFlushSendMsgs(i_u8);
+      {  /* throughput between the first and the last received frame */
+         double rxTimeS = HW_CanTimeDiffS(&node_ps->rxFirst, &node_ps->rxLast);
+         hw_DebugPrint("CAN node %u: rx %u frames in %u batches (%.0f frames/s), tx %u frames in %u batches, %u overflows\n",
+            i_u8, node_ps->rxFrameCount_u32, node_ps->rxBatchCount_u32,
+            (rxTimeS > 0.0) ? (node_ps->rxFrameCount_u32 / rxTimeS) : 0.0,
+            node_ps->txFrameCount_u32, node_ps->txBatchCount_u32, node_ps->txOverflowCount_u32);
+      }
+
+      close(node_ps->socket_i);
+      node_ps->socket_i = -1;
+   }
+
+   if (m_Epoll_i >= 0)
+   {
+      close(m_Epoll_i);
+      m_Epoll_i = -1;
+   }
+
+   m_MaxCanNodes_u8 = 0u;
+}
+
+int16_t hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canData_au8[], uint8_t canDataLength_u8)
+{
+   CanNode_t* node_ps;
+   struct can_frame* frame_ps;
+
+   if ((canNode_u8 >= m_MaxCanNodes_u8) || (m_CanNodes[canNode_u8].socket_i < 0))
+   {
+      return -9;  /* E_COM -> Bus off*/
+   }
+
+   node_ps = &m_CanNodes[canNode_u8];
+   if (node_ps->txCount_u32 >= CAN_TX_QUEUE_LEN)
+   {  /* try to make room */
+      HW_CanSendBatch(node_ps);
+   }
+
+   if (node_ps->txCount_u32 >= CAN_TX_QUEUE_LEN)
+   {
+      node_ps->txOverflowCount_u32++;
+      hw_DebugPrint("Tx error: %x %x \n", canId_u32, canData_au8[0]);
+      return -6; /* E_OVERFLOW */
+   }
+
+   frame_ps = &node_ps->txFrames[(node_ps->txHead_u32 + node_ps->txCount_u32) % CAN_TX_QUEUE_LEN];
+   memset(frame_ps, 0, sizeof(struct can_frame));
+   frame_ps->can_id = (canId_u32 & CAN_EFF_MASK) | CAN_EFF_FLAG; /* extended */
+   frame_ps->can_dlc = (canDataLength_u8 > 8u) ? 8u : canDataLength_u8;
+   memcpy(frame_ps->data, canData_au8, frame_ps->can_dlc);
+   node_ps->txCount_u32++;
+   HW_CanMsgPrint(canNode_u8, frame_ps, NULL, 0u);
+
+   if (node_ps->txCount_u32 >= CAN_BATCH_SIZE)
+   {
+      HW_CanSendBatch(node_ps);
+   }
+
+   return 0;
+}
+
+void hw_CanFlushSendMsgs(uint8_t canNode_u8)
+{
+   if ((canNode_u8 < m_MaxCanNodes_u8) && (m_CanNodes[canNode_u8].socket_i >= 0))
+   {
+      HW_CanSendBatch(&m_CanNodes[canNode_u8]);
+   }
+}
+
+int16_t hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_pau8[], uint8_t *canDataLength_pu8)
+{
+   const struct can_frame* frame_ps = HW_CanNextRxFrame(canNode_u8);
+   if (frame_ps == NULL)
+   {
+      return 0;
+   }
+
+   *canId_pu32 = frame_ps->can_id & CAN_EFF_MASK;
+   *canDataLength_pu8 = frame_ps->can_dlc;
+   memcpy(canData_pau8, frame_ps->data, frame_ps->can_dlc);
+   return 1;
+}
+
+int16_t hw_CanReadMsgs(uint8_t canNode_u8, hw_CanMsg_t canMsgs_as[], int16_t maxMsgs_s16)
+{
+   int16_t count_s16 = 0;
+   const struct can_frame* frame_ps;
+
+   while ((count_s16 < maxMsgs_s16) && ((frame_ps = HW_CanNextRxFrame(canNode_u8)) != NULL))
+   {
+      canMsgs_as[count_s16].canId_u32 = frame_ps->can_id & CAN_EFF_MASK;
+      canMsgs_as[count_s16].canDataLength_u8 = frame_ps->can_dlc;
+      memcpy(canMsgs_as[count_s16].canData_au8, frame_ps->data, frame_ps->can_dlc);
+      count_s16++;
+   }
+
+   return count_s16;
+}
+
+int16_t hw_CanGetRxStatus(uint8_t canNode_u8, hw_CanRxStatus_t* rxStatus_ps)
+{
+   CanNode_t* node_ps;
+
+   if ((canNode_u8 >= m_MaxCanNodes_u8) || (m_CanNodes[canNode_u8].socket_i < 0))
+   {
+      return -1;
+   }
+
+   /* the socket does not report its queue length: the frames waiting in the socket are read into
+      the batch, so pending counts the frames received so far, at most CAN_BATCH_SIZE */
+   node_ps = &m_CanNodes[canNode_u8];
+   HW_CanReceiveBatch(node_ps);
+   rxStatus_ps->pending_u32 = node_ps->rxCount_u32 - node_ps->rxIndex_u32;
+   rxStatus_ps->dropped_u32 = node_ps->rxDropped_u32;
+   return 0;
+}
+
+int16_t  hw_CanGetFreeSendMsgBufferSize(uint8_t canNode_u8)
+{
+   CanNode_t* node_ps;
+
+   if ((canNode_u8 >= m_MaxCanNodes_u8) || (m_CanNodes[canNode_u8].socket_i < 0))
+   {
+      return 0;
+   }
+
+   node_ps = &m_CanNodes[canNode_u8];
+   if (node_ps->txBlocked_u8 != 0u)
+   {  /* the queued frames wait for the socket: no room until it accepts them again */
+      HW_CanSendBatch(node_ps);
+   }
+
+   return (node_ps->txBlocked_u8 != 0u) ? 0 : (int16_t)(CAN_TX_QUEUE_LEN - node_ps->txCount_u32);
+}
+
+int16_t hw_CanWaitRx(uint32_t timeoutMs_u32)
+{
+   struct epoll_event events[CAN_MAX_NODES];
+   uint8_t i_u8;
+   int ret_i;
+
+   if (m_Epoll_i < 0)
+   {
+      return -1;
+   }
+
+   for (i_u8 = 0u; i_u8 < m_MaxCanNodes_u8; i_u8++)
+   {  /* frames of the last batch not read yet */
+      if (m_CanNodes[i_u8].rxIndex_u32 < m_CanNodes[i_u8].rxCount_u32)
+      {
+         return 1;
+      }
+   }
+
+   ret_i = epoll_wait(m_Epoll_i, events, CAN_MAX_NODES, (timeoutMs_u32 > (uint32_t)INT32_MAX) ? -1 : (int)timeoutMs_u32);
+   if (ret_i < 0)
+   {  /* EINTR: e.g. SIGINT; the caller checks hw_PowerSwitchIsOn() */
+      return (errno == EINTR) ? 0 : -1;
+   }
+   return (ret_i > 0) ? 1 : 0;
+}
+
+/* ************************************************************************ */
+
+/* Returns the next received extended data frame; NULL: none */
+static const struct can_frame* HW_CanNextRxFrame(uint8_t canNode_u8)
+{
+   CanNode_t* node_ps;
+
+   if ((canNode_u8 >= m_MaxCanNodes_u8) || (m_CanNodes[canNode_u8].socket_i < 0))
+   {
+      return NULL;
+   }
+
+   node_ps = &m_CanNodes[canNode_u8];
+   for (;;)
+   {
+      const CanRxFrame_t* rx_ps;
+      if (node_ps->rxIndex_u32 >= node_ps->rxCount_u32)
+      {
+         HW_CanReceiveBatch(node_ps);
+         if (node_ps->rxIndex_u32 >= node_ps->rxCount_u32)
+         {
+            return NULL;
+         }
+      }
+
+      rx_ps = &node_ps->rxFrames[node_ps->rxIndex_u32++];
+      if ((rx_ps->frame.can_id & (CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG)) == CAN_EFF_FLAG)
+      {  /* ISOBUS uses extended data frames only */
+         HW_CanMsgPrint(canNode_u8, &rx_ps->frame, &rx_ps->timestamp, 1u);
+         return &rx_ps->frame;
+      }
+   }
+}
+
+/* Appends the pending frames to the unread frames of the batch (up to CAN_BATCH_SIZE) without waiting. */
+static void HW_CanReceiveBatch(CanNode_t* node_ps)
+{
+   struct mmsghdr msgs[CAN_BATCH_SIZE];
+   struct iovec iovs[CAN_BATCH_SIZE];
+   char controls[CAN_BATCH_SIZE][CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+   uint32_t unread_u32 = node_ps->rxCount_u32 - node_ps->rxIndex_u32;
+   uint32_t free_u32 = CAN_BATCH_SIZE - unread_u32;
+   uint32_t i_u32;
+   int count_i;
+
+   if ((node_ps->rxIndex_u32 > 0u) && (unread_u32 > 0u))
+   {
+      memmove(&node_ps->rxFrames[0], &node_ps->rxFrames[node_ps->rxIndex_u32], unread_u32 * sizeof(CanRxFrame_t));
+   }
+
+   node_ps->rxIndex_u32 = 0u;
+   node_ps->rxCount_u32 = unread_u32;
+   if (free_u32 == 0u)
+   {
+      return;
+   }
+
+   memset(msgs, 0, sizeof(msgs));
+   for (i_u32 = 0u; i_u32 < free_u32; i_u32++)
+   {
+      iovs[i_u32].iov_base = &node_ps->rxFrames[unread_u32 + i_u32].frame;
+      iovs[i_u32].iov_len = sizeof(struct can_frame);
+      msgs[i_u32].msg_hdr.msg_iov = &iovs[i_u32];
+      msgs[i_u32].msg_hdr.msg_iovlen = 1;
+      msgs[i_u32].msg_hdr.msg_control = controls[i_u32];
+      msgs[i_u32].msg_hdr.msg_controllen = sizeof(controls[i_u32]);
+   }
+
+   count_i = recvmmsg(node_ps->socket_i, msgs, free_u32, MSG_DONTWAIT, NULL);
+   if (count_i <= 0)
+   {  /* EAGAIN: no frame */
+      return;
+   }
+
+   for (i_u32 = 0u; i_u32 < (uint32_t)count_i; i_u32++)
+   {
+      struct cmsghdr* cmsg_ps;
+      CanRxFrame_t* rx_ps = &node_ps->rxFrames[unread_u32 + i_u32];
+
+      memset(&rx_ps->timestamp, 0, sizeof(rx_ps->timestamp));
+      for (cmsg_ps = CMSG_FIRSTHDR(&msgs[i_u32].msg_hdr); cmsg_ps != NULL; cmsg_ps = CMSG_NXTHDR(&msgs[i_u32].msg_hdr, cmsg_ps))
+      {
+         if ((cmsg_ps->cmsg_level == SOL_SOCKET) && (cmsg_ps->cmsg_type == SCM_TIMESTAMPNS))
+         {
+            memcpy(&rx_ps->timestamp, CMSG_DATA(cmsg_ps), sizeof(struct timespec));
+         }
+         else if ((cmsg_ps->cmsg_level == SOL_SOCKET) && (cmsg_ps->cmsg_type == SO_RXQ_OVFL))
+         {
+            memcpy(&node_ps->rxDropped_u32, CMSG_DATA(cmsg_ps), sizeof(uint32_t));
+         }
+      }
+
+      if (node_ps->rxFrameCount_u32 == 0u)
+      {
+         node_ps->rxFirst = rx_ps->timestamp;
+      }
+
+      node_ps->rxLast = rx_ps->timestamp;
+      node_ps->rxFrameCount_u32++;
+   }
+
+   node_ps->rxCount_u32 += (uint32_t)count_i;
+   node_ps->rxBatchCount_u32++;
+}
+
+/* Sends the queued frames; frames not accepted by the socket (EAGAIN) stay queued. */
+static void HW_CanSendBatch(CanNode_t* node_ps)
+{
+   while (node_ps->txCount_u32 > 0u)
+   {
+      struct mmsghdr msgs[CAN_BATCH_SIZE];
+      struct iovec iovs[CAN_BATCH_SIZE];
+      uint32_t count_u32 = (node_ps->txCount_u32 > CAN_BATCH_SIZE) ? CAN_BATCH_SIZE : node_ps->txCount_u32;
+      uint32_t i_u32;
+      int sent_i;
+
+      memset(msgs, 0, sizeof(msgs));
+      for (i_u32 = 0u; i_u32 < count_u32; i_u32++)
+      {
+         iovs[i_u32].iov_base = &node_ps->txFrames[(node_ps->txHead_u32 + i_u32) % CAN_TX_QUEUE_LEN];
+         iovs[i_u32].iov_len = sizeof(struct can_frame);
+         msgs[i_u32].msg_hdr.msg_iov = &iovs[i_u32];
+         msgs[i_u32].msg_hdr.msg_iovlen = 1;
+      }
+
+      sent_i = sendmmsg(node_ps->socket_i, msgs, count_u32, MSG_DONTWAIT);
+      if (sent_i <= 0)
+      {  /* socket buffer is full (EAGAIN/ENOBUFS) or bus error; retry with the next flush */
+         node_ps->txBlocked_u8 = 1u;
+         break;
+      }
+
+      node_ps->txBlocked_u8 = 0u;
+
+      node_ps->txHead_u32 = (node_ps->txHead_u32 + (uint32_t)sent_i) % CAN_TX_QUEUE_LEN;
+      node_ps->txCount_u32 -= (uint32_t)sent_i;
+      node_ps->txFrameCount_u32 += (uint32_t)sent_i;
+      node_ps->txBatchCount_u32++;
+   }
+}
+
+static double HW_CanTimeDiffS(const struct timespec* from_ps, const struct timespec* to_ps)
+{
+   return (double)(to_ps->tv_sec - from_ps->tv_sec) + ((double)(to_ps->tv_nsec - from_ps->tv_nsec) / 1.0e9);
+}
+
+static void HW_CanMsgPrint(uint8_t canNode_u8, const struct can_frame* can_msg_ps, const struct timespec* timestamp_ps, uint8_t isRX)
+{
+   const char_t *pcMsgTxt;
+   const char_t *pcRxTx;
+   uint32_t canId_u32 = can_msg_ps->can_id & CAN_EFF_MASK;
+   /* printf hw_DebugPrint hw_DebugTrace */
+   #define CAN_PRINT hw_DebugTrace
+
+   if (!APP_LOG_ENABLED(APP_LOG_MOD_CAN, APP_LOG_LEVEL_TRACE))
+   {  /* removed by the compiler below APP_LOG_LEVEL_TRACE; run time: Log.CAN=5 */
+      return;
+   }
+
+   pcRxTx = (isRX > 0u) ? "Rx" : "Tx";
+   CAN_PRINT("%2u %12.3f %2s %8x %1u ", canNode_u8,
+      (timestamp_ps != NULL) ? ((double)timestamp_ps->tv_sec * 1000.0) + ((double)timestamp_ps->tv_nsec / 1.0e6) : 0.0,
+      pcRxTx, canId_u32, can_msg_ps->can_dlc);
+
+#if defined(USE_APP_OUTPUT)
+   {  // Get PGN and extra text if available
+      uint32_t u32PGN;
+      u32PGN = (canId_u32 & 0x03FFFF00uL) >> 8u;
+      if ((u32PGN & 0x00FF00uL) < PGN_PDU2_240_X)
+      {  /* PDU 1 -> remove DA */
+         u32PGN &= 0x03FF00uL;
+      }
+
+      switch (u32PGN)
+      {
+         case PGN_VTtoECU        :
+         case PGN_ECUtoVT        : pcMsgTxt = VTSublistTextout(can_msg_ps->data[0] ); break;
+         case PGN_PROCESS_DATA   : pcMsgTxt = TCSublistTextout(can_msg_ps->data[0] ); break;
+         case PGN_TP_DT          : pcMsgTxt = TPSublistTextout(can_msg_ps->data[0], can_msg_ps->data[1] ); break;
+         case PGN_ADDRESS_CLAIMED: pcMsgTxt = ACLSublistTextout(canId_u32, (const ISO_CF_NAME_T*)&(can_msg_ps->data) ); break;
+         case PGN_TP_CM          :
+         case PGN_ETP_CM         : pcMsgTxt = TPCMSublistTextOut(canId_u32, (iso_u8*)can_msg_ps->data); break;
+         case PGN_N_ACK          : pcMsgTxt = ACKSublistTextOut(canId_u32, (iso_u8*)can_msg_ps->data); break;
+         case PGN_WORKING_SET_MEMBER: pcMsgTxt = "Working set member ";   break;
+         case PGN_WORKING_SET_MASTER: pcMsgTxt = "Working set master ";   break;
+         case PGN_LANGUAGE_COMMAND  : pcMsgTxt = "Language command ";     break;
+         case PGN_ACTIVE_DIAG_TROUBLE_CODES: pcMsgTxt = "DM1 ";      break;
+         default                    : pcMsgTxt = " ";                break;
+      }
+   }
+#else
+   pcMsgTxt = " ";
+#endif /* defined(USE_APP_OUTPUT) */
+
+   if (can_msg_ps->can_dlc == 3)
+   {
+      CAN_PRINT("%2.2x %2.2x %2.2x  %s\n", can_msg_ps->data[0], can_msg_ps->data[1], can_msg_ps->data[2], pcMsgTxt);
+   }
+   else
+   {
+      CAN_PRINT("%2.2x %2.2x %2.2x %2.2x %2.2x %2.2x %2.2x %2.2x  %s\n",
+         can_msg_ps->data[0], can_msg_ps->data[1], can_msg_ps->data[2], can_msg_ps->data[3],
+         can_msg_ps->data[4], can_msg_ps->data[5], can_msg_ps->data[6], can_msg_ps->data[7], pcMsgTxt);
+   }
+}
+#endif // !defined(CCI_CAN_API)
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include "AppHW.h"
+#include "AppLog.h"
 
 #ifdef ESP_PLATFORM
 #include "freertos/FreeRTOS.h"
@@ -102,6 +103,106 @@ BOOL WINAPI ConsoleHandler(DWORD CEvent)
 #include <unistd.h>
 #endif // defined(linux) || defined(ESP_PLATFORM)
 
+#ifdef linux
+#include <termios.h>    //keyboard without echo and line buffering
+#include <sys/select.h>
+#include <signal.h>
+
+static struct termios m_TermOrig;
+static uint8_t m_TermRaw_u8 = 0u;
+static volatile sig_atomic_t m_PowerOff = 0;
+
+/* CTRL+C / SIGTERM ends the main loop */
+static void HW_SignalHandler(int signal_i)
+{
+   (void)signal_i;
+   m_PowerOff = 1;
+}
+
+static void HW_TermRestore(void)
+{
+   if (m_TermRaw_u8 != 0u)
+   {
+      tcsetattr(STDIN_FILENO, TCSANOW, &m_TermOrig);
+      m_TermRaw_u8 = 0u;
+   }
+}
+
+static void HW_TermSetRaw(void)
+{
+   struct termios termRaw;
+   if ((m_TermRaw_u8 == 0u) && (isatty(STDIN_FILENO) != 0) && (tcgetattr(STDIN_FILENO, &m_TermOrig) == 0))
+   {
+      termRaw = m_TermOrig;
+      termRaw.c_lflag &= ~(ICANON | ECHO);
+      termRaw.c_cc[VMIN] = 1;
+      termRaw.c_cc[VTIME] = 0;
+      if (tcsetattr(STDIN_FILENO, TCSANOW, &termRaw) == 0)
+      {
+         m_TermRaw_u8 = 1u;
+         atexit(HW_TermRestore);
+      }
+   }
+}
+
+/* returns 1 if a character can be read within timeoutMs */
+static int_t HW_TermWaitChar(uint32_t timeoutMs)
+{
+   fd_set readSet;
+   struct timeval timeout;
+   FD_ZERO(&readSet);
+   FD_SET(STDIN_FILENO, &readSet);
+   timeout.tv_sec = 0;
+   timeout.tv_usec = (suseconds_t)(timeoutMs * 1000u);
+   return (select(STDIN_FILENO + 1, &readSet, NULL, NULL, &timeout) > 0) ? 1 : 0;
+}
+
+static int_t HW_TermReadChar(void)
+{
+   unsigned char ch = 0u;
+   return (read(STDIN_FILENO, &ch, 1u) == 1) ? (int_t)ch : 0;
+}
+
+/* Maps the escape sequences of F1 .. F8 (xterm and linux console) to the Windows key codes 59 .. 66 */
+static int_t HW_TermReadFunctionKey(void)
+{
+   char sequence[8];
+   uint32_t length_u32 = 0u;
+   while ((length_u32 < (sizeof(sequence) - 1u)) && (HW_TermWaitChar(10u) != 0))
+   {
+      sequence[length_u32++] = (char)HW_TermReadChar();
+      if ((sequence[length_u32 - 1u] == '~')
+         || ((length_u32 == 2u) && (sequence[0] == 'O'))
+         || ((length_u32 == 3u) && (sequence[1] == '[')))
+      {
+         break;
+      }
+   }
+   sequence[length_u32] = '\0';
+
+   if ((length_u32 == 2u) && (sequence[0] == 'O') && (sequence[1] >= 'P') && (sequence[1] <= 'S'))
+   {  /* xterm F1 .. F4: ESC O P .. ESC O S */
+      return 59 + (sequence[1] - 'P');
+   }
+   if ((length_u32 == 3u) && (sequence[0] == '[') && (sequence[1] == '[') && (sequence[2] >= 'A') && (sequence[2] <= 'E'))
+   {  /* linux console F1 .. F5: ESC [ [ A .. ESC [ [ E */
+      return 59 + (sequence[2] - 'A');
+   }
+   if ((length_u32 == 4u) && (sequence[0] == '[') && (sequence[3] == '~'))
+   {  /* F1 .. F8: ESC [ 11~ .. ESC [ 19~ (no 16) */
+      static const char* const keys[] = { "11", "12", "13", "14", "15", "17", "18", "19" };
+      for (uint8_t i_u8 = 0u; i_u8 < 8u; i_u8++)
+      {
+         if ((sequence[1] == keys[i_u8][0]) && (sequence[2] == keys[i_u8][1]))
+         {
+            return 59 + i_u8;
+         }
+      }
+   }
+   return 27;  /* escape */
+}
+#endif // def linux
+
 /* ************************************************************************ */
 
 void hw_Init(void)
@@ -114,10 +215,18 @@ void hw_Init(void)
       printf("Unable to install console handler!\n");
    }
 #endif //def _WIN32
+#ifdef linux
+   signal(SIGINT, HW_SignalHandler);
+   signal(SIGTERM, HW_SignalHandler);
+#endif // def linux
 }
 
 void hw_Shutdown(void)
 {
+   AppLog_Stop();
+#ifdef linux
+   HW_TermRestore();
+#endif // def linux
 #ifdef _WIN32
    if (pCANDriver)
    {
@@ -130,45 +239,43 @@ void hw_Shutdown(void)
 
 uint8_t hw_PowerSwitchIsOn(void)
 {
+#ifdef linux
+   return (m_PowerOff == 0) ? 1u : 0u;
+#else // def linux
    return 1u;
+#endif // def linux
 }
 
 void hw_DebugPrint(const char_t format[], ...)
 {
    va_list args;
    va_start(args, format);
-   vprintf(format, args);
+   hw_vDebugPrint(format, args);
    va_end(args);
 }
 
 void hw_vDebugPrint(const char_t format[], va_list args)
 {
-   vprintf(format, args);
+   if (AppLog_VWrite(APP_LOG_CH_PRINT, format, args) == 0u)
+   {
+      vprintf(format, args);
+   }
 }
 
 void hw_DebugTrace(const char_t format[], ...)
 {
-#ifndef _WIN32
-   va_list args;
-   va_start(args, format);
-   vprintf(format, args);
-   va_end(args);
-#else
-   char strOut[500];
    va_list args;
    va_start(args, format);
-#pragma warning(push)
-#pragma warning(disable: 4996) // Deprecation
-   vsprintf(strOut, format, args);
-#pragma warning(pop)
+   hw_vDebugTrace(format, args);
    va_end(args);
-   OutputDebugStringA(strOut);
-
-#endif
 }
 
 void hw_vDebugTrace(const char_t format[], va_list args)
 {
+   if (AppLog_VWrite(APP_LOG_CH_TRACE, format, args) != 0u)
+   {
+      return;
+   }
 #ifndef _WIN32
    vprintf(format, args);
 #else
@@ -181,6 +288,18 @@ void hw_vDebugTrace(const char_t format[], va_list args)
 #endif
 }
 
+void hw_DebugSetDeferred(uint8_t deferred_u8)
+{
+   if (deferred_u8 != 0u)
+   {
+      AppLog_Start();
+   }
+   else
+   {
+      AppLog_Stop();
+   }
+}
+
 void hw_LogError(const char_t format[], ...)
 {
    va_list args;
@@ -208,6 +327,21 @@ int32_t hw_GetTimeMs(void)
 #endif //def _WIN32
 }
 
+uint64_t hw_GetTimeUs(void)
+{
+#ifdef _WIN32
+   LARGE_INTEGER counter, frequency;
+   QueryPerformanceCounter(&counter);
+   QueryPerformanceFrequency(&frequency);
+   return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000uLL
+                   + (((counter.QuadPart % frequency.QuadPart) * 1000000uLL) / frequency.QuadPart));
+#else //_WIN32
+   struct timespec tv;
+   clock_gettime(CLOCK_MONOTONIC, &tv);
+   return ((uint64_t)tv.tv_sec * 1000000uLL) + ((uint64_t)tv.tv_nsec / 1000uLL);
+#endif //def _WIN32
+}
+
 
 /* ################### CAN Functions ################ */
 
@@ -288,6 +422,11 @@ int16_t hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canD
    return ret_16;
 }
 
+void hw_CanFlushSendMsgs(uint8_t canNode_u8)
+{  /* sendMessage() passes the message to the driver */
+   (void)canNode_u8;
+}
+
 int16_t hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_pau8[], uint8_t *canDataLength_pu8)
 {
    CANMsg_t can_msg_read;
@@ -316,11 +455,36 @@ int16_t hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_
    return 0;
 }
 
+int16_t hw_CanReadMsgs(uint8_t canNode_u8, hw_CanMsg_t canMsgs_as[], int16_t maxMsgs_s16)
+{
+   int16_t count_s16 = 0;
+   while ((count_s16 < maxMsgs_s16)
+      && (hw_CanReadMsg(canNode_u8, &canMsgs_as[count_s16].canId_u32, canMsgs_as[count_s16].canData_au8, &canMsgs_as[count_s16].canDataLength_u8) > 0))
+   {
+      count_s16++;
+   }
+   return count_s16;
+}
+
+int16_t hw_CanGetRxStatus(uint8_t canNode_u8, hw_CanRxStatus_t* rxStatus_ps)
+{  /* the queue state is not provided by the driver */
+   (void)canNode_u8;
+   (void)rxStatus_ps;
+   return -1;
+}
+
 int16_t  hw_CanGetFreeSendMsgBufferSize(uint8_t canNode_u8)
-{  /* we return always 20 free buffer entries.... */
+{  /* the queue state is not provided by the driver; we return always 20 free buffer entries.... */
+   (void)canNode_u8;
    return 20;
 }
 
+int16_t hw_CanWaitRx(uint32_t timeoutMs_u32)
+{  /* the driver has no receive event: the caller sleeps */
+   (void)timeoutMs_u32;
+   return -1;
+}
+
 static void HW_CanMsgPrint(uint8_t canNode_u8, CANMsg_t* can_msg_ps, uint8_t isRX)
 {
    const char_t *pcMsgTxt;
@@ -328,6 +492,11 @@ static void HW_CanMsgPrint(uint8_t canNode_u8, CANMsg_t* can_msg_ps, uint8_t isR
    /* printf hw_DebugPrint hw_DebugTrace */
    #define CAN_PRINT hw_DebugTrace
 
+   if (!APP_LOG_ENABLED(APP_LOG_MOD_CAN, APP_LOG_LEVEL_TRACE))
+   {  /* removed by the compiler below APP_LOG_LEVEL_TRACE; run time: Log.CAN=5 */
+      return;
+   }
+
    pcRxTx = (isRX > 0u) ? "Rx" : "Tx";
    CAN_PRINT("%2u %12d %2s %8x %1u ", canNode_u8, can_msg_ps->TimeStamp, pcRxTx, can_msg_ps->ID, can_msg_ps->DLC);
 
@@ -403,6 +572,9 @@ int_t hw_SimGetKbHit(void)
 {
 #ifdef _WIN32
    return _kbhit();
+#elif defined(linux)
+   HW_TermSetRaw();
+   return (m_TermRaw_u8 != 0u) ? HW_TermWaitChar(0u) : 0;
 #else // _WIN32
     return 0;
 #endif //_WIN32
@@ -419,6 +591,17 @@ int_t hw_SimGetCharEx(uint8_t noEcho)
       ch = (noEcho == 1u) ? _getch() : _getche();
    }
    return ch;
+#elif defined(linux)
+   int_t ch = HW_TermReadChar();
+   if (ch == 27)
+   {  // function key
+      ch = HW_TermReadFunctionKey();
+   }
+   else if (noEcho != 1u)
+   {
+      putchar(ch);
+   }
+   return ch;
 #else // _WIN32
     return 0;
 #endif // def _WIN32
@@ -49,6 +49,21 @@ typedef char* va_list;
 typedef char char_t;
 typedef int  int_t;
 
+/* received CAN message (hw_CanReadMsgs()) */
+typedef struct
+{
+   uint32_t canId_u32;
+   uint8_t  canData_au8[8];
+   uint8_t  canDataLength_u8;
+} hw_CanMsg_t;
+
+/* receive queue of a CAN node (hw_CanGetRxStatus()) */
+typedef struct
+{
+   uint32_t pending_u32;   /* messages waiting in the receive queue */
+   uint32_t dropped_u32;   /* messages lost by receive queue overflows since hw_CanInit() */
+} hw_CanRxStatus_t;
+
 /* ************************************************************************ */
 #ifdef __cplusplus
 extern "C" {
@@ -66,15 +81,21 @@ extern "C" {
 
    void     hw_vDebugPrint(const char_t format[], va_list args); 
    void     hw_vDebugTrace(const char_t format[], va_list args); 
+   void     hw_DebugSetDeferred(uint8_t deferred_u8);   /* 1: formatted and printed by a low-priority task (AppLog.h) */
 
    int32_t  hw_GetTimeMs(void);
+   uint64_t hw_GetTimeUs(void);      /* monotonic time for measurements */
 
 #if !defined(CCI_CAN_API)   // the declaration is not required if CAN is out sourced into a DLL
    void     hw_CanInit(uint8_t maxCanNodes_u8);
    void     hw_CanClose(void);
    int16_t  hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canData_au8[], uint8_t canDataLength_u8);
+   void     hw_CanFlushSendMsgs(uint8_t canNode_u8);   /* sends the frames queued by hw_CanSendMsg() (batching drivers) */
    int16_t  hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_pau8[], uint8_t *canDataLength_pu8);
+   int16_t  hw_CanReadMsgs(uint8_t canNode_u8, hw_CanMsg_t canMsgs_as[], int16_t maxMsgs_s16);  /* returns the number of messages; never waits */
+   int16_t  hw_CanGetRxStatus(uint8_t canNode_u8, hw_CanRxStatus_t* rxStatus_ps);               /* 0: ok, < 0: not supported */
    int16_t  hw_CanGetFreeSendMsgBufferSize(uint8_t canNode_u8);
+   int16_t  hw_CanWaitRx(uint32_t timeoutMs_u32);  /* waits for a message on any node; 1: received, 0: timeout, < 0: not supported */
 #endif // !defined(CCI_CAN_API) 
 
    void     hw_SimDoSleep(uint32_t milliseconds);
@@ -0,0 +1,765 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Deferred debug output: binary log ring and writer task
+
+   \details    Record in the ring (32 bit words):
+               - header: bit 31 committed, bits 16 .. 23 type, bits 0 .. 15 length in words
+               - time of AppLog_VWrite() (hw_GetTimeUs(), low 32 bits)
+               - pointer to the format string (two words)
+               - arguments in the order of the format: 64 bit values; strings as length
+                 word followed by the characters
+               Producers reserve space with compare and swap on m_LogHead and set the
+               committed bit last; the writer formats the records in order, clears them
+               and advances m_LogTail. A full ring drops the new record.
+*/
+/* ************************************************************************ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include "AppLog.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else  // ESP_PLATFORM
+#include <chrono>
+#include <thread>
+#endif // ESP_PLATFORM
+
+#ifdef linux
+#include <pthread.h>
+#include <sched.h>
+#endif // linux
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif // _WIN32
+
+#if defined(_MSC_VER )
+#pragma warning(disable : 4996)
+#endif // defined(_MSC_VER )
+
+/* ************************************************************************ */
+
+#define LOG_RING_WORDS        4096u    /* 16 kbyte, power of two */
+#define LOG_RECORD_WORDS      96u      /* max. record: longer strings are truncated */
+#define LOG_HEADER_WORDS      4u       /* header, time, format pointer */
+#define LOG_TEXT_SIZE         512u     /* formatted record */
+#define LOG_WRITER_PERIOD_MS  10u
+
+#define LOG_COMMITTED         0x80000000uL
+#define LOG_TYPE_TEXT         0x10u    /* formatted by AppLog_VWrite() (flag) */
+#define LOG_TYPE_PAD          0xFFu    /* unused words up to the end of the ring */
+
+#ifdef ESP_PLATFORM
+   #define LOG_TASK_STACK     4096
+   #if (portNUM_PROCESSORS > 1)
+      #define LOG_TASK_PRIO   (tskIDLE_PRIORITY + 1)
+      #define LOG_TASK_CORE   1        /* app_main() runs on core 0 */
+   #else
+      #define LOG_TASK_PRIO   tskIDLE_PRIORITY   /* below app_main() */
+      #define LOG_TASK_CORE   0
+   #endif
+#endif // ESP_PLATFORM
+
+/* Argument of a conversion specification */
+typedef enum
+{
+   LOG_ARG_NONE,        /* %% */
+   LOG_ARG_INT,
+   LOG_ARG_UINT,
+   LOG_ARG_CHAR,
+   LOG_ARG_DOUBLE,
+   LOG_ARG_STRING,
+   LOG_ARG_POINTER
+} LogArg_e;
+
+/* Length modifier of a conversion specification */
+typedef enum
+{
+   LOG_LEN_NONE,
+   LOG_LEN_HH,
+   LOG_LEN_H,
+   LOG_LEN_L,
+   LOG_LEN_LL,
+   LOG_LEN_J,
+   LOG_LEN_Z,
+   LOG_LEN_T,
+   LOG_LEN_LD
+} LogLen_e;
+
+/* Parsed conversion specification "%[flags][width][.precision][length]conversion" */
+typedef struct
+{
+   char_t   flags_ac[8];
+   int32_t  width_s32;        /* -1: none */
+   int32_t  precision_s32;    /* -1: none */
+   bool     widthStar;
+   bool     precisionStar;
+   LogLen_e eLength;
+   LogArg_e eArg;
+   char_t   conversion_c;
+} LogSpec_t;
+
+static std::atomic<uint32_t> m_LogRing[LOG_RING_WORDS];
+static std::atomic<uint32_t> m_LogHead(0u);          /* reserved by the producers */
+static std::atomic<uint32_t> m_LogTail(0u);          /* released by the writer */
+static std::atomic<bool>     m_LogRun(false);
+static std::atomic<uint32_t> m_LogWritten(0u);
+static std::atomic<uint32_t> m_LogDropped(0u);
+static std::atomic<uint32_t> m_LogFormatted(0u);
+static std::atomic<uint32_t> m_LogMaxDelayUs(0u);
+static uint32_t              m_LogDroppedReported = 0u;
+static volatile uint8_t      m_LogLevels_au8[APP_LOG_MODULES] =
+{
+   APP_LOG_LEVEL_INFO, APP_LOG_LEVEL_INFO, APP_LOG_LEVEL_INFO, APP_LOG_LEVEL_INFO, APP_LOG_LEVEL_INFO
+};
+static const char_t* const   m_LogModuleNames[APP_LOG_MODULES] =
+{
+   "VTC", "Pool", "CAN", "NM", "Settings"
+};
+#ifdef ESP_PLATFORM
+static TaskHandle_t          m_LogTask = NULL;
+#else  // ESP_PLATFORM
+static std::thread           m_LogThread;
+#endif // ESP_PLATFORM
+
+/* ************************************************************************ */
+
+static const char_t* Log_ParseSpec(const char_t* format_pc, LogSpec_t* spec_ps);
+static uint32_t Log_Flush(uint32_t maxRecords_u32);
+#ifdef ESP_PLATFORM
+static void Log_Task(void* param_pv);
+#else  // ESP_PLATFORM
+static void Log_Thread(void);
+#endif // ESP_PLATFORM
+
+/* ************************************************************************ */
+
+void AppLog_Start(void)
+{
+   if (m_LogRun.load(std::memory_order_acquire))
+   {
+      return;
+   }
+
+   m_LogRun.store(true, std::memory_order_release);
+#ifdef ESP_PLATFORM
+   if (xTaskCreatePinnedToCore(Log_Task, "log", LOG_TASK_STACK, NULL, LOG_TASK_PRIO, &m_LogTask, LOG_TASK_CORE) != pdPASS)
+   {
+      m_LogTask = NULL;
+      m_LogRun.store(false, std::memory_order_release);
+      printf("Log task not created: direct output \n");
+   }
+#else  // ESP_PLATFORM
+   m_LogThread = std::thread(Log_Thread);
+#ifdef linux
+   {  /* runs only if no other thread of the process wants the CPU */
+      struct sched_param param;
+      memset(&param, 0, sizeof(param));
+      (void)pthread_setschedparam(m_LogThread.native_handle(), SCHED_IDLE, &param);
+   }
+#endif // linux
+#endif // ESP_PLATFORM
+}
+
+void AppLog_Stop(void)
+{
+   AppLogStats_t stats;
+
+   if (!m_LogRun.load(std::memory_order_acquire))
+   {
+      return;
+   }
+
+   m_LogRun.store(false, std::memory_order_release);
+#ifdef ESP_PLATFORM
+   while (m_LogTask != NULL)
+   {  /* the task ends after its current delay */
+      vTaskDelay(1);
+   }
+#else  // ESP_PLATFORM
+   m_LogThread.join();
+#endif // ESP_PLATFORM
+
+   (void)Log_Flush(UINT32_MAX);
+   AppLog_GetStats(&stats);
+   printf("Log: %u records, %u dropped, %u formatted at once, max. delay %u us \n",
+      stats.written_u32, stats.dropped_u32, stats.formatted_u32, stats.maxDelayUs_u32);
+}
+
+void AppLog_GetStats(AppLogStats_t* stats_ps)
+{
+   stats_ps->written_u32 = m_LogWritten.load(std::memory_order_relaxed);
+   stats_ps->dropped_u32 = m_LogDropped.load(std::memory_order_relaxed);
+   stats_ps->formatted_u32 = m_LogFormatted.load(std::memory_order_relaxed);
+   stats_ps->maxDelayUs_u32 = m_LogMaxDelayUs.load(std::memory_order_relaxed);
+}
+
+void AppLog_SetLevel(AppLogModule_e eModule, uint8_t level_u8)
+{
+   if ((uint32_t)eModule < APP_LOG_MODULES)
+   {
+      m_LogLevels_au8[eModule] = level_u8;
+   }
+}
+
+uint8_t AppLog_IsEnabled(AppLogModule_e eModule, uint8_t level_u8)
+{
+   return (((uint32_t)eModule < APP_LOG_MODULES) && (level_u8 <= m_LogLevels_au8[eModule])) ? 1u : 0u;
+}
+
+const char_t* AppLog_GetModuleName(AppLogModule_e eModule)
+{
+   return ((uint32_t)eModule < APP_LOG_MODULES) ? m_LogModuleNames[eModule] : NULL;
+}
+
+/* ************************************************************************ */
+
+#ifdef ESP_PLATFORM
+/* Prints the records every LOG_WRITER_PERIOD_MS until AppLog_Stop() */
+static void Log_Task(void* param_pv)
+{
+   (void)param_pv;
+   while (m_LogRun.load(std::memory_order_acquire))
+   {
+      (void)Log_Flush(UINT32_MAX);
+      vTaskDelay(pdMS_TO_TICKS(LOG_WRITER_PERIOD_MS));
+   }
+
+   m_LogTask = NULL;
+   vTaskDelete(NULL);
+}
+#else  // ESP_PLATFORM
+/* Prints the records every LOG_WRITER_PERIOD_MS until AppLog_Stop() */
+static void Log_Thread(void)
+{
+   while (m_LogRun.load(std::memory_order_acquire))
+   {
+      (void)Log_Flush(UINT32_MAX);
+      std::this_thread::sleep_for(std::chrono::milliseconds(LOG_WRITER_PERIOD_MS));
+   }
+}
+#endif // ESP_PLATFORM
+
+/* ************************************************************************ */
+
+/* Appends a 64 bit value; false: record full */
+static bool Log_Put(uint32_t record_au32[], uint32_t* words_pu32, uint64_t value_u64)
+{
+   if ((*words_pu32 + 2u) > LOG_RECORD_WORDS)
+   {
+      return false;
+   }
+   record_au32[(*words_pu32)++] = (uint32_t)value_u64;
+   record_au32[(*words_pu32)++] = (uint32_t)(value_u64 >> 32u);
+   return true;
+}
+
+/* Appends at most maxLength_u32 characters of the string; truncated to the free space of the record */
+static bool Log_PutString(uint32_t record_au32[], uint32_t* words_pu32, const char_t string_ac[], uint32_t maxLength_u32)
+{
+   uint32_t length_u32 = 0u;
+   uint32_t free_u32;
+
+   if ((*words_pu32 + 1u) > LOG_RECORD_WORDS)
+   {
+      return false;
+   }
+
+   free_u32 = (LOG_RECORD_WORDS - *words_pu32 - 1u) * 4u;
+   maxLength_u32 = (maxLength_u32 < free_u32) ? maxLength_u32 : free_u32;
+   while ((length_u32 < maxLength_u32) && (string_ac[length_u32] != '\0'))
+   {
+      length_u32++;
+   }
+
+   record_au32[*words_pu32] = length_u32;
+   memcpy(&record_au32[*words_pu32 + 1u], string_ac, length_u32);
+   *words_pu32 += 1u + ((length_u32 + 3u) / 4u);
+   return true;
+}
+
+/* Stores the arguments of the format; false: conversion not supported or record full */
+static bool Log_Capture(const char_t format[], va_list args, uint32_t record_au32[], uint32_t* words_pu32)
+{
+   const char_t* format_pc = format;
+   bool qOk = true;
+
+   while (qOk && (*format_pc != '\0'))
+   {
+      LogSpec_t spec;
+      if (*format_pc++ != '%')
+      {
+         continue;
+      }
+
+      format_pc = Log_ParseSpec(format_pc, &spec);
+      if (format_pc == NULL)
+      {
+         return false;
+      }
+
+      if (spec.widthStar)
+      {
+         qOk = Log_Put(record_au32, words_pu32, (uint64_t)(int64_t)va_arg(args, int));
+      }
+      if (qOk && spec.precisionStar)
+      {
+         spec.precision_s32 = va_arg(args, int);
+         qOk = Log_Put(record_au32, words_pu32, (uint64_t)(int64_t)spec.precision_s32);
+      }
+      if (!qOk)
+      {
+         break;
+      }
+
+      switch (spec.eArg)
+      {
+      case LOG_ARG_INT:
+      {
+         int64_t value_s64;
+         switch (spec.eLength)
+         {
+         case LOG_LEN_HH: value_s64 = (signed char)va_arg(args, int);    break;
+         case LOG_LEN_H:  value_s64 = (short)va_arg(args, int);          break;
+         case LOG_LEN_L:  value_s64 = va_arg(args, long);                break;
+         case LOG_LEN_LL: value_s64 = va_arg(args, long long);           break;
+         case LOG_LEN_J:  value_s64 = va_arg(args, intmax_t);            break;
+         case LOG_LEN_Z:  value_s64 = (int64_t)va_arg(args, size_t);     break;
+         case LOG_LEN_T:  value_s64 = va_arg(args, ptrdiff_t);           break;
+         default:         value_s64 = va_arg(args, int);                 break;
+         }
+         qOk = Log_Put(record_au32, words_pu32, (uint64_t)value_s64);
+         break;
+      }
+      case LOG_ARG_UINT:
+      {
+         uint64_t value_u64;
+         switch (spec.eLength)
+         {
+         case LOG_LEN_HH: value_u64 = (unsigned char)va_arg(args, unsigned int);  break;
+         case LOG_LEN_H:  value_u64 = (unsigned short)va_arg(args, unsigned int); break;
+         case LOG_LEN_L:  value_u64 = va_arg(args, unsigned long);                break;
+         case LOG_LEN_LL: value_u64 = va_arg(args, unsigned long long);           break;
+         case LOG_LEN_J:  value_u64 = va_arg(args, uintmax_t);                    break;
+         case LOG_LEN_Z:  value_u64 = va_arg(args, size_t);                       break;
+         case LOG_LEN_T:  value_u64 = (uint64_t)va_arg(args, ptrdiff_t);          break;
+         default:         value_u64 = va_arg(args, unsigned int);                 break;
+         }
+         qOk = Log_Put(record_au32, words_pu32, value_u64);
+         break;
+      }
+      case LOG_ARG_CHAR:
+         qOk = Log_Put(record_au32, words_pu32, (uint64_t)(int64_t)va_arg(args, int));
+         break;
+      case LOG_ARG_DOUBLE:
+      {
+         double value_d = (spec.eLength == LOG_LEN_LD) ? (double)va_arg(args, long double) : va_arg(args, double);
+         uint64_t bits_u64;
+         memcpy(&bits_u64, &value_d, sizeof(bits_u64));
+         qOk = Log_Put(record_au32, words_pu32, bits_u64);
+         break;
+      }
+      case LOG_ARG_STRING:
+      {  /* the string may be a temporary buffer: copy it; "%.7s" may have no terminating zero */
+         const char_t* string_pc = va_arg(args, const char_t*);
+         qOk = Log_PutString(record_au32, words_pu32, (string_pc != NULL) ? string_pc : "(null)",
+            (spec.precision_s32 >= 0) ? (uint32_t)spec.precision_s32 : UINT32_MAX);
+         break;
+      }
+      case LOG_ARG_POINTER:
+         qOk = Log_Put(record_au32, words_pu32, (uint64_t)(uintptr_t)va_arg(args, void*));
+         break;
+      default:
+         break;
+      }
+   }
+
+   return qOk;
+}
+
+/* Copies the record into the ring */
+static void Log_Commit(const uint32_t record_au32[], uint32_t words_u32, uint32_t type_u32)
+{
+   uint32_t head_u32 = m_LogHead.load(std::memory_order_relaxed);
+   uint32_t index_u32;
+   uint32_t pad_u32;
+   uint32_t i_u32;
+
+   do
+   {  /* a record does not wrap: the words up to the end of the ring are skipped */
+      uint32_t tail_u32 = m_LogTail.load(std::memory_order_acquire);
+      index_u32 = head_u32 & (LOG_RING_WORDS - 1u);
+      pad_u32 = ((LOG_RING_WORDS - index_u32) < words_u32) ? (LOG_RING_WORDS - index_u32) : 0u;
+      if (((head_u32 + pad_u32 + words_u32) - tail_u32) > LOG_RING_WORDS)
+      {
+         m_LogDropped.fetch_add(1u, std::memory_order_relaxed);
+         return;
+      }
+   } while (!m_LogHead.compare_exchange_weak(head_u32, head_u32 + pad_u32 + words_u32,
+                                             std::memory_order_acq_rel, std::memory_order_relaxed));
+
+   if (pad_u32 > 0u)
+   {
+      m_LogRing[index_u32].store(LOG_COMMITTED | (LOG_TYPE_PAD << 16u) | pad_u32, std::memory_order_release);
+      index_u32 = 0u;
+   }
+   for (i_u32 = 1u; i_u32 < words_u32; i_u32++)
+   {
+      m_LogRing[index_u32 + i_u32].store(record_au32[i_u32], std::memory_order_relaxed);
+   }
+   m_LogRing[index_u32].store(LOG_COMMITTED | (type_u32 << 16u) | words_u32, std::memory_order_release);
+   m_LogWritten.fetch_add(1u, std::memory_order_relaxed);
+}
+
+uint8_t AppLog_VWrite(uint8_t channel_u8, const char_t format[], va_list args)
+{
+   uint32_t record_au32[LOG_RECORD_WORDS];
+   uint32_t words_u32 = LOG_HEADER_WORDS;
+   uint32_t type_u32 = channel_u8;
+   bool     qCaptured;
+   va_list  argsCopy;
+
+   if (!m_LogRun.load(std::memory_order_acquire))
+   {
+      return 0u;
+   }
+
+   va_copy(argsCopy, args);
+   qCaptured = Log_Capture(format, argsCopy, record_au32, &words_u32);
+   va_end(argsCopy);
+
+   record_au32[1] = (uint32_t)hw_GetTimeUs();
+   if (qCaptured)
+   {
+      record_au32[2] = (uint32_t)(uintptr_t)format;
+      record_au32[3] = (uint32_t)((uint64_t)(uintptr_t)format >> 32u);
+   }
+   else
+   {  /* e.g. %n or a string beyond the record size: store the text */
+      char_t* text_pc = (char_t*)&record_au32[LOG_HEADER_WORDS + 1u];
+      int_t length_i;
+      va_copy(argsCopy, args);
+      length_i = vsnprintf(text_pc, (LOG_RECORD_WORDS - LOG_HEADER_WORDS - 1u) * 4u, format, argsCopy);
+      va_end(argsCopy);
+      record_au32[2] = 0u;
+      record_au32[3] = 0u;
+      words_u32 = LOG_HEADER_WORDS;
+      (void)Log_PutString(record_au32, &words_u32, text_pc, (length_i > 0) ? (uint32_t)length_i : 0u);
+      type_u32 |= LOG_TYPE_TEXT;
+      m_LogFormatted.fetch_add(1u, std::memory_order_relaxed);
+   }
+
+   Log_Commit(record_au32, words_u32, type_u32);
+   return 1u;
+}
+
+/* ************************************************************************ */
+
+/* Parses the specification after '%'; returns the character after it or NULL if not supported */
+static const char_t* Log_ParseSpec(const char_t* format_pc, LogSpec_t* spec_ps)
+{
+   uint32_t flags_u32 = 0u;
+
+   memset(spec_ps, 0, sizeof(LogSpec_t));
+   spec_ps->width_s32 = -1;
+   spec_ps->precision_s32 = -1;
+
+   while ((*format_pc != '\0') && (strchr("-+ #0", *format_pc) != NULL))
+   {
+      if (flags_u32 < (sizeof(spec_ps->flags_ac) - 1u))
+      {
+         spec_ps->flags_ac[flags_u32++] = *format_pc;
+      }
+      format_pc++;
+   }
+
+   if (*format_pc == '*')
+   {
+      spec_ps->widthStar = true;
+      format_pc++;
+   }
+   else
+   {
+      while ((*format_pc >= '0') && (*format_pc <= '9'))
+      {
+         spec_ps->width_s32 = (((spec_ps->width_s32 > 0) ? spec_ps->width_s32 : 0) * 10) + (*format_pc++ - '0');
+      }
+   }
+
+   if (*format_pc == '.')
+   {
+      format_pc++;
+      if (*format_pc == '*')
+      {
+         spec_ps->precisionStar = true;
+         format_pc++;
+      }
+      else
+      {
+         spec_ps->precision_s32 = 0;
+         while ((*format_pc >= '0') && (*format_pc <= '9'))
+         {
+            spec_ps->precision_s32 = (spec_ps->precision_s32 * 10) + (*format_pc++ - '0');
+         }
+      }
+   }
+
+   switch (*format_pc)
+   {
+   case 'h': spec_ps->eLength = (format_pc[1] == 'h') ? LOG_LEN_HH : LOG_LEN_H; break;
+   case 'l': spec_ps->eLength = (format_pc[1] == 'l') ? LOG_LEN_LL : LOG_LEN_L; break;
+   case 'j': spec_ps->eLength = LOG_LEN_J;  break;
+   case 'z': spec_ps->eLength = LOG_LEN_Z;  break;
+   case 't': spec_ps->eLength = LOG_LEN_T;  break;
+   case 'L': spec_ps->eLength = LOG_LEN_LD; break;
+   default:  spec_ps->eLength = LOG_LEN_NONE; break;
+   }
+   format_pc += ((spec_ps->eLength == LOG_LEN_HH) || (spec_ps->eLength == LOG_LEN_LL)) ? 2
+              : (spec_ps->eLength != LOG_LEN_NONE) ? 1 : 0;
+
+   spec_ps->conversion_c = *format_pc;
+   switch (spec_ps->conversion_c)
+   {
+   case '%':
+      spec_ps->eArg = LOG_ARG_NONE;
+      break;
+   case 'd': case 'i':
+      spec_ps->eArg = LOG_ARG_INT;
+      break;
+   case 'u': case 'o': case 'x': case 'X':
+      spec_ps->eArg = LOG_ARG_UINT;
+      break;
+   case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+      spec_ps->eArg = LOG_ARG_DOUBLE;
+      break;
+   case 'p':
+      spec_ps->eArg = LOG_ARG_POINTER;
+      break;
+   case 'c':
+   case 's':  /* no wide characters */
+      if (spec_ps->eLength != LOG_LEN_NONE)
+      {
+         return NULL;
+      }
+      spec_ps->eArg = (spec_ps->conversion_c == 'c') ? LOG_ARG_CHAR : LOG_ARG_STRING;
+      break;
+   default:   /* %n, end of the format or unknown */
+      return NULL;
+   }
+
+   return format_pc + 1;
+}
+
+/* Reads a 64 bit value of the record */
+static uint64_t Log_Get(const uint32_t record_au32[], uint32_t words_u32, uint32_t* index_pu32)
+{
+   uint64_t value_u64 = 0u;
+   if ((*index_pu32 + 2u) <= words_u32)
+   {
+      value_u64 = (uint64_t)record_au32[*index_pu32] | ((uint64_t)record_au32[*index_pu32 + 1u] << 32u);
+      *index_pu32 += 2u;
+   }
+   return value_u64;
+}
+
+/* Copies a string of the record into string_ac (size LOG_TEXT_SIZE) */
+static void Log_GetString(const uint32_t record_au32[], uint32_t words_u32, uint32_t* index_pu32, char_t string_ac[])
+{
+   uint32_t length_u32 = 0u;
+   if (*index_pu32 < words_u32)
+   {
+      length_u32 = record_au32[*index_pu32];
+      length_u32 = (length_u32 < ((words_u32 - *index_pu32 - 1u) * 4u)) ? length_u32 : ((words_u32 - *index_pu32 - 1u) * 4u);
+      length_u32 = (length_u32 < (LOG_TEXT_SIZE - 1u)) ? length_u32 : (LOG_TEXT_SIZE - 1u);
+      memcpy(string_ac, &record_au32[*index_pu32 + 1u], length_u32);
+      *index_pu32 += 1u + ((length_u32 + 3u) / 4u);
+   }
+   string_ac[length_u32] = '\0';
+}
+
+/* Formats a record with the arguments stored by Log_Capture() */
+static void Log_Format(const uint32_t record_au32[], uint32_t words_u32, uint32_t type_u32, char_t text_ac[])
+{
+   const char_t* format_pc = (const char_t*)(uintptr_t)((uint64_t)record_au32[2] | ((uint64_t)record_au32[3] << 32u));
+   uint32_t index_u32 = LOG_HEADER_WORDS;
+   uint32_t length_u32 = 0u;
+
+   if ((type_u32 & LOG_TYPE_TEXT) != 0u)
+   {
+      Log_GetString(record_au32, words_u32, &index_u32, text_ac);
+      return;
+   }
+
+   while ((*format_pc != '\0') && (length_u32 < (LOG_TEXT_SIZE - 1u)))
+   {
+      LogSpec_t spec;
+      char_t    spec_ac[40];
+      int32_t   specLength_s32;
+      int_t     ret_i = 0;
+      char_t*   out_pc = &text_ac[length_u32];
+      size_t    outSize = LOG_TEXT_SIZE - length_u32;
+
+      if (*format_pc != '%')
+      {
+         text_ac[length_u32++] = *format_pc++;
+         continue;
+      }
+
+      format_pc = Log_ParseSpec(format_pc + 1, &spec);
+      if (format_pc == NULL)
+      {  /* not possible: checked by Log_Capture() */
+         break;
+      }
+
+      if (spec.widthStar)
+      {  /* negative width: left-justified */
+         spec.width_s32 = (int32_t)(int64_t)Log_Get(record_au32, words_u32, &index_u32);
+      }
+      if (spec.precisionStar)
+      {  /* negative precision: none */
+         spec.precision_s32 = (int32_t)(int64_t)Log_Get(record_au32, words_u32, &index_u32);
+      }
+
+      /* the stored values are 64 bit integers or double */
+      specLength_s32 = snprintf(spec_ac, sizeof(spec_ac), "%%%s%s", spec.flags_ac, (spec.width_s32 < 0) ? "-" : "");
+      if (spec.widthStar || (spec.width_s32 >= 0))
+      {
+         specLength_s32 += snprintf(&spec_ac[specLength_s32], sizeof(spec_ac) - (size_t)specLength_s32, "%d",
+            (spec.width_s32 < 0) ? -spec.width_s32 : spec.width_s32);
+      }
+      if (spec.precision_s32 >= 0)
+      {
+         specLength_s32 += snprintf(&spec_ac[specLength_s32], sizeof(spec_ac) - (size_t)specLength_s32, ".%d", spec.precision_s32);
+      }
+      (void)snprintf(&spec_ac[specLength_s32], sizeof(spec_ac) - (size_t)specLength_s32, "%s%c",
+         ((spec.eArg == LOG_ARG_INT) || (spec.eArg == LOG_ARG_UINT)) ? "ll" : "", spec.conversion_c);
+
+      switch (spec.eArg)
+      {
+      case LOG_ARG_NONE:
+         ret_i = snprintf(out_pc, outSize, "%%");
+         break;
+      case LOG_ARG_INT:
+         ret_i = snprintf(out_pc, outSize, spec_ac, (long long)(int64_t)Log_Get(record_au32, words_u32, &index_u32));
+         break;
+      case LOG_ARG_UINT:
+         ret_i = snprintf(out_pc, outSize, spec_ac, (unsigned long long)Log_Get(record_au32, words_u32, &index_u32));
+         break;
+      case LOG_ARG_CHAR:
+         ret_i = snprintf(out_pc, outSize, spec_ac, (int)(int64_t)Log_Get(record_au32, words_u32, &index_u32));
+         break;
+      case LOG_ARG_DOUBLE:
+      {
+         uint64_t bits_u64 = Log_Get(record_au32, words_u32, &index_u32);
+         double value_d;
+         memcpy(&value_d, &bits_u64, sizeof(value_d));
+         ret_i = snprintf(out_pc, outSize, spec_ac, value_d);
+         break;
+      }
+      case LOG_ARG_STRING:
+      {
+         char_t string_ac[LOG_TEXT_SIZE];
+         Log_GetString(record_au32, words_u32, &index_u32, string_ac);
+         ret_i = snprintf(out_pc, outSize, spec_ac, string_ac);
+         break;
+      }
+      case LOG_ARG_POINTER:
+         ret_i = snprintf(out_pc, outSize, spec_ac, (void*)(uintptr_t)Log_Get(record_au32, words_u32, &index_u32));
+         break;
+      default:
+         break;
+      }
+
+      if (ret_i > 0)
+      {
+         length_u32 += ((uint32_t)ret_i < (outSize - 1u)) ? (uint32_t)ret_i : (uint32_t)(outSize - 1u);
+      }
+   }
+
+   text_ac[length_u32] = '\0';
+}
+
+/* Prints the committed records in order; only one caller at a time (writer task or AppLog_Stop()) */
+static uint32_t Log_Flush(uint32_t maxRecords_u32)
+{
+   uint32_t record_au32[LOG_RECORD_WORDS];
+   char_t   text_ac[LOG_TEXT_SIZE];
+   uint32_t count_u32 = 0u;
+   uint32_t dropped_u32;
+
+   while (count_u32 < maxRecords_u32)
+   {
+      uint32_t tail_u32 = m_LogTail.load(std::memory_order_relaxed);
+      uint32_t index_u32 = tail_u32 & (LOG_RING_WORDS - 1u);
+      uint32_t header_u32;
+      uint32_t words_u32;
+      uint32_t type_u32;
+      uint32_t i_u32;
+
+      if (tail_u32 == m_LogHead.load(std::memory_order_acquire))
+      {
+         break;
+      }
+      header_u32 = m_LogRing[index_u32].load(std::memory_order_acquire);
+      if ((header_u32 & LOG_COMMITTED) == 0u)
+      {  /* reserved, but still being written */
+         break;
+      }
+
+      words_u32 = header_u32 & 0xFFFFu;
+      type_u32 = (header_u32 >> 16u) & 0xFFu;
+      if (type_u32 != LOG_TYPE_PAD)
+      {
+         uint32_t delayUs_u32;
+         for (i_u32 = 1u; i_u32 < words_u32; i_u32++)
+         {
+            record_au32[i_u32] = m_LogRing[index_u32 + i_u32].load(std::memory_order_relaxed);
+         }
+
+         Log_Format(record_au32, words_u32, type_u32, text_ac);
+#ifdef _WIN32
+         if ((type_u32 & ~LOG_TYPE_TEXT) == APP_LOG_CH_TRACE)
+         {
+            OutputDebugStringA(text_ac);
+         }
+         else
+#endif // _WIN32
+         {
+            (void)fputs(text_ac, stdout);
+         }
+
+         delayUs_u32 = (uint32_t)hw_GetTimeUs() - record_au32[1];
+         if (delayUs_u32 > m_LogMaxDelayUs.load(std::memory_order_relaxed))
+         {
+            m_LogMaxDelayUs.store(delayUs_u32, std::memory_order_relaxed);
+         }
+         count_u32++;
+      }
+
+      /* free words are zero: a producer may not have written its header yet */
+      for (i_u32 = 0u; i_u32 < words_u32; i_u32++)
+      {
+         m_LogRing[index_u32 + i_u32].store(0u, std::memory_order_relaxed);
+      }
+      m_LogTail.store(tail_u32 + words_u32, std::memory_order_release);
+   }
+
+   dropped_u32 = m_LogDropped.load(std::memory_order_relaxed);
+   if (dropped_u32 != m_LogDroppedReported)
+   {
+      printf("Log: %u records dropped (ring full) \n", dropped_u32 - m_LogDroppedReported);
+      m_LogDroppedReported = dropped_u32;
+   }
+   if (count_u32 > 0u)
+   {
+      (void)fflush(stdout);
+   }
+   return count_u32;
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,117 @@
+/* ************************************************************************ */
+/*! \file
+   \brief      Debug output: log levels per module, binary log ring and writer task
+
+   \details    APP_LOG_ERROR() .. APP_LOG_TRACE() print if the level is enabled at compile
+               time (APP_LOG_LEVEL) and for the module at run time (AppLog_SetLevel()).
+               Calls above APP_LOG_LEVEL are removed by the compiler; the arguments are
+               still checked. APP_LOG_LEVEL is a CMake cache variable of the Linux build
+               and the simulator. The run time level of each module is read from settings
+               section "Log" (VTC, Pool, CAN, NM, Settings; default 3), e.g. Log.CAN=5
+               with APP_LOG_LEVEL=5 prints each CAN message, Log.VTC=1 only the errors
+               of the VT client.
+
+               AppLog_VWrite() stores the pointer to the format string and the raw
+               arguments (strings are copied) in a lock-free ring buffer and returns
+               without formatting. A low-priority writer task (ESP32) or thread formats
+               the records with snprintf() and prints them, so that hw_DebugPrint()
+               does not stall the cyclic task on the UART or terminal.
+               Format strings must be string literals or otherwise remain valid until
+               the record has been printed.
+               The writer (ESP32: task "log" on core 1; Linux: SCHED_IDLE thread) prints
+               every 10 ms. A full ring drops records instead of blocking; hw_Shutdown()
+               prints the rest and the counters. Settings section "Log", key "Deferred":
+               0 prints at once as before. The effect on the cycle is shown by the
+               period statistics (F1, p99 and max of "period") with both settings.
+*/
+/* ************************************************************************ */
+#ifndef DEF_APP_LOG_H
+#define DEF_APP_LOG_H
+/* ************************************************************************ */
+
+#include "AppHW.h"
+
+/* ************************************************************************ */
+
+#define APP_LOG_LEVEL_OFF     0u
+#define APP_LOG_LEVEL_ERROR   1u
+#define APP_LOG_LEVEL_WARN    2u
+#define APP_LOG_LEVEL_INFO    3u
+#define APP_LOG_LEVEL_DEBUG   4u    /*!< e.g. cyclic events of the VT client */
+#define APP_LOG_LEVEL_TRACE   5u    /*!< e.g. each CAN message */
+
+#ifndef APP_LOG_LEVEL
+   #define APP_LOG_LEVEL      APP_LOG_LEVEL_INFO   /*!< highest level compiled in */
+#endif /* APP_LOG_LEVEL */
+
+/*! \brief Modules with their own run time level (settings section "Log", key: AppLog_GetModuleName()) */
+typedef enum
+{
+   APP_LOG_MOD_VTC = 0,       /*!< VT client events and messages */
+   APP_LOG_MOD_POOL,          /*!< object pool load, reload and telemetry */
+   APP_LOG_MOD_CAN,           /*!< CAN messages and transport protocol */
+   APP_LOG_MOD_NM,            /*!< network management and control function events */
+   APP_LOG_MOD_SETTINGS,      /*!< settings and stored assignments */
+   APP_LOG_MODULES
+} AppLogModule_e;
+
+#define APP_LOG_ENABLED(eModule, u8Level) \
+   (((u8Level) <= APP_LOG_LEVEL) && (AppLog_IsEnabled((eModule), (u8Level)) != 0u))
+
+#define APP_LOG_ERROR(eModule, ...) \
+   do { if (APP_LOG_ENABLED((eModule), APP_LOG_LEVEL_ERROR)) { hw_DebugPrint(__VA_ARGS__); } } while (0)
+#define APP_LOG_WARN(eModule, ...) \
+   do { if (APP_LOG_ENABLED((eModule), APP_LOG_LEVEL_WARN)) { hw_DebugPrint(__VA_ARGS__); } } while (0)
+#define APP_LOG_INFO(eModule, ...) \
+   do { if (APP_LOG_ENABLED((eModule), APP_LOG_LEVEL_INFO)) { hw_DebugPrint(__VA_ARGS__); } } while (0)
+#define APP_LOG_DEBUG(eModule, ...) \
+   do { if (APP_LOG_ENABLED((eModule), APP_LOG_LEVEL_DEBUG)) { hw_DebugPrint(__VA_ARGS__); } } while (0)
+#define APP_LOG_TRACE(eModule, ...) \
+   do { if (APP_LOG_ENABLED((eModule), APP_LOG_LEVEL_TRACE)) { hw_DebugTrace(__VA_ARGS__); } } while (0)
+
+#define APP_LOG_CH_PRINT   0u    /*!< hw_DebugPrint(), iso_DebugPrint() */
+#define APP_LOG_CH_TRACE   1u    /*!< hw_DebugTrace(), iso_DebugTrace() */
+
+/*! \brief Counters of the log ring */
+typedef struct
+{
+   uint32_t written_u32;      /*!< records stored in the ring */
+   uint32_t dropped_u32;      /*!< records lost because the ring was full */
+   uint32_t formatted_u32;    /*!< records formatted before storing (format not supported) */
+   uint32_t maxDelayUs_u32;   /*!< maximum time from AppLog_VWrite() to the output */
+} AppLogStats_t;
+
+/* ************************************************************************ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ************************************************************************ */
+
+   /*! \brief Starts the writer task; afterwards AppLog_VWrite() defers the output */
+   void     AppLog_Start(void);
+
+   /*! \brief Stops the writer task, prints the remaining records and the statistics */
+   void     AppLog_Stop(void);
+
+   /*! \brief Stores a record; 0: not started, the caller prints the message itself */
+   uint8_t  AppLog_VWrite(uint8_t channel_u8, const char_t format[], va_list args);
+
+   void     AppLog_GetStats(AppLogStats_t* stats_ps);
+
+   /*! \brief Sets the run time level of a module (APP_LOG_LEVEL_OFF .. APP_LOG_LEVEL_TRACE) */
+   void     AppLog_SetLevel(AppLogModule_e eModule, uint8_t level_u8);
+
+   /*! \brief 1: messages of the module with this level are printed (APP_LOG_ENABLED()) */
+   uint8_t  AppLog_IsEnabled(AppLogModule_e eModule, uint8_t level_u8);
+
+   /*! \brief Name of the module, e.g. "VTC"; NULL: invalid module */
+   const char_t* AppLog_GetModuleName(AppLogModule_e eModule);
+
+/* ************************************************************************ */
+#ifdef __cplusplus
+} /* end of extern "C" */
+#endif
+
+#endif /* DEF_APP_LOG_H */
+/* ************************************************************************ */
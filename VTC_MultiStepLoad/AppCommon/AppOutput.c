@@ -15,6 +15,7 @@
 #include "IsoVtcApi.h"     // only needed if _LAY6_ not defined
 
 #include "AppOutput.h"
+#include "AppLog.h"
 
 #if defined(_MSC_VER )
 #pragma warning(disable : 4996)
@@ -56,6 +57,11 @@ void OutputNetworkEvents(const ISONETEVENT_T* psNmEvent, iso_s32  s32Time)
 #ifdef ISO_DEBUG_ENABLED
    const iso_char    *pchRev, *pchEv;
 
+   if (!APP_LOG_ENABLED(APP_LOG_MOD_NM, APP_LOG_LEVEL_INFO))
+   {
+      return;
+   }
+
    switch (psNmEvent->eMemberRefer)
    {
    case intern:    pchRev = "Intern"; break;
@@ -110,6 +116,11 @@ void OutputDataLink(ISO_TPREP_E eDataTransStatus, const ISO_TPINFO_T* psTpInfo)
       const iso_char* cpchTpStatus;
       iso_s32  s32Time;
 
+      if (!APP_LOG_ENABLED(APP_LOG_MOD_CAN, APP_LOG_LEVEL_DEBUG))
+      {
+         return;
+      }
+
 #if (!defined(ISO_CORE_MUTEX)) || defined(ISO_CORE_MUTEX_RECURSIVE)
       s32Time = IsoDrvGetTimeMs();
 #else /* (!defined(ISO_CORE_MUTEX)) || defined(ISO_CORE_MUTEX_RECURSIVE) */
@@ -146,7 +157,12 @@ void OutputClientCfEvents(const ISOCFEVENT_T* psCfEvData, iso_s32 s32Time)
    const  iso_char*  pchFunc;
    const  iso_char*  pchEv;
    ISO_CF_INFO_T     sCFDat;
-   
+
+   if (!APP_LOG_ENABLED(APP_LOG_MOD_NM, APP_LOG_LEVEL_INFO))
+   {
+      return;
+   }
+
    pchFunc = NMUserFuncString(psCfEvData->eIsoUserFunct);
 
    switch (psCfEvData->eCFEvent)
@@ -185,26 +201,29 @@ void OutputVtMessages(const ISOVT_MSG_STA_T* pIsoMsgSta, iso_s32 s32Time)
    switch (pIsoMsgSta->iVtFunction)
    {
    case softkey_activation:
-      iso_DebugPrint("SOFTKEY ACTIVATION: 0x%4.4x   %5d   %10d   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->bPara, pIsoMsgSta->lValue, s32Time);
+      APP_LOG_INFO(APP_LOG_MOD_VTC, "SOFTKEY ACTIVATION: 0x%4.4x   %5d   %10d   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->bPara, pIsoMsgSta->lValue, s32Time);
       break;
    case auxiliary_assign_type_1:
-      iso_DebugPrint("AUX TYP 1 ASSIGN:   0x%4.4x   %5d   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->wPara1, s32Time);
+      APP_LOG_INFO(APP_LOG_MOD_VTC, "AUX TYP 1 ASSIGN:   0x%4.4x   %5d   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->wPara1, s32Time);
       break;
    case auxiliary_assign_type_2:
    {
       iso_u8 u8I;
-      iso_DebugPrint("AUX TYP 2 ASSIGN:   0x%4.4x   %5d   Time: %8.4d Aux Unit: ", pIsoMsgSta->wObjectID, pIsoMsgSta->wPara1, s32Time);
-      for (u8I = 0u; u8I < 8u; u8I++) {
-         iso_DebugPrint("%2.2X", pIsoMsgSta->pabVtData[u8I]);
+      if (APP_LOG_ENABLED(APP_LOG_MOD_VTC, APP_LOG_LEVEL_INFO))
+      {
+         iso_DebugPrint("AUX TYP 2 ASSIGN:   0x%4.4x   %5d   Time: %8.4d Aux Unit: ", pIsoMsgSta->wObjectID, pIsoMsgSta->wPara1, s32Time);
+         for (u8I = 0u; u8I < 8u; u8I++) {
+            iso_DebugPrint("%2.2X", pIsoMsgSta->pabVtData[u8I]);
+         }
+         iso_DebugPrint("\n");
       }
-      iso_DebugPrint("\n");
    }
    break;
    case aux_input_status_type_1:
-      iso_DebugPrint("AUX TYP 1 INPUT/FKT: 0x%4.4x   %10d   %s   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->lValue, pchStatus, s32Time);
+      APP_LOG_DEBUG(APP_LOG_MOD_VTC, "AUX TYP 1 INPUT/FKT: 0x%4.4x   %10d   %s   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->lValue, pchStatus, s32Time);
       break;
    case auxiliary_input_status_type_2:
-      iso_DebugPrint("AUX TYP 2 INPUT/FKT: 0x%4.4x   %10d   %s   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->lValue, pchStatus, s32Time);
+      APP_LOG_DEBUG(APP_LOG_MOD_VTC, "AUX TYP 2 INPUT/FKT: 0x%4.4x   %10d   %s   Time: %8.4d\n", pIsoMsgSta->wObjectID, pIsoMsgSta->lValue, pchStatus, s32Time);
       break;
    default:
    {
@@ -212,7 +231,7 @@ void OutputVtMessages(const ISOVT_MSG_STA_T* pIsoMsgSta, iso_s32 s32Time)
       pchCmd = VTSublistTextout((iso_u8)pIsoMsgSta->iVtFunction);
       if (pIsoMsgSta->iErrorCode != E_NO_ERR)
       {
-         iso_DebugPrint("ERROR CommandResp:  %s   %10d   %s   Time: %8.4d\n", pchCmd, pIsoMsgSta->wPara1, pchStatus, s32Time);
+         APP_LOG_WARN(APP_LOG_MOD_VTC, "ERROR CommandResp:  %s   %10d   %s   Time: %8.4d\n", pchCmd, pIsoMsgSta->wPara1, pchStatus, s32Time);
       }
       else
       {
@@ -8,9 +8,13 @@
 
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
 #include <string.h>
 #include "Settings/settings.h"
 #include "AppMemAccess.h"
+#include "AppCommon/AppLog.h"
 
 #if defined(ESP_PLATFORM)
 #include <sys/param.h>
@@ -36,19 +40,7 @@ using namespace std;
 #define sprintf_s snprintf
 #endif // defined(linux) || defined(ESP_PLATFORM)
 
-#if defined(linux)
-#define USE_L_FOR_64BIT
-#elif defined(__MINGW_GCC_VERSION)
-#define USE_LL_FOR_64BIT
-#else // defined(linux), defined(__MINGW_GCC_VERSION)
-#endif // defined(linux), defined(__MINGW_GCC_VERSION)
-#if defined(ESP_PLATFORM)
-   #define USE_LL_FOR_64BIT
-#endif // def ESP_PLATFORM
-
-static bool parseAuxEntry(char* entry, VT_AUXAPP_T* auxEntry);
 static bool getKey(const VT_AUXAPP_T& auxEntry, char* key, size_t size);
-static bool getValue(const VT_AUXAPP_T& auxEntry, char* value, size_t size);
 
 /* ****************   Object pool access   *********************************** */
 
@@ -248,95 +240,183 @@ int IsoAuxWriteAssignToFile(VT_AUXAPP_T asAuxAss[], iso_s16 iNumberOfAssigns)
 }
 
 
-int getAuxAssignment(const char auxSection[], VT_AUXAPP_T asAuxAss[])
+/* Stored aux assignment: one binary record per auxiliary function (key: wObjID_Fun),
+   little endian, CRC-32 over the bytes before the CRC. Records with another version
+   or a wrong CRC (e.g. the former text records) are ignored. setBlob() writes an NVS
+   blob on the ESP32 and hexadecimal text in settings.ini; getSectionEntries() passes
+   both as text. setAuxAssignment() writes only removed and changed functions.
+   Checked by tools/HostTests/AuxAssignmentTests. */
+#define AUX_RECORD_VERSION    1u
+#define AUX_RECORD_CRC_POS    20u
+#define AUX_RECORD_SIZE       24u
+
+static void putU16(iso_u8* record, iso_u16 value)
+{
+   record[0] = static_cast<iso_u8>(value);
+   record[1] = static_cast<iso_u8>(value >> 8);
+}
+
+static iso_u16 readU16(const iso_u8* record)
+{
+   return static_cast<iso_u16>(record[0] | (record[1] << 8));
+}
+
+/* CRC-32 (IEEE 802.3, reflected) */
+static iso_u32 auxRecordCrc(const iso_u8* record, size_t size)
 {
-   char sectionData[4096] = { '\0' };
-   size_t sectionChars = getSection(auxSection, &sectionData[0], sizeof(sectionData));
-   size_t idxData = 0U;
-   size_t idxAux = 0U;
-   while (idxData < sectionChars)
+   iso_u32 crc = 0xFFFFFFFFu;
+   for (size_t idx = 0u; idx < size; idx++)
    {
-      char* entry = &(sectionData[idxData]);
-      VT_AUXAPP_T* auxEntry = &asAuxAss[idxAux];
-      if (parseAuxEntry(entry, auxEntry))
+      crc ^= record[idx];
+      for (int bit = 0; bit < 8; bit++)
       {
-          char key[64];
-          char value[64];
-          getKey(*auxEntry, key, sizeof(key));
-          getValue(*auxEntry, value, sizeof(value));
-          iso_DebugPrint("getAuxAssignment: %d %s %s\n", idxAux, key, value);
-          idxAux++;
+         crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
       }
+   }
+   return ~crc;
+}
 
-      idxData += (strlen(entry) + 1U);
+static void encodeAuxRecord(const VT_AUXAPP_T& auxEntry, iso_u8 record[AUX_RECORD_SIZE])
+{
+   record[0] = AUX_RECORD_VERSION;
+   record[1] = static_cast<iso_u8>(auxEntry.eAuxType);
+   putU16(&record[2], auxEntry.wObjID_Fun);
+   putU16(&record[4], auxEntry.wObjID_Input);
+   putU16(&record[6], auxEntry.wManuCode);
+   putU16(&record[8], auxEntry.wModelIdentCode);
+   record[10] = static_cast<iso_u8>(auxEntry.qPrefAssign);
+   record[11] = auxEntry.bFuncAttribute;
+   memcpy(&record[12], &auxEntry.baAuxName[0], 8);
+   iso_u32 crc = auxRecordCrc(record, AUX_RECORD_CRC_POS);
+   putU16(&record[AUX_RECORD_CRC_POS], static_cast<iso_u16>(crc));
+   putU16(&record[AUX_RECORD_CRC_POS + 2u], static_cast<iso_u16>(crc >> 16));
+}
+
+static bool decodeAuxRecord(const iso_u8* record, size_t size, VT_AUXAPP_T* auxEntry)
+{
+   if ((size != AUX_RECORD_SIZE) || (record[0] != AUX_RECORD_VERSION))
+   {
+      return false;
+   }
+   iso_u32 crc = readU16(&record[AUX_RECORD_CRC_POS]) | (static_cast<iso_u32>(readU16(&record[AUX_RECORD_CRC_POS + 2u])) << 16);
+   if (crc != auxRecordCrc(record, AUX_RECORD_CRC_POS))
+   {
+      return false;
    }
 
-   return (int)idxAux;
+   auxEntry->eAuxType = static_cast<VTAUXTYP_e>(record[1]);
+   auxEntry->wObjID_Fun = readU16(&record[2]);
+   auxEntry->wObjID_Input = readU16(&record[4]);
+   auxEntry->wManuCode = readU16(&record[6]);
+   auxEntry->wModelIdentCode = readU16(&record[8]);
+   auxEntry->qPrefAssign = static_cast<iso_bool>(record[10]);
+   auxEntry->bFuncAttribute = record[11];
+   memcpy(&auxEntry->baAuxName[0], &record[12], 8);
+   return true;
 }
 
+/* record of a getSectionEntries() value (blobToText()); false: no valid record */
+static bool readAuxRecord(const char key[], const char value[], VT_AUXAPP_T* auxEntry)
+{
+   iso_u8 record[AUX_RECORD_SIZE];
+   size_t size = blobFromText(value, record, sizeof(record));
+   if (!decodeAuxRecord(record, size, auxEntry) || (strtoul(key, nullptr, 10) != auxEntry->wObjID_Fun))
+   {
+      APP_LOG_WARN(APP_LOG_MOD_SETTINGS, "Ignoring aux assignment %s=%s\n", key, value);
+      return false;
+   }
+   return true;
+}
 
-bool parseAuxEntry(char* entry, VT_AUXAPP_T* auxEntry)
+/* getAuxAssignment(): all records of the section in one pass (getSectionEntries()),
+   at most maxCount; no buffer for the whole section */
+struct AuxReadContext
 {
-    int wObjID_Fun;
-    int wObjID_Input;
-    int eAuxType;
-    int wManuCode;
-    int wModelIdentCode;
-    int qPrefAssign;
-    int bFuncAttribute;
-    uint64_t name;
-    int parameterCount = sscanf(entry,
-#if defined(USE_L_FOR_64BIT)
-        "%d=%d,%d,%d,%d,%d,%d,%lX", &wObjID_Fun,
-#elif defined(USE_LL_FOR_64BIT)
-        "%d=%d,%d,%d,%d,%d,%d,%llX", &wObjID_Fun,
-#else // !defined(USE_L_FOR_64BIT)
-        "%d=%d,%d,%d,%d,%d,%d,%I64X", &wObjID_Fun,
-#endif //!defined(USE_L_FOR_64BIT)
-        &wObjID_Input, &eAuxType, &wManuCode, &wModelIdentCode,
-        &qPrefAssign, &bFuncAttribute, &name);
-    if (parameterCount == 8)
-    {
-        auxEntry->wObjID_Fun = static_cast<iso_u16>(wObjID_Fun);              /* Object ID of auxiliary function */
-        auxEntry->wObjID_Input = static_cast<iso_u16>(wObjID_Input);          /* Object ID of auxiliary input */
-        auxEntry->eAuxType = static_cast<VTAUXTYP_e>(eAuxType);      /* Function/input type (without attribute bits)
-                                                            - only because of downwards compatibility  */
-        auxEntry->wManuCode = static_cast<iso_u16>(wManuCode);                /* Manufacturer Code of auxiliary input device */
-        auxEntry->wModelIdentCode = static_cast<iso_u16>(wModelIdentCode);    /* Model identification code of aux input device */
-        auxEntry->qPrefAssign = static_cast<iso_bool>(qPrefAssign);            /* This assignment shall used for preferred assignment */
-        auxEntry->bFuncAttribute = static_cast<iso_u8>(bFuncAttribute);      /* Complete function attribute byte of auxiliary function */
-        memcpy(&auxEntry->baAuxName[0], &name, 8);      /* ISO name of the auxiliary input device. The bytes must be set to 0xFF if not used. */
-        return true;
-    }
+   VT_AUXAPP_T* asAuxAss;
+   size_t idxAux;
+   size_t maxCount;
+};
+
+static uint8_t readAuxEntry(const char key[], const char value[], void* context)
+{
+   AuxReadContext* auxRead = static_cast<AuxReadContext*>(context);
+   VT_AUXAPP_T* auxEntry = &auxRead->asAuxAss[auxRead->idxAux];
+   if (readAuxRecord(key, value, auxEntry))
+   {
+      APP_LOG_DEBUG(APP_LOG_MOD_SETTINGS, "getAuxAssignment: %d %s=%s\n", (int)auxRead->idxAux, key, value);
+      auxRead->idxAux++;
+   }
+   if (auxRead->idxAux == auxRead->maxCount)
+   {
+      APP_LOG_WARN(APP_LOG_MOD_SETTINGS, "getAuxAssignment: buffer full after %d assignments\n", (int)auxRead->maxCount);
+      return 0U;
+   }
+   return 1U;
+}
 
-    return false;
+int getAuxAssignment(const char auxSection[], VT_AUXAPP_T asAuxAss[], iso_u16 maxCount)
+{
+   AuxReadContext auxRead = { asAuxAss, 0U, maxCount };
+   if (maxCount > 0U)
+   {
+      (void)getSectionEntries(auxSection, &readAuxEntry, &auxRead);
+   }
+   return (int)auxRead.idxAux;
 }
 
-void setAuxAssignment(const char section[], VT_AUXAPP_T asAuxAss[], iso_s16 iNumberOfAssigns)
+/* setAuxAssignment(): compares the stored records with the new assignment */
+struct AuxCompareContext
 {
-   char buffer[512];
-   char key[16];
+   const VT_AUXAPP_T* asAuxAss;
+   iso_s16 iNumberOfAssigns;
+   vector<bool> unchanged;       /* new entry equals the stored record */
+   vector<string> staleKeys;     /* stored keys without new entry */
+};
 
-   // erase complete section
-   clearSection(section);
+static uint8_t compareAuxEntry(const char key[], const char value[], void* context)
+{
+   AuxCompareContext* auxCompare = static_cast<AuxCompareContext*>(context);
+   unsigned long objIdFun = strtoul(key, nullptr, 10);
+   for (iso_s16 idx = 0; idx < auxCompare->iNumberOfAssigns; idx++)
+   {
+      if (auxCompare->asAuxAss[idx].wObjID_Fun == objIdFun)
+      {
+         iso_u8 storedRecord[AUX_RECORD_SIZE];
+         iso_u8 newRecord[AUX_RECORD_SIZE];
+         size_t size = blobFromText(value, storedRecord, sizeof(storedRecord));
+         encodeAuxRecord(auxCompare->asAuxAss[idx], newRecord);
+         auxCompare->unchanged[static_cast<size_t>(idx)] =
+            (size == AUX_RECORD_SIZE) && (memcmp(storedRecord, newRecord, AUX_RECORD_SIZE) == 0);
+         return 1U;
+      }
+   }
+   auxCompare->staleKeys.push_back(key);
+   return 1U;
+}
 
-   // write aux entries
-   for (int8_t idx = 0; idx < iNumberOfAssigns; idx++)
+void setAuxAssignment(const char section[], VT_AUXAPP_T asAuxAss[], iso_s16 iNumberOfAssigns)
+{
+   AuxCompareContext auxCompare;
+   auxCompare.asAuxAss = asAuxAss;
+   auxCompare.iNumberOfAssigns = (iNumberOfAssigns > 0) ? iNumberOfAssigns : 0;
+   auxCompare.unchanged.assign(static_cast<size_t>(auxCompare.iNumberOfAssigns), false);
+   (void)getSectionEntries(section, &compareAuxEntry, &auxCompare);
+
+   // only removed and changed entries are written
+   for (size_t idx = 0u; idx < auxCompare.staleKeys.size(); idx++)
    {
-      VT_AUXAPP_T* auxEntry = &asAuxAss[idx];
-      sprintf_s(key, sizeof(key), "%d", auxEntry->wObjID_Fun);
-      uint64_t name = 0;
-      memcpy(&name, &auxEntry->baAuxName[0], 8);            /* ISO name of the auxiliary input device. The bytes must be set to 0xFF if not used. */
-#if defined(USE_L_FOR_64BIT)
-      sprintf_s(buffer, sizeof(buffer), "%d,%d,%d,%d,%d,%d,%lX",
-#elif defined(USE_LL_FOR_64BIT)
-      sprintf_s(buffer, sizeof(buffer), "%d,%d,%d,%d,%d,%d,%llX",
-#else // !defined(USE_L_FOR_64BIT)
-      sprintf_s(buffer, sizeof(buffer), "%d,%d,%d,%d,%d,%d,%I64X",
-#endif //!defined(USE_L_FOR_64BIT)
-         auxEntry->wObjID_Input, auxEntry->eAuxType, auxEntry->wManuCode, auxEntry->wModelIdentCode,
-         auxEntry->qPrefAssign, auxEntry->bFuncAttribute, name);
-      setString(section, key, buffer);
+      setString(section, auxCompare.staleKeys[idx].c_str(), nullptr);
+   }
+   for (iso_s16 idx = 0; idx < auxCompare.iNumberOfAssigns; idx++)
+   {
+      if (!auxCompare.unchanged[static_cast<size_t>(idx)])
+      {
+         char key[16];
+         iso_u8 record[AUX_RECORD_SIZE];
+         getKey(asAuxAss[idx], key, sizeof(key));
+         encodeAuxRecord(asAuxAss[idx], record);
+         setBlob(section, key, record, sizeof(record));
+      }
    }
 }
 
@@ -345,52 +425,24 @@ void updateAuxAssignment(const char auxSection[], VT_AUXAPP_T* sAuxAss)
     if (sAuxAss->wObjID_Input != 0xFFFF)
     {
         char key[64];
-        char value[64];
+        iso_u8 record[AUX_RECORD_SIZE];
         getKey(*sAuxAss, key, sizeof(key));
-        getValue(*sAuxAss, value, sizeof(value));
-        iso_DebugPrint("updateAuxAssignment add: %s %s\n", key, value);
-        setString(auxSection, key, value);
+        encodeAuxRecord(*sAuxAss, record);
+        APP_LOG_INFO(APP_LOG_MOD_SETTINGS, "updateAuxAssignment add: %s input %d\n", key, (int)sAuxAss->wObjID_Input);
+        setBlob(auxSection, key, record, sizeof(record));
     }
     else
     {
-        iso_s16 auxCfHandle = IsoClGetCfHandleToName(ISO_CAN_VT, &sAuxAss->baAuxName);
-        iso_u16 wModelIdentCode = 0;
-        if (IsoReadAuxInputDevModIdentCode(auxCfHandle, &wModelIdentCode) == E_NO_ERR)
-        {
-            sAuxAss->wModelIdentCode = wModelIdentCode;
-        }
-
         char key[64];
         getKey(*sAuxAss, key, sizeof(key));
-        iso_DebugPrint("updateAuxAssignment remove: %s\n", key);
+        APP_LOG_INFO(APP_LOG_MOD_SETTINGS, "updateAuxAssignment remove: %s\n", key);
         setString(auxSection, key, nullptr);
     }
 }
 
 static bool getKey(const VT_AUXAPP_T& auxEntry, char* key, size_t size)
 {
-#if defined(linux)
-    sprintf_s(key, size, "%d",
-#else // defined(linux)
-    sprintf_s(key, size, "%d",
-#endif // defined(linux)
-        auxEntry.wObjID_Fun);
-    return true;
-}
-
-static bool getValue(const VT_AUXAPP_T& auxEntry, char* value, size_t size)
-{
-    uint64_t name = 0;
-    memcpy(&name, &auxEntry.baAuxName[0], 8);            /* ISO name of the auxiliary input device. The bytes must be set to 0xFF if not used. */
-#if defined(USE_L_FOR_64BIT)
-    sprintf_s(value, size, "%d,%d,%d,%d,%d,%d,%lX",
-#elif defined(USE_LL_FOR_64BIT)
-    sprintf_s(value, size, "%d,%d,%d,%d,%d,%d,%llX",
-#else // !defined(USE_L_FOR_64BIT)
-    sprintf_s(value, size, "%d,%d,%d,%d,%d,%d,%I64X",
-#endif // !defined(USE_L_FOR_64BIT)
-        auxEntry.wObjID_Input, auxEntry.eAuxType, auxEntry.wManuCode, auxEntry.wModelIdentCode,
-        auxEntry.qPrefAssign, auxEntry.bFuncAttribute, name);
+    sprintf_s(key, size, "%d", auxEntry.wObjID_Fun);
     return true;
 }
 
@@ -24,7 +24,8 @@ extern "C" {
    int IsoAuxReadAssignOfFile(VT_AUXAPP_T asAuxAss[]);
    int IsoAuxWriteAssignToFile(VT_AUXAPP_T asAuxAss[], iso_s16 iNumberOfAssigns);
 
-   int  getAuxAssignment(const char section[], VT_AUXAPP_T asAuxAss[]);
+   /* reads at most maxCount assignments into asAuxAss[]; returns the number read */
+   int  getAuxAssignment(const char section[], VT_AUXAPP_T asAuxAss[], iso_u16 maxCount);
    void setAuxAssignment(const char section[], VT_AUXAPP_T asAuxAss[], iso_s16 iNumberOfAssigns);
    void updateAuxAssignment(const char auxSection[], VT_AUXAPP_T* sAuxAss);
 
@@ -0,0 +1,175 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Run time and period statistics of the phases of AppIso_Cyclic()
+
+   \details    Single writer: the sequence counter is odd while the writer updates
+               the statistics; a reader retries its copy if the counter was odd or
+               has changed (sequence lock).
+*/
+/* ************************************************************************ */
+
+#include <string.h>
+#include "IsoDef.h"
+#include "AppCommon/AppHW.h"
+#include "App_CycleStats.h"
+
+/* ************************************************************************ */
+
+#if defined(__GNUC__)
+   #define CYCLESTATS_BARRIER()  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+   #define CYCLESTATS_BARRIER()  /* single task: writer and reader call AppIso_Cyclic() */
+#endif
+
+static const char_t* const m_CyclePhaseNames[APP_CYCLE_PHASES] =
+{
+   "rx", "app", "core", "base", "clients", "tx", "cycle", "period"
+};
+
+static AppCyclePhaseStats_t m_CycleStats[APP_CYCLE_PHASES];
+static volatile uint32_t    m_CycleStatsSeq_u32 = 0u;
+static volatile iso_bool    m_CycleStatsReset = ISO_TRUE;
+static uint64_t             m_CycleStartUs_u64 = 0u;
+
+/* ************************************************************************ */
+
+/* bucket 0 .. 3: 0 .. 3 us; then bucket 4 + 4 * (msb - 2) + next two bits below the msb */
+static uint8_t CycleStats_Bucket(uint32_t u32Us)
+{
+   uint32_t u32Bucket;
+   uint8_t  u8Msb = 0u;
+
+   if (u32Us < 4u)
+   {
+      return (uint8_t)u32Us;
+   }
+   while ((u8Msb < 31u) && ((u32Us >> (u8Msb + 1u)) != 0u))
+   {
+      u8Msb++;
+   }
+   u32Bucket = 4u + (4u * (u8Msb - 2u)) + ((u32Us >> (u8Msb - 2u)) & 3u);
+   return (u32Bucket < APP_CYCLE_HIST_BUCKETS) ? (uint8_t)u32Bucket : (uint8_t)(APP_CYCLE_HIST_BUCKETS - 1u);
+}
+
+/* largest value of a bucket */
+static uint32_t CycleStats_BucketUpper(uint8_t u8Bucket)
+{
+   uint8_t u8Shift;
+   if (u8Bucket < 4u)
+   {
+      return u8Bucket;
+   }
+   u8Shift = (uint8_t)((u8Bucket - 4u) / 4u);
+   return ((uint32_t)(4u + ((u8Bucket - 4u) % 4u) + 1u) << u8Shift) - 1u;
+}
+
+static void CycleStats_Record(AppCyclePhase_e ePhase, uint64_t u64Us)
+{
+   AppCyclePhaseStats_t* psStats = &m_CycleStats[ePhase];
+   uint32_t u32Us = (u64Us > 0xFFFFFFFFuLL) ? 0xFFFFFFFFuL : (uint32_t)u64Us;
+
+   m_CycleStatsSeq_u32++;
+   CYCLESTATS_BARRIER();
+   psStats->min_u32 = ((psStats->count_u32 == 0u) || (u32Us < psStats->min_u32)) ? u32Us : psStats->min_u32;
+   psStats->max_u32 = (u32Us > psStats->max_u32) ? u32Us : psStats->max_u32;
+   psStats->sum_u64 += u32Us;
+   psStats->count_u32++;
+   psStats->hist_au32[CycleStats_Bucket(u32Us)]++;
+   CYCLESTATS_BARRIER();
+   m_CycleStatsSeq_u32++;
+}
+
+/* ************************************************************************ */
+
+uint64_t AppCycleStats_Start(void)
+{
+   uint64_t u64NowUs = hw_GetTimeUs();
+
+   if (m_CycleStatsReset == ISO_TRUE)
+   {
+      m_CycleStatsSeq_u32++;
+      CYCLESTATS_BARRIER();
+      memset(m_CycleStats, 0, sizeof(m_CycleStats));
+      CYCLESTATS_BARRIER();
+      m_CycleStatsSeq_u32++;
+      m_CycleStatsReset = ISO_FALSE;
+   }
+   else
+   {
+      CycleStats_Record(APP_CYCLE_PERIOD, u64NowUs - m_CycleStartUs_u64);
+   }
+
+   m_CycleStartUs_u64 = u64NowUs;
+   return u64NowUs;
+}
+
+uint64_t AppCycleStats_Add(AppCyclePhase_e ePhase, uint64_t u64StartUs)
+{
+   uint64_t u64NowUs = hw_GetTimeUs();
+   if (ePhase < APP_CYCLE_PHASES)
+   {
+      CycleStats_Record(ePhase, u64NowUs - u64StartUs);
+   }
+   return u64NowUs;
+}
+
+iso_bool AppCycleStats_Get(AppCyclePhase_e ePhase, AppCyclePhaseStats_t* psStats)
+{
+   uint32_t u32Seq;
+
+   if (ePhase >= APP_CYCLE_PHASES)
+   {
+      return ISO_FALSE;
+   }
+
+   do
+   {
+      u32Seq = m_CycleStatsSeq_u32;
+      CYCLESTATS_BARRIER();
+      memcpy(psStats, &m_CycleStats[ePhase], sizeof(AppCyclePhaseStats_t));
+      CYCLESTATS_BARRIER();
+   } while (((u32Seq & 1u) != 0u) || (u32Seq != m_CycleStatsSeq_u32));
+
+   return ISO_TRUE;
+}
+
+uint32_t AppCycleStats_Percentile(const AppCyclePhaseStats_t* psStats, uint8_t u8Percent)
+{
+   uint64_t u64Limit = ((uint64_t)psStats->count_u32 * u8Percent + 99u) / 100u;
+   uint64_t u64Sum = 0u;
+   uint8_t  u8Bucket;
+
+   for (u8Bucket = 0u; u8Bucket < APP_CYCLE_HIST_BUCKETS; u8Bucket++)
+   {
+      u64Sum += psStats->hist_au32[u8Bucket];
+      if ((u64Sum >= u64Limit) && (u64Sum > 0u))
+      {
+         uint32_t u32Upper = CycleStats_BucketUpper(u8Bucket);
+         return ((u8Bucket == (APP_CYCLE_HIST_BUCKETS - 1u)) || (u32Upper > psStats->max_u32)) ? psStats->max_u32 : u32Upper;
+      }
+   }
+   return psStats->max_u32;
+}
+
+void AppCycleStats_Reset(void)
+{
+   m_CycleStatsReset = ISO_TRUE;
+}
+
+void AppCycleStats_Print(void)
+{
+   uint8_t u8Phase;
+
+   hw_DebugPrint("%-8s %8s %8s %8s %8s %8s [us]\n", "phase", "count", "min", "avg", "p99", "max");
+   for (u8Phase = 0u; u8Phase < (uint8_t)APP_CYCLE_PHASES; u8Phase++)
+   {
+      AppCyclePhaseStats_t sStats;
+      (void)AppCycleStats_Get((AppCyclePhase_e)u8Phase, &sStats);
+      hw_DebugPrint("%-8s %8u %8u %8u %8u %8u\n", m_CyclePhaseNames[u8Phase], sStats.count_u32, sStats.min_u32,
+         (sStats.count_u32 > 0u) ? (uint32_t)(sStats.sum_u64 / sStats.count_u32) : 0u,
+         AppCycleStats_Percentile(&sStats, 99u), sStats.max_u32);
+   }
+}
+
+/* ************************************************************************ */
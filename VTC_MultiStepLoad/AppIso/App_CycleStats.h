@@ -0,0 +1,74 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Run time and period statistics of the phases of AppIso_Cyclic()
+
+   \details    Each phase keeps count, min, max, sum and a histogram with power of
+               two ranges in microseconds, each split into four buckets (max. 25 % error
+               of the percentiles). The statistics are written only by the
+               task calling AppIso_Cyclic(); AppCycleStats_Get() copies them with a
+               sequence counter, so other tasks read a consistent snapshot without lock.
+               F1 prints the table with p99, F2 clears it; app_main() prints it at
+               shutdown. The period from start to start shows the jitter of the main
+               loop, e.g. with MainLoop.EventDriven=0 and =1.
+*/
+/* ************************************************************************ */
+
+#ifndef APP_CYCLESTATS_H
+#define APP_CYCLESTATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APP_CYCLE_HIST_BUCKETS   92u   /*!< 0 .. 3 us, then 4 buckets per power of two; last: >= 14.7 s */
+
+/*! \brief Measured phases */
+typedef enum
+{
+   APP_CYCLE_RX = 0,          /*!< Do_ReceiveCanMessages() */
+   APP_CYCLE_APP,             /*!< AppTpBurst_Cyclic() and AppImpl_doProcess() */
+   APP_CYCLE_CORE,            /*!< iso_CoreCyclic() */
+   APP_CYCLE_BASE,            /*!< iso_BaseCyclic() */
+   APP_CYCLE_CLIENTS,         /*!< IsoClientsCyclicCall() */
+   APP_CYCLE_TX,              /*!< hw_CanFlushSendMsgs() */
+   APP_CYCLE_TOTAL,           /*!< AppIso_Cyclic() */
+   APP_CYCLE_PERIOD,          /*!< start to start of AppIso_Cyclic() */
+   APP_CYCLE_PHASES
+} AppCyclePhase_e;
+
+/*! \brief Statistics of one phase in microseconds */
+typedef struct
+{
+   uint32_t count_u32;
+   uint32_t min_u32;
+   uint32_t max_u32;
+   uint64_t sum_u64;
+   uint32_t hist_au32[APP_CYCLE_HIST_BUCKETS];
+} AppCyclePhaseStats_t;
+
+/*! \brief Starts a cycle: records the period and returns the start time (hw_GetTimeUs()) */
+uint64_t AppCycleStats_Start(void);
+
+/*! \brief Records the phase from u64StartUs until now and returns now (start of the next phase) */
+uint64_t AppCycleStats_Add(AppCyclePhase_e ePhase, uint64_t u64StartUs);
+
+/*! \brief Copies the statistics of a phase; ISO_FALSE: invalid phase */
+iso_bool AppCycleStats_Get(AppCyclePhase_e ePhase, AppCyclePhaseStats_t* psStats);
+
+/*! \brief Percentile (0 .. 100) from the histogram: upper limit of the bucket, at most the maximum */
+uint32_t AppCycleStats_Percentile(const AppCyclePhaseStats_t* psStats, uint8_t u8Percent);
+
+/*! \brief Clears all statistics at the start of the next cycle */
+void AppCycleStats_Reset(void);
+
+/*! \brief Prints count, min, avg, p99 and max of all phases */
+void AppCycleStats_Print(void);
+
+/* ************************************************************************ */
+#ifdef __cplusplus
+} /* end of extern "C" */
+#endif
+
+#endif /* APP_CYCLESTATS_H */
+/* ************************************************************************ */
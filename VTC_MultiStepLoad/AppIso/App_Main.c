@@ -21,10 +21,14 @@
 
 #include "IsoDef.h"
 #include "App_Base.h"
+#include "Settings/settings.h"
 
 
 #include "AppCommon/AppOutput.h"
+#include "AppCommon/AppLog.h"
 #include "App_VTClient.h"  /* needed only for DoKeyBoard() */
+#include "App_TpBurst.h"
+#include "App_CycleStats.h"
 //#include "App_TCClient.h"  /* needed only for DoKeyBoard() */
 
 #include "../Samples/AddOn/AppIso_Output.h"  /* relative to IsoLib */
@@ -57,11 +61,50 @@ static iso_s32 CB_GetTimeMs(void);
 
 /* CAN message receive and forward function */
 static void Do_ReceiveCanMessages(void);
+static void PrintCanRxStats(void);
+
+/* main loop scheduling */
+static void WaitNextCycle(iso_s32 s32CycleStartMs);
+static void PrintMainLoopStats(void);
 
 /* **************************  const data initialization ****************** */
 
 /* **************************  module global data  ************************ */
 
+#define APP_CAN_RX_BATCH     16u    /*!< messages per hw_CanReadMsgs() call */
+#define APP_CAN_RX_MIN_CAP   40u    /*!< messages per cycle and CAN node (queue depth unknown or low) */
+#define APP_CAN_RX_MAX_CAP  400u    /*!< upper limit of the adaptive cap */
+#define APP_CAN_TX_LOW_PRIO    6u   /*!< CAN priority of (E)TP data packets and other bulk messages */
+#define APP_CAN_TX_RESERVE     4    /*!< transmit slots kept free for higher priority messages */
+
+/*! \brief Receive statistics of one CAN node */
+typedef struct
+{
+   uint32_t received_u32;           /*!< messages forwarded to the ISOBUS driver */
+   uint32_t deferred_u32;           /*!< sum of the messages left in the queue at the cap */
+   uint32_t dropped_u32;            /*!< messages lost by the driver */
+   uint32_t lastReceived_u32;       /*!< values of the last cycle */
+   uint32_t lastDeferred_u32;
+   uint32_t lastDropped_u32;
+   uint32_t maxReceived_u32;        /*!< maximum messages of one cycle */
+   uint32_t driverDropped_u32;      /*!< last total reported by hw_CanGetRxStatus() */
+} AppCanRxStats_t;
+
+static AppCanRxStats_t m_CanRxStats[ISO_CAN_NODES];
+
+/*! \brief Main loop settings (section "MainLoop") and statistics */
+typedef struct
+{
+   iso_bool qEventDriven;           /*!< ISO_TRUE: the next cycle starts when a CAN message is received */
+   iso_u16  u16CycleMs;             /*!< period of AppIso_Cyclic() without CAN messages */
+   uint32_t cycles_u32;
+   uint32_t rxWakeUps_u32;          /*!< cycles started early by a received CAN message */
+   uint64_t idleUs_u64;             /*!< time spent waiting for the next cycle */
+   uint64_t startUs_u64;
+} AppMainLoop_t;
+
+static AppMainLoop_t m_MainLoop;
+
 /* ************************************************************************ */
 /*! \brief Sample main function */
 void app_main(void)
@@ -69,6 +112,16 @@ void app_main(void)
    hw_DebugPrint("ISO Application starts \n");
    /* Initialize application */
    AppHW_Init();
+   /* debug output: formatted by a low-priority task instead of the cyclic task */
+   hw_DebugSetDeferred(getU8("Log", "Deferred", 1u));
+   {  /* run time level of each module, e.g. Log.CAN=5 prints each CAN message (if compiled in) */
+      uint8_t module_u8;
+      for (module_u8 = 0u; module_u8 < (uint8_t)APP_LOG_MODULES; module_u8++)
+      {
+         AppLog_SetLevel((AppLogModule_e)module_u8,
+            getU8("Log", AppLog_GetModuleName((AppLogModule_e)module_u8), APP_LOG_LEVEL_INFO));
+      }
+   }
 
 #if defined(APP_TEST_CAN_DRIVER)
    {  /* Check CAN driver send function  */
@@ -86,15 +139,24 @@ void app_main(void)
    AppIso_Init();
 
    /* sample main loop */
+   m_MainLoop.qEventDriven = (getU8("MainLoop", "EventDriven", 1u) != 0u) ? ISO_TRUE : ISO_FALSE;
+   m_MainLoop.u16CycleMs = getU16("MainLoop", "CycleMs", 5u);
+   m_MainLoop.startUs_u64 = hw_GetTimeUs();
    while (hw_PowerSwitchIsOn())
    {
+      iso_s32 s32CycleStartMs = hw_GetTimeMs();
       /* run cyclic application function */
       AppIso_Cyclic();
 
-      hw_SimDoSleep(5);  // Simulate loop time "5ms"
+      WaitNextCycle(s32CycleStartMs);
       DoKeyBoard();
    }
 
+   PrintMainLoopStats();
+   AppCycleStats_Print();
+   PrintCanRxStats();
+   AppTpBurst_Print();
+   settingsFlush();
    hw_Shutdown();
 
    return;
@@ -112,7 +174,6 @@ void AppHW_Init(void)
 /*! \brief Sample ISOBUS library initialization */
 void AppIso_Init(void)
 {
-   iso_u8  u8I;
    iso_s16 s16Ret, s16FnRet;
    iso_u32 u32version;
 
@@ -123,12 +184,9 @@ void AppIso_Init(void)
    s16Ret = iso_CoreInit( CB_GetTimeMs, CB_Watchdog, CB_ReportError,
                           CB_CanSend, CB_GetSendMsgFiFoSize,
                           IsoCbBaseDataDistributor, IsoCbBaseNetworkDistributor, 0 );
-   /* do next step for each CAN node */
-   for (u8I = 0u; u8I < ISO_CAN_NODES; u8I++)
-   {  /* set number of (E)TP messages for each cycle (V10: Replaced iso_DlTPRepeatSet() with iso_CoreTPRepeatSet()) */
-      s16FnRet = iso_CoreTPRepeatSet(u8I, 5);
-      s16Ret = (s16Ret == E_NO_ERR) ? s16FnRet : s16Ret;
-   }
+   /* set number of (E)TP messages for each cycle; adapted by AppTpBurst_Cyclic() */
+   s16FnRet = AppTpBurst_Init();
+   s16Ret = (s16Ret == E_NO_ERR) ? s16FnRet : s16Ret;
 
    /* Initialize the base ISOBUS driver library package */
 #if defined(ISO_MODULE_CLIENTS)  /* same as #if defined(_LAY6_) || defined(_LAY10_) || defined(_LAY13_) || ... */
@@ -161,18 +219,41 @@ void AppIso_Init(void)
 /*! \brief Sample: cyclic function */
 void AppIso_Cyclic(void)
 {
+   /* phase times: see App_CycleStats.h */
+   uint64_t u64CycleStartUs = AppCycleStats_Start();
+   uint64_t u64PhaseStartUs;
+
    /* Get the incoming CAN messages and forward them to the ISOBUS driver */
    Do_ReceiveCanMessages();
+   u64PhaseStartUs = AppCycleStats_Add(APP_CYCLE_RX, u64CycleStartUs);
+
+   /* Adapt the number of (E)TP messages per cycle */
+   AppTpBurst_Cyclic();
 
    /* Call the implement sample cyclic function */
    AppImpl_doProcess();
+   u64PhaseStartUs = AppCycleStats_Add(APP_CYCLE_APP, u64PhaseStartUs);
 
    /* Call the ISOBUS driver cyclic functions */
    iso_CoreCyclic();
+   u64PhaseStartUs = AppCycleStats_Add(APP_CYCLE_CORE, u64PhaseStartUs);
    iso_BaseCyclic();
+   u64PhaseStartUs = AppCycleStats_Add(APP_CYCLE_BASE, u64PhaseStartUs);
 #if defined(ISO_MODULE_CLIENTS) /* same as #if defined(_LAY6_) || defined(_LAY10_) || defined(_LAY13_) || ... */
    (void) IsoClientsCyclicCall();
+   u64PhaseStartUs = AppCycleStats_Add(APP_CYCLE_CLIENTS, u64PhaseStartUs);
 #endif /* defined(ISO_MODULE_CLIENTS) */
+
+   /* Send the CAN messages of this cycle */
+   {
+      uint8_t canNode_u8;
+      for (canNode_u8 = 0u; canNode_u8 < ISO_CAN_NODES; canNode_u8++)
+      {
+         hw_CanFlushSendMsgs(canNode_u8);
+      }
+   }
+   (void)AppCycleStats_Add(APP_CYCLE_TX, u64PhaseStartUs);
+   (void)AppCycleStats_Add(APP_CYCLE_TOTAL, u64CycleStartUs);
 }
 
 
@@ -194,16 +275,28 @@ static void CB_ReportError(iso_u8 functionId_u8, iso_u8 locationId_u8, iso_s16 e
 /*! \brief ISOBUS driver CAN message send callback function */
 static iso_s16 CB_CanSend(iso_u8 canNode_u8, iso_u32 canId_u32, const iso_u8 canData_au8[], iso_u8 canDataLength_u8)
 {
-   return hw_CanSendMsg(canNode_u8, canId_u32, canData_au8, canDataLength_u8);
+   iso_s16 s16Ret = hw_CanSendMsg(canNode_u8, canId_u32, canData_au8, canDataLength_u8);
+   if (s16Ret == 0)
+   {
+      AppTpBurst_CanMsgSent(canNode_u8, canId_u32, canData_au8, canDataLength_u8);
+   }
+   return s16Ret;
 }
 
-/*! \brief ISOBUS driver "Get CAN message FIFO size" callback function */
+/*! \brief ISOBUS driver "Get CAN message FIFO size" callback function
+   \details Returns the free transmit slots of the CAN driver (ESP32: tx_queue_len minus msgs_to_tx,
+   0 if the controller is not running; SocketCAN: free entries of the driver queue). Messages with low
+   priority (e.g. (E)TP data packets) leave APP_CAN_TX_RESERVE slots for the messages with higher priority. \n
+   The pool upload with and without backpressure is compared in the simulator:
+   VtSimulator --tx-queue 20 and VtSimulator --tx-queue 20 --fixed-free-tx 20 */
 static iso_s16 CB_GetSendMsgFiFoSize(iso_u8 u8CanNode, iso_u8 u8MsgPrio)
-{  /* we don't check here and return always 20 free buffer entries ... */
-    (void)u8CanNode;
-    (void)u8MsgPrio;
-    return 20;
-   /* return hw_CanGetFreeSendMsgBufferSize(u8CanNode); */
+{
+   iso_s16 s16Free = hw_CanGetFreeSendMsgBufferSize(u8CanNode);
+   if (u8MsgPrio >= APP_CAN_TX_LOW_PRIO)
+   {
+      s16Free -= APP_CAN_TX_RESERVE;
+   }
+   return (s16Free > 0) ? s16Free : 0;
 }
 
 /* ************************************************************************ */
@@ -218,35 +311,127 @@ static iso_s32 CB_GetTimeMs(void)
 }
 
 /*! \brief CAN message receive and forward function
-   \details This sample function forwards the incoming CAN messages to the ISOBUS driver */
+   \details This sample function forwards the incoming CAN messages to the ISOBUS driver.
+   The messages are read in batches. The number of messages per cycle is limited by a cap
+   which follows the receive queue depth reported by the driver; messages above the cap are
+   deferred to the next cycle. Without queue status (Windows) the cap is APP_CAN_RX_MIN_CAP. \n
+   Messages lost by the driver (ESP32 rx_missed_count, SocketCAN SO_RXQ_OVFL) are counted as
+   dropped; app_main() prints the totals at shutdown. */
    /*! [Do_ReceiveCanMessages] */
 static void Do_ReceiveCanMessages(void)
 {
    uint8_t  canNode_u8;
-   uint32_t canId_u32;
-   uint8_t  canData_au8[8];
-   uint8_t  canDataLength_u8;
+   hw_CanMsg_t canMsgs_as[APP_CAN_RX_BATCH];
 
-   iso_bool msgFound;
-   uint8_t  msgCount = 0u;
-
-   do
+   for (canNode_u8 = 0u; canNode_u8 < ISO_CAN_NODES; canNode_u8++)
    {
-      msgFound = ISO_FALSE;
+      AppCanRxStats_t* stats_ps = &m_CanRxStats[canNode_u8];
+      hw_CanRxStatus_t rxStatus_s;
+      iso_bool qStatus = (hw_CanGetRxStatus(canNode_u8, &rxStatus_s) == 0) ? ISO_TRUE : ISO_FALSE;
+      uint32_t cap_u32 = APP_CAN_RX_MIN_CAP;
+      uint32_t received_u32 = 0u;
+      int16_t  count_s16;
+
+      if (qStatus == ISO_TRUE)
+      {  /* drain a growing queue faster, but keep the cycle time bounded */
+         cap_u32 = (rxStatus_s.pending_u32 < APP_CAN_RX_MIN_CAP) ? APP_CAN_RX_MIN_CAP
+                 : (rxStatus_s.pending_u32 > APP_CAN_RX_MAX_CAP) ? APP_CAN_RX_MAX_CAP : rxStatus_s.pending_u32;
+      }
 
-      for (canNode_u8 = 0u; canNode_u8 < ISO_CAN_NODES; canNode_u8++)
+      do
       {
-         int16_t   ret_s16;
-         ret_s16 = hw_CanReadMsg(canNode_u8, &canId_u32, canData_au8, &canDataLength_u8);
-
-         if (ret_s16 > 0)
+         int16_t idx_s16;
+         uint32_t max_u32 = cap_u32 - received_u32;
+         count_s16 = hw_CanReadMsgs(canNode_u8, canMsgs_as, (int16_t)((max_u32 < APP_CAN_RX_BATCH) ? max_u32 : APP_CAN_RX_BATCH));
+         for (idx_s16 = 0; idx_s16 < count_s16; idx_s16++)
          {  /* call the ISOBUS library receive function */
-            iso_CoreCanMsgRec(canNode_u8, canId_u32, canData_au8, canDataLength_u8);
-            msgFound = ISO_TRUE;
-            msgCount++;
+            iso_CoreCanMsgRec(canNode_u8, canMsgs_as[idx_s16].canId_u32, canMsgs_as[idx_s16].canData_au8, canMsgs_as[idx_s16].canDataLength_u8);
+            AppTpBurst_CanMsgRec(canNode_u8, canMsgs_as[idx_s16].canId_u32, canMsgs_as[idx_s16].canData_au8, canMsgs_as[idx_s16].canDataLength_u8);
          }
-      } /* end for */
-   } while ((msgFound == ISO_TRUE) && (msgCount <= 40u));
+         received_u32 += (count_s16 > 0) ? (uint32_t)count_s16 : 0u;
+      } while ((count_s16 > 0) && (received_u32 < cap_u32));
+
+      stats_ps->lastReceived_u32 = received_u32;
+      stats_ps->received_u32 += received_u32;
+      if (received_u32 > stats_ps->maxReceived_u32)
+      {
+         stats_ps->maxReceived_u32 = received_u32;
+      }
+
+      stats_ps->lastDeferred_u32 = 0u;
+      stats_ps->lastDropped_u32 = 0u;
+      if ((qStatus == ISO_TRUE) && (hw_CanGetRxStatus(canNode_u8, &rxStatus_s) == 0))
+      {
+         stats_ps->lastDeferred_u32 = (received_u32 >= cap_u32) ? rxStatus_s.pending_u32 : 0u;
+         stats_ps->lastDropped_u32 = rxStatus_s.dropped_u32 - stats_ps->driverDropped_u32;
+         stats_ps->driverDropped_u32 = rxStatus_s.dropped_u32;
+         stats_ps->deferred_u32 += stats_ps->lastDeferred_u32;
+         stats_ps->dropped_u32 += stats_ps->lastDropped_u32;
+         if (stats_ps->lastDropped_u32 > 0u)
+         {
+            hw_DebugPrint("CAN %u: %u messages lost (received %u, deferred %u) \n", canNode_u8,
+               stats_ps->lastDropped_u32, received_u32, stats_ps->lastDeferred_u32);
+         }
+      }
+   }
+}
+
+/*! \brief Waits for the next cycle
+   \details Event driven: returns when a CAN message is received on any node or when the cycle
+   time since s32CycleStartMs has elapsed, so that the ISOBUS driver cyclic functions still run
+   every u16CycleMs. Without receive event of the CAN driver, or with EventDriven=0, it sleeps. \n
+   Receive events: SocketCAN epoll on all sockets, ESP32 task notification of the RX task.
+   app_main() prints cycles, cycles started by CAN and the idle time at shutdown. The soft key
+   round trip is compared in the simulator: VtSimulator --key-messages 20 --set MainLoop.EventDriven=0
+   and VtSimulator --key-messages 20 */
+static void WaitNextCycle(iso_s32 s32CycleStartMs)
+{
+   uint64_t u64WaitStartUs = hw_GetTimeUs();
+   iso_s32  s32RemainMs = (s32CycleStartMs + (iso_s32)m_MainLoop.u16CycleMs) - hw_GetTimeMs();
+
+   if (m_MainLoop.qEventDriven == ISO_TRUE)
+   {
+      iso_s16 s16Ret = (s32RemainMs > 0) ? hw_CanWaitRx((uint32_t)s32RemainMs) : 0;
+      if (s16Ret > 0)
+      {
+         m_MainLoop.rxWakeUps_u32++;
+      }
+      else if (s16Ret < 0)
+      {
+         hw_SimDoSleep((uint32_t)s32RemainMs);
+      }
+      else { /* cycle time elapsed */ }
+   }
+   else
+   {
+      hw_SimDoSleep(m_MainLoop.u16CycleMs);  // Simulate loop time "5ms"
+   }
+
+   m_MainLoop.cycles_u32++;
+   m_MainLoop.idleUs_u64 += hw_GetTimeUs() - u64WaitStartUs;
+}
+
+/*! \brief Prints cycles and idle time of the main loop */
+static void PrintMainLoopStats(void)
+{
+   uint64_t u64TotalUs = hw_GetTimeUs() - m_MainLoop.startUs_u64;
+   hw_DebugPrint("Main loop (%s, %u ms): %u cycles, %u started by CAN, idle %u.%u %% \n",
+      (m_MainLoop.qEventDriven == ISO_TRUE) ? "event driven" : "fixed", m_MainLoop.u16CycleMs,
+      m_MainLoop.cycles_u32, m_MainLoop.rxWakeUps_u32,
+      (uint32_t)((u64TotalUs > 0u) ? ((m_MainLoop.idleUs_u64 * 100u) / u64TotalUs) : 0u),
+      (uint32_t)((u64TotalUs > 0u) ? (((m_MainLoop.idleUs_u64 * 1000u) / u64TotalUs) % 10u) : 0u));
+}
+
+/*! \brief Prints the receive statistics of all CAN nodes */
+static void PrintCanRxStats(void)
+{
+   uint8_t canNode_u8;
+   for (canNode_u8 = 0u; canNode_u8 < ISO_CAN_NODES; canNode_u8++)
+   {
+      const AppCanRxStats_t* stats_ps = &m_CanRxStats[canNode_u8];
+      hw_DebugPrint("CAN %u rx: %u messages, max. %u per cycle, %u deferred, %u lost \n", canNode_u8,
+         stats_ps->received_u32, stats_ps->maxReceived_u32, stats_ps->deferred_u32, stats_ps->dropped_u32);
+   }
 }
 /*! [Do_ReceiveCanMessages] */
 
@@ -254,8 +439,8 @@ static void Do_ReceiveCanMessages(void)
 
 static void PrintKeyBoard(void)
 {
-   hw_DebugPrint("F1 - \n");
-   hw_DebugPrint("F2 - \n");
+   hw_DebugPrint("F1 - Print cycle time statistics\n");
+   hw_DebugPrint("F2 - Reset cycle time statistics\n");
    hw_DebugPrint("F3 - \n");
    hw_DebugPrint("F4 - VT - Delete stored pool\n");
    hw_DebugPrint("F5 - VT - Pool reload\n");
@@ -273,10 +458,12 @@ static void DoKeyBoard(void)
       switch (c)
       {
       case 59:
-         hw_DebugPrint("F1  \n");
+         hw_DebugPrint("F1 - Cycle time statistics \n");
+         AppCycleStats_Print();
          break;
       case 60:
-         hw_DebugPrint("F2  \n");
+         hw_DebugPrint("F2 - Reset cycle time statistics \n");
+         AppCycleStats_Reset();
          break;
       case 61:
          hw_DebugPrint("F3  \n");
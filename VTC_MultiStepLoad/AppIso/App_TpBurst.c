@@ -0,0 +1,321 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Adaptive number of (E)TP messages per cycle
+
+   \details    Additive increase, multiplicative decrease once per interval:
+               - congestion (bus load above LoadHighPercent or fewer free transmit
+                 slots than the repeat count): halve the repeat count
+               - otherwise: increase it by a quarter (at least one message)
+               The result is limited to the CTS window of the open connections of the
+               ECU (more packets per cycle than granted are not sent anyway), to the
+               free transmit slots and to MinRepeat .. MaxRepeat. \n
+               A connection is opened by an RTS sent by the ECU and closed by the EoMA
+               or an abort. Only CTS messages of the receiver of an open connection,
+               addressed to the ECU, set its window; the transfers of other nodes and
+               finished connections do not.
+*/
+/* ************************************************************************ */
+
+#include <string.h>
+#include "IsoDef.h"
+#include "AppCommon/AppHW.h"
+#include "Settings/settings.h"
+#include "App_TpBurst.h"
+
+/* ************************************************************************ */
+
+#define TPBURST_FRAME_BITS     140u     /*!< extended frame with 8 data bytes incl. stuff bits */
+#define TPBURST_PF_TP_CM       0xECu    /*!< PDU format of TP.CM */
+#define TPBURST_PF_ETP_CM      0xC8u    /*!< PDU format of ETP.CM */
+#define TPBURST_TP_RTS         16u      /*!< control byte of TP.CM_RTS */
+#define TPBURST_TP_CTS         17u      /*!< control byte of TP.CM_CTS */
+#define TPBURST_TP_EOMA        19u      /*!< control byte of TP.CM_EndOfMsgAck */
+#define TPBURST_ETP_RTS        20u      /*!< control byte of ETP.CM_RTS */
+#define TPBURST_ETP_CTS        21u      /*!< control byte of ETP.CM_CTS */
+#define TPBURST_ETP_EOMA       23u      /*!< control byte of ETP.CM_EOMA */
+#define TPBURST_ABORT          255u     /*!< control byte of TP.Conn_Abort and ETP.Conn_Abort */
+#define TPBURST_CONNECTIONS    4u       /*!< tracked (E)TP connections of the ECU per CAN node */
+
+/*! \brief Settings of the controller */
+typedef struct
+{
+   iso_bool qAdaptive;
+   iso_u8   u8StartRepeat;
+   iso_u8   u8MinRepeat;
+   iso_u8   u8MaxRepeat;
+   iso_u8   u8LoadHighPercent;
+   iso_u16  u16IntervalMs;
+   iso_u32  u32Bitrate;
+} AppTpBurstCfg_t;
+
+/*! \brief (E)TP connection sent by the ECU */
+typedef struct
+{
+   iso_u8   u8PduFormat;         /*!< TPBURST_PF_TP_CM or TPBURST_PF_ETP_CM; 0: unused */
+   iso_u8   u8Sa;                /*!< source address of the ECU */
+   iso_u8   u8Da;                /*!< address of the receiver */
+   iso_u8   u8CtsWindow;         /*!< packets granted by the last CTS; 0: no CTS received yet */
+} AppTpBurstConn_t;
+
+/*! \brief Controller state of one CAN node */
+typedef struct
+{
+   iso_u8   u8Repeat;            /*!< current (E)TP messages per cycle */
+   iso_u8   u8CtsWindow;         /*!< largest window of the open connections; 0: none */
+   iso_u8   u8LoadPercent;       /*!< bus load of the last interval */
+   iso_u32  u32Frames;           /*!< frames received and sent in the current interval */
+   iso_s32  s32IntervalStartMs;
+   AppTpBurstConn_t asConn[TPBURST_CONNECTIONS];
+} AppTpBurstNode_t;
+
+static AppTpBurstCfg_t  m_TpBurstCfg;
+static AppTpBurstNode_t m_TpBurstNodes[ISO_CAN_NODES];
+
+static AppTpBurstConn_t* TpBurst_FindConn(AppTpBurstNode_t* psNode, iso_u8 u8PduFormat, iso_u8 u8Sa, iso_u8 u8Da);
+static void TpBurst_CloseConn(AppTpBurstNode_t* psNode, AppTpBurstConn_t* psConn);
+
+/* ************************************************************************ */
+
+iso_s16 AppTpBurst_Init(void)
+{
+   iso_s16 s16Ret = E_NO_ERR;
+   iso_u8  u8I;
+
+   m_TpBurstCfg.qAdaptive = (getU8("TpBurst", "Adaptive", 1u) != 0u) ? ISO_TRUE : ISO_FALSE;
+   m_TpBurstCfg.u8StartRepeat = getU8("TpBurst", "StartRepeat", 5u);
+   m_TpBurstCfg.u8MinRepeat = getU8("TpBurst", "MinRepeat", 2u);
+   m_TpBurstCfg.u8MaxRepeat = getU8("TpBurst", "MaxRepeat", 32u);
+   m_TpBurstCfg.u8LoadHighPercent = getU8("TpBurst", "LoadHighPercent", 70u);
+   m_TpBurstCfg.u16IntervalMs = getU16("TpBurst", "IntervalMs", 50u);
+   m_TpBurstCfg.u32Bitrate = getU32("CanDriver", "Bitrate", 250000uL);
+
+   if ((m_TpBurstCfg.u8MinRepeat == 0u) || (m_TpBurstCfg.u8MaxRepeat < m_TpBurstCfg.u8MinRepeat))
+   {  /* invalid limits */
+      m_TpBurstCfg.u8MinRepeat = 1u;
+      m_TpBurstCfg.u8MaxRepeat = (m_TpBurstCfg.u8MaxRepeat > 0u) ? m_TpBurstCfg.u8MaxRepeat : 1u;
+   }
+   if ((m_TpBurstCfg.u16IntervalMs == 0u) || (m_TpBurstCfg.u32Bitrate == 0uL))
+   {
+      m_TpBurstCfg.qAdaptive = ISO_FALSE;
+   }
+
+   for (u8I = 0u; u8I < ISO_CAN_NODES; u8I++)
+   {  /* set number of (E)TP messages for each cycle (V10: Replaced iso_DlTPRepeatSet() with iso_CoreTPRepeatSet()) */
+      AppTpBurstNode_t* psNode = &m_TpBurstNodes[u8I];
+      iso_s16 s16FnRet;
+      psNode->u8Repeat = (m_TpBurstCfg.qAdaptive == ISO_TRUE)
+                       ? ((m_TpBurstCfg.u8StartRepeat < m_TpBurstCfg.u8MinRepeat) ? m_TpBurstCfg.u8MinRepeat
+                       : (m_TpBurstCfg.u8StartRepeat > m_TpBurstCfg.u8MaxRepeat) ? m_TpBurstCfg.u8MaxRepeat : m_TpBurstCfg.u8StartRepeat)
+                       : m_TpBurstCfg.u8StartRepeat;
+      psNode->u8CtsWindow = 0u;
+      memset(psNode->asConn, 0, sizeof(psNode->asConn));
+      psNode->u8LoadPercent = 0u;
+      psNode->u32Frames = 0uL;
+      psNode->s32IntervalStartMs = hw_GetTimeMs();
+      s16FnRet = iso_CoreTPRepeatSet(u8I, psNode->u8Repeat);
+      s16Ret = (s16Ret == E_NO_ERR) ? s16FnRet : s16Ret;
+   }
+
+   return s16Ret;
+}
+
+void AppTpBurst_CanMsgRec(iso_u8 u8CanNode, iso_u32 u32CanId, const iso_u8 au8Data[], iso_u8 u8DataLength)
+{
+   iso_u8 u8PduFormat = (iso_u8)(u32CanId >> 16u);
+   AppTpBurstNode_t* psNode;
+   AppTpBurstConn_t* psConn;
+
+   if (u8CanNode >= ISO_CAN_NODES)
+   {
+      return;
+   }
+
+   psNode = &m_TpBurstNodes[u8CanNode];
+   psNode->u32Frames++;
+   if (((u8PduFormat != TPBURST_PF_TP_CM) && (u8PduFormat != TPBURST_PF_ETP_CM)) || (u8DataLength < 2u))
+   {
+      return;
+   }
+
+   /* sent by the receiver of a connection of the ECU: SA is the receiver, DA (PS) the ECU */
+   psConn = TpBurst_FindConn(psNode, u8PduFormat, (iso_u8)(u32CanId >> 8u), (iso_u8)u32CanId);
+   if (psConn == 0)
+   {  /* connection of another node, or finished */
+      return;
+   }
+
+   if ((au8Data[0] == TPBURST_TP_CTS) || (au8Data[0] == TPBURST_ETP_CTS))
+   {  /* a CTS with 0 packets holds the connection and does not change the window */
+      if (au8Data[1] > 0u)
+      {
+         psConn->u8CtsWindow = au8Data[1];
+         if (psConn->u8CtsWindow > psNode->u8CtsWindow)
+         {
+            psNode->u8CtsWindow = psConn->u8CtsWindow;
+         }
+      }
+   }
+   else if ((au8Data[0] == TPBURST_TP_EOMA) || (au8Data[0] == TPBURST_ETP_EOMA) || (au8Data[0] == TPBURST_ABORT))
+   {
+      TpBurst_CloseConn(psNode, psConn);
+   }
+   else
+   {
+      /* RTS of the receiver, DPO: no change */
+   }
+}
+
+void AppTpBurst_CanMsgSent(iso_u8 u8CanNode, iso_u32 u32CanId, const iso_u8 au8Data[], iso_u8 u8DataLength)
+{
+   iso_u8 u8PduFormat = (iso_u8)(u32CanId >> 16u);
+   iso_u8 u8Sa = (iso_u8)u32CanId;
+   iso_u8 u8Da = (iso_u8)(u32CanId >> 8u);
+   AppTpBurstNode_t* psNode;
+   AppTpBurstConn_t* psConn;
+   iso_u8 u8I;
+
+   if (u8CanNode >= ISO_CAN_NODES)
+   {
+      return;
+   }
+
+   psNode = &m_TpBurstNodes[u8CanNode];
+   psNode->u32Frames++;
+   if (((u8PduFormat != TPBURST_PF_TP_CM) && (u8PduFormat != TPBURST_PF_ETP_CM)) || (u8DataLength < 1u))
+   {
+      return;
+   }
+
+   psConn = TpBurst_FindConn(psNode, u8PduFormat, u8Sa, u8Da);
+   if ((au8Data[0] == TPBURST_TP_RTS) || (au8Data[0] == TPBURST_ETP_RTS))
+   {  /* new connection, or the RTS of a connection is repeated */
+      for (u8I = 0u; (psConn == 0) && (u8I < TPBURST_CONNECTIONS); u8I++)
+      {
+         if (psNode->asConn[u8I].u8PduFormat == 0u)
+         {
+            psConn = &psNode->asConn[u8I];
+         }
+      }
+      /* more connections than TPBURST_CONNECTIONS: the CTS of the others are ignored */
+      if (psConn != 0)
+      {
+         TpBurst_CloseConn(psNode, psConn);
+         psConn->u8PduFormat = u8PduFormat;
+         psConn->u8Sa = u8Sa;
+         psConn->u8Da = u8Da;
+      }
+   }
+   else if ((au8Data[0] == TPBURST_ABORT) && (psConn != 0))
+   {
+      TpBurst_CloseConn(psNode, psConn);
+   }
+   else
+   {
+      /* BAM, DPO, CTS and EoMA of connections received by the ECU: no change */
+   }
+}
+
+void AppTpBurst_Cyclic(void)
+{
+   iso_s32 s32TimeMs = hw_GetTimeMs();
+   iso_u8  u8I;
+
+   if (m_TpBurstCfg.qAdaptive != ISO_TRUE)
+   {
+      return;
+   }
+
+   for (u8I = 0u; u8I < ISO_CAN_NODES; u8I++)
+   {
+      AppTpBurstNode_t* psNode = &m_TpBurstNodes[u8I];
+      iso_s32 s32ElapsedMs = s32TimeMs - psNode->s32IntervalStartMs;
+      iso_s16 s16Free;
+      uint64_t u64Load;
+      iso_u32 u32Repeat;
+
+      if (s32ElapsedMs < (iso_s32)m_TpBurstCfg.u16IntervalMs)
+      {
+         continue;
+      }
+
+      /* bus load in percent: frame bits of the interval / bits transferable in the interval;
+         64 bit, as the frames of a long interval (e.g. after a stalled cycle) overflow 32 bit */
+      u64Load = ((uint64_t)psNode->u32Frames * TPBURST_FRAME_BITS * 100u)
+              / ((uint64_t)(m_TpBurstCfg.u32Bitrate / 1000uL) * (iso_u32)s32ElapsedMs);
+      psNode->u8LoadPercent = (u64Load > 100u) ? 100u : (iso_u8)u64Load;
+      psNode->u32Frames = 0uL;
+      psNode->s32IntervalStartMs = s32TimeMs;
+
+      s16Free = hw_CanGetFreeSendMsgBufferSize(u8I);
+      if ((psNode->u8LoadPercent > m_TpBurstCfg.u8LoadHighPercent) || (s16Free < (iso_s16)psNode->u8Repeat))
+      {  /* congestion */
+         u32Repeat = psNode->u8Repeat / 2u;
+      }
+      else
+      {
+         u32Repeat = psNode->u8Repeat + ((psNode->u8Repeat >= 8u) ? (psNode->u8Repeat / 4u) : 1u);
+         if ((psNode->u8CtsWindow > 0u) && (u32Repeat > psNode->u8CtsWindow))
+         {
+            u32Repeat = psNode->u8CtsWindow;
+         }
+         if ((s16Free > 0) && (u32Repeat > (iso_u32)s16Free))
+         {
+            u32Repeat = (iso_u32)s16Free;
+         }
+      }
+
+      u32Repeat = (u32Repeat < m_TpBurstCfg.u8MinRepeat) ? m_TpBurstCfg.u8MinRepeat
+                : (u32Repeat > m_TpBurstCfg.u8MaxRepeat) ? m_TpBurstCfg.u8MaxRepeat : u32Repeat;
+      if (u32Repeat != psNode->u8Repeat)
+      {
+         psNode->u8Repeat = (iso_u8)u32Repeat;
+         (void)iso_CoreTPRepeatSet(u8I, psNode->u8Repeat);
+         hw_DebugTrace("TpBurst %u: %u messages per cycle (load %u %%, CTS window %u, free %d) \n",
+            u8I, psNode->u8Repeat, psNode->u8LoadPercent, psNode->u8CtsWindow, s16Free);
+      }
+   }
+}
+
+/*! \brief Returns the open connection from u8Sa (ECU) to u8Da; 0: none */
+static AppTpBurstConn_t* TpBurst_FindConn(AppTpBurstNode_t* psNode, iso_u8 u8PduFormat, iso_u8 u8Sa, iso_u8 u8Da)
+{
+   iso_u8 u8I;
+   for (u8I = 0u; u8I < TPBURST_CONNECTIONS; u8I++)
+   {
+      AppTpBurstConn_t* psConn = &psNode->asConn[u8I];
+      if ((psConn->u8PduFormat == u8PduFormat) && (psConn->u8Sa == u8Sa) && (psConn->u8Da == u8Da))
+      {
+         return psConn;
+      }
+   }
+   return 0;
+}
+
+/*! \brief Releases the connection and recomputes the window of the node */
+static void TpBurst_CloseConn(AppTpBurstNode_t* psNode, AppTpBurstConn_t* psConn)
+{
+   iso_u8 u8I;
+   memset(psConn, 0, sizeof(*psConn));
+   psNode->u8CtsWindow = 0u;
+   for (u8I = 0u; u8I < TPBURST_CONNECTIONS; u8I++)
+   {
+      if (psNode->asConn[u8I].u8CtsWindow > psNode->u8CtsWindow)
+      {
+         psNode->u8CtsWindow = psNode->asConn[u8I].u8CtsWindow;
+      }
+   }
+}
+
+void AppTpBurst_Print(void)
+{
+   iso_u8 u8I;
+   for (u8I = 0u; u8I < ISO_CAN_NODES; u8I++)
+   {
+      const AppTpBurstNode_t* psNode = &m_TpBurstNodes[u8I];
+      hw_DebugPrint("CAN %u TP burst: %u messages per cycle (%s), CTS window %u, load %u %% \n", u8I, psNode->u8Repeat,
+         (m_TpBurstCfg.qAdaptive == ISO_TRUE) ? "adaptive" : "fixed", psNode->u8CtsWindow, psNode->u8LoadPercent);
+   }
+}
+
+/* ************************************************************************ */
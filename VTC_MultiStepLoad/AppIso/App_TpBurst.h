@@ -0,0 +1,50 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Adaptive number of (E)TP messages per cycle (iso_CoreTPRepeatSet())
+
+   \details    The repeat count of each CAN node follows the free transmit slots,
+               the window of the last CTS and the measured bus load: it grows while
+               the bus and the transmit queue have room and is halved on congestion.
+               Settings section "TpBurst":
+               - Adaptive: 0: fixed StartRepeat (previous behaviour), 1: adaptive
+               - StartRepeat, MinRepeat, MaxRepeat: (E)TP messages per cycle
+               - LoadHighPercent: bus load above which the repeat count is reduced
+               - IntervalMs: control interval
+               The bit rate is read from section "CanDriver", key "Bitrate".
+*/
+/* ************************************************************************ */
+
+#ifndef APP_TPBURST_H
+#define APP_TPBURST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ************************************************************************ */
+/*!
+   \brief  Reads the settings and sets the start repeat count of all CAN nodes
+   \return E_NO_ERR or the error of iso_CoreTPRepeatSet()
+*/
+iso_s16 AppTpBurst_Init(void);
+
+/*! \brief Counts a received CAN message and records the CTS window of the (E)TP connections of the ECU */
+void AppTpBurst_CanMsgRec(iso_u8 u8CanNode, iso_u32 u32CanId, const iso_u8 au8Data[], iso_u8 u8DataLength);
+
+/*! \brief Counts a CAN message accepted by the CAN driver and tracks the (E)TP connections opened by it */
+void AppTpBurst_CanMsgSent(iso_u8 u8CanNode, iso_u32 u32CanId, const iso_u8 au8Data[], iso_u8 u8DataLength);
+
+/*! \brief Adjusts the repeat counts once per control interval */
+void AppTpBurst_Cyclic(void);
+
+/*! \brief Prints the current repeat count, CTS window and bus load of all CAN nodes */
+void AppTpBurst_Print(void);
+
+/* ************************************************************************ */
+#ifdef __cplusplus
+} /* end of extern "C" */
+#endif
+
+#endif /* APP_TPBURST_H */
+/* ************************************************************************ */
@@ -23,6 +23,7 @@
 #include "Settings/settings.h"
 #include "AppMemAccess.h"
 #include "AppCommon/AppOutput.h"
+#include "AppCommon/AppLog.h"
 
 #include "App_VTClient.h"
 
@@ -109,14 +110,14 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
       VTC_setNewVT();
       break;
    case IsoEvMaskServerVersAvailable:
-       iso_DebugPrint("cf(%04X), IsoEvMaskServerVersAvailable(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskServerVersAvailable(%d)\n", vtHandle, psEvData->eEvent);
       if (IsoGetVTStatusInfo(VT_VERSIONNR) >= 4u)
       {
          // IsoVTObjTypeParsableSet(PNGObject);  // for test purposes (must be called here)
       }
       break;
    case IsoEvMaskLanguageCmd:
-       iso_DebugPrint("cf(%04X), IsoEvMaskLanguageCmd(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskLanguageCmd(%d)\n", vtHandle, psEvData->eEvent);
        if (m_primaryVt.initialized)
        {
            IsoReadWorkingSetLanguageData(s16_CfHndVtClient, abLCData);
@@ -128,7 +129,7 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
        }
       break;
    case IsoEvMaskTechDataV4Request:
-       iso_DebugPrint("cf(%04X), IsoEvMaskTechDataV4Request(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskTechDataV4Request(%d)\n", vtHandle, psEvData->eEvent);
       /* If VT >= V4 then application can request some more technical data */
       if (IsoGetVTStatusInfo(VT_VERSIONNR) >= 4u)
       {
@@ -138,7 +139,7 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
       }
       break;
    case IsoEvMaskLoadObjects:
-       iso_DebugPrint("cf(%04X), IsoEvMaskLoadObjects(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskLoadObjects(%d) %d ms after start\n", vtHandle, psEvData->eEvent, (int)iso_BaseGetTimeMs());
        AppPoolSettings(ISO_FALSE, &m_primaryVt);
       {  /* Current VT and boot time of VT can be read and stored here in EEPROM */
          iso_s16 s16HndCurrentVT = (iso_s16)IsoGetVTStatusInfo(VT_HND);   /* get CF handle of actual VT */
@@ -162,27 +163,28 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
       }
       break;
    case IsoEvMaskReadyToStore:
-       iso_DebugPrint("cf(%04X), IsoEvMaskReadyToStore(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskReadyToStore(%d)\n", vtHandle, psEvData->eEvent);
       /* pool upload finished - here we can change objects values which should be stored */
       VTC_SetObjValuesBeforeStore();
       break;
    case IsoEvMaskActivated:
-       iso_DebugPrint("cf(%04X), IsoEvMaskActivated(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskActivated(%d)\n", vtHandle, psEvData->eEvent);
        /* pool is ready - here we can setup the initial mask and data which should be displayed */
        //iso_DebugPrint("IsoEvMaskActivated: %x\n", vt.transferLanguage);
        updateTick = iso_BaseGetTimeMs();
+       vtcPoolTelemetryEvent(&m_primaryVt, vtcEvPoolActivated, 0U, 0U);
        vtcPoolLoadHandler(&m_primaryVt);
       break;
    case IsoEvMaskTick:  // Cyclic event; Called only after successful login
        if (m_primaryVt.m_retryPoolLoad != ISO_FALSE)
        {
-           iso_DebugPrint("cf(%04X), IsoEvMaskTick -- pool load handler(%d)\n", vtHandle, psEvData->eEvent);
+           APP_LOG_DEBUG(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskTick -- pool load handler(%d)\n", vtHandle, psEvData->eEvent);
            vtcPoolLoadHandler(&m_primaryVt);
        }
 
        if (m_primaryVt.m_activeLanguage == lcBase)
        {
-           iso_DebugPrint("cf(%04X), IsoEvMaskTick -- update progress(%d)\n", vtHandle, psEvData->eEvent);
+           APP_LOG_DEBUG(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskTick -- update progress(%d)\n", vtHandle, psEvData->eEvent);
            iso_u32 tick = iso_BaseGetTimeMs();
            iso_u32 deltaTick = tick - updateTick;
            if (deltaTick > 1000)
@@ -195,22 +197,22 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
       AppVTClientDoProcess();   // Sending of commands etc. for mask instance
       break;
    case IsoEvMaskLoginAborted:
-       iso_DebugPrint("cf(%04X), IsoEvMaskLoginAborted(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskLoginAborted(%d)\n", vtHandle, psEvData->eEvent);
       // Login failed - application has to decide if login shall be repeated and how often
       //AppVTClientLogin(s16_CfHndVtClient);
       break;
    case IsoEvConnSafeState:
-       iso_DebugPrint("cf(%04X), IsoEvConnSafeState(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvConnSafeState(%d)\n", vtHandle, psEvData->eEvent);
        // invalidate pool information
         vtcPoolClear(&m_primaryVt);
         vtcPoolClear(&m_auxVt);
       // Connection closed ( VT lost, VT_LOGOUT (delete object pool response was received ) )
       break;
    case IsoEvAuxServerVersAvailable:
-       iso_DebugPrint("cf(%04X), IsoEvAuxServerVersAvailable(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxServerVersAvailable(%d)\n", vtHandle, psEvData->eEvent);
       break;
    case IsoEvAuxLanguageCmd:
-       iso_DebugPrint("cf(%04X), IsoEvAuxLanguageCmd(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxLanguageCmd(%d)\n", vtHandle, psEvData->eEvent);
        if (m_auxVt.initialized)
        {
            IsoReadWorkingSetLanguageData(s16_CfHndVtClient, abLCData);
@@ -219,26 +221,27 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
       //IsoClServ_ReadLCOfServer( , );
       break;
    case IsoEvAuxTechDataV4Request:
-       iso_DebugPrint("cf(%04X), IsoEvAuxTechDataV4Request(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxTechDataV4Request(%d)\n", vtHandle, psEvData->eEvent);
       break;
    case IsoEvAuxLoadObjects:
-       iso_DebugPrint("cf(%04X), IsoEvAuxLoadObjects(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxLoadObjects(%d)\n", vtHandle, psEvData->eEvent);
        AppPoolSettings(ISO_TRUE, &m_auxVt);
       break;
    case IsoEvAuxActivated:
-       iso_DebugPrint("cf(%04X), IsoEvAuxActivated(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxActivated(%d)\n", vtHandle, psEvData->eEvent);
        updateTick = iso_BaseGetTimeMs();
+       vtcPoolTelemetryEvent(&m_auxVt, vtcEvPoolActivated, 0U, 0U);
        vtcPoolLoadHandler(&m_auxVt);
       break;
    case IsoEvAuxTick:
        if (m_auxVt.m_retryPoolLoad != ISO_FALSE)
        {
-           iso_DebugPrint("cf(%04X), IsoEvAuxTick -- pool load handler(%d)\n", vtHandle, psEvData->eEvent);
+           APP_LOG_DEBUG(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxTick -- pool load handler(%d)\n", vtHandle, psEvData->eEvent);
            vtcPoolLoadHandler(&m_auxVt);
        }
       break;
    case IsoEvAuxLoginAborted:
-       iso_DebugPrint("cf(%04X), IsoEvAuxLoginAborted(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvAuxLoginAborted(%d)\n", vtHandle, psEvData->eEvent);
       // Login failed - application has to decide if login shall be repeated and how often
       break;
 
@@ -246,12 +249,13 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
        //iso_DebugPrint("cf(%04X), IsoEvAuxStateChanged(%d, %d)\n", vtHandle, psEvData->eEvent, IsoGetVTStatusInfo(VT_STATEOFANNOUNCING));
        break;
    case IsoEvAuxPoolReloadFinished:
-       iso_DebugPrint("cf(%04X), language(%04X), IsoEvAuxPoolReloadFinished(%d)\n", vtHandle, m_auxVt.m_transferLanguage, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), language(%04X), IsoEvAuxPoolReloadFinished(%d)\n", vtHandle, m_auxVt.m_transferLanguage, psEvData->eEvent);
        //iso_DebugPrint("IsoEvAuxPoolReloadFinished: %x\n", vt.transferLanguage);
+       vtcPoolTelemetryEvent(&m_auxVt, vtcEvPoolReloadFinished, 0U, 0U);
        break;
 
     case IsoEvMaskPoolReloadFinished:
-        iso_DebugPrint("cf(%04X), IsoEvMaskPoolReloadFinished(%d)\n", vtHandle, psEvData->eEvent);
+        APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), IsoEvMaskPoolReloadFinished(%d)\n", vtHandle, psEvData->eEvent);
         //iso_DebugPrint("IsoEvMaskPoolReloadFinished: %x\n", vt.transferLanguage);
         if (m_primaryVt.initialized == ISO_FALSE)
         {
@@ -261,11 +265,12 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
         {
             if (m_primaryVt.m_activeLanguage != lcUndefined)
             {
+                vtcPoolTelemetryEvent(&m_primaryVt, vtcEvPoolReloadFinished, 0U, 0U);
                 vtcPoolLoadHandler(&m_primaryVt);
             }
             else
             {
-                iso_DebugPrint("IsoEvMaskPoolReloadFinished???\n");
+                APP_LOG_WARN(APP_LOG_MOD_VTC, "IsoEvMaskPoolReloadFinished???\n");
             }
         }
         break;
@@ -275,7 +280,7 @@ static void CbVtConnCtrl(const ISOVT_EVENT_DATA_T* psEvData)
         break;
 
    default: 
-       iso_DebugPrint("cf(%04X), event(%d)\n", vtHandle, psEvData->eEvent);
+       APP_LOG_INFO(APP_LOG_MOD_VTC, "cf(%04X), event(%d)\n", vtHandle, psEvData->eEvent);
        break;
    }
 }
@@ -312,11 +317,12 @@ static void AppPoolSettings( iso_bool auxVT, struct VTCPool* vtcPool )
         vtcPoolGetPoolLabel(vtcPool->m_transferLanguage, actPoolLabel);
     }
 
-    iso_DebugPrint("pool %s\n", actPoolLabel);
+    APP_LOG_INFO(APP_LOG_MOD_POOL, "pool %s\n", actPoolLabel);
 
     (void)IsoPoolInit((iso_u8*)actPoolLabel, poolData, 0,       // Version, PoolAddress, ( PoolSize not needed ) 
         u16NumberObjects, colour_256,      // Number of objects, Graphic typ, 
         ISO_DESIGNATOR_WIDTH, ISO_DESIGNATOR_HEIGHT, ISO_MASK_SIZE);                   // SKM width and height, DM res.
+    vtcPoolTelemetryEvent(vtcPool, vtcEvLoadObjects, u32PoolSize, u16NumberObjects);
 
    // Set pool manipulations
    vtcPoolSetPoolManipulation();
@@ -568,7 +574,7 @@ static void CbAuxPrefAssignment(VT_AUXAPP_T asAuxAss[], iso_s16* ps16MaxNumberOf
 
    /* Reading stored preferred assignment */
 //   s16NumbOfPrefAssigns = IsoAuxReadAssignOfFile(asPrefAss);
-   s16NumbOfPrefAssigns = getAuxAssignment("CF-A-AuxAssignment", asPrefAss);
+   s16NumbOfPrefAssigns = getAuxAssignment("CF-A-AuxAssignment", asPrefAss, (iso_u16)(sizeof(asPrefAss) / sizeof(asPrefAss[0])));
 
    for (s16I = 0; s16I < s16NumbOfPrefAssigns; s16I++)
    {
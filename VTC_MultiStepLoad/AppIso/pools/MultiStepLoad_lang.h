@@ -0,0 +1,34 @@
+// Generated by tools/PoolSplitter/LanguagePools from JetViewERS.cfg
+// Do not change!
+
+#ifndef MULTISTEPLOAD_LANG_H
+#define MULTISTEPLOAD_LANG_H
+
+#define MultiStepLoad_lang_de_Size 24
+#define MultiStepLoad_lang_de_NumObjs 1
+
+// the default language is provided by the secondary pool
+#define MultiStepLoad_DefaultLanguage (('e' << 8) + 'n')
+
+extern const unsigned char MultiStepLoad_lang_de[MultiStepLoad_lang_de_Size];
+
+// VT language besides the default language; its delta pool is loaded after the secondary pool.
+struct PoolLanguage
+{
+    unsigned short languageCode;        // VT language
+    unsigned char fallback;             // index of the language used instead; MultiStepLoad_NoLanguage: default language
+    const unsigned char* pool;          // delta pool; 0: the pool of the fallback language is used
+    unsigned long size;
+    unsigned short numObjs;
+};
+
+#define MultiStepLoad_LanguageCount 2
+#define MultiStepLoad_NoLanguage 0xFF
+
+extern const struct PoolLanguage MultiStepLoad_languages[MultiStepLoad_LanguageCount];
+
+// index of a language code within MultiStepLoad_languages; MultiStepLoad_NoLanguage: not supported
+// [first letter - 'a'][second letter - 'a']
+extern const unsigned char MultiStepLoad_languageIndex[26][26];
+
+#endif
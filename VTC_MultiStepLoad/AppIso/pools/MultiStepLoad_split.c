@@ -0,0 +1,8882 @@
+// Generated by tools/PoolSplitter from MultiStepLoad.c
+// Do not change!
+
+#include "MultiStepLoad_split.h"
+
+const unsigned char MultiStepLoad_base[MultiStepLoad_base_Size] = {
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xe8, 0x03, 0x01, 0x00, 0x02, 0x20, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x64, 0x65, 0xe8, 0x03, 0x01, 0x01,
+    0xff, 0xff, 0x1b, 0x00, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4e,
+    0x00, 0x00, 0xff, 0xff, 0xf8, 0x2a, 0x05, 0x00, 0x14, 0x00, 0xf9, 0x2a,
+    0x08, 0x00, 0xb4, 0x00, 0xfa, 0x2a, 0x6c, 0x00, 0xb4, 0x00, 0xfb, 0x2a,
+    0x6c, 0x00, 0xbe, 0x00, 0xfc, 0x2a, 0x08, 0x00, 0xbe, 0x00, 0xb3, 0x36,
+    0x05, 0x00, 0x2f, 0x00, 0xb9, 0x0b, 0x0a, 0x00, 0x31, 0x00, 0xba, 0x0b,
+    0x1c, 0x00, 0x31, 0x00, 0xbb, 0x0b, 0x2e, 0x00, 0x31, 0x00, 0xbc, 0x0b,
+    0x40, 0x00, 0x31, 0x00, 0xbd, 0x0b, 0x52, 0x00, 0x31, 0x00, 0xbe, 0x0b,
+    0x64, 0x00, 0x31, 0x00, 0xbf, 0x0b, 0x76, 0x00, 0x31, 0x00, 0xc0, 0x0b,
+    0x88, 0x00, 0x31, 0x00, 0xc1, 0x0b, 0x9a, 0x00, 0x31, 0x00, 0xc2, 0x0b,
+    0xac, 0x00, 0x31, 0x00, 0xfd, 0x2a, 0x08, 0x00, 0x7d, 0x00, 0xfe, 0x2a,
+    0x08, 0x00, 0x87, 0x00, 0xff, 0x2a, 0x08, 0x00, 0x91, 0x00, 0x00, 0x2b,
+    0x6c, 0x00, 0x87, 0x00, 0x01, 0x2b, 0x6c, 0x00, 0x91, 0x00, 0x02, 0x2b,
+    0x08, 0x00, 0x9b, 0x00, 0x03, 0x2b, 0x6c, 0x00, 0x9b, 0x00, 0x04, 0x2b,
+    0x08, 0x00, 0xaa, 0x00, 0xe0, 0x2e, 0x32, 0x00, 0x3c, 0x00, 0xb9, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xbd, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x2a, 0x0b, 0xbe, 0x00, 0x13, 0x00, 0x00, 0xdc, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x20,
+    0x53, 0x74, 0x65, 0x70, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x00, 0xf9, 0x2a,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xdd, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x08, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xfa,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xde, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x30, 0x2e, 0x31, 0x20, 0x00, 0xfb, 0x2a, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xdf, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00,
+    0x31, 0x30, 0x2e, 0x31, 0x32, 0x2e, 0x32, 0x30, 0x31, 0x39, 0x00, 0xfc,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe0, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x05, 0x00, 0x44, 0x61, 0x74, 0x65, 0x3a, 0x00, 0xfd, 0x2a, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe1, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x56, 0x54, 0x20, 0x20, 0x00, 0xfe, 0x2a, 0x0b, 0x5a, 0x00, 0x09,
+    0x00, 0x00, 0xe2, 0x59, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x56, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xff, 0x2a, 0x0b, 0x5a, 0x00,
+    0x09, 0x00, 0x00, 0xe3, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0b, 0x00, 0x52,
+    0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0x00,
+    0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe4, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x34, 0x20, 0x20, 0x20, 0x00, 0x01, 0x2b, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xe5, 0x59, 0x00, 0xff, 0xff, 0x00, 0x09, 0x00,
+    0x34, 0x38, 0x30, 0x20, 0x78, 0x20, 0x34, 0x38, 0x30, 0x00, 0x02, 0x2b,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe6, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x09, 0x00, 0x4c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a, 0x00,
+    0x03, 0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe7, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0x00, 0x65, 0x6e, 0x20, 0x20, 0x00, 0x04, 0x2b, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe8, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0xe0, 0x2e, 0x0c, 0x64, 0x00, 0x09,
+    0x00, 0x01, 0xe9, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x01, 0x00, 0xb3,
+    0x36, 0x0e, 0xc2, 0x5d, 0xbe, 0x00, 0x0a, 0x00, 0x00, 0xa9, 0x61, 0x00,
+    0xb4, 0x36, 0x0e, 0xc3, 0x5d, 0x12, 0x00, 0x07, 0x00, 0x00, 0xaa, 0x61,
+    0x00, 0x20, 0x4e, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x80, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x38, 0xe6, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3c, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3f, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x87, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0xf1, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0xfc, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x3c, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x1c, 0xe6, 0x7f,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x01, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfb, 0xd8, 0x31, 0x78, 0x3f, 0xff, 0xf0, 0xff, 0xfb,
+    0xd7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb, 0xd0, 0x1a, 0xb7, 0xdf,
+    0xff, 0xf0, 0xff, 0xfb, 0xd7, 0xfa, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb,
+    0xb7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xf0, 0x78, 0x32, 0x98, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x21, 0x4e,
+    0x14, 0xc8, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x04, 0x01, 0x66, 0x18,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x7f, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x04, 0x00, 0x01, 0x18, 0x03,
+    0x00, 0x01, 0x07, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01, 0xf0, 0x04, 0x00, 0x01,
+    0x1c, 0x03, 0x00, 0x01, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x01, 0xfe, 0x0b,
+    0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0xf8, 0x03, 0x00, 0x02, 0xff, 0x05,
+    0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x07, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xe0, 0x0a, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x01, 0xc0, 0x02, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0a, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x1f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x02,
+    0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x07, 0x03, 0xff, 0x0a, 0x00, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x04, 0xff, 0x03,
+    0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x08,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x03, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xfc, 0x01, 0x00, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x03, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x01, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x03, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3e, 0x09,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x60, 0x02, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x30, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x40, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x08, 0x09, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xe0, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x02, 0xff, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xe0, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x02, 0xff, 0x01,
+    0xfc, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x03, 0xff, 0x01,
+    0x80, 0x06, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0x80, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xf0, 0x06, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x02,
+    0xff, 0x01, 0xfc, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03,
+    0xff, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xc0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xe0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf8, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x02, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x03,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x04,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x08, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3c, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xfe, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x01, 0x02, 0xff, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xfe, 0x01, 0x01, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x07, 0x05, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfe, 0x01, 0x00, 0x01,
+    0x07, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xe0, 0x09, 0x00, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01,
+    0xfe, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x02, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x09, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x0a, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x02, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01,
+    0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xc0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x0c, 0x00, 0x01,
+    0x03, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0xff,
+    0x00, 0xff, 0x00, 0x0d, 0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e,
+    0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x7c, 0x01, 0x00, 0x01, 0x3c, 0x01,
+    0x00, 0x01, 0x0f, 0x02, 0x00, 0x01, 0xe0, 0x01, 0x78, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0x80, 0x01, 0x78, 0x01, 0x01, 0x01, 0xe0, 0x07, 0x00, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x3c, 0x01, 0x00, 0x01, 0x03, 0x01,
+    0xc0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x7f, 0x01, 0xc0, 0x01, 0x7b, 0x01, 0xf9, 0x01, 0xfe, 0x01,
+    0x00, 0x01, 0x03, 0x01, 0x9f, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01, 0xbe, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x0f, 0x01, 0xf0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc1, 0x01, 0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x7f, 0x01,
+    0xfd, 0x01, 0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xbf, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x3e, 0x01, 0x07, 0x01, 0x80, 0x01,
+    0x1e, 0x01, 0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xbe, 0x02,
+    0x3c, 0x01, 0x1f, 0x01, 0xfc, 0x1d, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0x83, 0x01, 0xff, 0x01, 0xe1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x3f, 0x01, 0xfe, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xfe, 0x01, 0x3c, 0x01,
+    0x7c, 0x01, 0x3f, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x03, 0x01,
+    0xc3, 0x02, 0xe0, 0x01, 0xf0, 0x01, 0x7e, 0x01, 0x3f, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1c, 0x01,
+    0x3e, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xe0, 0x01, 0x3c, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x38, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xc1, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x10, 0x02, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0xf0, 0x01, 0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01,
+    0x1e, 0x02, 0x0e, 0x01, 0x00, 0x01, 0x0e, 0x01, 0x3f, 0x01, 0x8e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01,
+    0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3f, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xe0, 0x01,
+    0x3e, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x87, 0x01, 0xe0, 0x01,
+    0x03, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x7e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01,
+    0x3f, 0x01, 0x80, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x7f, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xfe, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01,
+    0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x1f, 0x01, 0xe0, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x7f, 0x01, 0xfe, 0x01, 0x07, 0x01, 0x1c, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0x3b, 0x01, 0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01,
+    0x3f, 0x01, 0xc0, 0x01, 0x0f, 0x01, 0xf8, 0x1e, 0x00, 0x01, 0x3c, 0x01,
+    0x07, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfc, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01,
+    0x78, 0x01, 0x7f, 0x01, 0x9e, 0x01, 0x07, 0x01, 0x9c, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0x39, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01,
+    0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xfc, 0x1e, 0x00, 0x01,
+    0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01,
+    0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xbc, 0x01,
+    0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xfc, 0x1e,
+    0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01,
+    0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x03, 0x01, 0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0xf1, 0x01, 0xfc, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xc0, 0x01,
+    0x43, 0x01, 0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x7c, 0x01,
+    0x1e, 0x01, 0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01,
+    0xf8, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x78, 0x01, 0x10, 0x02, 0x3c, 0x1d, 0x00, 0x01, 0x3c, 0x01, 0x43, 0x03,
+    0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3c, 0x01, 0x3e, 0x01,
+    0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01, 0xf8, 0x01,
+    0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0x7c, 0x03,
+    0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe3, 0x01, 0xff, 0x01, 0xe1, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3f, 0x01, 0xfe, 0x01,
+    0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf0, 0x01, 0xf8, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xc0, 0x02, 0x3c, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe1, 0x01, 0xff, 0x01,
+    0xe1, 0x01, 0xff, 0x01, 0x70, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x3f, 0x01,
+    0xee, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf8, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x3f, 0x01, 0xf8, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x1f, 0x01,
+    0xc0, 0x01, 0xff, 0x01, 0x80, 0x01, 0xfe, 0x01, 0x70, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xdf, 0x01, 0xc0, 0x01,
+    0x78, 0x01, 0x1f, 0x01, 0xce, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xe0, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0x7c, 0x02, 0x1f, 0x01, 0xf0, 0x01, 0x3c, 0x1d, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x10, 0x05, 0x00, 0x01,
+    0x03, 0x01, 0xc7, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xe0, 0x05, 0x00, 0x01, 0xf0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x28,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0x80, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x35, 0x00, 0x01,
+    0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x6b, 0x00, 0xdc, 0x59, 0x17,
+    0x01, 0x03, 0x00, 0x00, 0x00, 0xdd, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xde, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe1, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe4, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe7, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x59, 0x17, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xc2, 0x5d, 0x18, 0x01, 0x00, 0xff, 0xff, 0x00, 0xc3, 0x5d, 0x18,
+    0x01, 0x00, 0xff, 0xff, 0x00, 0xa9, 0x61, 0x19, 0x02, 0x07, 0xff, 0xff,
+    0x00, 0xaa, 0x61, 0x19, 0x02, 0x01, 0xff, 0xff, 0x00, 0x48, 0x71, 0x1f,
+    0x01, 0x00, 0x00, 0x49, 0x71, 0x1f, 0x01, 0x00, 0x00, 0x4a, 0x71, 0x1f,
+    0x01, 0x02, 0x00, 0x4b, 0x71, 0x1f, 0x01, 0x02, 0x00, 0x4c, 0x71, 0x1f,
+    0x01, 0x00, 0x00,
+}; // MultiStepLoad_base
+
+const unsigned char MultiStepLoad_secondary[MultiStepLoad_secondary_Size] = {
+    0x03, 0x00, 0x1c, 0x08, 0x00, 0xad, 0x00, 0x00, 0xe8, 0x03, 0xff, 0xff,
+    0xff, 0xe9, 0x03, 0x01, 0x01, 0xa1, 0x0f, 0x0e, 0x00, 0x5c, 0x2b, 0x07,
+    0x00, 0x06, 0x00, 0x50, 0x46, 0x0b, 0x00, 0x31, 0x00, 0x5d, 0x2b, 0x4c,
+    0x00, 0x0c, 0x00, 0x5e, 0x2b, 0x2d, 0x00, 0x37, 0x00, 0x5f, 0x2b, 0x2b,
+    0x00, 0xa8, 0x00, 0x44, 0x2f, 0x07, 0x00, 0x9f, 0x00, 0x45, 0x2f, 0x84,
+    0x00, 0x38, 0x00, 0x5d, 0x2f, 0x84, 0x00, 0x23, 0x00, 0xbd, 0x1b, 0x8b,
+    0x00, 0xa3, 0x00, 0x3a, 0x0c, 0x9d, 0x00, 0x80, 0x00, 0x60, 0x2b, 0x2f,
+    0x00, 0x84, 0x00, 0xbe, 0x1b, 0x8b, 0x00, 0xb1, 0x00, 0xbc, 0x1b, 0x9e,
+    0x00, 0x4e, 0x00, 0x21, 0x0c, 0x2c, 0x00, 0x61, 0x00, 0xea, 0x03, 0x01,
+    0x01, 0xaa, 0x0f, 0x10, 0x00, 0x94, 0x0c, 0x03, 0x00, 0x35, 0x00, 0xc0,
+    0x2b, 0x0a, 0x00, 0x04, 0x00, 0xc1, 0x2b, 0x0a, 0x00, 0x14, 0x00, 0xc2,
+    0x2b, 0x0a, 0x00, 0x24, 0x00, 0xc3, 0x2b, 0x07, 0x00, 0xab, 0x00, 0xa8,
+    0x2f, 0x10, 0x00, 0xb8, 0x00, 0xeb, 0x4e, 0x72, 0x00, 0x9a, 0x00, 0xec,
+    0x4e, 0x7e, 0x00, 0x9a, 0x00, 0xed, 0x4e, 0x51, 0x00, 0x99, 0x00, 0xfc,
+    0x4e, 0x4b, 0x00, 0x40, 0x00, 0xfd, 0x4e, 0x6b, 0x00, 0x40, 0x00, 0xfe,
+    0x4e, 0x8b, 0x00, 0x40, 0x00, 0xff, 0x4e, 0xa9, 0x00, 0x40, 0x00, 0xb1,
+    0x36, 0x6e, 0x00, 0x98, 0x00, 0x01, 0x4f, 0x99, 0x00, 0xa4, 0x00, 0x40,
+    0x51, 0xa5, 0x00, 0xaa, 0x00, 0xeb, 0x03, 0x01, 0x01, 0xa3, 0x0f, 0x09,
+    0x00, 0x84, 0x1c, 0x46, 0x00, 0x0c, 0x00, 0x20, 0x1c, 0x0e, 0x00, 0x09,
+    0x00, 0xc8, 0x32, 0x06, 0x00, 0x2d, 0x00, 0xb0, 0x36, 0x69, 0x00, 0x64,
+    0x00, 0x98, 0x3a, 0x0e, 0x00, 0x41, 0x00, 0xac, 0x3f, 0x85, 0x00, 0x27,
+    0x00, 0x68, 0x42, 0x09, 0x00, 0x64, 0x00, 0x38, 0x4a, 0x14, 0x00, 0x8f,
+    0x00, 0x82, 0x69, 0x82, 0x00, 0x64, 0x00, 0x4c, 0x04, 0x01, 0x01, 0xa3,
+    0x0f, 0x05, 0x00, 0x40, 0x9c, 0x1e, 0x00, 0x14, 0x00, 0x4d, 0x9c, 0x00,
+    0x00, 0x00, 0x00, 0x4e, 0x9c, 0x5a, 0x00, 0x5a, 0x00, 0x4b, 0x9c, 0x00,
+    0x00, 0x00, 0x00, 0x4d, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x02,
+    0x01, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00, 0x78, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xb1, 0x04, 0x02, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00, 0x79,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x03, 0xae, 0x01, 0x3a, 0x00,
+    0x00, 0x0b, 0x00, 0xf9, 0x2a, 0x00, 0x00, 0x1e, 0x00, 0xfa, 0x2a, 0x64,
+    0x00, 0x1e, 0x00, 0xfb, 0x2a, 0x64, 0x00, 0x2d, 0x00, 0xfc, 0x2a, 0x00,
+    0x00, 0x2d, 0x00, 0xfd, 0x2a, 0xf0, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0xf0,
+    0x00, 0x0f, 0x00, 0xff, 0x2a, 0xf0, 0x00, 0x1e, 0x00, 0x00, 0x2b, 0x54,
+    0x01, 0x0f, 0x00, 0x01, 0x2b, 0x54, 0x01, 0x1e, 0x00, 0x02, 0x2b, 0xf0,
+    0x00, 0x2d, 0x00, 0x03, 0x2b, 0x54, 0x01, 0x2d, 0x00, 0xc3, 0x0b, 0x03,
+    0x98, 0x01, 0x15, 0x00, 0x00, 0x0b, 0x00, 0xb3, 0x36, 0x00, 0x00, 0x00,
+    0x00, 0xb9, 0x0b, 0x04, 0x00, 0x02, 0x00, 0xba, 0x0b, 0x2c, 0x00, 0x02,
+    0x00, 0xbb, 0x0b, 0x54, 0x00, 0x02, 0x00, 0xbc, 0x0b, 0x7c, 0x00, 0x02,
+    0x00, 0xbd, 0x0b, 0xa4, 0x00, 0x02, 0x00, 0xbe, 0x0b, 0xcc, 0x00, 0x02,
+    0x00, 0xbf, 0x0b, 0xf4, 0x00, 0x02, 0x00, 0xc0, 0x0b, 0x1c, 0x01, 0x02,
+    0x00, 0xc1, 0x0b, 0x44, 0x01, 0x02, 0x00, 0xc2, 0x0b, 0x6c, 0x01, 0x02,
+    0x00, 0xc4, 0x0b, 0x03, 0xbe, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0xfd,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x00, 0x00, 0x0a, 0x00, 0xff,
+    0x2a, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2b, 0x64, 0x00, 0x0a, 0x00, 0x01,
+    0x2b, 0x64, 0x00, 0x14, 0x00, 0x02, 0x2b, 0x00, 0x00, 0x1e, 0x00, 0x03,
+    0x2b, 0x64, 0x00, 0x1e, 0x00, 0x1d, 0x0c, 0x03, 0x3c, 0x00, 0x20, 0x00,
+    0x00, 0x01, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0x03,
+    0x3c, 0x00, 0x20, 0x00, 0x01, 0x01, 0x00, 0xde, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x0c, 0x03, 0x64, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0xe4,
+    0x3e, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x0c, 0x03, 0x14, 0x00, 0x0e, 0x00,
+    0x00, 0x01, 0x00, 0x46, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x94, 0x0c, 0x03,
+    0x46, 0x00, 0x71, 0x00, 0x00, 0x01, 0x00, 0x78, 0x69, 0x00, 0x00, 0x00,
+    0x00, 0x95, 0x0c, 0x03, 0x46, 0x00, 0x71, 0x00, 0x01, 0x01, 0x00, 0xf3,
+    0x4e, 0x00, 0x00, 0x00, 0x00, 0x96, 0x0c, 0x03, 0x46, 0x00, 0x71, 0x00,
+    0x01, 0x01, 0x00, 0xf4, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x03,
+    0x46, 0x00, 0x71, 0x00, 0x01, 0x01, 0x00, 0xf5, 0x4e, 0x00, 0x00, 0x00,
+    0x00, 0xa1, 0x0f, 0x04, 0x01, 0x05, 0x00, 0xf0, 0x13, 0xed, 0x13, 0xee,
+    0x13, 0xef, 0x13, 0xec, 0x13, 0xa2, 0x0f, 0x04, 0x01, 0x03, 0x00, 0x50,
+    0x14, 0xec, 0x13, 0xf6, 0x13, 0xa3, 0x0f, 0x04, 0x01, 0x01, 0x00, 0x50,
+    0x14, 0xaa, 0x0f, 0x04, 0x01, 0x05, 0x00, 0xf6, 0x13, 0x51, 0x14, 0x51,
+    0x14, 0x50, 0x14, 0xec, 0x13, 0xec, 0x13, 0x05, 0x01, 0x05, 0x01, 0x00,
+    0xdc, 0x50, 0x00, 0x00, 0x00, 0x00, 0xed, 0x13, 0x05, 0x01, 0x02, 0x01,
+    0x00, 0xe2, 0x50, 0x00, 0x00, 0x00, 0x00, 0xee, 0x13, 0x05, 0x01, 0x03,
+    0x01, 0x00, 0xe0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xef, 0x13, 0x05, 0x01,
+    0x04, 0x01, 0x00, 0xe1, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x13, 0x05,
+    0x01, 0x01, 0x02, 0x00, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x13, 0x05, 0x01, 0x0a, 0x02, 0x00, 0xb2,
+    0x36, 0x0a, 0x00, 0x01, 0x00, 0xb2, 0x2f, 0x04, 0x00, 0x0a, 0x00, 0x50,
+    0x14, 0x05, 0x01, 0x65, 0x01, 0x01, 0xdd, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x03, 0x51, 0x14, 0x05, 0x01, 0x64, 0x00, 0x00, 0x70, 0x17, 0x06,
+    0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x1b,
+    0x07, 0x0a, 0x14, 0x00, 0xd8, 0x59, 0xff, 0xff, 0x01, 0x01, 0x00, 0xbd,
+    0x1b, 0x09, 0x28, 0x00, 0x0b, 0x00, 0x07, 0xd8, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0xbe, 0x1b, 0x09, 0x28, 0x00, 0x0b, 0x00, 0x0d, 0xd8, 0x59, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x02, 0x01, 0x00, 0x20, 0x1c, 0x0a, 0x14, 0x00, 0x14, 0x00, 0xff, 0xff,
+    0x00, 0x03, 0x01, 0x00, 0x56, 0x4f, 0x57, 0x4f, 0x58, 0x4f, 0x84, 0x1c,
+    0x08, 0x5b, 0x00, 0x0f, 0x00, 0x07, 0xd8, 0x59, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0x0a, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x01, 0x00, 0x5c, 0x2b, 0x0b, 0x39, 0x00, 0x0f, 0x00, 0x0e, 0xd9,
+    0x59, 0x00, 0xff, 0xff, 0x01, 0x04, 0x00, 0x49, 0x53, 0x4f, 0x20, 0x00,
+    0x5d, 0x2b, 0x0b, 0x70, 0x00, 0x10, 0x00, 0x0a, 0xd8, 0x59, 0x00, 0xff,
+    0xff, 0x01, 0x0d, 0x00, 0x44, 0x65, 0x6d, 0x6f, 0x6e, 0x73, 0x74, 0x72,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x5e, 0x2b, 0x0b, 0x4b, 0x00, 0x0e,
+    0x00, 0x0c, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x01, 0x08, 0x00, 0x43, 0x6f,
+    0x75, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x00, 0x5f, 0x2b, 0x0b, 0x50, 0x00,
+    0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x49,
+    0x6e, 0x70, 0x75, 0x74, 0x20, 0x4e, 0x72, 0x2e, 0x3a, 0x00, 0x60, 0x2b,
+    0x0b, 0x48, 0x00, 0x0f, 0x00, 0x09, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x01,
+    0x08, 0x00, 0x41, 0x75, 0x73, 0x77, 0x61, 0x68, 0x6c, 0x3a, 0x00, 0xc0,
+    0x2b, 0x0b, 0xb6, 0x00, 0x0e, 0x00, 0x0e, 0xda, 0x59, 0x00, 0xf0, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x2b, 0x0b, 0xb6, 0x00, 0x0e, 0x00, 0x0d,
+    0xda, 0x59, 0x00, 0xf1, 0x55, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x2b, 0x0b,
+    0xb6, 0x00, 0x0e, 0x00, 0x0e, 0xda, 0x59, 0x00, 0xf2, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0xc3, 0x2b, 0x0b, 0x40, 0x00, 0x0e, 0x00, 0x01, 0xda, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+    0x6e, 0x3a, 0x00, 0x44, 0x2f, 0x0c, 0x17, 0x00, 0x0e, 0x00, 0x01, 0xd8,
+    0x59, 0x00, 0x08, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x45, 0x2f, 0x0c, 0x2c,
+    0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0x09, 0x52, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02,
+    0x00, 0x46, 0x2f, 0x0c, 0x14, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00,
+    0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x2f, 0x0c, 0x2c, 0x00, 0x0e,
+    0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x00, 0xa8,
+    0x2f, 0x0c, 0x28, 0x00, 0x0e, 0x00, 0x01, 0xda, 0x59, 0x01, 0xff, 0xff,
+    0x18, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0x23, 0x3c,
+    0x02, 0x00, 0x02, 0x00, 0xb2, 0x2f, 0x0c, 0x28, 0x00, 0x0e, 0x00, 0x01,
+    0xdb, 0x59, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0xd7, 0x23, 0x3c, 0x02, 0x00, 0x02, 0x00, 0xc8, 0x32, 0x0d,
+    0xc0, 0x5d, 0x64, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb0, 0x36, 0x0e, 0xc0,
+    0x5d, 0x14, 0x00, 0x46, 0x00, 0x00, 0xa8, 0x61, 0x00, 0xb1, 0x36, 0x0e,
+    0xc0, 0x5d, 0x1e, 0x00, 0x24, 0x00, 0x02, 0xff, 0xff, 0x00, 0xb2, 0x36,
+    0x0e, 0xc0, 0x5d, 0x24, 0x00, 0x1e, 0x00, 0x04, 0xa8, 0x61, 0x00, 0x98,
+    0x3a, 0x0f, 0xc1, 0x5d, 0x50, 0x00, 0x1e, 0x00, 0x02, 0x0a, 0xa5, 0xff,
+    0xff, 0x00, 0xe4, 0x3e, 0x10, 0x13, 0x00, 0x0f, 0x00, 0xc0, 0x5d, 0xa8,
+    0x61, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0e, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0xac, 0x3f, 0x10, 0x3e, 0x00, 0x35, 0x00, 0xc1,
+    0x5d, 0xff, 0xff, 0x02, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x28, 0x00,
+    0x24, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x33, 0x00, 0x3c, 0x00,
+    0x00, 0x00, 0x68, 0x42, 0x11, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+    0x00, 0x5a, 0x00, 0x00, 0x64, 0x00, 0x0a, 0x52, 0x00, 0x00, 0x00, 0x50,
+    0x46, 0x12, 0x0f, 0x00, 0x64, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00,
+    0x64, 0x00, 0x08, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38,
+    0x4a, 0x13, 0x3f, 0x00, 0x30, 0x00, 0x03, 0x00, 0x13, 0x00, 0x5a, 0x08,
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x0a, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0xea, 0x4e, 0x14, 0x3b, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x02,
+    0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x28, 0x00, 0xff,
+    0x01, 0x28, 0x01, 0xff, 0x02, 0x28, 0x02, 0xff, 0x07, 0x28, 0x07, 0xff,
+    0x03, 0x28, 0x03, 0xff, 0x09, 0x28, 0x09, 0xff, 0x04, 0x28, 0x04, 0xff,
+    0x0a, 0x28, 0x0a, 0xff, 0x05, 0x28, 0x05, 0xff, 0x0b, 0x28, 0x0b, 0xff,
+    0x06, 0x28, 0x06, 0xff, 0x0c, 0x28, 0x0c, 0xff, 0x08, 0x28, 0x08, 0xff,
+    0x0d, 0x28, 0x0d, 0xff, 0x0f, 0x28, 0x0f, 0xff, 0x0e, 0x28, 0x0e, 0xeb,
+    0x4e, 0x14, 0x08, 0x00, 0x08, 0x00, 0x20, 0x00, 0x01, 0x04, 0x01, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x11, 0x01, 0x10, 0x01, 0x00,
+    0x01, 0x01, 0x02, 0x11, 0x08, 0x22, 0x08, 0x77, 0x08, 0x33, 0x08, 0x99,
+    0x08, 0x44, 0x08, 0xaa, 0x08, 0x55, 0x08, 0xbb, 0x08, 0x66, 0x08, 0xcc,
+    0x08, 0x88, 0x08, 0xdd, 0x09, 0xff, 0x07, 0xee, 0xec, 0x4e, 0x14, 0x08,
+    0x00, 0x08, 0x00, 0x20, 0x00, 0x00, 0x04, 0x01, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xfe, 0x01, 0x1f, 0x01, 0x40, 0x01,
+    0x00, 0x02, 0xff, 0x0a, 0x00, 0x02, 0xff, 0x04, 0x00, 0x04, 0xff, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xab, 0xed, 0x4e, 0x14, 0x14, 0x00, 0x14, 0x00,
+    0x20, 0x00, 0x00, 0x04, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x02, 0xff, 0x01, 0xf0, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x40,
+    0x05, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x1e, 0x00,
+    0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0,
+    0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0,
+    0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0,
+    0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00,
+    0x01, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x01, 0xab, 0x01, 0xff,
+    0x01, 0xf0, 0xee, 0x4e, 0x14, 0x09, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00,
+    0x04, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x26, 0x00, 0xef, 0x4e, 0x14, 0x21, 0x00,
+    0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x90, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xf0, 0x4e, 0x14, 0x28, 0x00, 0x28, 0x00, 0x50,
+    0x00, 0x01, 0x00, 0x01, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xf2, 0x4e, 0x14, 0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x00,
+    0x01, 0x73, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x87, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x58, 0x71, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x77, 0x11, 0x78, 0x77, 0x71,
+    0x71, 0x17, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x11, 0x77, 0x77, 0x77, 0x77, 0x87,
+    0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x17, 0x78, 0x78, 0x88, 0x4c, 0xc8, 0x88, 0x8e, 0xc4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x88, 0x87, 0x88, 0x88, 0x88, 0x8c, 0x4c, 0xcc, 0x88, 0x88, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x11,
+    0x78, 0x66, 0x86, 0x88, 0x4c, 0xcc, 0xcc, 0x87, 0x78, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x78, 0x88, 0x86,
+    0x66, 0x66, 0x66, 0xcc, 0xcc, 0xcc, 0x77, 0x7c, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x78, 0x44, 0x4c, 0x44, 0x66,
+    0x66, 0x68, 0xcc, 0xcc, 0xcc, 0x87, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0x84, 0x44, 0x44, 0x4c, 0x66, 0x66,
+    0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x78, 0x64, 0x44, 0x44, 0x4c, 0x66, 0x66, 0x6c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x77, 0x86, 0x66, 0x64, 0x44, 0x44, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc8, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x88, 0x44, 0x46, 0x66, 0x44, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc8, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x80, 0x00, 0x04, 0x66, 0x44, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x87,
+    0x71, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4c, 0xcc, 0xcc, 0x87, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x48, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x71, 0x77, 0x88, 0x88, 0x88, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x87, 0x17, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x71, 0x80, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x81,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x17, 0x71, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x77, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x77, 0x77, 0x71, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x88, 0x87, 0x77, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x88, 0x88, 0x77, 0x77, 0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
+    0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88,
+    0x88, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88,
+    0x77, 0x77, 0x88, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x17, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x87, 0x77, 0x77,
+    0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x71, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x77, 0x11, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x11, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x77, 0x77, 0x71, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xcc, 0x87, 0x77, 0x77, 0x77, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x78, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4c, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x87, 0x7c, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0xcc, 0x8c,
+    0xcc, 0xcc, 0x78, 0xcc, 0x7c, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc,
+    0x44, 0x4c, 0xcc, 0xc0, 0x00, 0x00, 0x0c, 0xcc, 0xcc, 0x8c, 0xc8, 0xcc,
+    0xc8, 0x8c, 0xc7, 0x7c, 0xcc, 0xcc, 0xc4, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0x44,
+    0x77, 0xcc, 0xcc, 0x40, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc,
+    0xcc, 0xc7, 0xcc, 0x8c, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0x48, 0x11,
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x87, 0xc8, 0xcc, 0xcc, 0xcc, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x44, 0x77, 0x7c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78,
+    0xc7, 0x7c, 0xcc, 0xcc, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x44, 0x48, 0x7c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc8, 0x88, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0xc7,
+    0x78, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x44, 0x48, 0x8c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x8c, 0xcc, 0xec, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0x87, 0xc7,
+    0x8c, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x44, 0x45, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x8c, 0xc8, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0x7c, 0xcc, 0x7c,
+    0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0x44, 0x40, 0x4c, 0xcc, 0xcc, 0xcc, 0x4c,
+    0xc7, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0x8c, 0xcc, 0x88, 0xcc,
+    0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xcc, 0xcc, 0x44, 0x4c, 0xcc,
+    0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x77, 0x8c, 0xcc, 0xcc, 0xcc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xc4, 0x44, 0x00, 0x04, 0xc8, 0x76,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x77, 0x8c, 0xcc, 0xc8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x40, 0x04, 0x40, 0x00, 0x00, 0x04, 0xc6, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x78, 0xcc, 0xcc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0xc8, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x88, 0x77, 0xc7, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x87, 0xcc, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc8, 0xcc, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68,
+    0x86, 0xc6, 0xcc, 0xcc, 0xcc, 0xc8, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x58, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x88,
+    0x88, 0x88, 0x87, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88,
+    0x88, 0x77, 0x17, 0x77, 0x78, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x00, 0x00, 0x08, 0x77, 0x71, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00,
+    0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x08,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x87, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x87, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x77, 0x77, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77,
+    0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x71, 0x11,
+    0x17, 0x77, 0x88, 0x80, 0x00, 0x00, 0x08, 0x88, 0x87, 0x77, 0x77, 0x77,
+    0x77, 0x11, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x77, 0x78, 0x88,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x87, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf3, 0x4e, 0x14, 0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x00,
+    0x01, 0x73, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x77, 0x77, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88, 0x77, 0x71, 0x11,
+    0x11, 0x17, 0x77, 0x77, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x87, 0x17, 0x78, 0x17, 0x77, 0x77, 0x77, 0x77,
+    0x78, 0xc7, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x71, 0x17, 0x77, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0xcc,
+    0xc7, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x78, 0x88, 0x88, 0x44, 0xcc, 0x88, 0x86, 0x67, 0x7c, 0xcc, 0xc8,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0xc4, 0x4c, 0xc6, 0x68, 0x87, 0x7c, 0xcc, 0xc7, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x78, 0x66,
+    0x66, 0x64, 0x4c, 0x4c, 0xcc, 0x8e, 0x77, 0x7c, 0xcc, 0xc7, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x88, 0x66, 0x66,
+    0x66, 0x4c, 0xcc, 0xcc, 0x8e, 0x77, 0x7c, 0xcc, 0xc7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x44, 0x44, 0x46, 0x66, 0x66,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x84, 0x44, 0x44, 0x46, 0x66, 0x66, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x88, 0x44, 0x44, 0x4c, 0x66, 0x6c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x86, 0x44, 0x44, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x86, 0x64, 0x44, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88,
+    0x77, 0x77, 0x17, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x86, 0x40, 0x04, 0xcc, 0xcc, 0xcc, 0x88, 0x77, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0x87, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4c, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x87,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xf1,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x17, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x08, 0x17, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x08, 0x17, 0x77, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x8f, 0x00, 0x00, 0x05, 0x17, 0x77, 0x77, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x80, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x18, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x77, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x11, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+    0x88, 0x87, 0x77, 0x77, 0x87, 0x77, 0x77, 0x77, 0x87, 0x88, 0x87, 0x77,
+    0x77, 0x77, 0x77, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88,
+    0x88, 0x87, 0x77, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
+    0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x45, 0x88, 0x88,
+    0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88,
+    0x88, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x44, 0x44, 0x44, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x77, 0x71, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x11, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x77, 0x77, 0x77, 0x11, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x17, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xcc, 0xcc, 0x87, 0x78, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0xcc,
+    0x8c, 0xcc, 0xcc, 0x88, 0x8c, 0x8c, 0xcc, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xcc, 0x44, 0x4c, 0xcc, 0x40, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc8, 0x8c, 0xcc, 0x7c, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc,
+    0x44, 0x8c, 0xcc, 0xc4, 0x00, 0x04, 0x4c, 0xcc, 0xcc, 0x8c, 0xcc, 0xcc,
+    0xc8, 0xcc, 0xc7, 0x7c, 0xcc, 0xcc, 0xcc, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0x4c,
+    0x17, 0x8c, 0xcc, 0xc4, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc7, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0x44, 0x71,
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc7, 0xc8, 0x8c, 0xcc, 0xcc, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x44, 0x88, 0x7c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x78, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c,
+    0xc7, 0x7c, 0xcc, 0xcc, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x44, 0x48, 0x7c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x8c, 0xc8, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0xc7,
+    0x87, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x44, 0x48, 0x8c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x8c, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0x88, 0xc8,
+    0x7c, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x44, 0x4c, 0xcc, 0xcc, 0xcc,
+    0xc6, 0xcc, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0x8c, 0xcc, 0x88,
+    0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xcc, 0xcc, 0xc4, 0x4c,
+    0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0x78, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xcc, 0xc4, 0x44, 0x44, 0xcc,
+    0x8e, 0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xe7, 0x77, 0xcc, 0xcc, 0xcc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x04, 0x44, 0x40, 0x00, 0x04, 0xc8, 0x8c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0x7c, 0xcc, 0xc8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xcc, 0x71, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x87, 0x77, 0xc8, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x77, 0xcc, 0x71, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc7, 0xcc, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x88, 0x66, 0x64, 0xcc, 0x6c, 0xc8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0x87, 0x88,
+    0x88, 0x88, 0x87, 0x18, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x00, 0x00, 0x00, 0x08, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
+    0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x00, 0x00, 0x08, 0x71, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00,
+    0x08, 0x71, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x87,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x87, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x87, 0x71, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x78, 0x88, 0x87, 0x77, 0x77, 0x77,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x17, 0x71,
+    0x11, 0x11, 0x77, 0x77, 0x88, 0x00, 0x04, 0x88, 0x88, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x4e, 0x14, 0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x04,
+    0x01, 0xa4, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2a, 0x00, 0x01, 0x88,
+    0x20, 0x00, 0x01, 0x77, 0x02, 0x11, 0x01, 0x78, 0x01, 0x88, 0x1a, 0x00,
+    0x01, 0x04, 0x01, 0x78, 0x01, 0x17, 0x01, 0x78, 0x01, 0x17, 0x02, 0x77,
+    0x02, 0x11, 0x01, 0x18, 0x01, 0x80, 0x17, 0x00, 0x01, 0x88, 0x01, 0x77,
+    0x01, 0x11, 0x01, 0x71, 0x01, 0x11, 0x01, 0x77, 0x01, 0x87, 0x03, 0x77,
+    0x01, 0x71, 0x01, 0x10, 0x14, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x87,
+    0x03, 0x77, 0x01, 0x87, 0x01, 0x77, 0x01, 0x88, 0x01, 0xcc, 0x01, 0xc7,
+    0x03, 0x77, 0x01, 0x78, 0x13, 0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x17,
+    0x01, 0x78, 0x02, 0x88, 0x01, 0x6e, 0x01, 0x8e, 0x01, 0x78, 0x02, 0xcc,
+    0x01, 0xc7, 0x01, 0xe7, 0x02, 0x77, 0x01, 0x70, 0x13, 0x00, 0x01, 0x07,
+    0x01, 0x78, 0x01, 0x88, 0x01, 0x84, 0x01, 0x48, 0x01, 0x88, 0x01, 0x66,
+    0x01, 0xe7, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc7, 0x01, 0x77, 0x01, 0x78,
+    0x01, 0xc8, 0x14, 0x00, 0x01, 0x08, 0x02, 0x88, 0x01, 0x84, 0x01, 0x4c,
+    0x01, 0xc6, 0x01, 0x66, 0x01, 0x6e, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc7,
+    0x01, 0x77, 0x01, 0x7c, 0x01, 0x78, 0x14, 0x00, 0x01, 0x08, 0x01, 0x88,
+    0x01, 0x68, 0x01, 0x4c, 0x01, 0x44, 0x01, 0xcc, 0x01, 0x68, 0x01, 0x8e,
+    0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc7, 0x01, 0x77, 0x01, 0x7c, 0x01, 0x78,
+    0x14, 0x00, 0x01, 0x71, 0x01, 0x88, 0x01, 0x66, 0x01, 0x64, 0x02, 0xcc,
+    0x01, 0x66, 0x01, 0xee, 0x01, 0x8c, 0x03, 0xcc, 0x01, 0x77, 0x01, 0x78,
+    0x01, 0x70, 0x13, 0x00, 0x01, 0x08, 0x01, 0x78, 0x01, 0x85, 0x02, 0x66,
+    0x09, 0xcc, 0x01, 0xc8, 0x01, 0x20, 0x13, 0x00, 0x01, 0x08, 0x01, 0x84,
+    0x01, 0x44, 0x01, 0x46, 0x01, 0x66, 0x07, 0xcc, 0x01, 0x8c, 0x01, 0xcc,
+    0x01, 0xc0, 0x15, 0x00, 0x01, 0x84, 0x02, 0x44, 0x01, 0x64, 0x08, 0xcc,
+    0x01, 0x8c, 0x01, 0xc0, 0x17, 0x00, 0x01, 0x04, 0x01, 0x4c, 0x05, 0xcc,
+    0x01, 0x88, 0x02, 0x77, 0x01, 0x8c, 0x01, 0xc0, 0x18, 0x00, 0x01, 0x4c,
+    0x02, 0xcc, 0x01, 0xc8, 0x01, 0x87, 0x01, 0x71, 0x03, 0x11, 0x01, 0x17,
+    0x01, 0xc4, 0x18, 0x00, 0x01, 0x0c, 0x01, 0xcc, 0x01, 0x88, 0x01, 0x71,
+    0x06, 0x11, 0x01, 0x74, 0x18, 0x00, 0x01, 0x04, 0x01, 0xc7, 0x01, 0x71,
+    0x07, 0x11, 0x01, 0x17, 0x02, 0x88, 0x01, 0x50, 0x15, 0x00, 0x01, 0x04,
+    0x01, 0x71, 0x04, 0x11, 0x01, 0x18, 0x06, 0x11, 0x01, 0x17, 0x01, 0x80,
+    0x14, 0x00, 0x01, 0x88, 0x05, 0x11, 0x01, 0x87, 0x08, 0x11, 0x01, 0x80,
+    0x12, 0x00, 0x01, 0x08, 0x05, 0x11, 0x01, 0x18, 0x01, 0x71, 0x08, 0x11,
+    0x01, 0x17, 0x13, 0x00, 0x05, 0x11, 0x01, 0x77, 0x0a, 0x11, 0x01, 0x70,
+    0x12, 0x00, 0x10, 0x11, 0x01, 0x18, 0x11, 0x00, 0x01, 0x08, 0x11, 0x11,
+    0x01, 0x80, 0x10, 0x00, 0x01, 0x0f, 0x01, 0x71, 0x0d, 0x11, 0x01, 0x18,
+    0x01, 0x88, 0x01, 0x81, 0x01, 0x70, 0x11, 0x00, 0x01, 0x71, 0x0d, 0x11,
+    0x01, 0x80, 0x01, 0x00, 0x01, 0x08, 0x01, 0x88, 0x10, 0x00, 0x01, 0x80,
+    0x01, 0x71, 0x0c, 0x11, 0x01, 0x17, 0x02, 0x00, 0x01, 0x08, 0x01, 0x88,
+    0x10, 0x00, 0x01, 0x80, 0x01, 0x81, 0x0c, 0x11, 0x01, 0x18, 0x03, 0x00,
+    0x01, 0x88, 0x10, 0x00, 0x01, 0x80, 0x01, 0x81, 0x01, 0x71, 0x0b, 0x11,
+    0x01, 0x17, 0x03, 0x00, 0x01, 0x07, 0x10, 0x00, 0x01, 0x80, 0x01, 0x81,
+    0x01, 0x71, 0x0b, 0x11, 0x01, 0x17, 0x01, 0x80, 0x02, 0x00, 0x01, 0x81,
+    0x01, 0x80, 0x10, 0x00, 0x01, 0x81, 0x01, 0x77, 0x03, 0x11, 0x01, 0x77,
+    0x01, 0x71, 0x07, 0x11, 0x01, 0x78, 0x01, 0x00, 0x01, 0x08, 0x01, 0x11,
+    0x01, 0x80, 0x10, 0x00, 0x01, 0x87, 0x01, 0x77, 0x01, 0x71, 0x01, 0x11,
+    0x01, 0x17, 0x02, 0x77, 0x03, 0x11, 0x02, 0x77, 0x03, 0x11, 0x01, 0x77,
+    0x02, 0x11, 0x01, 0x80, 0x10, 0x00, 0x01, 0x87, 0x0c, 0x77, 0x01, 0x71,
+    0x04, 0x11, 0x01, 0x80, 0x10, 0x00, 0x01, 0x07, 0x0d, 0x77, 0x04, 0x11,
+    0x11, 0x00, 0x01, 0x07, 0x01, 0x88, 0x0c, 0x77, 0x02, 0x71, 0x01, 0x11,
+    0x01, 0x17, 0x11, 0x00, 0x01, 0x08, 0x01, 0x88, 0x0d, 0x77, 0x01, 0x71,
+    0x01, 0x11, 0x01, 0x18, 0x11, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x87,
+    0x0d, 0x77, 0x01, 0x11, 0x01, 0x70, 0x11, 0x00, 0x01, 0x08, 0x01, 0x88,
+    0x01, 0x87, 0x02, 0x77, 0x01, 0x87, 0x02, 0x77, 0x01, 0x78, 0x03, 0x88,
+    0x05, 0x77, 0x01, 0x80, 0x11, 0x00, 0x01, 0x08, 0x01, 0x84, 0x01, 0x08,
+    0x01, 0x87, 0x01, 0x77, 0x08, 0x88, 0x03, 0x77, 0x01, 0x78, 0x15, 0x00,
+    0x01, 0x88, 0x01, 0x87, 0x09, 0x88, 0x02, 0x77, 0x01, 0x80, 0x15, 0x00,
+    0x01, 0x08, 0x01, 0x88, 0x01, 0x78, 0x0a, 0x88, 0x0f, 0x00, 0x01, 0x48,
+    0x07, 0x00, 0x07, 0x88, 0x01, 0x58, 0x02, 0x88, 0x01, 0x50, 0x10, 0x00,
+    0x01, 0x71, 0x01, 0x80, 0x06, 0x00, 0x01, 0x08, 0x06, 0x88, 0x01, 0x44,
+    0x01, 0x40, 0x12, 0x00, 0x01, 0x11, 0x01, 0x70, 0x07, 0x00, 0x01, 0x87,
+    0x01, 0x77, 0x04, 0x88, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x70,
+    0x07, 0x00, 0x01, 0x87, 0x02, 0x77, 0x01, 0x88, 0x01, 0x87, 0x01, 0x78,
+    0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x18, 0x07, 0x00, 0x01, 0x07,
+    0x04, 0x77, 0x01, 0x18, 0x13, 0x00, 0x01, 0x07, 0x01, 0x11, 0x01, 0x18,
+    0x07, 0x00, 0x01, 0x07, 0x04, 0x77, 0x01, 0x15, 0x13, 0x00, 0x01, 0x07,
+    0x01, 0x11, 0x01, 0x77, 0x07, 0x00, 0x01, 0x07, 0x03, 0x77, 0x01, 0x71,
+    0x01, 0x10, 0x13, 0x00, 0x01, 0x07, 0x01, 0x11, 0x01, 0x77, 0x07, 0x00,
+    0x01, 0x08, 0x03, 0x77, 0x01, 0x11, 0x01, 0x74, 0x13, 0x00, 0x01, 0x08,
+    0x01, 0x11, 0x01, 0x78, 0x07, 0x00, 0x01, 0xcc, 0x01, 0xc8, 0x03, 0x77,
+    0x01, 0x7c, 0x01, 0x40, 0x12, 0x00, 0x01, 0x08, 0x01, 0x78, 0x01, 0xc4,
+    0x06, 0x00, 0x01, 0x4c, 0x05, 0xcc, 0x01, 0x8c, 0x01, 0xc4, 0x12, 0x00,
+    0x01, 0x0c, 0x02, 0xcc, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x02, 0xcc,
+    0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc4,
+    0x11, 0x00, 0x01, 0x4c, 0x01, 0xc4, 0x02, 0xcc, 0x01, 0x40, 0x03, 0x00,
+    0x01, 0x4c, 0x05, 0xcc, 0x01, 0x88, 0x02, 0x8c, 0x02, 0xcc, 0x01, 0x40,
+    0x0f, 0x00, 0x01, 0xcc, 0x01, 0x44, 0x01, 0x4c, 0x01, 0xcc, 0x01, 0xc4,
+    0x02, 0x00, 0x01, 0x04, 0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01, 0x8c,
+    0x01, 0xcc, 0x01, 0x7c, 0x03, 0xcc, 0x01, 0x40, 0x0d, 0x00, 0x01, 0x0c,
+    0x01, 0xcc, 0x01, 0xc4, 0x01, 0x71, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc4,
+    0x01, 0x4c, 0x06, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0x7c,
+    0x04, 0xcc, 0x0d, 0x00, 0x01, 0x08, 0x01, 0xcc, 0x01, 0x44, 0x01, 0x71,
+    0x01, 0x18, 0x05, 0xcc, 0x01, 0x7c, 0x05, 0xcc, 0x01, 0xc7, 0x02, 0x8c,
+    0x02, 0xcc, 0x01, 0xc8, 0x01, 0x40, 0x0c, 0x00, 0x01, 0x08, 0x01, 0x17,
+    0x01, 0x84, 0x01, 0x87, 0x01, 0x77, 0x05, 0xcc, 0x01, 0x77, 0x05, 0xcc,
+    0x01, 0xc7, 0x01, 0xcc, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0xc0,
+    0x0c, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x84, 0x01, 0x48, 0x01, 0x78,
+    0x04, 0xcc, 0x01, 0xc8, 0x01, 0x88, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xc8,
+    0x01, 0xcc, 0x01, 0x77, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc0, 0x0d, 0x00,
+    0x01, 0x11, 0x01, 0x74, 0x01, 0x44, 0x01, 0x7c, 0x04, 0xcc, 0x01, 0x8c,
+    0x01, 0xcc, 0x01, 0xce, 0x04, 0xcc, 0x01, 0x8c, 0x01, 0xc7, 0x01, 0x8c,
+    0x01, 0x7c, 0x02, 0xcc, 0x01, 0x40, 0x0d, 0x00, 0x01, 0x77, 0x01, 0x84,
+    0x01, 0x44, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0x6c, 0x01, 0xc8, 0x01, 0xcc,
+    0x01, 0x6c, 0x03, 0xcc, 0x01, 0x8c, 0x01, 0xc7, 0x01, 0xcc, 0x01, 0x87,
+    0x02, 0xcc, 0x01, 0x40, 0x0d, 0x00, 0x01, 0x08, 0x02, 0x44, 0x01, 0x4c,
+    0x03, 0xcc, 0x01, 0xc4, 0x01, 0xcc, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xce,
+    0x01, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x88, 0x02, 0xcc, 0x01, 0x40,
+    0x0e, 0x00, 0x01, 0x44, 0x01, 0x40, 0x01, 0x0c, 0x02, 0xcc, 0x02, 0x44,
+    0x01, 0xc8, 0x01, 0xcc, 0x01, 0x6c, 0x05, 0xcc, 0x01, 0xc7, 0x01, 0x78,
+    0x03, 0xcc, 0x01, 0x40, 0x0e, 0x00, 0x01, 0x44, 0x01, 0x40, 0x01, 0x04,
+    0x01, 0xcc, 0x01, 0x44, 0x01, 0x00, 0x01, 0x04, 0x01, 0xcc, 0x01, 0x78,
+    0x07, 0xcc, 0x01, 0xc7, 0x01, 0x78, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x40,
+    0x0e, 0x00, 0x01, 0x44, 0x01, 0x40, 0x01, 0x00, 0x01, 0x40, 0x02, 0x00,
+    0x01, 0x04, 0x01, 0xc6, 0x01, 0x6c, 0x06, 0xcc, 0x01, 0xc8, 0x01, 0x88,
+    0x01, 0xc7, 0x02, 0xcc, 0x01, 0x40, 0x0e, 0x00, 0x01, 0x44, 0x01, 0x40,
+    0x05, 0x00, 0x01, 0x4c, 0x08, 0xcc, 0x01, 0xc8, 0x01, 0x8c, 0x01, 0xc7,
+    0x01, 0x7c, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40, 0x05, 0x00, 0x01, 0x4c,
+    0x08, 0xcc, 0x01, 0x87, 0x01, 0x8c, 0x01, 0x71, 0x01, 0x18, 0x0f, 0x00,
+    0x01, 0x44, 0x01, 0x40, 0x05, 0x00, 0x08, 0xcc, 0x01, 0xc8, 0x01, 0x77,
+    0x01, 0x8c, 0x01, 0x71, 0x01, 0x17, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40,
+    0x04, 0x00, 0x01, 0x04, 0x09, 0xcc, 0x01, 0xc7, 0x01, 0x8c, 0x01, 0x87,
+    0x01, 0x18, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
+    0x01, 0xcc, 0x01, 0xc8, 0x07, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x87,
+    0x01, 0x80, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
+    0x0b, 0xcc, 0x01, 0x88, 0x0f, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x04, 0x00, 0x01, 0x04, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04,
+    0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x0b, 0xcc, 0x10, 0x00,
+    0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x05, 0x00, 0x01, 0x4c, 0x08, 0xcc,
+    0x01, 0xc8, 0x01, 0x86, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x06, 0x00, 0x01, 0x48, 0x01, 0x86, 0x02, 0x6c, 0x03, 0xcc, 0x01, 0x88,
+    0x01, 0x60, 0x11, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x07, 0x00,
+    0x06, 0x88, 0x01, 0x80, 0x12, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x07, 0x00, 0x01, 0x08, 0x01, 0x78, 0x03, 0x88, 0x01, 0x78, 0x13, 0x00,
+    0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x03, 0x00, 0x01, 0x08, 0x03, 0x88,
+    0x01, 0x87, 0x01, 0x77, 0x02, 0x88, 0x01, 0x87, 0x03, 0x77, 0x01, 0x78,
+    0x02, 0x88, 0x0e, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x02, 0x00,
+    0x01, 0x87, 0x01, 0x71, 0x01, 0x11, 0x01, 0x17, 0x04, 0x77, 0x01, 0x87,
+    0x03, 0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x80, 0x0c, 0x00, 0x01, 0x04,
+    0x01, 0x44, 0x01, 0x40, 0x01, 0x00, 0x01, 0x87, 0x04, 0x11, 0x01, 0x17,
+    0x07, 0x77, 0x01, 0x71, 0x05, 0x11, 0x0c, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x40, 0x01, 0x08, 0x01, 0x71, 0x07, 0x11, 0x05, 0x77, 0x01, 0x71,
+    0x05, 0x11, 0x01, 0x80, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x01, 0x08, 0x01, 0x71, 0x06, 0x11, 0x01, 0x17, 0x01, 0x77, 0x01, 0x87,
+    0x04, 0x77, 0x05, 0x11, 0x01, 0x10, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x40, 0x01, 0x08, 0x01, 0x71, 0x05, 0x11, 0x01, 0x17, 0x02, 0x77,
+    0x01, 0x88, 0x04, 0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x10, 0x0b, 0x00,
+    0x01, 0x04, 0x01, 0x44, 0x01, 0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x71,
+    0x04, 0x11, 0x02, 0x77, 0x03, 0x88, 0x06, 0x77, 0x02, 0x11, 0x01, 0x10,
+    0x0e, 0x00, 0x01, 0x08, 0x03, 0x77, 0x02, 0x11, 0x01, 0x77, 0x01, 0x78,
+    0x01, 0x80, 0x03, 0x00, 0x02, 0x88, 0x04, 0x77, 0x01, 0x71, 0x01, 0x17,
+    0x01, 0x70, 0x0e, 0x00, 0x01, 0x08, 0x02, 0x88, 0x01, 0x87, 0x01, 0x77,
+    0x02, 0x88, 0x07, 0x00, 0x01, 0x08, 0x05, 0x88, 0xff, 0x00, 0xff, 0x00,
+    0xc6, 0x00, 0xf5, 0x4e, 0x14, 0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01,
+    0x04, 0x01, 0x8e, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0x4a, 0x00, 0x01,
+    0x04, 0x01, 0x58, 0x01, 0x88, 0x01, 0x50, 0x1e, 0x00, 0x01, 0x04, 0x01,
+    0x71, 0x03, 0x11, 0x01, 0x77, 0x01, 0x11, 0x01, 0x78, 0x01, 0x88, 0x01,
+    0x84, 0x17, 0x00, 0x01, 0x08, 0x01, 0x80, 0x01, 0x88, 0x06, 0x77, 0x03,
+    0x11, 0x01, 0x78, 0x15, 0x00, 0x01, 0x47, 0x01, 0x77, 0x02, 0x17, 0x01,
+    0x77, 0x01, 0x8c, 0x01, 0x88, 0x02, 0x77, 0x01, 0x78, 0x03, 0x77, 0x01,
+    0x71, 0x01, 0x70, 0x13, 0x00, 0x01, 0x08, 0x01, 0x17, 0x03, 0x77, 0x01,
+    0x78, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0xee, 0x01, 0x7e, 0x02, 0x77, 0x01,
+    0x88, 0x01, 0x77, 0x01, 0x18, 0x13, 0x00, 0x01, 0x08, 0x03, 0x88, 0x01,
+    0x78, 0x01, 0x8c, 0x03, 0xcc, 0x01, 0x8e, 0x01, 0xee, 0x01, 0x77, 0x01,
+    0x7c, 0x01, 0xcc, 0x01, 0x77, 0x01, 0x80, 0x13, 0x00, 0x01, 0x81, 0x02,
+    0x88, 0x01, 0x68, 0x01, 0xe8, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x01,
+    0x7e, 0x01, 0xee, 0x01, 0x77, 0x02, 0xcc, 0x01, 0x71, 0x01, 0x78, 0x13,
+    0x00, 0x02, 0x88, 0x01, 0x4c, 0x01, 0x66, 0x01, 0x6e, 0x01, 0x8c, 0x02,
+    0xcc, 0x01, 0xc8, 0x01, 0xe7, 0x02, 0x77, 0x02, 0xcc, 0x01, 0x77, 0x01,
+    0x71, 0x01, 0x80, 0x12, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x4c, 0x01,
+    0x66, 0x01, 0x8e, 0x01, 0x8c, 0x03, 0xcc, 0x01, 0x8e, 0x02, 0x77, 0x01,
+    0xcc, 0x01, 0xc8, 0x01, 0x78, 0x01, 0x87, 0x01, 0x80, 0x13, 0x00, 0x01,
+    0x06, 0x01, 0x6c, 0x01, 0xc8, 0x01, 0x7e, 0x01, 0x8c, 0x04, 0xcc, 0x01,
+    0xc8, 0x01, 0x7c, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x78, 0x01, 0x87, 0x01,
+    0x80, 0x14, 0x00, 0x01, 0x84, 0x01, 0xcc, 0x01, 0x6c, 0x08, 0xcc, 0x01,
+    0x87, 0x02, 0x88, 0x15, 0x00, 0x01, 0x68, 0x01, 0x4c, 0x06, 0xcc, 0x01,
+    0xc8, 0x02, 0xcc, 0x01, 0x88, 0x01, 0x87, 0x17, 0x00, 0x01, 0x4c, 0x07,
+    0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0x88, 0x17, 0x00, 0x01,
+    0x4c, 0x02, 0xcc, 0x01, 0x87, 0x03, 0x77, 0x01, 0x8c, 0x01, 0xcc, 0x01,
+    0x8c, 0x01, 0xc4, 0x18, 0x00, 0x01, 0x4c, 0x01, 0xc8, 0x01, 0x71, 0x05,
+    0x11, 0x01, 0x78, 0x01, 0xcc, 0x01, 0x40, 0x18, 0x00, 0x01, 0x05, 0x01,
+    0x71, 0x07, 0x11, 0x01, 0x7c, 0x01, 0x40, 0x18, 0x00, 0x01, 0x07, 0x08,
+    0x11, 0x01, 0x17, 0x01, 0x40, 0x18, 0x00, 0x01, 0x81, 0x09, 0x11, 0x01,
+    0x80, 0x17, 0x00, 0x01, 0x08, 0x01, 0x71, 0x09, 0x11, 0x01, 0x18, 0x16,
+    0x00, 0x01, 0x08, 0x01, 0x77, 0x0b, 0x11, 0x01, 0x70, 0x15, 0x00, 0x01,
+    0x01, 0x01, 0x17, 0x0b, 0x11, 0x01, 0x17, 0x15, 0x00, 0x01, 0x81, 0x01,
+    0x77, 0x0c, 0x11, 0x01, 0x80, 0x14, 0x00, 0x01, 0x71, 0x01, 0x77, 0x04,
+    0x11, 0x01, 0x17, 0x01, 0x77, 0x06, 0x11, 0x01, 0x70, 0x14, 0x00, 0x01,
+    0x11, 0x01, 0x77, 0x03, 0x11, 0x01, 0x18, 0x01, 0xf0, 0x01, 0x05, 0x01,
+    0x88, 0x05, 0x11, 0x01, 0x10, 0x14, 0x00, 0x01, 0x11, 0x01, 0x71, 0x03,
+    0x11, 0x01, 0x80, 0x02, 0x00, 0x01, 0xff, 0x01, 0x81, 0x04, 0x11, 0x01,
+    0x18, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x71, 0x03, 0x11, 0x01,
+    0x80, 0x02, 0x00, 0x01, 0x08, 0x01, 0x81, 0x04, 0x11, 0x01, 0x17, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x17, 0x01, 0x71, 0x02, 0x11, 0x01, 0x17, 0x01,
+    0x40, 0x03, 0x00, 0x01, 0x81, 0x04, 0x11, 0x01, 0x17, 0x13, 0x00, 0x01,
+    0x08, 0x01, 0x17, 0x01, 0x71, 0x03, 0x11, 0x01, 0x80, 0x03, 0x00, 0x01,
+    0x81, 0x04, 0x11, 0x01, 0x17, 0x13, 0x00, 0x01, 0x08, 0x01, 0x17, 0x01,
+    0x71, 0x03, 0x11, 0x01, 0x78, 0x02, 0x00, 0x01, 0x08, 0x01, 0x71, 0x04,
+    0x11, 0x01, 0x17, 0x13, 0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x71, 0x03,
+    0x11, 0x01, 0x77, 0x02, 0x88, 0x01, 0x87, 0x05, 0x11, 0x01, 0x17, 0x13,
+    0x00, 0x01, 0x03, 0x02, 0x77, 0x02, 0x11, 0x01, 0x17, 0x04, 0x77, 0x05,
+    0x11, 0x01, 0x18, 0x14, 0x00, 0x09, 0x77, 0x01, 0x71, 0x03, 0x11, 0x01,
+    0x17, 0x01, 0x18, 0x14, 0x00, 0x09, 0x77, 0x01, 0x71, 0x03, 0x11, 0x01,
+    0x17, 0x01, 0x78, 0x14, 0x00, 0x01, 0x87, 0x09, 0x77, 0x03, 0x11, 0x01,
+    0x77, 0x01, 0x80, 0x14, 0x00, 0x02, 0x87, 0x09, 0x77, 0x02, 0x11, 0x01,
+    0x77, 0x01, 0x80, 0x14, 0x00, 0x01, 0x08, 0x01, 0x88, 0x09, 0x77, 0x01,
+    0x71, 0x01, 0x17, 0x01, 0x77, 0x16, 0x00, 0x01, 0x88, 0x01, 0x87, 0x01,
+    0x77, 0x03, 0x88, 0x01, 0x87, 0x04, 0x77, 0x02, 0x78, 0x16, 0x00, 0x01,
+    0x48, 0x07, 0x88, 0x01, 0x87, 0x02, 0x77, 0x01, 0x88, 0x01, 0x80, 0x18,
+    0x00, 0x07, 0x88, 0x01, 0x77, 0x02, 0x88, 0x19, 0x00, 0x01, 0x48, 0x07,
+    0x88, 0x01, 0x80, 0x12, 0x00, 0x01, 0x01, 0x01, 0x80, 0x06, 0x00, 0x01,
+    0x08, 0x01, 0x84, 0x06, 0x88, 0x13, 0x00, 0x01, 0x81, 0x01, 0x70, 0x07,
+    0x00, 0x05, 0x88, 0x01, 0x87, 0x01, 0x80, 0x13, 0x00, 0x01, 0x71, 0x01,
+    0x70, 0x07, 0x00, 0x01, 0x87, 0x03, 0x88, 0x01, 0x87, 0x01, 0x77, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x18, 0x07, 0x00, 0x01, 0x07, 0x01,
+    0x77, 0x01, 0x88, 0x01, 0x87, 0x01, 0x77, 0x01, 0x17, 0x13, 0x00, 0x01,
+    0x08, 0x01, 0x11, 0x01, 0x17, 0x07, 0x00, 0x01, 0x07, 0x03, 0x77, 0x01,
+    0x71, 0x01, 0x18, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x17, 0x01,
+    0x40, 0x06, 0x00, 0x01, 0x08, 0x03, 0x77, 0x01, 0x71, 0x01, 0x18, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x77, 0x01, 0x80, 0x06, 0x00, 0x01,
+    0x08, 0x03, 0x77, 0x01, 0x11, 0x01, 0x10, 0x13, 0x00, 0x01, 0x08, 0x01,
+    0x11, 0x01, 0x77, 0x01, 0x40, 0x06, 0x00, 0x01, 0x4c, 0x03, 0x77, 0x01,
+    0x11, 0x01, 0x1c, 0x01, 0x40, 0x12, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01,
+    0x78, 0x06, 0x00, 0x01, 0x04, 0x03, 0xcc, 0x01, 0x77, 0x01, 0x88, 0x01,
+    0x7c, 0x01, 0xc0, 0x12, 0x00, 0x01, 0x05, 0x01, 0x8c, 0x01, 0xcc, 0x01,
+    0x40, 0x05, 0x00, 0x01, 0x4c, 0x01, 0xcc, 0x01, 0x8c, 0x02, 0xcc, 0x01,
+    0xc8, 0x01, 0x78, 0x01, 0xcc, 0x01, 0x40, 0x11, 0x00, 0x01, 0x0c, 0x02,
+    0xcc, 0x01, 0xc4, 0x04, 0x00, 0x01, 0x04, 0x05, 0xcc, 0x01, 0xc7, 0x01,
+    0x78, 0x01, 0xc7, 0x01, 0xcc, 0x01, 0x44, 0x10, 0x00, 0x01, 0x4c, 0x01,
+    0xc4, 0x01, 0x4c, 0x01, 0xcc, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x4c, 0x01,
+    0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01, 0x88, 0x01, 0x8c, 0x01, 0x87, 0x02,
+    0xcc, 0x01, 0xc4, 0x0f, 0x00, 0x01, 0xcc, 0x01, 0xc4, 0x01, 0xc8, 0x02,
+    0xcc, 0x02, 0x00, 0x01, 0x4c, 0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01,
+    0x8c, 0x01, 0xcc, 0x01, 0x78, 0x01, 0xc8, 0x03, 0xcc, 0x0d, 0x00, 0x01,
+    0x08, 0x01, 0xcc, 0x01, 0xc4, 0x01, 0x81, 0x01, 0x7c, 0x02, 0xcc, 0x01,
+    0x4c, 0x02, 0xcc, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01,
+    0x7c, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0x8c, 0x01, 0x40, 0x0c,
+    0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0xc4, 0x01, 0x81, 0x01, 0x17, 0x05,
+    0xcc, 0x01, 0x78, 0x03, 0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc7, 0x02,
+    0x7c, 0x02, 0xcc, 0x01, 0xc7, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x71, 0x01,
+    0x84, 0x01, 0x48, 0x01, 0x77, 0x05, 0xcc, 0x01, 0x87, 0x05, 0xcc, 0x01,
+    0xc7, 0x01, 0xcc, 0x01, 0x77, 0x03, 0xcc, 0x01, 0xc0, 0x0d, 0x00, 0x01,
+    0x71, 0x01, 0x74, 0x01, 0x44, 0x01, 0x77, 0x04, 0xcc, 0x01, 0xc7, 0x01,
+    0xcc, 0x01, 0x88, 0x04, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x77, 0x01,
+    0x7c, 0x02, 0xcc, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x71, 0x01, 0x74, 0x01,
+    0x44, 0x01, 0x88, 0x04, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0xc8, 0x01,
+    0xec, 0x03, 0xcc, 0x01, 0x8c, 0x01, 0xc8, 0x01, 0x7c, 0x01, 0x77, 0x02,
+    0xcc, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x87, 0x01, 0x84, 0x01, 0x44, 0x01,
+    0x4c, 0x05, 0xcc, 0x01, 0xce, 0x05, 0xcc, 0x01, 0x8c, 0x01, 0xc7, 0x01,
+    0xcc, 0x01, 0x87, 0x02, 0xcc, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01,
+    0x04, 0x03, 0xcc, 0x01, 0xc4, 0x01, 0xc8, 0x01, 0x8c, 0x04, 0xcc, 0x01,
+    0xc8, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x8c, 0x03, 0xcc, 0x01, 0xc0, 0x0e,
+    0x00, 0x02, 0x44, 0x01, 0x04, 0x02, 0xcc, 0x02, 0x44, 0x01, 0xcc, 0x01,
+    0xc8, 0x01, 0xec, 0x05, 0xcc, 0x01, 0xce, 0x01, 0x77, 0x01, 0x7c, 0x02,
+    0xcc, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01, 0x04, 0x01, 0xc4, 0x01,
+    0x44, 0x02, 0x00, 0x01, 0xcc, 0x01, 0x78, 0x07, 0xcc, 0x01, 0xc7, 0x01,
+    0x77, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01,
+    0x00, 0x01, 0x40, 0x03, 0x00, 0x01, 0xc6, 0x07, 0xcc, 0x01, 0xc8, 0x02,
+    0x88, 0x02, 0xcc, 0x01, 0x40, 0x0e, 0x00, 0x02, 0x44, 0x05, 0x00, 0x01,
+    0x4c, 0x08, 0xcc, 0x01, 0xc8, 0x01, 0x7c, 0x01, 0x87, 0x01, 0x17, 0x0f,
+    0x00, 0x02, 0x44, 0x05, 0x00, 0x01, 0x4c, 0x07, 0xcc, 0x01, 0x88, 0x01,
+    0x77, 0x01, 0x8c, 0x01, 0x71, 0x01, 0x11, 0x0f, 0x00, 0x02, 0x44, 0x05,
+    0x00, 0x09, 0xcc, 0x01, 0x87, 0x01, 0x7c, 0x01, 0x77, 0x01, 0x17, 0x0f,
+    0x00, 0x02, 0x44, 0x05, 0x00, 0x01, 0xcc, 0x01, 0xc8, 0x07, 0xcc, 0x01,
+    0xc7, 0x01, 0x7c, 0x01, 0xc7, 0x01, 0x78, 0x0f, 0x00, 0x02, 0x44, 0x05,
+    0x00, 0x09, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x80, 0x0f,
+    0x00, 0x02, 0x44, 0x05, 0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01,
+    0x44, 0x01, 0x40, 0x05, 0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01,
+    0x44, 0x01, 0x40, 0x05, 0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01,
+    0x44, 0x01, 0x40, 0x05, 0x00, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01,
+    0x44, 0x01, 0x40, 0x05, 0x00, 0x01, 0x46, 0x01, 0x6c, 0x07, 0xcc, 0x01,
+    0xc8, 0x01, 0x60, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x06,
+    0x00, 0x01, 0x06, 0x01, 0x88, 0x01, 0x86, 0x01, 0x6c, 0x02, 0xcc, 0x01,
+    0xc8, 0x01, 0x88, 0x01, 0x40, 0x11, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01,
+    0x40, 0x07, 0x00, 0x01, 0x08, 0x05, 0x88, 0x01, 0x80, 0x12, 0x00, 0x01,
+    0x04, 0x01, 0x44, 0x01, 0x40, 0x07, 0x00, 0x01, 0x08, 0x01, 0x78, 0x03,
+    0x88, 0x01, 0x77, 0x02, 0x88, 0x01, 0x84, 0x10, 0x00, 0x01, 0x04, 0x01,
+    0x44, 0x01, 0x40, 0x03, 0x00, 0x01, 0x88, 0x06, 0x77, 0x01, 0x88, 0x03,
+    0x77, 0x01, 0x71, 0x02, 0x11, 0x01, 0x77, 0x01, 0x88, 0x0d, 0x00, 0x01,
+    0x04, 0x01, 0x44, 0x01, 0x40, 0x01, 0x00, 0x01, 0x08, 0x01, 0x77, 0x03,
+    0x11, 0x08, 0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x18, 0x0c, 0x00, 0x01,
+    0x04, 0x01, 0x44, 0x01, 0x40, 0x01, 0x00, 0x01, 0x87, 0x05, 0x11, 0x01,
+    0x17, 0x06, 0x77, 0x06, 0x11, 0x01, 0x80, 0x0b, 0x00, 0x01, 0x04, 0x01,
+    0x44, 0x01, 0x40, 0x01, 0x08, 0x01, 0x71, 0x07, 0x11, 0x01, 0x17, 0x04,
+    0x77, 0x01, 0x71, 0x05, 0x11, 0x01, 0x10, 0x0b, 0x00, 0x01, 0x04, 0x01,
+    0x44, 0x01, 0x40, 0x01, 0x08, 0x01, 0x71, 0x06, 0x11, 0x01, 0x17, 0x05,
+    0x77, 0x01, 0x71, 0x05, 0x11, 0x01, 0x18, 0x0b, 0x00, 0x01, 0x04, 0x01,
+    0x44, 0x01, 0x40, 0x01, 0x08, 0x01, 0x71, 0x05, 0x11, 0x01, 0x17, 0x02,
+    0x77, 0x01, 0x88, 0x04, 0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x18, 0x0e,
+    0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x71, 0x04, 0x11, 0x02, 0x77, 0x01,
+    0x88, 0x01, 0x48, 0x01, 0x88, 0x01, 0x87, 0x04, 0x77, 0x01, 0x71, 0x02,
+    0x11, 0x01, 0x18, 0x0e, 0x00, 0x01, 0x08, 0x06, 0x77, 0x01, 0x88, 0x01,
+    0x80, 0x03, 0x00, 0x01, 0x05, 0x02, 0x88, 0x05, 0x77, 0x01, 0x70, 0x0f,
+    0x00, 0x01, 0x58, 0x04, 0x88, 0x0a, 0x00, 0x01, 0x08, 0x02, 0x88, 0xff,
+    0x00, 0xff, 0x00, 0xa4, 0x00, 0xfc, 0x4e, 0x14, 0x20, 0x00, 0x20, 0x00,
+    0x4f, 0x00, 0x02, 0x00, 0x01, 0xe0, 0x09, 0x00, 0x00, 0x00, 0x82, 0x82,
+    0x82, 0x89, 0x89, 0x3a, 0x82, 0x5e, 0x65, 0x5e, 0x5e, 0x34, 0x34, 0x5e,
+    0x5e, 0x34, 0x34, 0xad, 0x3b, 0x34, 0x88, 0x34, 0x58, 0x82, 0xa6, 0x82,
+    0xac, 0x04, 0x5e, 0x58, 0x82, 0x82, 0x04, 0x89, 0x82, 0x3a, 0x5e, 0x5e,
+    0x34, 0x34, 0x34, 0x5e, 0x82, 0x5e, 0x5e, 0x5e, 0x04, 0x8a, 0x58, 0x65,
+    0x82, 0x34, 0xae, 0x82, 0x58, 0x82, 0x04, 0x82, 0x04, 0x82, 0x58, 0x34,
+    0x5e, 0xa0, 0x8a, 0x65, 0x5e, 0x58, 0x5e, 0x34, 0x58, 0x00, 0x34, 0x82,
+    0x82, 0x5e, 0x5e, 0x58, 0x5e, 0xd8, 0xa6, 0xd9, 0xa6, 0x08, 0xcb, 0xa6,
+    0x5e, 0x34, 0x82, 0x82, 0x82, 0x04, 0x82, 0x04, 0x58, 0x5e, 0x34, 0x3a,
+    0x00, 0x5e, 0x34, 0x34, 0x82, 0x00, 0x00, 0x3b, 0x00, 0x34, 0x00, 0x00,
+    0x5f, 0xd2, 0x89, 0xd2, 0xa6, 0xae, 0xca, 0xa6, 0x5e, 0x58, 0x04, 0x82,
+    0x82, 0xac, 0xa6, 0x82, 0xa6, 0x82, 0x00, 0x34, 0x00, 0x3a, 0x5e, 0x3a,
+    0x5e, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x3b, 0xd2, 0xd8, 0xcb,
+    0xad, 0xca, 0x0c, 0xca, 0x82, 0x58, 0x5e, 0x58, 0x82, 0xa6, 0x82, 0x82,
+    0x5e, 0xa6, 0x5e, 0x34, 0x34, 0x88, 0x5e, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x34, 0x5e, 0x58, 0x5e, 0x66, 0xb4, 0xd8, 0xca, 0xa0, 0xa0, 0xa0, 0xa6,
+    0x04, 0x5e, 0x58, 0x5e, 0x82, 0xa6, 0x82, 0x82, 0xac, 0x82, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3a, 0x34, 0x00, 0x34, 0x34, 0x34,
+    0xb5, 0xcb, 0xac, 0x0c, 0x0c, 0xa0, 0xca, 0x04, 0x04, 0x5e, 0x34, 0x58,
+    0x82, 0xac, 0xa6, 0x5e, 0x5e, 0x34, 0x58, 0x34, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x34, 0x5e, 0x00, 0x5e, 0xa6, 0x5e, 0x58, 0xbb, 0xa6, 0xa6, 0xd0,
+    0xac, 0xca, 0x04, 0x58, 0x5e, 0x04, 0x04, 0x82, 0xa6, 0xa6, 0x88, 0x88,
+    0x34, 0x82, 0x58, 0x34, 0x34, 0x00, 0x34, 0x5e, 0x82, 0x34, 0x34, 0x5f,
+    0x88, 0x82, 0x82, 0x65, 0xd9, 0xa0, 0xa6, 0xac, 0xca, 0xa0, 0x3a, 0x34,
+    0x04, 0x82, 0x82, 0x04, 0x82, 0x82, 0x82, 0xa6, 0x82, 0x82, 0x58, 0x3a,
+    0x58, 0x00, 0x5e, 0x82, 0x34, 0x34, 0x88, 0xac, 0xb3, 0x58, 0x3a, 0xae,
+    0xd2, 0xa6, 0xa6, 0xa7, 0xca, 0x04, 0x34, 0x34, 0x5e, 0xa6, 0xa6, 0x82,
+    0x04, 0x82, 0x5e, 0x5e, 0xa0, 0x89, 0xac, 0x3a, 0x34, 0x00, 0x34, 0x88,
+    0x82, 0x34, 0xac, 0xb2, 0xad, 0x00, 0x82, 0xb4, 0xe0, 0x01, 0xe0, 0xd2,
+    0xa7, 0xb5, 0xa6, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xa6, 0x82,
+    0xb5, 0x01, 0x5e, 0x5e, 0x00, 0x00, 0x34, 0x5e, 0x82, 0x5e, 0x34, 0x88,
+    0xb3, 0x82, 0x82, 0xb5, 0x01, 0xe0, 0xad, 0xa6, 0xe0, 0xae, 0x0c, 0xac,
+    0x58, 0x3a, 0x89, 0x58, 0x5e, 0x82, 0x5e, 0xe0, 0x01, 0x01, 0x5e, 0x82,
+    0x5e, 0x34, 0x00, 0x5e, 0xa6, 0x82, 0x58, 0x5e, 0xb3, 0xad, 0xac, 0xe0,
+    0xdf, 0x89, 0xa6, 0xa0, 0xa6, 0x5e, 0x58, 0x82, 0x5e, 0x58, 0x3a, 0x88,
+    0x34, 0x34, 0x07, 0x01, 0x01, 0x01, 0x82, 0x82, 0x34, 0x5e, 0x34, 0x34,
+    0xac, 0x88, 0x82, 0x34, 0x89, 0xb3, 0x89, 0xe0, 0xad, 0x04, 0xa6, 0x82,
+    0x82, 0x3a, 0x00, 0x3a, 0x5e, 0x34, 0x34, 0x34, 0xac, 0x89, 0x01, 0x01,
+    0x01, 0xae, 0x82, 0xac, 0x00, 0x00, 0x82, 0x00, 0x5e, 0x58, 0x82, 0x00,
+    0x34, 0xb3, 0xae, 0xe0, 0x04, 0x82, 0xa6, 0x82, 0xac, 0x82, 0x5e, 0x00,
+    0x88, 0x34, 0x34, 0x00, 0x3a, 0x08, 0x01, 0x01, 0xda, 0x04, 0xac, 0x82,
+    0x82, 0x00, 0x04, 0x34, 0x5e, 0x58, 0x5e, 0x5e, 0x5e, 0x88, 0xd9, 0xd9,
+    0x82, 0x04, 0xa6, 0xa6, 0x88, 0xad, 0xad, 0x00, 0x34, 0x82, 0x82, 0x34,
+    0x00, 0xe0, 0x01, 0x01, 0xae, 0x04, 0xac, 0xa6, 0x82, 0x82, 0x82, 0x5e,
+    0x5e, 0x34, 0x82, 0x34, 0x58, 0x82, 0xb5, 0xb4, 0xa0, 0x82, 0xa0, 0xac,
+    0xa6, 0x3a, 0x5e, 0x5f, 0x34, 0x5e, 0x5e, 0x58, 0x5f, 0x01, 0x01, 0xe6,
+    0xae, 0x04, 0xac, 0xac, 0x88, 0x82, 0x82, 0x82, 0x82, 0x5e, 0x04, 0x82,
+    0x58, 0x82, 0xb5, 0xd2, 0x82, 0xa6, 0x0c, 0xa6, 0x5e, 0x82, 0x5e, 0x34,
+    0x00, 0x5e, 0xac, 0x82, 0x89, 0x01, 0xe6, 0x07, 0x66, 0x00, 0xac, 0xac,
+    0xac, 0xac, 0xac, 0x58, 0x34, 0x3a, 0x82, 0x58, 0x5e, 0x04, 0xbb, 0xad,
+    0xa6, 0xa0, 0x0c, 0x0c, 0x06, 0xb2, 0xb3, 0xac, 0x34, 0x5e, 0x82, 0x88,
+    0x89, 0xe0, 0xb5, 0x58, 0x00, 0x00, 0xac, 0xa6, 0xb3, 0xac, 0xb3, 0x82,
+    0x5e, 0x82, 0x5e, 0x58, 0x58, 0x5e, 0xb5, 0xd1, 0xa0, 0xa6, 0x0c, 0xa6,
+    0x82, 0x82, 0x88, 0x82, 0x5e, 0x5e, 0x5e, 0x5e, 0x82, 0xca, 0x07, 0x8b,
+    0x3a, 0x34, 0xac, 0xa6, 0x88, 0x88, 0xa6, 0xac, 0xa6, 0x58, 0x04, 0x5e,
+    0x58, 0x58, 0x07, 0xad, 0xa6, 0x0c, 0x0c, 0xa0, 0x5e, 0x82, 0x88, 0x34,
+    0x5e, 0x00, 0x34, 0xa6, 0x82, 0xa6, 0xe0, 0x01, 0xad, 0xa0, 0x04, 0x82,
+    0xa6, 0x04, 0xa6, 0x82, 0x82, 0x82, 0x82, 0x82, 0x04, 0x04, 0xbb, 0xd2,
+    0xa6, 0x0c, 0x0c, 0x0c, 0x58, 0x34, 0x00, 0x3a, 0x00, 0x34, 0x5e, 0x88,
+    0xad, 0xac, 0xd9, 0x01, 0xa6, 0x58, 0x82, 0x04, 0x82, 0xac, 0x82, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x58, 0x82, 0x82, 0xad, 0xa6, 0x0c, 0x0c, 0x0c,
+    0xca, 0xa6, 0x00, 0x82, 0x82, 0x58, 0x82, 0xac, 0x5e, 0x82, 0x89, 0x01,
+    0xa7, 0x58, 0x58, 0x34, 0x5e, 0x82, 0x04, 0xa6, 0xa6, 0x82, 0x5e, 0x58,
+    0x04, 0x58, 0x5e, 0x89, 0xcb, 0xa0, 0x0c, 0x0c, 0x0c, 0xa0, 0x34, 0x3a,
+    0x82, 0x04, 0x88, 0x88, 0x58, 0x88, 0xac, 0x07, 0xb5, 0x58, 0xa6, 0x34,
+    0x5e, 0x82, 0x04, 0x82, 0x04, 0xa6, 0x58, 0x58, 0x5e, 0x04, 0x82, 0x82,
+    0xb4, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa0, 0x5e, 0x5e, 0x5e, 0x82, 0x82,
+    0x82, 0x04, 0x82, 0xae, 0x01, 0x82, 0xa6, 0x58, 0x58, 0x82, 0xa6, 0x82,
+    0x3a, 0x82, 0x82, 0x58, 0x58, 0x58, 0x58, 0x58, 0xb4, 0xa6, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0xa0, 0xa6, 0x58, 0x58, 0x04, 0x82, 0xa6, 0x5e, 0xad,
+    0x01, 0xb3, 0x82, 0xac, 0x5e, 0x58, 0x3a, 0x04, 0x82, 0x58, 0x82, 0x58,
+    0x58, 0x5e, 0x58, 0x3a, 0x82, 0xb3, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xa6, 0x58, 0x82, 0x82, 0x82, 0x04, 0x5e, 0xe0, 0xa0, 0x58, 0x82,
+    0xa6, 0x34, 0x00, 0x34, 0xa6, 0x34, 0x82, 0x58, 0x58, 0x58, 0x34, 0x58,
+    0x04, 0xac, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa0, 0x0c, 0xa6, 0x58,
+    0x58, 0x58, 0x82, 0x83, 0xe0, 0x04, 0x58, 0x5e, 0x58, 0x5e, 0x34, 0x00,
+    0x34, 0x5e, 0x58, 0x04, 0x04, 0x58, 0x5e, 0x58, 0x58, 0x04, 0xa6, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0x0c, 0x82, 0xae, 0x90, 0xb5, 0x01,
+    0xe0, 0x82, 0x04, 0x58, 0x34, 0x00, 0x58, 0x34, 0x3a, 0x34, 0x00, 0x5e,
+    0x04, 0x58, 0x58, 0x58, 0x82, 0x58, 0x82, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x82, 0xa6, 0xa0, 0xa6, 0x83, 0xb5, 0x01, 0x01, 0xd9, 0xa6, 0x04, 0x82,
+    0x34, 0x34, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00, 0x34, 0x82, 0x58, 0x58,
+    0x34, 0x58, 0x58, 0xa6, 0x0c, 0x0c, 0x0c, 0xa0, 0x04, 0x82, 0x04, 0x82,
+    0x34, 0x58, 0x5e, 0x08, 0xae, 0xae, 0x34, 0x3a, 0x34, 0x34, 0x5e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3a, 0x58, 0x58, 0x34, 0x5e,
+    0xa0, 0x0c, 0xa6, 0x04, 0x3a, 0x58, 0x04, 0x58, 0x00, 0x58, 0x04, 0x58,
+    0x82, 0x82, 0x58, 0x34, 0x5e, 0x34, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x5e, 0x58, 0x58, 0x82, 0xa0, 0x82, 0x58,
+    0x34, 0x04, 0x58, 0x3a, 0x34, 0x5e, 0x58, 0x5e, 0x04, 0x04, 0x04, 0x00,
+    0x58, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x34,
+    0x58, 0x58, 0x82, 0x04, 0x58, 0x88, 0xa6, 0x58, 0x5e, 0x58, 0x58, 0x3a,
+    0x34, 0x58, 0x04, 0x58, 0x04, 0x82, 0x82, 0x34, 0x5e, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x34, 0x34,
+    0x3a, 0x5e, 0xd8, 0x83, 0xa6, 0x58, 0x82, 0x58, 0x58, 0x04, 0x82, 0xa6,
+    0xa0, 0x82, 0x82, 0x34, 0x04, 0x04, 0x00, 0x34, 0xb4, 0x89, 0x5e, 0x89,
+    0x82, 0x89, 0x89, 0x82, 0x82, 0xb2, 0xae, 0xb3, 0xac, 0x88, 0x01, 0xb5,
+    0x01, 0xd9, 0x82, 0x58, 0x04, 0x04, 0x82, 0xa0, 0x82, 0xa6, 0x34, 0x82,
+    0x58, 0x82, 0x04, 0x88, 0x89, 0x82, 0xac, 0x88, 0x82, 0x89, 0xac, 0x89,
+    0xb3, 0xad, 0xb3, 0xb4, 0xb4, 0xb4, 0xe0, 0xe6, 0x01, 0x01, 0xe1, 0x89,
+    0x04, 0x04, 0xa6, 0xa6, 0xa6, 0xa0, 0x5e, 0x34, 0x34, 0x82, 0xac, 0x82,
+    0xac, 0x88, 0xad, 0xad, 0xb4, 0xad, 0xb4, 0xad, 0xb4, 0xb4, 0x90, 0xb5,
+    0xe0, 0xbb, 0xe1, 0x01, 0x01, 0x01, 0x01, 0xa7, 0xa6, 0xa6, 0xa0, 0xa6,
+    0xa0, 0x82, 0x5e, 0xb4, 0xad, 0x8a, 0xac, 0xb4, 0xb4, 0xb4, 0xb5, 0xbb,
+    0xbb, 0xbb, 0xe0, 0x07, 0xe6, 0xe6, 0xe1, 0x07, 0xe0, 0x07, 0xe0, 0x01,
+    0x01, 0x01, 0xad, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0xa6, 0x04, 0xb3, 0xad,
+    0xba, 0xb3, 0xdf, 0xb5, 0xbb, 0xbb, 0xe0, 0x07, 0xe0, 0xe0, 0x01, 0xe0,
+    0x07, 0xdf, 0xbb, 0xe6, 0xe0, 0xbb, 0xe0, 0x01, 0x01, 0xae, 0x58, 0xa6,
+    0xa6, 0x0c, 0x0c, 0x0c, 0xa0, 0x82, 0xb4, 0x90, 0xbb, 0xb4, 0xb4, 0xdf,
+    0xdf, 0xb5, 0xde, 0xb4, 0xbb, 0xbb, 0xdf, 0xbb, 0xe0, 0x07, 0xe0, 0x07,
+    0xdf, 0xbb, 0xe0, 0x01, 0xe0, 0x3a, 0xa0, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c,
+    0xa0, 0x82, 0xb4, 0xdf, 0xba, 0xb4, 0xba, 0xb4, 0xba, 0xb4, 0xba, 0xdf,
+    0xbb, 0xde, 0xbb, 0xe0, 0x07, 0xdf, 0xbb, 0xdf, 0xba, 0xba, 0xe0, 0x01,
+    0x8a, 0x04, 0xa6, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0x04, 0x5e, 0x89,
+    0xb4, 0xb4, 0x89, 0x8a, 0x90, 0xb4, 0xb4, 0xbb, 0xe0, 0x07, 0xe6, 0xe0,
+    0xbb, 0xdf, 0xba, 0xb4, 0xba, 0xde, 0xb5, 0x01, 0xad, 0xa0, 0x82, 0xa0,
+    0xca, 0x0c, 0x0c, 0x0c, 0x04, 0x58, 0x34, 0x3a, 0x5e, 0x5e, 0x5f, 0xb4,
+    0xb4, 0xdf, 0xdf, 0x8a, 0x90, 0xbb, 0xb4, 0xba, 0xba, 0xd8, 0xba, 0xd8,
+    0xba, 0xd7, 0xb4, 0x01, 0xa7, 0xa6, 0xa6, 0x04, 0xa6, 0xa6, 0x0c, 0xa6,
+    0x58, 0x58, 0x5e, 0x82, 0x88, 0xb3, 0xb3, 0xb3, 0x82, 0xac, 0x88, 0x82,
+    0x5e, 0x58, 0x83, 0xac, 0x82, 0xb4, 0xbb, 0xe6, 0x07, 0xe6, 0xb5, 0x01,
+    0xd8, 0x04, 0x58, 0x04, 0x04, 0xa6, 0xa0, 0x04, 0x04, 0x04, 0x88, 0x82,
+    0xac, 0x88, 0xad, 0xb4, 0xb3, 0xb9, 0xb4, 0xad, 0x88, 0x82, 0x5e, 0x5e,
+    0xad, 0xad, 0xb4, 0xdf, 0xdf, 0xc2, 0xdf, 0xe6, 0x01, 0xe6, 0xb5, 0x82,
+    0x82, 0xa0, 0xa6, 0x04, 0x5e, 0xa6, 0x82, 0xb3, 0xb4, 0xb4, 0xe0, 0xbb,
+    0xe0, 0x01, 0x01, 0xe6, 0x07, 0x01, 0x01, 0x01, 0x01, 0xbb, 0x01, 0x01,
+    0xe6, 0x01, 0xe0, 0x01, 0x01, 0x01, 0x01, 0xad, 0xa0, 0xa6, 0x04, 0x5e,
+    0x04, 0x04, 0x08, 0xe6, 0x01, 0xdf, 0xbb, 0xe0, 0xe6, 0xe6, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0xe6, 0x07, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe0, 0x04, 0x82, 0xa0, 0x82, 0x58, 0x04, 0x82, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0xe6, 0xe0, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x82,
+    0x04, 0x82, 0x04, 0x04, 0x82, 0x04, 0x01, 0xe0, 0x01, 0x01, 0xe0, 0xbb,
+    0xe6, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0xe6, 0x01,
+    0x01, 0xe0, 0xbb, 0x01, 0x01, 0xdf, 0xa6, 0x04, 0x04, 0x04, 0x04, 0x58,
+    0x82, 0x04, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0xe0, 0x01, 0x01, 0xdf, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0x07, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xbb, 0xca, 0x82, 0x04, 0x82, 0x58, 0x04, 0x58, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x01, 0xe6,
+    0x01, 0xe6, 0xdf, 0xba, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0xba, 0xa6,
+    0x04, 0x58, 0x04, 0x58, 0x82, 0xa6, 0x01, 0x01, 0xe6, 0xe0, 0xe6, 0x07,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xdf, 0x01, 0x01, 0xe6, 0x07, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x04, 0x04, 0x58, 0x04,
+    0x82, 0xa0, 0x01, 0xe6, 0xbb, 0xdf, 0xe6, 0xdf, 0xbb, 0xd8, 0xbb, 0xdf,
+    0x01, 0xe6, 0xdf, 0xdf, 0x01, 0xe6, 0x01, 0x01, 0xe0, 0x01, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0xb4, 0x82, 0x58, 0x58, 0x04, 0x82, 0x0c, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0xe6, 0xe6, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0xe6, 0xe0, 0xbb, 0xbb, 0xdf, 0xb4, 0x01, 0x01, 0x01, 0xd9,
+    0x04, 0x58, 0x82, 0xa7, 0xa0, 0xa6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe0, 0xb4, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdf,
+    0xe6, 0x01, 0xe6, 0xe0, 0x01, 0x01, 0x01, 0xae, 0x04, 0x34, 0x07, 0xd1,
+    0x82, 0xa0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xd8, 0x82, 0x66, 0x01, 0xa6, 0x04, 0xa6, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xae,
+    0x58, 0xe0, 0xb4, 0x04, 0x82, 0xa0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb5, 0xa6, 0x82, 0xd8, 0x04, 0x04,
+    0xa6, 0xa6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0xac, 0x04, 0x04, 0x58, 0x5e, 0x04, 0x82, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xca, 0x58,
+    0x00, 0x3a, 0x34, 0x58, 0x04, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xac, 0x04, 0x34, 0x34, 0x5e, 0x58,
+    0x58, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xdf, 0xa6, 0x58, 0x3a, 0x34, 0x58, 0x5e, 0x58, 0x58, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xde, 0xa6, 0x04,
+    0x5e, 0x58, 0x3a, 0x58, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0x01, 0xb4, 0xca, 0x04, 0x04, 0x58, 0x04, 0x04,
+    0x82, 0x7d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xd9, 0xdf, 0xb5, 0xa7, 0x8a, 0x82, 0x83, 0x8a, 0x8a, 0xe0, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0xad, 0xb5, 0xb5,
+    0x08, 0xd9, 0x35, 0x8a, 0xb4, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xdf, 0xbb, 0xe1, 0xad, 0x8a, 0xb6, 0x08, 0xe0, 0x58,
+    0x8a, 0x8b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdf,
+    0xba, 0x8b, 0x07, 0x8a, 0x8a, 0xb5, 0x8b, 0x07, 0x5f, 0x83, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb4, 0x83, 0x08, 0xb6,
+    0x8a, 0x89, 0xb5, 0x08, 0xe0, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xbb, 0xca, 0x5e, 0x58, 0xb4, 0xb6, 0x8a, 0x8a, 0xb4,
+    0x8b, 0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xa7,
+    0x04, 0x34, 0x3a, 0x34, 0x08, 0xb5, 0x8a, 0x5f, 0xad, 0x34, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd9, 0x82, 0x34, 0x5e, 0x58, 0x3a,
+    0x34, 0xae, 0xb6, 0x8a, 0x34, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xae, 0x58, 0x5e, 0x58, 0x58, 0x34, 0x34, 0x3a, 0xa8, 0x90,
+    0x5e, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x58,
+    0x34, 0x04, 0x58, 0x5e, 0x58, 0x00, 0x34, 0x5e, 0x34, 0x3a, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x58, 0x5e, 0x58, 0x58, 0x58,
+    0x3a, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x04, 0x58, 0x5e, 0x34, 0x3a, 0x58, 0x58, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x04, 0x5e,
+    0x58, 0x5e, 0x34, 0x3a, 0x58, 0x3a, 0x00, 0x00, 0x34, 0x3b, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xdf, 0x04, 0x58, 0x58, 0x04, 0x58, 0x34,
+    0x3a, 0x58, 0x34, 0x00, 0x65, 0x8b, 0xfd, 0x4e, 0x14, 0x1f, 0x00, 0x1f,
+    0x00, 0x4f, 0x00, 0x02, 0x00, 0x01, 0x91, 0x09, 0x00, 0x00, 0x00, 0x82,
+    0x00, 0x34, 0x34, 0x34, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+    0x00, 0x5e, 0x5e, 0x82, 0x83, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x16, 0x66,
+    0x89, 0xb4, 0x58, 0x5e, 0x00, 0x00, 0x04, 0x58, 0x00, 0x34, 0x00, 0x34,
+    0x5e, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x88, 0x88, 0x34,
+    0x00, 0x00, 0x00, 0x00, 0x35, 0x89, 0x8a, 0x5f, 0x88, 0x82, 0x34, 0x00,
+    0x00, 0x82, 0x82, 0x34, 0x00, 0x00, 0x34, 0x58, 0x5e, 0x00, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x34, 0x5e, 0x3a, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3a,
+    0x5e, 0x5e, 0x89, 0x88, 0x88, 0x82, 0x82, 0x58, 0x82, 0x04, 0x82, 0x58,
+    0x00, 0x00, 0x34, 0x58, 0x00, 0x34, 0x5e, 0x34, 0x34, 0x00, 0x00, 0x00,
+    0x58, 0x3a, 0x3b, 0x34, 0x5f, 0x00, 0x34, 0xb4, 0xad, 0x88, 0x34, 0x5e,
+    0x58, 0x3a, 0x83, 0x04, 0x82, 0x04, 0x5e, 0x34, 0x34, 0x3a, 0x34, 0x00,
+    0x00, 0x3a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x65, 0xca, 0xa7, 0xca,
+    0x5f, 0x5e, 0xd2, 0xa7, 0x82, 0x58, 0x58, 0x5e, 0x5e, 0x5e, 0x88, 0x83,
+    0x88, 0x04, 0x58, 0x00, 0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x34,
+    0x34, 0x00, 0x5e, 0xa8, 0x0c, 0xa7, 0xca, 0xad, 0xa6, 0xb4, 0xad, 0x82,
+    0x88, 0x82, 0x34, 0x34, 0x3a, 0xac, 0x88, 0x04, 0x82, 0x34, 0x00, 0x00,
+    0x34, 0x3a, 0x34, 0x34, 0x34, 0x58, 0x04, 0x00, 0x3a, 0x82, 0xca, 0xca,
+    0xa6, 0xd6, 0xa6, 0xba, 0xd9, 0xb3, 0xa6, 0x5e, 0x58, 0x34, 0x3a, 0x58,
+    0x88, 0xa6, 0x88, 0x82, 0x58, 0x34, 0x00, 0x34, 0x34, 0x00, 0x00, 0x5e,
+    0x5e, 0x5e, 0x34, 0x34, 0x82, 0x82, 0x0c, 0xd0, 0xac, 0xd6, 0xb4, 0xdf,
+    0xbb, 0x5e, 0x5e, 0x34, 0x3a, 0x5e, 0x58, 0x82, 0x88, 0xb3, 0x88, 0xae,
+    0x04, 0x5e, 0x00, 0x00, 0x58, 0x00, 0x34, 0x00, 0xac, 0x3a, 0x34, 0x5e,
+    0x5e, 0xa0, 0xac, 0xd8, 0xb9, 0xb9, 0xde, 0xb9, 0xdf, 0x5e, 0x5e, 0x34,
+    0x00, 0x3a, 0xb5, 0xde, 0xbb, 0xdf, 0xe6, 0xb4, 0x58, 0x34, 0x00, 0x00,
+    0x00, 0x3a, 0xae, 0x5e, 0x00, 0x5e, 0x58, 0x3a, 0x5e, 0x82, 0xd6, 0xc0,
+    0xdd, 0xb8, 0xdc, 0xbb, 0x04, 0x5e, 0x34, 0x00, 0x34, 0xe6, 0x07, 0x82,
+    0xde, 0xbb, 0xb3, 0x04, 0x3a, 0x00, 0x00, 0x34, 0x3b, 0x65, 0x00, 0x34,
+    0x89, 0x5e, 0x34, 0x82, 0x58, 0xac, 0xb3, 0xdd, 0xb8, 0xd6, 0xba, 0x83,
+    0x5e, 0x3a, 0x34, 0x00, 0xdf, 0xad, 0x82, 0x82, 0xac, 0xac, 0xa6, 0x34,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x88, 0x82, 0x8a, 0xad, 0xa0,
+    0xae, 0xd0, 0xb9, 0xb2, 0xd6, 0xb3, 0xae, 0x34, 0x00, 0x00, 0x5f, 0xe0,
+    0xac, 0xa0, 0xa6, 0xa6, 0xd0, 0xac, 0x82, 0x34, 0x34, 0x00, 0x00, 0x00,
+    0x34, 0x88, 0x82, 0x04, 0xad, 0x0c, 0xac, 0xd7, 0xac, 0xb3, 0xd6, 0xd0,
+    0xb2, 0xd8, 0x34, 0x16, 0x34, 0x00, 0xa6, 0x0c, 0xa0, 0x0c, 0x0c, 0xac,
+    0xd0, 0xb3, 0xac, 0x58, 0x00, 0x00, 0x00, 0x00, 0x34, 0x5e, 0x58, 0x34,
+    0x5e, 0x04, 0xa6, 0xd0, 0xac, 0xb2, 0xb3, 0xb2, 0xad, 0x00, 0x34, 0x34,
+    0x5e, 0xa0, 0xa0, 0x0c, 0x0c, 0x0c, 0xca, 0xb2, 0xde, 0x82, 0x58, 0x00,
+    0x00, 0x3a, 0x58, 0x00, 0x34, 0x82, 0x88, 0xac, 0x5e, 0x5e, 0xa6, 0xa6,
+    0xca, 0xa6, 0xd6, 0x89, 0x00, 0x34, 0x3a, 0x82, 0xa6, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xac, 0xe0, 0xa6, 0x3a, 0x00, 0x00, 0x34, 0x88, 0x5e, 0x5e,
+    0x34, 0x3a, 0x34, 0x82, 0x00, 0x5e, 0x90, 0xa7, 0xca, 0xac, 0x8a, 0x3a,
+    0x3a, 0x34, 0x5e, 0x82, 0x0c, 0xa6, 0x04, 0x04, 0xa0, 0xac, 0xe0, 0x04,
+    0x58, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00,
+    0x00, 0x8a, 0xa6, 0xa0, 0xd0, 0xad, 0x3a, 0x82, 0x89, 0xb2, 0x34, 0x34,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0xdf, 0x5e, 0x82, 0x34, 0x00, 0x00, 0x00,
+    0x5e, 0x00, 0x34, 0x34, 0x34, 0x34, 0x65, 0x34, 0xb4, 0x82, 0xa0, 0xca,
+    0xb3, 0x34, 0x00, 0x5e, 0xa6, 0x00, 0x34, 0x34, 0x00, 0x00, 0x34, 0xa6,
+    0xb3, 0x34, 0x5e, 0x82, 0x5e, 0x5e, 0x34, 0x5e, 0x5e, 0x5e, 0x89, 0x5e,
+    0x66, 0xb3, 0x5e, 0xb5, 0x04, 0x04, 0xca, 0x8f, 0x00, 0x3b, 0xb4, 0x88,
+    0x00, 0x82, 0xa0, 0x82, 0x04, 0x0c, 0xac, 0x0c, 0x82, 0x34, 0x34, 0x00,
+    0x34, 0x5e, 0x5e, 0x34, 0x5e, 0x34, 0x3b, 0x5e, 0xb4, 0x5e, 0xdf, 0x58,
+    0x82, 0xca, 0xac, 0x34, 0x5e, 0x5e, 0x82, 0x34, 0x04, 0x0c, 0xa0, 0xa0,
+    0x0c, 0x0c, 0xa0, 0x58, 0x34, 0x00, 0x34, 0x00, 0x3a, 0x82, 0x3a, 0x34,
+    0x3a, 0x34, 0x00, 0x3a, 0xad, 0xd9, 0x82, 0x04, 0xd0, 0xb2, 0x89, 0x88,
+    0xad, 0x82, 0x00, 0x82, 0xa0, 0xa6, 0x58, 0xa0, 0xca, 0x82, 0x58, 0x00,
+    0x89, 0x5f, 0x3a, 0x83, 0x00, 0x5e, 0x89, 0x82, 0x5f, 0x00, 0x00, 0x90,
+    0xd8, 0x58, 0xa0, 0xac, 0xd0, 0xad, 0xad, 0x64, 0x82, 0x34, 0xa6, 0xad,
+    0x89, 0x58, 0x0c, 0xd0, 0x34, 0x00, 0x5e, 0x34, 0x65, 0x34, 0x5e, 0x5e,
+    0x34, 0x88, 0x89, 0x89, 0x8a, 0x5e, 0xb5, 0xd8, 0x04, 0xa0, 0xd0, 0xb3,
+    0x89, 0x5e, 0x5e, 0x5e, 0x34, 0x5e, 0xa0, 0xa0, 0x0c, 0xca, 0x88, 0x34,
+    0x34, 0x3a, 0x34, 0x34, 0x5e, 0xad, 0x89, 0x3a, 0x5e, 0x34, 0x34, 0x16,
+    0x5f, 0xbb, 0xd7, 0x82, 0x0c, 0xb2, 0xac, 0x82, 0x89, 0x89, 0x89, 0x58,
+    0x04, 0xca, 0x0c, 0x0c, 0xac, 0x58, 0x34, 0x88, 0x82, 0x82, 0x5e, 0x64,
+    0x5f, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x34, 0xae, 0xb4, 0xa0, 0xca,
+    0xb2, 0x82, 0x3a, 0x34, 0x00, 0x08, 0xa6, 0x04, 0xa0, 0x0c, 0x0c, 0xa6,
+    0x04, 0x3a, 0x5e, 0x5e, 0x3a, 0x00, 0x34, 0x00, 0x00, 0x5f, 0x88, 0x89,
+    0x89, 0x58, 0x82, 0x04, 0x04, 0xa0, 0x0c, 0xca, 0xad, 0x3b, 0x89, 0x89,
+    0x88, 0x04, 0x58, 0xa6, 0x0c, 0x0c, 0xa0, 0x58, 0x34, 0x00, 0x00, 0x58,
+    0x34, 0x65, 0x89, 0xb4, 0x88, 0x82, 0x04, 0x58, 0xa6, 0x04, 0x04, 0xa6,
+    0xa0, 0x0c, 0xa0, 0x5f, 0x65, 0xad, 0x88, 0x88, 0x58, 0xa6, 0x0c, 0x0c,
+    0x0c, 0xa6, 0x89, 0x8a, 0x8a, 0xb4, 0x8f, 0xb4, 0xad, 0x89, 0xad, 0xb4,
+    0x5e, 0x58, 0x82, 0xa6, 0x04, 0x82, 0xa0, 0x0c, 0x82, 0x34, 0x00, 0x34,
+    0x88, 0x82, 0x88, 0x04, 0x82, 0x0c, 0x0c, 0x0c, 0x0c, 0x89, 0xb3, 0xb3,
+    0x5f, 0x89, 0xb3, 0xb4, 0xb4, 0xb4, 0x5e, 0x3a, 0x04, 0xa6, 0xa0, 0xa6,
+    0xa0, 0x0c, 0xa6, 0x5e, 0x58, 0x00, 0x00, 0x5f, 0x89, 0x89, 0xa0, 0xa6,
+    0x0c, 0xa0, 0x0c, 0x0c, 0xa7, 0xad, 0x58, 0x65, 0x08, 0x07, 0x89, 0x11,
+    0x00, 0x34, 0x58, 0x04, 0x82, 0xa6, 0x0c, 0x0c, 0x0c, 0x3a, 0x34, 0x34,
+    0x3a, 0x3b, 0x34, 0x3a, 0x35, 0xa6, 0x04, 0xa0, 0xa6, 0x0c, 0xa6, 0x0c,
+    0x82, 0x04, 0xb4, 0x5f, 0x34, 0x00, 0x00, 0x34, 0x58, 0x58, 0x04, 0xa6,
+    0xa6, 0xa0, 0x0c, 0x82, 0x58, 0x89, 0x88, 0x82, 0x82, 0x5f, 0x5f, 0x34,
+    0x04, 0x5e, 0x04, 0x82, 0x04, 0x82, 0x04, 0x5e, 0x34, 0x00, 0x00, 0x34,
+    0x5e, 0x34, 0x04, 0x58, 0x82, 0xa6, 0xa6, 0xa0, 0x0c, 0x04, 0x34, 0x5e,
+    0x82, 0x82, 0x3a, 0x82, 0x5e, 0x82, 0x04, 0x82, 0x04, 0x82, 0xa6, 0x04,
+    0x04, 0x58, 0x34, 0x00, 0x00, 0x34, 0x04, 0x04, 0x5e, 0x58, 0x04, 0x04,
+    0x82, 0xa0, 0x0c, 0xa6, 0x5e, 0x82, 0x82, 0x88, 0x82, 0x5e, 0x82, 0x5e,
+    0x88, 0x82, 0x04, 0x82, 0x04, 0x04, 0x04, 0x58, 0x5e, 0x34, 0x34, 0x00,
+    0x82, 0xa6, 0x04, 0x58, 0x04, 0x04, 0x82, 0xa0, 0xa6, 0xac, 0x89, 0xad,
+    0xb3, 0xad, 0x89, 0xb4, 0xb3, 0x89, 0xb4, 0xb3, 0xb4, 0x82, 0x04, 0x82,
+    0x04, 0x04, 0x82, 0x58, 0x58, 0x34, 0x82, 0xa0, 0xa0, 0x04, 0x58, 0x58,
+    0x82, 0xa6, 0xa6, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb5, 0xb4, 0xb3, 0xae,
+    0xb5, 0xb5, 0xb4, 0xb4, 0xa6, 0x04, 0x04, 0x58, 0x04, 0x04, 0x82, 0x04,
+    0x82, 0x0c, 0x0c, 0x82, 0x04, 0x82, 0xa0, 0xa6, 0xae, 0xb4, 0xe0, 0xb5,
+    0xbb, 0xbb, 0xbb, 0xb5, 0xe0, 0xbb, 0xbb, 0xbb, 0xb4, 0xe0, 0xb5, 0x82,
+    0x04, 0x58, 0x04, 0x82, 0x82, 0xa6, 0xa0, 0x0c, 0x0c, 0xa0, 0x0c, 0x0c,
+    0x0c, 0xa6, 0x82, 0xb5, 0x90, 0x07, 0xdf, 0xb6, 0xdf, 0xb5, 0xe0, 0xc2,
+    0xb5, 0xd9, 0xbb, 0xdf, 0xe0, 0x07, 0x04, 0x34, 0x58, 0x04, 0x58, 0x04,
+    0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0xdf, 0xc2, 0xb4, 0x07,
+    0xb4, 0xe0, 0xbb, 0xbb, 0xb4, 0x8a, 0xdf, 0xb5, 0x90, 0xb4, 0xbb, 0xb4,
+    0xbb, 0x58, 0x5e, 0x58, 0x5e, 0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xa6, 0xd8, 0xe0, 0xe0, 0xbb, 0xe0, 0x07, 0xbb, 0xe0, 0x07, 0xe0,
+    0xc2, 0xe0, 0xe0, 0xb5, 0xba, 0x89, 0x8a, 0xe0, 0x58, 0x58, 0x5e, 0x34,
+    0x00, 0x00, 0x04, 0xa0, 0x0c, 0xca, 0x0c, 0xca, 0xad, 0xdf, 0xbb, 0xe6,
+    0xe6, 0x07, 0xe6, 0xe0, 0x07, 0xe0, 0xe6, 0xb5, 0xe6, 0xbb, 0x07, 0xdf,
+    0x07, 0xde, 0x07, 0x04, 0x58, 0x04, 0x58, 0x00, 0x00, 0x82, 0x0c, 0x0c,
+    0x0c, 0xca, 0xa6, 0xdf, 0xdf, 0x07, 0xdf, 0x07, 0xdf, 0xc2, 0xe0, 0xc2,
+    0xdf, 0xe0, 0xbb, 0xbb, 0xe0, 0xe0, 0xc2, 0xe0, 0xbb, 0xe0, 0x58, 0x04,
+    0x04, 0x58, 0x00, 0x5e, 0xa0, 0x0c, 0xca, 0xca, 0x0c, 0xb4, 0xdf, 0xbb,
+    0xe6, 0x01, 0xe6, 0xe0, 0xe6, 0xe6, 0xe0, 0xc2, 0xe6, 0xe6, 0xe0, 0xe6,
+    0xbb, 0xdf, 0xe6, 0x01, 0xe0, 0x34, 0x04, 0x5e, 0x04, 0x04, 0xa0, 0x0c,
+    0x0c, 0xac, 0xca, 0xac, 0xdf, 0xc2, 0xdf, 0xc2, 0xde, 0xdf, 0xc2, 0xe0,
+    0xe6, 0x01, 0xe6, 0xe0, 0xe6, 0xe6, 0xbb, 0xdf, 0x01, 0xbb, 0xe0, 0xe6,
+    0x58, 0x04, 0x04, 0x82, 0x0c, 0x0c, 0xca, 0xca, 0xac, 0xca, 0xba, 0xdf,
+    0xe6, 0xe6, 0xe0, 0xbb, 0xbb, 0xdf, 0xc1, 0xdf, 0xbb, 0xe6, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x04, 0x5e, 0x04, 0x82, 0x0c,
+    0x0c, 0x0c, 0xa6, 0xca, 0xac, 0xdf, 0x07, 0xe6, 0xe0, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xe0, 0xe6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xa6, 0x04, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0xd8,
+    0xe6, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa6, 0xa6, 0xa0,
+    0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xb5, 0x08, 0xb5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0x01, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xd2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x07,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82,
+    0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xb4, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xe1, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x82, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01,
+    0x01, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0xd2, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd9, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x0c, 0x0c,
+    0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdf, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x0c, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xa0, 0xa6, 0x04, 0x82, 0x0c, 0x0c, 0x0c, 0xd1, 0xe6, 0xe6, 0x01, 0xe6,
+    0x01, 0x07, 0xe6, 0xe6, 0xe0, 0x01, 0x01, 0x07, 0xe0, 0x01, 0xe6, 0x07,
+    0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x82, 0x04, 0x82, 0x0c,
+    0x0c, 0x0c, 0xa0, 0xb4, 0xe0, 0xe6, 0x01, 0xe0, 0xe0, 0xe6, 0x07, 0xe6,
+    0xbb, 0xdf, 0xe0, 0xe6, 0xe0, 0xb4, 0xdf, 0xe6, 0xba, 0xb4, 0xdf, 0xe6,
+    0xc2, 0xd9, 0xa6, 0x04, 0x04, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0xa0, 0xe6,
+    0x01, 0x01, 0xe6, 0x01, 0xe6, 0xe6, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6, 0xe6, 0xe0, 0xdf, 0xa6, 0x04, 0xa6,
+    0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0xe0, 0xe6, 0x07, 0xbb, 0x82, 0x04, 0x82, 0xa0, 0xca, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xa6, 0xe6, 0x01, 0x01, 0xbb, 0xe0, 0xe6, 0xe6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x04,
+    0x82, 0xa0, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0xbb, 0xbb, 0xe0,
+    0xe6, 0xb4, 0xe6, 0xbb, 0xe0, 0x01, 0x01, 0x01, 0xe0, 0xe6, 0xe0, 0xe6,
+    0x01, 0x01, 0x01, 0x01, 0xe6, 0xdf, 0x04, 0x82, 0x82, 0x04, 0xa6, 0xa0,
+    0x0c, 0x0c, 0x0c, 0xa6, 0xe0, 0xbb, 0xdf, 0xe0, 0xe6, 0xe0, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0x01, 0xba, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x04, 0x04, 0x82, 0x04, 0xa6, 0xa0, 0xa0, 0xa0, 0x0c, 0x0c, 0xd2,
+    0xe6, 0xb3, 0x83, 0xdf, 0xdf, 0xbb, 0xb3, 0xe6, 0x01, 0xe6, 0x01, 0x01,
+    0xdf, 0x01, 0x01, 0x01, 0xbb, 0xe0, 0xe6, 0x01, 0x82, 0xa0, 0x83, 0x8a,
+    0xb5, 0x83, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0xbb, 0xe0, 0xe6, 0x01, 0x01,
+    0xe6, 0xe0, 0x07, 0xde, 0xba, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0x04, 0xae, 0xb4, 0x8b, 0x8a, 0x5e, 0xa0, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xd9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0,
+    0x01, 0xbb, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xaf, 0x5e,
+    0x8a, 0xa7, 0x58, 0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0xd9, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xbb, 0xde, 0xbb, 0xe0, 0x01,
+    0x01, 0x01, 0xe6, 0xe0, 0xe6, 0x07, 0xd3, 0x58, 0x5e, 0x58, 0x34, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xd2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0xe0, 0xe6, 0xad, 0xd1, 0xb4, 0x07, 0x01, 0x01, 0x01,
+    0x8a, 0x8a, 0x58, 0x04, 0x5e, 0x58, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xa7,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xbb,
+    0xd9, 0xba, 0x88, 0x07, 0x01, 0x01, 0x01, 0xae, 0x34, 0x58, 0x04, 0x04,
+    0x04, 0x82, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0xd8, 0xb4, 0xe6, 0x01,
+    0x01, 0x01, 0x34, 0x58, 0x5e, 0x58, 0x58, 0x04, 0x82, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6,
+    0x01, 0x01, 0x07, 0x01, 0xdf, 0xb4, 0x01, 0x01, 0x01, 0x34, 0x3a, 0x58,
+    0x58, 0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xdf, 0x01, 0xe6,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xe0, 0xbb,
+    0xd9, 0xb3, 0xae, 0x8a, 0x34, 0x3a, 0x34, 0x5e, 0x58, 0x04, 0xa6, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xb5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xe6, 0xb5, 0xb4, 0x82, 0xa6, 0xba, 0xac, 0x34,
+    0x34, 0x3a, 0x58, 0x58, 0x04, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xd8,
+    0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xb3, 0x89, 0xb4, 0xdf, 0xe0, 0xbb, 0x3a, 0x00, 0x34, 0x5e, 0x04, 0x04,
+    0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xae, 0x01, 0xe6, 0xe0, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb5, 0xd8, 0xbb, 0xdf, 0x07, 0xe6,
+    0x01, 0x34, 0x34, 0x3a, 0x58, 0x04, 0x82, 0x82, 0xa6, 0xa0, 0x0c, 0x0c,
+    0x0c, 0xd2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0x01, 0xe0, 0xc2, 0xe0, 0xe0, 0x34, 0x3a, 0x34, 0x58,
+    0x58, 0x04, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x0c, 0xae, 0xe6, 0x01, 0xe6,
+    0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xb5,
+    0x01, 0x01, 0xe6, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x82, 0xa0, 0xa6, 0xa0,
+    0xca, 0x0c, 0x0c, 0xd9, 0x01, 0x01, 0xe0, 0xe6, 0x01, 0xe6, 0x01, 0x01,
+    0xe0, 0x01, 0xe6, 0xe6, 0xbb, 0xe0, 0xe6, 0x07, 0x07, 0xbb, 0x3a, 0x34,
+    0x34, 0x3a, 0x04, 0x04, 0x82, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x07, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6,
+    0x01, 0xdf, 0x01, 0x01, 0x01, 0x34, 0x34, 0x3a, 0x34, 0x58, 0x04, 0x82,
+    0xa0, 0xa6, 0xa0, 0xca, 0xa0, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xfe, 0x4e, 0x14, 0x1e, 0x00, 0x1e, 0x00, 0x4f, 0x00, 0x02, 0x04, 0x1f,
+    0x6a, 0x04, 0x00, 0x00, 0x00, 0x1a, 0xb9, 0x01, 0xb5, 0x01, 0x8a, 0x01,
+    0x83, 0x01, 0x04, 0x01, 0xb9, 0x01, 0xbb, 0x03, 0xb9, 0x01, 0xbb, 0x15,
+    0xb9, 0x01, 0x8b, 0x01, 0x83, 0x01, 0x7d, 0x01, 0xbb, 0x01, 0xb9, 0x01,
+    0xbb, 0x18, 0xb9, 0x01, 0x08, 0x01, 0x84, 0x01, 0x04, 0x01, 0x08, 0x1a,
+    0xb9, 0x01, 0xbb, 0x01, 0x8a, 0x01, 0x7d, 0x01, 0x08, 0x1b, 0xb9, 0x01,
+    0x8b, 0x02, 0x83, 0x01, 0x08, 0x1a, 0xb9, 0x01, 0x08, 0x01, 0x84, 0x01,
+    0x04, 0x01, 0x84, 0x01, 0x08, 0x19, 0xb9, 0x01, 0xbb, 0x01, 0x89, 0x01,
+    0x7d, 0x01, 0x83, 0x01, 0x8a, 0x01, 0x08, 0x16, 0xb9, 0x01, 0xbb, 0x01,
+    0xba, 0x01, 0xb3, 0x01, 0x89, 0x02, 0x7d, 0x01, 0x83, 0x01, 0x8b, 0x01,
+    0x08, 0x13, 0xb9, 0x01, 0xbb, 0x01, 0xb9, 0x03, 0xdc, 0x01, 0x8f, 0x03,
+    0x7d, 0x01, 0x83, 0x01, 0x8b, 0x01, 0x97, 0x10, 0xb9, 0x01, 0xbb, 0x01,
+    0xb9, 0x06, 0xdc, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x83, 0x01, 0x7d, 0x01,
+    0x83, 0x01, 0x08, 0x10, 0xb9, 0x01, 0xb3, 0x07, 0xdc, 0x02, 0x04, 0x01,
+    0x7d, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x84, 0x01, 0x08, 0x0c, 0xb9, 0x01,
+    0xb4, 0x0a, 0xdc, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x83, 0x03, 0x04, 0x01,
+    0x8a, 0x01, 0x08, 0x0a, 0xb9, 0x01, 0xb3, 0x0b, 0xdc, 0x01, 0x04, 0x01,
+    0x7d, 0x02, 0x04, 0x01, 0x82, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x8a, 0x01,
+    0x08, 0x08, 0xb9, 0x01, 0xb3, 0x0c, 0xdc, 0x03, 0x04, 0x01, 0x7d, 0x03,
+    0x04, 0x01, 0x83, 0x01, 0x8b, 0x06, 0xb9, 0x01, 0xbb, 0x01, 0xb3, 0x0d,
+    0xdc, 0x01, 0x04, 0x03, 0x7d, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x04, 0x02,
+    0x83, 0x01, 0x08, 0x04, 0xb9, 0x01, 0xba, 0x0f, 0xdc, 0x02, 0x7d, 0x01,
+    0x04, 0x01, 0x7d, 0x02, 0x04, 0x03, 0x83, 0x01, 0x84, 0x01, 0x08, 0x02,
+    0xbb, 0x01, 0xb9, 0x10, 0xdc, 0x02, 0x7d, 0x02, 0x04, 0x02, 0x7d, 0x04,
+    0x83, 0x01, 0x8a, 0x01, 0x90, 0x01, 0xb3, 0x11, 0xdc, 0x03, 0x04, 0x01,
+    0x7d, 0x01, 0x04, 0x05, 0x83, 0x01, 0x5f, 0x01, 0x89, 0x01, 0xb3, 0x11,
+    0xdc, 0x01, 0x7d, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x04, 0x05, 0x83, 0x01,
+    0x5f, 0x01, 0x42, 0x01, 0x43, 0x01, 0x8f, 0x01, 0xb3, 0x10, 0xdc, 0x01,
+    0x82, 0x07, 0x83, 0x01, 0x5f, 0x01, 0x42, 0x02, 0x1f, 0x01, 0x43, 0x01,
+    0x8f, 0x10, 0xdc, 0x01, 0x82, 0x06, 0x83, 0x01, 0x5f, 0x01, 0x42, 0x04,
+    0x1f, 0x01, 0x66, 0x01, 0x8f, 0x0f, 0xdc, 0x02, 0x83, 0x01, 0x82, 0x03,
+    0x83, 0x01, 0x5f, 0x01, 0x3c, 0x06, 0x1f, 0x01, 0x66, 0x01, 0x8f, 0x0e,
+    0xdc, 0x01, 0x83, 0x01, 0x82, 0x03, 0x83, 0x01, 0x59, 0x01, 0x3c, 0x08,
+    0x1f, 0x01, 0x6c, 0x01, 0xb3, 0x0d, 0xdc, 0x01, 0x83, 0x01, 0x82, 0x01,
+    0x04, 0x01, 0x83, 0x01, 0x7d, 0x01, 0x3b, 0x07, 0x1f, 0x01, 0x19, 0x02,
+    0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0c, 0xdc, 0x02, 0x82, 0x01, 0x83, 0x01,
+    0x7d, 0x01, 0x3b, 0x01, 0x1e, 0x0b, 0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0b,
+    0xdc, 0x01, 0x04, 0x02, 0x7d, 0x01, 0x59, 0x01, 0x18, 0x0d, 0x1f, 0x01,
+    0x66, 0x01, 0x8f, 0x0a, 0xdc, 0x01, 0x7d, 0x01, 0x04, 0x01, 0x59, 0x01,
+    0x18, 0x0f, 0x1f, 0x01, 0x43, 0x02, 0xb3, 0x08, 0xdc, 0x01, 0x83, 0x01,
+    0x59, 0x01, 0x18, 0x11, 0x1f, 0x01, 0x66, 0x02, 0xb3, 0x07, 0xdc, 0x01,
+    0x83, 0x01, 0x18, 0x13, 0x1f, 0x01, 0x6c, 0x01, 0xb3, 0x07, 0xdc, 0x01,
+    0x60, 0x15, 0x1f, 0x01, 0x6c, 0x01, 0xb3, 0x06, 0xdc, 0x01, 0x43, 0x16,
+    0x1f, 0x01, 0x8f, 0x06, 0xdc, 0x05, 0x1f, 0x01, 0x19, 0x11, 0x1f, 0x01,
+    0x43, 0x01, 0x8f, 0x03, 0xdc, 0x01, 0xb3, 0x01, 0xe6, 0x18, 0x1f, 0x01,
+    0x42, 0x01, 0x8f, 0x01, 0xdc, 0x01, 0xb9, 0x02, 0xe6, 0x19, 0x1f, 0x01,
+    0x42, 0x01, 0x90, 0x01, 0xbb, 0x01, 0x07, 0x01, 0xe6, 0x01, 0x42, 0x18,
+    0x1f, 0x01, 0x1e, 0x01, 0x41, 0x01, 0x08, 0x01, 0xbb, 0x01, 0xe6, 0x01,
+    0x8f, 0x01, 0x66, 0x01, 0x43, 0x15, 0x1f, 0x01, 0x1d, 0x02, 0x40, 0x01,
+    0x65, 0x01, 0x08, 0x01, 0xbb, 0x02, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01,
+    0x42, 0x01, 0x1e, 0x01, 0x18, 0x10, 0x1f, 0x01, 0x1e, 0x04, 0x41, 0x01,
+    0x6b, 0x01, 0x97, 0x04, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x01,
+    0x1e, 0x0e, 0x1f, 0x01, 0x1e, 0x03, 0x40, 0x01, 0x41, 0x02, 0x40, 0x01,
+    0x6b, 0x06, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x0c, 0x1f, 0x01,
+    0x1e, 0x01, 0x41, 0x07, 0x40, 0x08, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01,
+    0x42, 0x02, 0x1f, 0x01, 0x19, 0x01, 0x1f, 0x01, 0x19, 0x05, 0x1f, 0x01,
+    0x41, 0x04, 0x40, 0x01, 0x41, 0x03, 0x40, 0x0a, 0xdc, 0x01, 0x06, 0x01,
+    0x65, 0x01, 0x42, 0x07, 0x19, 0x01, 0x1e, 0x02, 0x40, 0x01, 0x41, 0x06,
+    0x40, 0x0c, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x05, 0x19, 0x01,
+    0x41, 0x09, 0x40, 0x0f, 0xdc, 0x01, 0x65, 0x01, 0x42, 0x01, 0x18, 0x01,
+    0x19, 0x01, 0x18, 0x0a, 0x40, 0x11, 0xdc, 0x01, 0x89, 0x01, 0x42, 0x01,
+    0x41, 0x0a, 0x40, 0x12, 0xdc, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0x41, 0x09,
+    0x40, 0x12, 0xdc, 0x01, 0xb3, 0x01, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x01,
+    0x41, 0x07, 0x40, 0x12, 0xdc, 0x01, 0xb4, 0x02, 0xe6, 0x02, 0x97, 0x01,
+    0x90, 0x01, 0x66, 0x01, 0x41, 0x04, 0x40, 0x12, 0xdc, 0x01, 0x08, 0x06,
+    0xe6, 0x01, 0x08, 0x01, 0x6b, 0x01, 0x41, 0x02, 0x40, 0x11, 0xdc, 0x01,
+    0xb3, 0x09, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x01, 0x40, 0x11, 0xdc, 0x01,
+    0xb4, 0x0b, 0xe6, 0x01, 0x08, 0x11, 0xdc, 0x01, 0xba, 0x0c, 0xe6, 0x11,
+    0xdc, 0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xb3, 0x0d, 0xe6, 0x10, 0xdc, 0x01,
+    0xb9, 0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xb9, 0x0d, 0xe6, 0x10, 0xdc, 0x01,
+    0xba, 0x0d, 0xe6, 0x02, 0x41, 0x04, 0x65, 0x02, 0x89, 0x06, 0x8f, 0x02,
+    0xb3, 0x01, 0xb4, 0x0d, 0xe6, 0x05, 0x19, 0x01, 0x18, 0x01, 0x1e, 0x04,
+    0x19, 0x03, 0x43, 0x01, 0x19, 0x02, 0x42, 0x02, 0x41, 0x0a, 0x65, 0x01,
+    0x6c, 0x10, 0x19, 0x01, 0x42, 0x01, 0x40, 0x01, 0x41, 0x09, 0x40, 0x01,
+    0x41, 0x01, 0x40, 0x10, 0x19, 0x01, 0x42, 0x01, 0x41, 0x08, 0x40, 0x01,
+    0x41, 0x03, 0x40, 0x02, 0x19, 0x01, 0x1f, 0x0d, 0x19, 0x01, 0x42, 0x0d,
+    0x40, 0x10, 0x19, 0x01, 0x42, 0x0b, 0x40, 0x01, 0x41, 0x01, 0x40, 0x11,
+    0x19, 0x0d, 0x40, 0x11, 0x19, 0x0b, 0x40, 0x01, 0x41, 0x01, 0x40, 0x11,
+    0x19, 0x01, 0x41, 0x0a, 0x40, 0x02, 0x41, 0x11, 0x19, 0x01, 0x41, 0x06,
+    0x40, 0x01, 0x41, 0x01, 0x40, 0x02, 0x41, 0x01, 0x66, 0x01, 0x90, 0x11,
+    0x19, 0x01, 0x41, 0x06, 0x40, 0x02, 0x41, 0x01, 0x6c, 0x01, 0x08, 0x02,
+    0x07, 0x11, 0x19, 0x01, 0x1e, 0x02, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01,
+    0x41, 0x01, 0x65, 0x01, 0x90, 0x01, 0x08, 0x04, 0x07, 0x0b, 0x19, 0x01,
+    0x1f, 0x05, 0x19, 0x01, 0x18, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01,
+    0x6c, 0x01, 0x08, 0x07, 0x07, 0x0f, 0x19, 0x02, 0x18, 0x01, 0x3c, 0x01,
+    0x65, 0x01, 0x90, 0x0a, 0x07, 0x0d, 0x19, 0x02, 0x18, 0x01, 0x42, 0x01,
+    0x89, 0x01, 0xb2, 0x01, 0xb3, 0x0b, 0x07, 0x0b, 0x19, 0x01, 0x18, 0x01,
+    0x3c, 0x01, 0x65, 0x01, 0x06, 0x04, 0xb2, 0x01, 0x90, 0x0a, 0x07, 0x07,
+    0x19, 0x03, 0x18, 0x01, 0x41, 0x01, 0x89, 0x07, 0xb2, 0x01, 0xb3, 0x0a,
+    0x07, 0x01, 0x1f, 0x06, 0x19, 0x01, 0x3b, 0x01, 0x65, 0x01, 0x06, 0x0a,
+    0xb2, 0x01, 0x90, 0x09, 0x07, 0x05, 0x19, 0x01, 0x41, 0x01, 0x88, 0x0e,
+    0xb2, 0x01, 0x90, 0x08, 0x07, 0x02, 0x19, 0x01, 0x3b, 0x01, 0x64, 0x01,
+    0x06, 0x10, 0xb2, 0x01, 0xb3, 0x01, 0x07, 0x01, 0x97, 0x05, 0x07, 0x01,
+    0x90, 0x01, 0x41, 0x01, 0x64, 0x01, 0x06, 0x13, 0xb2, 0x01, 0xb4, 0x04,
+    0x07, 0x01, 0xbb, 0x01, 0x90, 0x01, 0x40, 0x01, 0x06, 0x16, 0xb2, 0x01,
+    0xba, 0x03, 0x07, 0x01, 0x6c, 0x02, 0x40, 0xff, 0x4e, 0x14, 0x1f, 0x00,
+    0x1f, 0x00, 0x4f, 0x00, 0x02, 0x04, 0x01, 0x7e, 0x06, 0x00, 0x00, 0x00,
+    0x01, 0x82, 0x0e, 0x83, 0x02, 0x7d, 0x03, 0x83, 0x01, 0xbb, 0x0a, 0xb9,
+    0x09, 0x83, 0x01, 0x82, 0x03, 0x83, 0x01, 0x04, 0x03, 0x7d, 0x03, 0x83,
+    0x01, 0xbb, 0x0a, 0xb9, 0x01, 0x04, 0x01, 0x82, 0x11, 0x83, 0x01, 0x84,
+    0x01, 0x97, 0x07, 0xbb, 0x03, 0xb9, 0x01, 0x7d, 0x09, 0x83, 0x04, 0x60,
+    0x05, 0x3c, 0x01, 0x66, 0x01, 0xb4, 0x06, 0xb9, 0x04, 0xbb, 0x01, 0x7d,
+    0x04, 0x83, 0x01, 0x5f, 0x01, 0x60, 0x02, 0x3c, 0x01, 0x43, 0x09, 0x1f,
+    0x01, 0x66, 0x01, 0xb3, 0x02, 0xdc, 0x02, 0xb3, 0x01, 0xdc, 0x03, 0xb3,
+    0x01, 0xb9, 0x01, 0xba, 0x02, 0x83, 0x01, 0x60, 0x01, 0x3c, 0x01, 0x43,
+    0x0e, 0x1f, 0x01, 0x66, 0x03, 0xdc, 0x01, 0xb9, 0x07, 0xdc, 0x01, 0x3c,
+    0x12, 0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0a, 0xdc, 0x01, 0x42, 0x12, 0x1f,
+    0x01, 0x66, 0x0b, 0xdc, 0x01, 0x66, 0x12, 0x1f, 0x01, 0x66, 0x01, 0xb3,
+    0x0a, 0xdc, 0x01, 0x66, 0x12, 0x1f, 0x01, 0x66, 0x0b, 0xdc, 0x01, 0x89,
+    0x01, 0x42, 0x11, 0x1f, 0x01, 0x66, 0x0b, 0xdc, 0x01, 0x8f, 0x01, 0x42,
+    0x11, 0x1f, 0x01, 0x66, 0x0c, 0xdc, 0x01, 0x66, 0x11, 0x1f, 0x01, 0x66,
+    0x0c, 0xdc, 0x01, 0x89, 0x01, 0x43, 0x10, 0x1f, 0x01, 0x66, 0x0c, 0xdc,
+    0x01, 0x8f, 0x01, 0x66, 0x10, 0x1f, 0x01, 0x6c, 0x0d, 0xdc, 0x01, 0x66,
+    0x10, 0x1f, 0x01, 0x8f, 0x0d, 0xdc, 0x01, 0x89, 0x01, 0x42, 0x0f, 0x1f,
+    0x01, 0x8f, 0x01, 0xb3, 0x0c, 0xdc, 0x01, 0xb3, 0x01, 0x66, 0x0f, 0x1f,
+    0x01, 0x8f, 0x0e, 0xdc, 0x01, 0x66, 0x0f, 0x1f, 0x01, 0x8f, 0x0e, 0xdc,
+    0x01, 0x8f, 0x01, 0x43, 0x0e, 0x1f, 0x01, 0x8f, 0x0f, 0xdc, 0x01, 0x66,
+    0x0d, 0x1f, 0x01, 0x42, 0x01, 0xb3, 0x0f, 0xdc, 0x01, 0x89, 0x01, 0x43,
+    0x0c, 0x1f, 0x01, 0x43, 0x01, 0xb3, 0x0f, 0xdc, 0x01, 0xb3, 0x01, 0x66,
+    0x01, 0x92, 0x01, 0x43, 0x0a, 0x1f, 0x01, 0x43, 0x01, 0xb3, 0x10, 0xdc,
+    0x01, 0x89, 0x01, 0xbd, 0x01, 0x43, 0x0a, 0x1f, 0x01, 0x42, 0x11, 0xdc,
+    0x01, 0x8f, 0x01, 0x98, 0x0b, 0x1f, 0x01, 0x42, 0x01, 0xdc, 0x01, 0xb3,
+    0x0f, 0xdc, 0x01, 0xb3, 0x01, 0x6d, 0x05, 0x1f, 0x04, 0x1e, 0x01, 0x1d,
+    0x02, 0x41, 0x01, 0xba, 0x01, 0xbb, 0x05, 0xba, 0x01, 0xb9, 0x0a, 0xdc,
+    0x01, 0x66, 0x02, 0x1f, 0x01, 0x1e, 0x01, 0x1d, 0x05, 0x41, 0x02, 0x40,
+    0x01, 0x65, 0x05, 0xe6, 0x03, 0xbb, 0x03, 0xba, 0x01, 0xb9, 0x06, 0xdc,
+    0x01, 0x8f, 0x01, 0x66, 0x03, 0x41, 0x02, 0x40, 0x01, 0x41, 0x01, 0x40,
+    0x02, 0x41, 0x01, 0x40, 0x01, 0x6b, 0x0a, 0xe6, 0x01, 0xbb, 0x01, 0xba,
+    0x05, 0xdc, 0x01, 0xba, 0x01, 0xbb, 0x01, 0x66, 0x01, 0x41, 0x04, 0x40,
+    0x05, 0x41, 0x01, 0x6b, 0x0b, 0xe6, 0x01, 0x08, 0x03, 0xdc, 0x01, 0xba,
+    0x02, 0xbb, 0x01, 0x07, 0x01, 0x90, 0x02, 0x41, 0x02, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x04, 0x41, 0x01, 0x66, 0x0b, 0xe6, 0x01, 0x6c, 0x01, 0xdc,
+    0x01, 0xb3, 0x02, 0xbb, 0x01, 0xe6, 0x02, 0xbb, 0x01, 0x08, 0x02, 0x41,
+    0x03, 0x40, 0x03, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x6c, 0x0a, 0xe6,
+    0x02, 0x23, 0x01, 0xba, 0x06, 0xe6, 0x01, 0xbb, 0x01, 0x6c, 0x03, 0x41,
+    0x02, 0x40, 0x04, 0x41, 0x01, 0x6c, 0x0a, 0xe6, 0x01, 0x6c, 0x01, 0x23,
+    0x07, 0xe6, 0x01, 0xbb, 0x01, 0x90, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x05, 0x41, 0x01, 0x6c, 0x0a, 0xe6, 0x02, 0x23, 0x08, 0xe6,
+    0x01, 0x97, 0x01, 0x6b, 0x02, 0x40, 0x06, 0x41, 0x01, 0x6c, 0x09, 0xe6,
+    0x03, 0x23, 0x08, 0xe6, 0x01, 0xbb, 0x01, 0x6c, 0x01, 0x46, 0x01, 0x40,
+    0x06, 0x41, 0x01, 0x6c, 0x09, 0xe6, 0x03, 0x23, 0x09, 0xe6, 0x01, 0x90,
+    0x01, 0x65, 0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x6c,
+    0x08, 0xe6, 0x04, 0x23, 0x09, 0xe6, 0x01, 0x97, 0x01, 0x6b, 0x01, 0x46,
+    0x01, 0x40, 0x05, 0x41, 0x01, 0x6c, 0x08, 0xe6, 0x01, 0x6c, 0x03, 0x23,
+    0x01, 0xbb, 0x09, 0xe6, 0x01, 0x6c, 0x01, 0x46, 0x04, 0x40, 0x02, 0x41,
+    0x01, 0x90, 0x08, 0xe6, 0x04, 0x23, 0x01, 0x08, 0x09, 0xe6, 0x01, 0x08,
+    0x01, 0x47, 0x03, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x90,
+    0x07, 0xe6, 0x05, 0x23, 0x01, 0x6c, 0x0a, 0xe6, 0x01, 0x6b, 0x01, 0x41,
+    0x02, 0x40, 0x03, 0x41, 0x01, 0x90, 0x07, 0xe6, 0x05, 0x23, 0x01, 0x40,
+    0x01, 0x6c, 0x09, 0xe6, 0x01, 0x6c, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x02, 0x41, 0x01, 0x08, 0x06, 0xe6, 0x06, 0x23, 0x02, 0x40,
+    0x01, 0x6c, 0x01, 0xbb, 0x07, 0xe6, 0x01, 0x08, 0x01, 0x41, 0x01, 0x40,
+    0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x08, 0x06, 0xe6,
+    0x02, 0x23, 0x01, 0x47, 0x03, 0x23, 0x02, 0x40, 0x01, 0x41, 0x01, 0x90,
+    0x08, 0xe6, 0x01, 0x6b, 0x05, 0x40, 0x01, 0x97, 0x05, 0xe6, 0x07, 0x23,
+    0x04, 0x40, 0x01, 0x90, 0x07, 0xe6, 0x01, 0x6c, 0x04, 0x40, 0x01, 0x46,
+    0x01, 0x97, 0x05, 0xe6, 0x01, 0x6b, 0x06, 0x23, 0x04, 0x40, 0x01, 0x41,
+    0x01, 0x08, 0x06, 0xe6, 0x01, 0x08, 0x03, 0x41, 0x01, 0x46, 0x01, 0x47,
+    0x01, 0x97, 0x04, 0xe6, 0x01, 0x23, 0x01, 0x47, 0x02, 0x23, 0x02, 0x47,
+    0x01, 0x23, 0x01, 0x47, 0x05, 0x40, 0x01, 0x41, 0x01, 0x08, 0x06, 0xe6,
+    0x01, 0x65, 0x01, 0x40, 0x03, 0x47, 0x01, 0x97, 0x04, 0xe6, 0x01, 0x6c,
+    0x03, 0x23, 0x01, 0x46, 0x03, 0x23, 0x02, 0x40, 0x01, 0x41, 0x03, 0x40,
+    0x01, 0x65, 0x01, 0x08, 0x05, 0xe6, 0x01, 0x6c, 0x01, 0x47, 0x01, 0x6b,
+    0x02, 0x47, 0x04, 0xe6, 0x01, 0x23, 0x02, 0x47, 0x02, 0x23, 0x01, 0x47,
+    0x02, 0x23, 0x01, 0xbb, 0x02, 0x40, 0x01, 0x41, 0x04, 0x40, 0x01, 0x6b,
+    0x01, 0x08, 0x04, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x03, 0x6b, 0x04, 0xe6,
+    0x01, 0x6c, 0x01, 0x46, 0x05, 0x23, 0x01, 0xbb, 0x01, 0xe6, 0x01, 0x41,
+    0x07, 0x40, 0x01, 0x6c, 0x01, 0x08, 0x04, 0xe6, 0x02, 0x6c, 0x02, 0x6b,
+    0x04, 0xe6, 0x06, 0x23, 0x01, 0xbb, 0x02, 0xe6, 0x01, 0x40, 0x01, 0x41,
+    0x07, 0x40, 0x01, 0x6c, 0x04, 0xe6, 0x01, 0x08, 0x03, 0x6c, 0x03, 0xe6,
+    0x01, 0x90, 0x05, 0x23, 0x01, 0xbb, 0x03, 0xe6, 0x01, 0x6c, 0x01, 0x41,
+    0x08, 0x40, 0x01, 0x90, 0x04, 0xe6, 0x01, 0x97, 0x05, 0xe6, 0x01, 0x6c,
+    0x01, 0x6b, 0x03, 0x23, 0x01, 0xbb, 0x05, 0xe6, 0x01, 0x08, 0x01, 0x6c,
+    0x01, 0x41, 0x06, 0x40, 0x01, 0x41, 0x01, 0x90, 0x01, 0xbb, 0x09, 0xe6,
+    0x01, 0x6c, 0x01, 0x23, 0x01, 0x6b, 0x09, 0xe6, 0x01, 0x97, 0x01, 0x6c,
+    0x01, 0x41, 0x06, 0x40, 0x01, 0xbb, 0x01, 0xe6, 0x01, 0xb5, 0x05, 0xae,
+    0x01, 0xb5, 0x02, 0xe6, 0x01, 0x23, 0x0c, 0xe6, 0x01, 0x97, 0x01, 0x6c,
+    0x01, 0x65, 0x03, 0x40, 0x01, 0x6b, 0x01, 0x07, 0x01, 0x90, 0x01, 0x7d,
+    0x02, 0xa7, 0x05, 0xae, 0x07, 0xe6, 0x01, 0x97, 0x01, 0x23, 0x08, 0xe6,
+    0x01, 0x90, 0x01, 0x65, 0x01, 0x41, 0x01, 0xbb, 0x01, 0xb5, 0x02, 0x04,
+    0x01, 0x7d, 0x01, 0xa7, 0x02, 0xae, 0x02, 0xa8, 0x01, 0xae, 0x01, 0xaf,
+    0x04, 0xe6, 0x01, 0x90, 0x02, 0x6b, 0x01, 0x47, 0x08, 0xe6, 0x01, 0x07,
+    0x01, 0xbb, 0x01, 0x97, 0x01, 0x07, 0x01, 0x84, 0x01, 0x7d, 0x02, 0x04,
+    0x01, 0xa7, 0x02, 0xae, 0x01, 0xa8, 0x03, 0xae, 0x01, 0xb5, 0x01, 0xe6,
+    0x06, 0x23, 0x08, 0xe6, 0x03, 0x07, 0x01, 0xbb, 0x01, 0x83, 0x03, 0x04,
+    0x03, 0xa7, 0x04, 0xae, 0x01, 0xb5, 0x01, 0xe6, 0x06, 0x23, 0x08, 0xe6,
+    0x03, 0x07, 0x01, 0x08, 0x02, 0x7d, 0x02, 0x04, 0x01, 0x83, 0x02, 0xa7,
+    0x01, 0xae, 0x02, 0xaf, 0x02, 0xae, 0x01, 0xe6, 0x06, 0x23, 0x06, 0x6c,
+    0x04, 0x90, 0x01, 0x07, 0x01, 0x08, 0x04, 0x04, 0x01, 0x83, 0x01, 0xa7,
+    0x04, 0xae, 0x02, 0xa7, 0x01, 0xe6, 0x01, 0x97, 0x01, 0x90, 0x04, 0x6c,
+    0x0a, 0x40, 0x01, 0x07, 0x01, 0x08, 0x02, 0x04, 0x03, 0x7d, 0x01, 0xa7,
+    0x03, 0xae, 0x01, 0xa7, 0x01, 0x83, 0x01, 0xa8, 0x07, 0xe6, 0x0a, 0x40,
+    0x01, 0xbb, 0x01, 0xb5, 0x01, 0x83, 0x01, 0x04, 0x03, 0x7d, 0x02, 0xa7,
+    0x03, 0xae, 0x01, 0x83, 0x01, 0xae, 0x07, 0xe6, 0x0a, 0x40, 0x01, 0x08,
+    0x01, 0x07, 0x01, 0x8a, 0x04, 0x04, 0x01, 0x83, 0x01, 0xa7, 0x03, 0xae,
+    0x01, 0x83, 0x01, 0xb5, 0x01, 0xe6, 0x01, 0xbb, 0x05, 0xe6, 0x02, 0x40,
+    0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x65, 0x01, 0x08, 0x02, 0x07,
+    0x01, 0x08, 0x01, 0x83, 0x03, 0x04, 0x01, 0x7d, 0x02, 0xa7, 0x03, 0xae,
+    0x01, 0x07, 0x01, 0x08, 0x01, 0x65, 0x01, 0x90, 0x01, 0x97, 0x03, 0xe6,
+    0x05, 0x40, 0x01, 0x65, 0x01, 0x6c, 0x01, 0x97, 0x05, 0x07, 0x01, 0x08,
+    0x01, 0x83, 0x03, 0x04, 0x02, 0xa7, 0x02, 0xae, 0x02, 0x07, 0x01, 0x65,
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x65, 0x01, 0x6c, 0x01, 0x08, 0x01, 0xe6,
+    0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x66, 0x01, 0x08, 0x06, 0x07,
+    0x01, 0xbb, 0x01, 0x08, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x8a, 0x03, 0x83,
+    0x01, 0xae, 0x01, 0xaf, 0x02, 0x07, 0x01, 0x90, 0x01, 0x41, 0x01, 0x40,
+    0x01, 0x41, 0x01, 0x40, 0x02, 0x41, 0x01, 0x6c, 0x01, 0x41, 0x01, 0x6c,
+    0x01, 0x08, 0x07, 0x07, 0x01, 0xbb, 0x01, 0x65, 0x01, 0x41, 0x01, 0x90,
+    0x02, 0xbb, 0x01, 0xb5, 0x02, 0x08, 0x04, 0x07, 0x01, 0x08, 0x01, 0x66,
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x0a, 0x07, 0x01, 0x65, 0x03, 0x40, 0x01, 0x6c, 0x04, 0xbb, 0x01, 0x07,
+    0x01, 0xbb, 0x02, 0x07, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x6c, 0x03, 0x40,
+    0x02, 0x41, 0x08, 0x07, 0x01, 0x08, 0x01, 0x41, 0x04, 0x40, 0x01, 0x90,
+    0x02, 0xbb, 0x01, 0x08, 0x01, 0x65, 0x02, 0x23, 0x01, 0x08, 0x03, 0xbb,
+    0x01, 0x08, 0x01, 0x6c, 0x01, 0x40, 0x03, 0x41, 0x07, 0x07, 0x01, 0x08,
+    0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x08, 0x02, 0xbb, 0x01, 0x08,
+    0x03, 0x23, 0x01, 0x90, 0x01, 0x08, 0x01, 0xbb, 0x02, 0x07, 0x01, 0x97,
+    0x01, 0x6c, 0x03, 0x41, 0x05, 0x07, 0x01, 0x08, 0x01, 0x90, 0x01, 0x41,
+    0x05, 0x40, 0x01, 0x6c, 0x02, 0x97, 0x02, 0x08, 0x04, 0x23, 0x01, 0x08,
+    0x04, 0x07, 0x01, 0x97, 0x01, 0x6c, 0x02, 0x41, 0x05, 0x07, 0x01, 0x90,
+    0x07, 0x40, 0x01, 0x08, 0x01, 0x97, 0x01, 0xbb, 0x01, 0x97, 0x01, 0x90,
+    0x04, 0x23, 0x01, 0x90, 0x05, 0x07, 0x01, 0x97, 0x01, 0x6c, 0x01, 0x41,
+    0x04, 0x07, 0x01, 0x90, 0x07, 0x40, 0x01, 0x6b, 0x01, 0xbb, 0x01, 0x97,
+    0x01, 0x08, 0x01, 0xbb, 0x01, 0x90, 0x04, 0x23, 0x01, 0x6c, 0x06, 0x07,
+    0x01, 0x97, 0x01, 0x6c, 0x03, 0x07, 0x01, 0x90, 0x08, 0x40, 0x01, 0x08,
+    0x04, 0xbb, 0x01, 0x08, 0x05, 0x23, 0x01, 0xbb, 0x06, 0x07, 0x01, 0xbb,
+    0x02, 0x07, 0x01, 0x90, 0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x02, 0x40,
+    0x01, 0x6c, 0x05, 0x07, 0x01, 0x90, 0x05, 0x23, 0x01, 0x90, 0x08, 0x07,
+    0x01, 0x90, 0x01, 0x40, 0x01, 0x41, 0x06, 0x40, 0x01, 0x41, 0x01, 0x97,
+    0x05, 0x07, 0x01, 0x90, 0x05, 0x23, 0x01, 0x6c, 0x07, 0x07, 0x01, 0x90,
+    0x07, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x6c, 0x06, 0x07, 0x01, 0x90,
+    0x06, 0x23, 0x01, 0x08, 0x06, 0x07, 0x02, 0x40, 0x01, 0x41, 0x04, 0x40,
+    0x01, 0x41, 0x02, 0x40, 0x01, 0x97, 0x06, 0x07, 0x01, 0x6c, 0x06, 0x23,
+    0x01, 0x6c, 0x06, 0x07, 0x01, 0x40, 0x01, 0x41, 0x05, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x01, 0x6b, 0x07, 0x07, 0x01, 0x6c, 0x06, 0x23, 0x01, 0x65,
+    0x01, 0x97, 0x05, 0x07, 0x09, 0x40, 0x01, 0x97, 0x07, 0x07, 0x01, 0x6c,
+    0x07, 0x23, 0x01, 0x08, 0x05, 0x07, 0x01, 0x4f, 0x14, 0x09, 0x00, 0x09,
+    0x00, 0x14, 0x00, 0x02, 0x04, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x0b, 0x14, 0x30, 0x38, 0xa3, 0x19, 0xdc, 0x36, 0x34, 0x56, 0x4f, 0x14,
+    0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x44, 0x41, 0x11, 0x11, 0x44, 0x41, 0x11, 0x11, 0x11, 0x14, 0x11, 0x44,
+    0x11, 0x14, 0x41, 0x44, 0x11, 0x11, 0x11, 0x14, 0x41, 0x44, 0x11, 0x14,
+    0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x44, 0x41, 0x11, 0x11, 0x44, 0x41,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14,
+    0x41, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x14, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x57, 0x4f,
+    0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x1f, 0xff, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11,
+    0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11,
+    0xf1, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11,
+    0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11,
+    0x1f, 0x11, 0x11, 0xff, 0xf1, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11,
+    0x11, 0xff, 0xf1, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0xff,
+    0xf1, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0xf1, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11,
+    0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x1f, 0xff, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58,
+    0x4f, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x04, 0x01, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x06, 0x22, 0x04, 0x11, 0x06, 0x22,
+    0x04, 0x11, 0x01, 0x22, 0x01, 0x01, 0x02, 0x11, 0x01, 0x10, 0x01, 0x22,
+    0x04, 0x11, 0x01, 0x22, 0x01, 0x10, 0x02, 0x11, 0x01, 0x01, 0x01, 0x22,
+    0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11,
+    0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10,
+    0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x10,
+    0x01, 0x01, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11,
+    0x01, 0x10, 0x01, 0x01, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22,
+    0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11,
+    0x01, 0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x01, 0x22,
+    0x04, 0x11, 0x01, 0x22, 0x01, 0x10, 0x02, 0x11, 0x01, 0x01, 0x01, 0x22,
+    0x04, 0x11, 0x01, 0x22, 0x01, 0x01, 0x02, 0x11, 0x01, 0x10, 0x01, 0x22,
+    0x04, 0x11, 0x06, 0x22, 0x04, 0x11, 0x06, 0x22, 0x20, 0x11, 0x78, 0x50,
+    0x14, 0xb7, 0x00, 0xb7, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x08,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+    0x03, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x01,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x01, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x10, 0x7f, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x30, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf0, 0x38, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xf0, 0x78, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xe0, 0x7c, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xe0, 0xfc, 0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x9f, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+    0xfe, 0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc1, 0xc6,
+    0x07, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x3f, 0x8f, 0xf8, 0xff,
+    0x3f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x81, 0xc7, 0x07,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x3f, 0x07, 0xf0, 0x7f, 0x3f,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x83, 0x83, 0x03, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x07, 0xf0, 0x7f, 0x9f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x03, 0x83, 0x83, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x07, 0xf0, 0x7f, 0x9f, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x07, 0x83, 0x81, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x8f, 0xf8, 0xff, 0x9f, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x07, 0x83, 0xc1, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xfe, 0x0f, 0x83, 0xc0, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xfc, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xfc, 0x1f, 0x83, 0xe0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xf8, 0x1f, 0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
+    0x3f, 0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x3f,
+    0x83, 0xf0, 0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x7f, 0x83,
+    0xf8, 0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0x7f, 0x83, 0xf8,
+    0x1f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x0f, 0xff, 0xcf,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0xff, 0x83, 0xfc, 0x1f,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xf0, 0x03, 0xff, 0x9f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xff, 0x83, 0xfc, 0x0f, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xc3, 0xf0, 0xff, 0x9f, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xc1, 0xff, 0x83, 0xfe, 0x0f, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x8f, 0xfc, 0x7f, 0x9f, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0x81, 0xff, 0x83, 0xfe, 0x07, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0x3f, 0x1f, 0xfe, 0x3f, 0x3f, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0x83, 0xff, 0x83, 0xff, 0x07, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0x3e, 0x3f, 0xff, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0x03, 0xff, 0xc7, 0xff, 0x03, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0x9f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0x07, 0xff, 0xc7, 0xff, 0x83, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0x9f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe,
+    0x07, 0xff, 0xff, 0xff, 0x81, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x0f,
+    0xff, 0xff, 0xff, 0xc1, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x0f, 0xff,
+    0xff, 0xff, 0xc0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xff, 0xc7,
+    0xff, 0xe0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xff, 0x83, 0xff,
+    0xe0, 0x7f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf0,
+    0x7f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x3f,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x7f, 0xff, 0xc7, 0xff, 0xf8, 0x3f, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x50, 0x14, 0xb7,
+    0x00, 0xb7, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x08, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x83,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x03, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf8, 0x10, 0x7f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xf8, 0x30, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xf0, 0x38, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xf0, 0x78, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0,
+    0x7c, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0, 0xfc,
+    0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xfe, 0x0f,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc1, 0xc6, 0x07, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xf8, 0x0f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x81, 0xc7, 0x07, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xf0, 0x07, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x83, 0x83, 0x03, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xe0, 0x03, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0x03, 0x83, 0x83, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xc0, 0x01, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0x07, 0x83, 0x81, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xc1, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xfe, 0x07, 0x83, 0xc1, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc,
+    0x00, 0x0f, 0x83, 0xff, 0x83, 0xc0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xfe, 0x0f, 0x83, 0xc0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00,
+    0x0f, 0x84, 0x1f, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xfc, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f,
+    0x80, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xfc,
+    0x1f, 0x83, 0xe0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0x00,
+    0x07, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8, 0x1f,
+    0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07,
+    0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8, 0x3f, 0x83,
+    0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x83,
+    0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x3f, 0x83, 0xf0,
+    0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x7f, 0x83, 0xf8, 0x3f,
+    0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0x7f, 0x83, 0xf8, 0x1f, 0xff,
+    0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0xff, 0x83, 0xfc, 0x1f, 0xff, 0xe7,
+    0xe7, 0xff, 0xfc, 0x00, 0x0e, 0x0f, 0x83, 0x81, 0xc0, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xff, 0x83, 0xfc, 0x0f, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xfe, 0x07, 0x07, 0xc1, 0xc1, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xc1, 0xff, 0x83, 0xfe, 0x0f, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x07, 0xc0, 0x01, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0x81, 0xff, 0x83, 0xfe, 0x07, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x0f, 0xe0, 0x03, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0x83, 0xff, 0x83, 0xff, 0x07, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x1f, 0xf0, 0x07, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0x03, 0xff, 0xc7, 0xff, 0x03, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x3f, 0xf8, 0x0f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0x07,
+    0xff, 0xc7, 0xff, 0x83, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x07, 0xff,
+    0xff, 0xff, 0x81, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x0f, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x0f, 0xff, 0xff, 0xff,
+    0xc0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xff, 0xc7, 0xff, 0xe0,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xff, 0x83, 0xff, 0xe0, 0x7f,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x7f, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xf0, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x3f, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xf0, 0x7f, 0xff, 0xc7, 0xff, 0xf8, 0x3f, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xc0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x50, 0x14, 0x3c, 0x00, 0x3c,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf1, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0x76, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0x17, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x67, 0xef, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xfc, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x79, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x1e, 0x77, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0xe7, 0x97, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0xf8, 0x60, 0x00, 0x0b, 0xff, 0xf0, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xdd, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x01, 0xe3,
+    0x7f, 0x06, 0xff, 0xf0, 0xff, 0xf9, 0xf9, 0xcc, 0x7e, 0x78, 0xff, 0xf0,
+    0xff, 0xf9, 0xfd, 0x9e, 0x7d, 0xfc, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0x9f,
+    0x79, 0xfc, 0xff, 0xf0, 0xff, 0xf9, 0xf7, 0x8f, 0x73, 0xfe, 0xff, 0xf0,
+    0xff, 0xf9, 0xf7, 0xc7, 0xf3, 0xff, 0xff, 0xf0, 0xff, 0xf8, 0x07, 0xe1,
+    0xf3, 0xff, 0xff, 0xf0, 0xff, 0xf9, 0xf7, 0xf8, 0xf3, 0xff, 0xff, 0xf0,
+    0xff, 0xf9, 0xf7, 0xfc, 0x73, 0xff, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xbe,
+    0x33, 0xff, 0xff, 0xf0, 0xff, 0xf9, 0xfe, 0xbf, 0x39, 0xfe, 0xff, 0xf0,
+    0xff, 0xf9, 0xfd, 0x9f, 0x39, 0xfd, 0xff, 0xf0, 0xff, 0xf9, 0xf9, 0x8e,
+    0x7c, 0x7b, 0xff, 0xf0, 0xff, 0xe0, 0x01, 0xb0, 0xff, 0x07, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xde, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe,
+    0x00, 0x07, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+    0x00, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xff,
+    0xf0, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x1f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff,
+    0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x1c, 0xf9, 0xcf, 0x0f, 0xff,
+    0xf0, 0xff, 0xff, 0x24, 0xaa, 0x24, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0x20,
+    0x22, 0x24, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0x18, 0x22, 0x24, 0x8f, 0xff,
+    0xf0, 0xff, 0xff, 0x04, 0x22, 0x27, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x24,
+    0x22, 0x24, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x38, 0x71, 0xce, 0x0f, 0xff,
+    0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff,
+    0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x1f, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff,
+    0xf0, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+    0x00, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe,
+    0x00, 0x07, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0x50, 0x14,
+    0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xfc, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xe0, 0x30, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x70, 0x00, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0x80, 0xe0, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff,
+    0x81, 0xe0, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x03, 0xe0, 0x00, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x0f, 0xff, 0x80, 0x3f, 0xff, 0xf0, 0xff, 0xfe, 0x07, 0xff, 0xc0, 0x1f,
+    0xff, 0xf0, 0xff, 0xfe, 0x03, 0xe3, 0xe0, 0x1f, 0xff, 0xf0, 0xff, 0xfe,
+    0x01, 0xe0, 0xe0, 0x1f, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0xe0, 0xe0, 0x1f,
+    0xff, 0xf0, 0xff, 0xff, 0x00, 0x70, 0xe0, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x00, 0x30, 0xe0, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x80, 0x00, 0xe0, 0x7f, 0xff, 0xf0, 0xff, 0xff,
+    0x80, 0x00, 0xe0, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0xe0, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xf0, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0x50, 0x14, 0x3c, 0x00, 0x3c,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0xff,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc3, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xe1, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xe2, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0xff, 0xff, 0xff,
+    0xe6, 0x7f, 0xf9, 0x9f, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf,
+    0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xfc, 0xff,
+    0xdf, 0xbf, 0xf7, 0xef, 0xf0, 0xff, 0xfe, 0x7f, 0x9f, 0x9f, 0xe7, 0xe7,
+    0xf0, 0xff, 0xff, 0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xf8, 0x00, 0x1f,
+    0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xf8, 0x00, 0x1f, 0x9f, 0x9f, 0xe7, 0xe7,
+    0xf0, 0xff, 0xff, 0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xfe, 0x7f,
+    0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xfc, 0xff, 0x9f, 0x9f, 0xe7, 0xe7,
+    0xf0, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xf7, 0xef, 0xf0, 0xff, 0xff, 0xff,
+    0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf,
+    0xf0, 0xff, 0xff, 0xff, 0xe6, 0x78, 0xf9, 0x9f, 0xf0, 0xff, 0xff, 0xff,
+    0xf0, 0xf8, 0x7c, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe3, 0x50, 0x14,
+    0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x8e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xbe, 0xff, 0xff, 0x01, 0xff,
+    0xff, 0xf0, 0xff, 0xbe, 0xff, 0xff, 0xed, 0xff, 0xff, 0xf0, 0xff, 0x9c,
+    0x1f, 0xff, 0xef, 0xff, 0xff, 0xf0, 0xff, 0xc1, 0xf8, 0xf8, 0x6f, 0xff,
+    0x9f, 0xf0, 0xf9, 0xdd, 0xf3, 0x7b, 0xef, 0xfe, 0x7f, 0xf0, 0xfd, 0xdd,
+    0xf6, 0x7b, 0xef, 0xf8, 0xff, 0xf0, 0xfc, 0x99, 0xf0, 0x7b, 0xff, 0xe3,
+    0xff, 0xf0, 0xfe, 0x7b, 0xff, 0x7b, 0xff, 0xcf, 0xff, 0xf0, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x8e, 0x20, 0x60,
+    0xe1, 0xf0, 0xff, 0xff, 0xfc, 0x79, 0xfb, 0xee, 0x6c, 0xf0, 0xff, 0xff,
+    0xf3, 0xfb, 0xfb, 0xef, 0x6e, 0xf0, 0xff, 0xff, 0xcf, 0xfb, 0xfb, 0xef,
+    0x60, 0xf0, 0xff, 0xff, 0xff, 0xf9, 0xfb, 0xdf, 0x6f, 0xf0, 0xff, 0xff,
+    0xff, 0xfc, 0x7b, 0xdf, 0x6f, 0xf0, 0xff, 0xff, 0xff, 0xbf, 0x7b, 0xdf,
+    0x6f, 0xf0, 0xff, 0xff, 0xff, 0x9f, 0x7b, 0xe0, 0xef, 0xf0, 0xff, 0xff,
+    0xff, 0xe6, 0x73, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x40, 0x51, 0x14, 0x16, 0x00, 0x0b,
+    0x00, 0x07, 0x00, 0x02, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x03, 0x0f, 0x04, 0x00, 0x04, 0x01, 0x03, 0x0f, 0x07, 0x01, 0x01,
+    0x00, 0x03, 0x0f, 0x05, 0x00, 0x03, 0x01, 0x03, 0x0b, 0x02, 0x02, 0x07,
+    0x0c, 0x02, 0x0f, 0x0d, 0x02, 0x06, 0x07, 0x03, 0x0f, 0x41, 0x51, 0x14,
+    0x30, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x0f, 0x01, 0x00, 0x01, 0xfe, 0x01, 0x00,
+    0x01, 0x07, 0x01, 0xe0, 0x04, 0x00, 0x01, 0xff, 0x01, 0x00, 0xa4, 0x51,
+    0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf9, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa5, 0x51, 0x14, 0x3c, 0x00,
+    0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe3,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf7,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x08, 0x52, 0x15, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x52, 0x15, 0x68, 0x04, 0x00, 0x00, 0x0a, 0x52, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0x55, 0x16, 0x16, 0x00, 0x38, 0x36, 0x39, 0x35, 0x36, 0x20,
+    0x53, 0x63, 0x68, 0x6f, 0x6e, 0x67, 0x61, 0x75, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xf1, 0x55, 0x16, 0x16, 0x00, 0x54, 0x65, 0x6c,
+    0x65, 0x66, 0x6f, 0x6e, 0x20, 0x30, 0x38, 0x38, 0x36, 0x31, 0x2f, 0x39,
+    0x33, 0x30, 0x39, 0x35, 0x34, 0x32, 0x20, 0xf2, 0x55, 0x16, 0x16, 0x00,
+    0x77, 0x77, 0x77, 0x2e, 0x77, 0x62, 0x7a, 0x2d, 0x65, 0x6e, 0x67, 0x69,
+    0x6e, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x64, 0x65, 0xd8, 0x59,
+    0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd9, 0x59, 0x17, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0xda, 0x59, 0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdb, 0x59,
+    0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x5d, 0x18, 0x00, 0x01, 0xff,
+    0xff, 0x00, 0xc1, 0x5d, 0x18, 0x02, 0x02, 0xff, 0xff, 0x00, 0xa8, 0x61,
+    0x19, 0x02, 0x04, 0xff, 0xff, 0x00, 0x90, 0x65, 0x1a, 0x00, 0x06, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x78, 0x69, 0x1b, 0xf3, 0x4e, 0x82,
+    0x69, 0x1b, 0xff, 0xff, 0x48, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xe3, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xa4, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x4a, 0x71, 0x1f, 0x01, 0x02, 0x01, 0xa5, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x4b, 0x71, 0x1f, 0x01, 0x02, 0x01, 0xe2, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xa5, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f,
+    0x0f, 0x05, 0x0f, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x31, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x32, 0x75,
+    0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x33, 0x75, 0x14, 0x30, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x34, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x35, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x36, 0x75,
+    0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x37, 0x75, 0x14, 0x30, 0x00,
+    0x21, 0x00, 0x20, 0x00, 0x02, 0x04, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09,
+    0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09,
+    0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09,
+    0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09,
+    0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09,
+    0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09,
+    0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09,
+    0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09,
+    0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09,
+    0x08, 0x0e, 0x01, 0x09, 0x01, 0x0e, 0x1e, 0x09, 0x01, 0x0e, 0x01, 0x09,
+    0x02, 0x0e, 0x1c, 0x09, 0x02, 0x0e, 0x01, 0x09, 0x03, 0x0e, 0x1a, 0x09,
+    0x03, 0x0e, 0x01, 0x09, 0x04, 0x0e, 0x18, 0x09, 0x04, 0x0e, 0x01, 0x09,
+    0x05, 0x0e, 0x16, 0x09, 0x05, 0x0e, 0x01, 0x09, 0x06, 0x0e, 0x14, 0x09,
+    0x06, 0x0e, 0x01, 0x09, 0x07, 0x0e, 0x12, 0x09, 0x07, 0x0e, 0x01, 0x09,
+    0x08, 0x0e, 0x10, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x01, 0x09, 0x0a, 0x0e, 0x0c, 0x09, 0x0a, 0x0e, 0x01, 0x09,
+    0x0b, 0x0e, 0x0a, 0x09, 0x0b, 0x0e, 0x01, 0x09, 0x0c, 0x0e, 0x08, 0x09,
+    0x0c, 0x0e, 0x01, 0x09, 0x0d, 0x0e, 0x06, 0x09, 0x0d, 0x0e, 0x01, 0x09,
+    0x0e, 0x0e, 0x04, 0x09, 0x0e, 0x0e, 0x01, 0x09, 0x0f, 0x0e, 0x02, 0x09,
+    0x0f, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01, 0x09,
+    0x38, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x04, 0x00,
+    0x46, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x0e, 0x01, 0x0c, 0x1e, 0x0e, 0x02,
+    0x0c, 0x1d, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03,
+    0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03,
+    0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x17, 0x0e, 0x05, 0x00, 0x03, 0x0c, 0x0b,
+    0x0e, 0x05, 0x00, 0x08, 0x0e, 0x05, 0x00, 0x02, 0x0c, 0x0c, 0x0e, 0x05,
+    0x00, 0x08, 0x0e, 0x05, 0x00, 0x01, 0x0c, 0x0d, 0x0e, 0x05, 0x00, 0xff,
+    0x0e, 0xe5, 0x0e, 0x39, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x44, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x09, 0x00, 0x53, 0x43, 0x43, 0x20, 0x54, 0x65, 0x73, 0x74,
+    0x20, 0x00, 0x45, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x31, 0x00, 0x46,
+    0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x32, 0x00, 0x47, 0x75, 0x0b, 0x18,
+    0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00,
+    0x56, 0x65, 0x6e, 0x31, 0x00, 0x48, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00,
+    0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x56, 0x65, 0x6e,
+    0x32, 0x00, 0x49, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x48, 0x79, 0x64, 0x4f, 0x66, 0x66,
+    0x20, 0x20, 0x00, 0x4a, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8,
+    0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x48, 0x00,
+    0x4b, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x53, 0x00, 0x4c, 0x75, 0x0b,
+    0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x05,
+    0x00, 0x56, 0x65, 0x4f, 0x66, 0x66, 0x00, 0x4d, 0x75, 0x0b, 0x18, 0x00,
+    0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x56,
+    0x65, 0x4f, 0x6e, 0x00, 0x50, 0x78, 0x14, 0x30, 0x00, 0x23, 0x00, 0x1c,
+    0x00, 0x02, 0x04, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x55, 0xbb, 0x06,
+    0x08, 0x12, 0xbb, 0x04, 0x08, 0x05, 0xbb, 0x02, 0x08, 0x06, 0x01, 0x02,
+    0x08, 0x05, 0xbb, 0x04, 0x08, 0x06, 0xbb, 0x01, 0x08, 0x04, 0x01, 0x05,
+    0x08, 0x03, 0x01, 0x04, 0x00, 0x03, 0x01, 0x05, 0x08, 0x04, 0x01, 0x01,
+    0x08, 0x05, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x02, 0x04, 0x07, 0x01, 0x02,
+    0x00, 0x04, 0x01, 0x02, 0x00, 0x07, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01,
+    0x08, 0x05, 0xbb, 0x01, 0x08, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01,
+    0x08, 0x06, 0xbb, 0x02, 0x08, 0x06, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01,
+    0x00, 0x06, 0x01, 0x03, 0x08, 0x08, 0xbb, 0x01, 0x08, 0x04, 0xbb, 0x01,
+    0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0xbb, 0x01,
+    0x08, 0x08, 0xbb, 0x04, 0x08, 0x04, 0xbb, 0x01, 0x01, 0x01, 0x00, 0x0a,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0xbb, 0x04, 0x08, 0x04, 0xbb, 0x01,
+    0x08, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01,
+    0x08, 0x03, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x01,
+    0x00, 0x0c, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x01,
+    0x08, 0x03, 0xbb, 0x01, 0x08, 0x08, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x08, 0x03, 0xbb, 0x01, 0x08, 0x07, 0xbb, 0x01,
+    0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0xbb, 0x01,
+    0x08, 0x04, 0xbb, 0x01, 0x08, 0x07, 0xbb, 0x01, 0x01, 0x01, 0x00, 0x0c,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0xbb, 0x02, 0x08, 0x02, 0xbb, 0x01,
+    0x08, 0x09, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01,
+    0x08, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x06, 0x04, 0x02, 0x01, 0x01,
+    0x00, 0x0c, 0x01, 0x01, 0x00, 0x02, 0x01, 0x06, 0x04, 0x01, 0x01, 0x01,
+    0x08, 0x01, 0xbb, 0x01, 0x08, 0x08, 0x01, 0x01, 0x00, 0x0e, 0x01, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x08, 0x02, 0xbb, 0x07, 0x08, 0x01, 0x01, 0x01,
+    0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01, 0x07, 0x08, 0x09, 0xbb, 0x01,
+    0x08, 0x01, 0x01, 0x01, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x08, 0x0f, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x01, 0x00, 0x0e, 0x01, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x01,
+    0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb, 0x01,
+    0x08, 0x01, 0x01, 0x10, 0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb, 0x01,
+    0x08, 0x07, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01,
+    0x08, 0x10, 0xbb, 0x06, 0x08, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01,
+    0x00, 0x01, 0x01, 0x06, 0x08, 0x16, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x01,
+    0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x1b, 0xbb, 0x01,
+    0x08, 0x06, 0x01, 0x01, 0x08, 0x1c, 0xbb, 0x06, 0x08, 0x0e, 0xbb, 0x00,
+    0x7d, 0x22, 0x01, 0x01, 0x00, 0x01, 0x00, 0x44, 0x75, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x64, 0x7d, 0x23, 0x00, 0x45, 0x75, 0xff, 0xff,
+    0x02, 0x00, 0xec, 0x13, 0xed, 0x13, 0xc8, 0x7d, 0x27, 0x00, 0x01, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+    0x0d, 0x0e, 0x0f, 0x00, 0x11, 0x12, 0x0f, 0x14, 0x09, 0x16, 0x17, 0x18,
+    0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x02, 0x23, 0x24,
+    0x03, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x0a, 0x2f, 0x30,
+    0x31, 0x32, 0x0b, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+    0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0x7b, 0x04, 0x7d, 0x7e, 0x05, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x06, 0x8f, 0x90,
+    0x08, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c,
+    0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8,
+    0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4,
+    0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0x07, 0xbd, 0xbe, 0xbf, 0xc0,
+    0xc1, 0xc2, 0xc3, 0x0c, 0xc5, 0xc6, 0xc7, 0xc8, 0x0d, 0xca, 0xcb, 0xcc,
+    0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8,
+    0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0x0e, 0xe3, 0xe4,
+    0xe5, 0xe6, 0x01, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0,
+    0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc,
+    0xfd, 0xfe, 0xff, 0x40, 0x9c, 0x0c, 0x32, 0x00, 0x14, 0x00, 0x01, 0x4a,
+    0x9c, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x9c, 0x17, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x4b, 0x9c, 0x1b, 0xff, 0xff, 0x4d, 0x9c, 0x0e,
+    0xc1, 0x5d, 0x32, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x4e, 0x9c,
+    0x03, 0x64, 0x00, 0x32, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x9c, 0x00, 0x00,
+    0x00, 0x00, 0x4f, 0x9c, 0x14, 0x30, 0x00, 0x30, 0x00, 0x1b, 0x00, 0x02,
+    0x04, 0x00, 0xde, 0x01, 0x00, 0x00, 0x00, 0x16, 0x01, 0x06, 0x00, 0x1e,
+    0x01, 0x09, 0x00, 0x07, 0x01, 0x02, 0x00, 0x1b, 0x01, 0x03, 0x00, 0x03,
+    0x01, 0x02, 0x00, 0x04, 0x01, 0x02, 0x00, 0x03, 0x01, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x1a, 0x01, 0x01, 0x00, 0x05, 0x01, 0x04, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x19,
+    0x01, 0x01, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x01, 0x01, 0x00, 0x04,
+    0x01, 0x01, 0x00, 0x08, 0x01, 0x06, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x06,
+    0x01, 0x07, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x0a,
+    0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x07,
+    0x01, 0x01, 0x00, 0x07, 0x01, 0x07, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03,
+    0x01, 0x02, 0x00, 0x06, 0x01, 0x02, 0x00, 0x03, 0x01, 0x03, 0x00, 0x04,
+    0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x04,
+    0x01, 0x02, 0x00, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x03, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x04,
+    0x01, 0x02, 0x00, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x03, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x07,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x04,
+    0x01, 0x01, 0x00, 0x0d, 0x01, 0x02, 0x00, 0x08, 0x01, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0c,
+    0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0f,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x0b,
+    0x01, 0x05, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0a,
+    0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0f,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0d,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x04,
+    0x01, 0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x07,
+    0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x0f,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x0e, 0x01, 0x02, 0x00, 0x06,
+    0x01, 0x02, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x07, 0x00, 0x06, 0x01, 0x02, 0x00, 0x08,
+    0x01, 0x02, 0x00, 0x06, 0x01, 0x02, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0x07, 0x00, 0x05, 0x01, 0x01, 0x00, 0x0c,
+    0x01, 0x06, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06,
+    0x01, 0x01, 0x00, 0x1d, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05,
+    0x01, 0x04, 0x00, 0x05, 0x01, 0x01, 0x00, 0x1d, 0x01, 0x01, 0x00, 0x03,
+    0x01, 0x03, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04, 0x01, 0x02, 0x00, 0x1d,
+    0x01, 0x01, 0x00, 0x07, 0x01, 0x09, 0x00, 0x1d, 0x01, 0x02, 0x00, 0x2e,
+    0x01, 0x02, 0x00, 0x2e, 0x01,
+}; // MultiStepLoad_secondary
+
+const unsigned char MultiStepLoad_gAux[MultiStepLoad_gAux_Size] = {
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xe8, 0x03, 0x01, 0x00, 0x02, 0x20, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x64, 0x65, 0xe8, 0x03, 0x01, 0x01,
+    0xff, 0xff, 0x1b, 0x00, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4e,
+    0x00, 0x00, 0xff, 0xff, 0xf8, 0x2a, 0x05, 0x00, 0x14, 0x00, 0xf9, 0x2a,
+    0x08, 0x00, 0xb4, 0x00, 0xfa, 0x2a, 0x6c, 0x00, 0xb4, 0x00, 0xfb, 0x2a,
+    0x6c, 0x00, 0xbe, 0x00, 0xfc, 0x2a, 0x08, 0x00, 0xbe, 0x00, 0xb3, 0x36,
+    0x05, 0x00, 0x2f, 0x00, 0xb9, 0x0b, 0x0a, 0x00, 0x31, 0x00, 0xba, 0x0b,
+    0x1c, 0x00, 0x31, 0x00, 0xbb, 0x0b, 0x2e, 0x00, 0x31, 0x00, 0xbc, 0x0b,
+    0x40, 0x00, 0x31, 0x00, 0xbd, 0x0b, 0x52, 0x00, 0x31, 0x00, 0xbe, 0x0b,
+    0x64, 0x00, 0x31, 0x00, 0xbf, 0x0b, 0x76, 0x00, 0x31, 0x00, 0xc0, 0x0b,
+    0x88, 0x00, 0x31, 0x00, 0xc1, 0x0b, 0x9a, 0x00, 0x31, 0x00, 0xc2, 0x0b,
+    0xac, 0x00, 0x31, 0x00, 0xfd, 0x2a, 0x08, 0x00, 0x7d, 0x00, 0xfe, 0x2a,
+    0x08, 0x00, 0x87, 0x00, 0xff, 0x2a, 0x08, 0x00, 0x91, 0x00, 0x00, 0x2b,
+    0x6c, 0x00, 0x87, 0x00, 0x01, 0x2b, 0x6c, 0x00, 0x91, 0x00, 0x02, 0x2b,
+    0x08, 0x00, 0x9b, 0x00, 0x03, 0x2b, 0x6c, 0x00, 0x9b, 0x00, 0x04, 0x2b,
+    0x08, 0x00, 0xaa, 0x00, 0xe0, 0x2e, 0x32, 0x00, 0x3c, 0x00, 0xb9, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xbd, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x2a, 0x0b, 0xbe, 0x00, 0x13, 0x00, 0x00, 0xdc, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x20,
+    0x53, 0x74, 0x65, 0x70, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x00, 0xf9, 0x2a,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xdd, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x08, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xfa,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xde, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x30, 0x2e, 0x31, 0x20, 0x00, 0xfb, 0x2a, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xdf, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00,
+    0x31, 0x30, 0x2e, 0x31, 0x32, 0x2e, 0x32, 0x30, 0x31, 0x39, 0x00, 0xfc,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe0, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x05, 0x00, 0x44, 0x61, 0x74, 0x65, 0x3a, 0x00, 0xfd, 0x2a, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe1, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x56, 0x54, 0x20, 0x20, 0x00, 0xfe, 0x2a, 0x0b, 0x5a, 0x00, 0x09,
+    0x00, 0x00, 0xe2, 0x59, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x56, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xff, 0x2a, 0x0b, 0x5a, 0x00,
+    0x09, 0x00, 0x00, 0xe3, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0b, 0x00, 0x52,
+    0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0x00,
+    0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe4, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x34, 0x20, 0x20, 0x20, 0x00, 0x01, 0x2b, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xe5, 0x59, 0x00, 0xff, 0xff, 0x00, 0x09, 0x00,
+    0x34, 0x38, 0x30, 0x20, 0x78, 0x20, 0x34, 0x38, 0x30, 0x00, 0x02, 0x2b,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe6, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x09, 0x00, 0x4c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a, 0x00,
+    0x03, 0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe7, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0x00, 0x65, 0x6e, 0x20, 0x20, 0x00, 0x04, 0x2b, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe8, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0xe0, 0x2e, 0x0c, 0x64, 0x00, 0x09,
+    0x00, 0x01, 0xe9, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x01, 0x00, 0xb3,
+    0x36, 0x0e, 0xc2, 0x5d, 0xbe, 0x00, 0x0a, 0x00, 0x00, 0xa9, 0x61, 0x00,
+    0xb4, 0x36, 0x0e, 0xc3, 0x5d, 0x12, 0x00, 0x07, 0x00, 0x00, 0xaa, 0x61,
+    0x00, 0x20, 0x4e, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x80, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x38, 0xe6, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3c, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3f, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x87, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0xf1, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0xfc, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x3c, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x1c, 0xe6, 0x7f,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x01, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfb, 0xd8, 0x31, 0x78, 0x3f, 0xff, 0xf0, 0xff, 0xfb,
+    0xd7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb, 0xd0, 0x1a, 0xb7, 0xdf,
+    0xff, 0xf0, 0xff, 0xfb, 0xd7, 0xfa, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb,
+    0xb7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xf0, 0x78, 0x32, 0x98, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x21, 0x4e,
+    0x14, 0xc8, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x04, 0x01, 0x66, 0x18,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x7f, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x04, 0x00, 0x01, 0x18, 0x03,
+    0x00, 0x01, 0x07, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01, 0xf0, 0x04, 0x00, 0x01,
+    0x1c, 0x03, 0x00, 0x01, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x01, 0xfe, 0x0b,
+    0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0xf8, 0x03, 0x00, 0x02, 0xff, 0x05,
+    0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x07, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xe0, 0x0a, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x01, 0xc0, 0x02, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0a, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x1f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x02,
+    0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x07, 0x03, 0xff, 0x0a, 0x00, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x04, 0xff, 0x03,
+    0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x08,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x03, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xfc, 0x01, 0x00, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x03, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x01, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x03, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3e, 0x09,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x60, 0x02, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x30, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x40, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x08, 0x09, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xe0, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x02, 0xff, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xe0, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x02, 0xff, 0x01,
+    0xfc, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x03, 0xff, 0x01,
+    0x80, 0x06, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0x80, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xf0, 0x06, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x02,
+    0xff, 0x01, 0xfc, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03,
+    0xff, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xc0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xe0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf8, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x02, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x03,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x04,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x08, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3c, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xfe, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x01, 0x02, 0xff, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xfe, 0x01, 0x01, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x07, 0x05, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfe, 0x01, 0x00, 0x01,
+    0x07, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xe0, 0x09, 0x00, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01,
+    0xfe, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x02, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x09, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x0a, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x02, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01,
+    0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xc0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x0c, 0x00, 0x01,
+    0x03, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0xff,
+    0x00, 0xff, 0x00, 0x0d, 0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e,
+    0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x7c, 0x01, 0x00, 0x01, 0x3c, 0x01,
+    0x00, 0x01, 0x0f, 0x02, 0x00, 0x01, 0xe0, 0x01, 0x78, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0x80, 0x01, 0x78, 0x01, 0x01, 0x01, 0xe0, 0x07, 0x00, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x3c, 0x01, 0x00, 0x01, 0x03, 0x01,
+    0xc0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x7f, 0x01, 0xc0, 0x01, 0x7b, 0x01, 0xf9, 0x01, 0xfe, 0x01,
+    0x00, 0x01, 0x03, 0x01, 0x9f, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01, 0xbe, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x0f, 0x01, 0xf0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc1, 0x01, 0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x7f, 0x01,
+    0xfd, 0x01, 0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xbf, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x3e, 0x01, 0x07, 0x01, 0x80, 0x01,
+    0x1e, 0x01, 0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xbe, 0x02,
+    0x3c, 0x01, 0x1f, 0x01, 0xfc, 0x1d, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0x83, 0x01, 0xff, 0x01, 0xe1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x3f, 0x01, 0xfe, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xfe, 0x01, 0x3c, 0x01,
+    0x7c, 0x01, 0x3f, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x03, 0x01,
+    0xc3, 0x02, 0xe0, 0x01, 0xf0, 0x01, 0x7e, 0x01, 0x3f, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1c, 0x01,
+    0x3e, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xe0, 0x01, 0x3c, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x38, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xc1, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x10, 0x02, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0xf0, 0x01, 0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01,
+    0x1e, 0x02, 0x0e, 0x01, 0x00, 0x01, 0x0e, 0x01, 0x3f, 0x01, 0x8e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01,
+    0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3f, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xe0, 0x01,
+    0x3e, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x87, 0x01, 0xe0, 0x01,
+    0x03, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x7e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01,
+    0x3f, 0x01, 0x80, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x7f, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xfe, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01,
+    0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x1f, 0x01, 0xe0, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x7f, 0x01, 0xfe, 0x01, 0x07, 0x01, 0x1c, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0x3b, 0x01, 0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01,
+    0x3f, 0x01, 0xc0, 0x01, 0x0f, 0x01, 0xf8, 0x1e, 0x00, 0x01, 0x3c, 0x01,
+    0x07, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfc, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01,
+    0x78, 0x01, 0x7f, 0x01, 0x9e, 0x01, 0x07, 0x01, 0x9c, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0x39, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01,
+    0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xfc, 0x1e, 0x00, 0x01,
+    0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01,
+    0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xbc, 0x01,
+    0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xfc, 0x1e,
+    0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01,
+    0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x03, 0x01, 0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0xf1, 0x01, 0xfc, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xc0, 0x01,
+    0x43, 0x01, 0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x7c, 0x01,
+    0x1e, 0x01, 0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01,
+    0xf8, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x78, 0x01, 0x10, 0x02, 0x3c, 0x1d, 0x00, 0x01, 0x3c, 0x01, 0x43, 0x03,
+    0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3c, 0x01, 0x3e, 0x01,
+    0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01, 0xf8, 0x01,
+    0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0x7c, 0x03,
+    0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe3, 0x01, 0xff, 0x01, 0xe1, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3f, 0x01, 0xfe, 0x01,
+    0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf0, 0x01, 0xf8, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xc0, 0x02, 0x3c, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe1, 0x01, 0xff, 0x01,
+    0xe1, 0x01, 0xff, 0x01, 0x70, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x3f, 0x01,
+    0xee, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf8, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x3f, 0x01, 0xf8, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x1f, 0x01,
+    0xc0, 0x01, 0xff, 0x01, 0x80, 0x01, 0xfe, 0x01, 0x70, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xdf, 0x01, 0xc0, 0x01,
+    0x78, 0x01, 0x1f, 0x01, 0xce, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xe0, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0x7c, 0x02, 0x1f, 0x01, 0xf0, 0x01, 0x3c, 0x1d, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x10, 0x05, 0x00, 0x01,
+    0x03, 0x01, 0xc7, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xe0, 0x05, 0x00, 0x01, 0xf0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x28,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0x80, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x35, 0x00, 0x01,
+    0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x6b, 0x00, 0xe2, 0x50, 0x14,
+    0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xf9,
+    0x9f, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xff,
+    0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xfc, 0xff, 0xdf, 0xbf, 0xf7,
+    0xef, 0xf0, 0xff, 0xfe, 0x7f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xff,
+    0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xf8, 0x00, 0x1f, 0x9f, 0x9f, 0xe7,
+    0xe7, 0xf0, 0xf8, 0x00, 0x1f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xff,
+    0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xfe, 0x7f, 0x9f, 0x9f, 0xe7,
+    0xe7, 0xf0, 0xff, 0xfc, 0xff, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xff,
+    0xff, 0xdf, 0xbf, 0xf7, 0xef, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3,
+    0xcf, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xff,
+    0xff, 0xe6, 0x78, 0xf9, 0x9f, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xf8, 0x7c,
+    0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe3, 0x50, 0x14, 0x3c, 0x00, 0x3c,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xbe, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xff,
+    0xbe, 0xff, 0xff, 0xed, 0xff, 0xff, 0xf0, 0xff, 0x9c, 0x1f, 0xff, 0xef,
+    0xff, 0xff, 0xf0, 0xff, 0xc1, 0xf8, 0xf8, 0x6f, 0xff, 0x9f, 0xf0, 0xf9,
+    0xdd, 0xf3, 0x7b, 0xef, 0xfe, 0x7f, 0xf0, 0xfd, 0xdd, 0xf6, 0x7b, 0xef,
+    0xf8, 0xff, 0xf0, 0xfc, 0x99, 0xf0, 0x7b, 0xff, 0xe3, 0xff, 0xf0, 0xfe,
+    0x7b, 0xff, 0x7b, 0xff, 0xcf, 0xff, 0xf0, 0xff, 0xfb, 0xff, 0xff, 0xff,
+    0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x8e, 0x20, 0x60, 0xe1, 0xf0, 0xff,
+    0xff, 0xfc, 0x79, 0xfb, 0xee, 0x6c, 0xf0, 0xff, 0xff, 0xf3, 0xfb, 0xfb,
+    0xef, 0x6e, 0xf0, 0xff, 0xff, 0xcf, 0xfb, 0xfb, 0xef, 0x60, 0xf0, 0xff,
+    0xff, 0xff, 0xf9, 0xfb, 0xdf, 0x6f, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x7b,
+    0xdf, 0x6f, 0xf0, 0xff, 0xff, 0xff, 0xbf, 0x7b, 0xdf, 0x6f, 0xf0, 0xff,
+    0xff, 0xff, 0x9f, 0x7b, 0xe0, 0xef, 0xf0, 0xff, 0xff, 0xff, 0xe6, 0x73,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xa4, 0x51, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf9,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xcf, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x1f,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xa5, 0x51, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0x99, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdc, 0x59, 0x17,
+    0x01, 0x03, 0x00, 0x00, 0x00, 0xdd, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xde, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe1, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe4, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe7, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x59, 0x17, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xc2, 0x5d, 0x18, 0x01, 0x00, 0xff, 0xff, 0x00, 0xc3, 0x5d, 0x18,
+    0x01, 0x00, 0xff, 0xff, 0x00, 0xa9, 0x61, 0x19, 0x02, 0x07, 0xff, 0xff,
+    0x00, 0xaa, 0x61, 0x19, 0x02, 0x01, 0xff, 0xff, 0x00, 0x48, 0x71, 0x1f,
+    0x01, 0x00, 0x01, 0xe3, 0x50, 0x00, 0x00, 0x00, 0x00, 0x49, 0x71, 0x1f,
+    0x01, 0x00, 0x01, 0xa4, 0x51, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x71, 0x1f,
+    0x01, 0x02, 0x01, 0xa5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x71, 0x1f,
+    0x01, 0x02, 0x01, 0xe2, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x71, 0x1f,
+    0x01, 0x00, 0x01, 0xa5, 0x51, 0x00, 0x00, 0x00, 0x00,
+}; // MultiStepLoad_gAux
+
+const unsigned char MultiStepLoad_stage0[MultiStepLoad_stage0_Size] = {
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xe8, 0x03, 0x01, 0x00, 0x02, 0x20, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x64, 0x65, 0xe8, 0x03, 0x01, 0x01,
+    0xff, 0xff, 0x1b, 0x00, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4e,
+    0x00, 0x00, 0xff, 0xff, 0xf8, 0x2a, 0x05, 0x00, 0x14, 0x00, 0xf9, 0x2a,
+    0x08, 0x00, 0xb4, 0x00, 0xfa, 0x2a, 0x6c, 0x00, 0xb4, 0x00, 0xfb, 0x2a,
+    0x6c, 0x00, 0xbe, 0x00, 0xfc, 0x2a, 0x08, 0x00, 0xbe, 0x00, 0xb3, 0x36,
+    0x05, 0x00, 0x2f, 0x00, 0xb9, 0x0b, 0x0a, 0x00, 0x31, 0x00, 0xba, 0x0b,
+    0x1c, 0x00, 0x31, 0x00, 0xbb, 0x0b, 0x2e, 0x00, 0x31, 0x00, 0xbc, 0x0b,
+    0x40, 0x00, 0x31, 0x00, 0xbd, 0x0b, 0x52, 0x00, 0x31, 0x00, 0xbe, 0x0b,
+    0x64, 0x00, 0x31, 0x00, 0xbf, 0x0b, 0x76, 0x00, 0x31, 0x00, 0xc0, 0x0b,
+    0x88, 0x00, 0x31, 0x00, 0xc1, 0x0b, 0x9a, 0x00, 0x31, 0x00, 0xc2, 0x0b,
+    0xac, 0x00, 0x31, 0x00, 0xfd, 0x2a, 0x08, 0x00, 0x7d, 0x00, 0xfe, 0x2a,
+    0x08, 0x00, 0x87, 0x00, 0xff, 0x2a, 0x08, 0x00, 0x91, 0x00, 0x00, 0x2b,
+    0x6c, 0x00, 0x87, 0x00, 0x01, 0x2b, 0x6c, 0x00, 0x91, 0x00, 0x02, 0x2b,
+    0x08, 0x00, 0x9b, 0x00, 0x03, 0x2b, 0x6c, 0x00, 0x9b, 0x00, 0x04, 0x2b,
+    0x08, 0x00, 0xaa, 0x00, 0xe0, 0x2e, 0x32, 0x00, 0x3c, 0x00, 0xb9, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xbd, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x0b, 0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x0b, 0x03, 0x12, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0b,
+    0x03, 0x12, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x2a, 0x0b, 0xbe, 0x00, 0x13, 0x00, 0x00, 0xdc, 0x59,
+    0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x20,
+    0x53, 0x74, 0x65, 0x70, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x00, 0xf9, 0x2a,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xdd, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x08, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xfa,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xde, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x30, 0x2e, 0x31, 0x20, 0x00, 0xfb, 0x2a, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xdf, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00,
+    0x31, 0x30, 0x2e, 0x31, 0x32, 0x2e, 0x32, 0x30, 0x31, 0x39, 0x00, 0xfc,
+    0x2a, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe0, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x05, 0x00, 0x44, 0x61, 0x74, 0x65, 0x3a, 0x00, 0xfd, 0x2a, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe1, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x56, 0x54, 0x20, 0x20, 0x00, 0xfe, 0x2a, 0x0b, 0x5a, 0x00, 0x09,
+    0x00, 0x00, 0xe2, 0x59, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x56, 0x65,
+    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0xff, 0x2a, 0x0b, 0x5a, 0x00,
+    0x09, 0x00, 0x00, 0xe3, 0x59, 0x00, 0xff, 0xff, 0x00, 0x0b, 0x00, 0x52,
+    0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x00, 0x00,
+    0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe4, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x04, 0x00, 0x34, 0x20, 0x20, 0x20, 0x00, 0x01, 0x2b, 0x0b, 0x5a,
+    0x00, 0x09, 0x00, 0x00, 0xe5, 0x59, 0x00, 0xff, 0xff, 0x00, 0x09, 0x00,
+    0x34, 0x38, 0x30, 0x20, 0x78, 0x20, 0x34, 0x38, 0x30, 0x00, 0x02, 0x2b,
+    0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe6, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x09, 0x00, 0x4c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a, 0x00,
+    0x03, 0x2b, 0x0b, 0x5a, 0x00, 0x09, 0x00, 0x00, 0xe7, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0x00, 0x65, 0x6e, 0x20, 0x20, 0x00, 0x04, 0x2b, 0x0b,
+    0x5a, 0x00, 0x09, 0x00, 0x00, 0xe8, 0x59, 0x02, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0xe0, 0x2e, 0x0c, 0x64, 0x00, 0x09,
+    0x00, 0x01, 0xe9, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x01, 0x00, 0xb3,
+    0x36, 0x0e, 0xc2, 0x5d, 0xbe, 0x00, 0x0a, 0x00, 0x00, 0xa9, 0x61, 0x00,
+    0xb4, 0x36, 0x0e, 0xc3, 0x5d, 0x12, 0x00, 0x07, 0x00, 0x00, 0xaa, 0x61,
+    0x00, 0x20, 0x4e, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x80, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x38, 0xe6, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3c, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0x3f, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x87, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0xf1, 0xcf, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0x9f, 0xfc, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0x9f, 0x3c, 0xcf, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x9f, 0x1c, 0xe6, 0x7f,
+    0xff, 0xf0, 0xff, 0xfe, 0x07, 0x01, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xfb, 0xd8, 0x31, 0x78, 0x3f, 0xff, 0xf0, 0xff, 0xfb,
+    0xd7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb, 0xd0, 0x1a, 0xb7, 0xdf,
+    0xff, 0xf0, 0xff, 0xfb, 0xd7, 0xfa, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xfb,
+    0xb7, 0xda, 0xb7, 0xdf, 0xff, 0xf0, 0xff, 0xf0, 0x78, 0x32, 0x98, 0x3f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x21, 0x4e,
+    0x14, 0xc8, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x04, 0x01, 0x66, 0x18,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x7f, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x04, 0x00, 0x01, 0x18, 0x03,
+    0x00, 0x01, 0x07, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01, 0xf0, 0x04, 0x00, 0x01,
+    0x1c, 0x03, 0x00, 0x01, 0x01, 0x01, 0xc0, 0x03, 0x00, 0x01, 0xfe, 0x0b,
+    0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0xf8, 0x03, 0x00, 0x02, 0xff, 0x05,
+    0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x07, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xe0, 0x0a, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x01, 0xc0, 0x02, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0a, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x1f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x1f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x02,
+    0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02,
+    0x00, 0x01, 0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x03,
+    0xff, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x07, 0x03, 0xff, 0x0a, 0x00, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x04, 0xff, 0x03,
+    0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x08,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x03, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x04, 0xff, 0x01, 0xfe, 0x08,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xfc, 0x01, 0x00, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x03, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x01, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x03, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01, 0xff, 0x01, 0xc0, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3e, 0x09,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x60, 0x02, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x30, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x40, 0x02, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x08, 0x09, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x1f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x0b,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xe0, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x01, 0x02, 0xff, 0x0b, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xe0, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xe0, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x02, 0xff, 0x01,
+    0xfc, 0x0a, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x03, 0xff, 0x01,
+    0x80, 0x06, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0x80, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xf0, 0x06, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x02,
+    0xff, 0x01, 0xfc, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x03,
+    0xff, 0x06, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02, 0x00, 0x01,
+    0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xc0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x0f, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x02, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xe0, 0x05, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xf0, 0x02,
+    0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03,
+    0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x07, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x01, 0x03, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01,
+    0xf0, 0x02, 0x00, 0x01, 0x03, 0x03, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x01, 0x03, 0xff, 0x01, 0xf8, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x07, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x02, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x03,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc0, 0x03, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x04, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x04,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02,
+    0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x08, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x05, 0x00, 0x01, 0xff, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01,
+    0xff, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x02, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01,
+    0x80, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x08, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x02, 0x00, 0x01,
+    0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xfe, 0x05, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x05, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3c, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0xe0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0xfe, 0x02, 0x00, 0x01, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x08, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xc0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x3f, 0x01,
+    0xff, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x80, 0x01, 0x01, 0x01,
+    0xff, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x01, 0x02, 0xff, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x08,
+    0x00, 0x01, 0x3f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xfc, 0x01, 0x3f, 0x01, 0xff, 0x02,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x3f, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0xff, 0x01, 0xfe, 0x01, 0x01, 0x02, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xfe, 0x01, 0x00, 0x01, 0x07, 0x01, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xc0, 0x01,
+    0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x07, 0x05, 0xff, 0x01, 0x80, 0x01, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfe, 0x01, 0x00, 0x01,
+    0x07, 0x04, 0xff, 0x01, 0xfe, 0x08, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x1f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x07, 0x05, 0xff, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xfc, 0x01, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01, 0xf8, 0x01, 0x00, 0x01,
+    0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x0f, 0x04, 0xff, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfe, 0x02, 0x00, 0x01, 0x3f, 0x04,
+    0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xfc, 0x08, 0x00, 0x01, 0x07, 0x04,
+    0xff, 0x01, 0xe0, 0x01, 0x00, 0x01, 0x03, 0x04, 0xff, 0x01, 0xf0, 0x01,
+    0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x07, 0x04, 0xff, 0x01,
+    0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xfc, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01, 0xf8, 0x08, 0x00, 0x01,
+    0x03, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x04,
+    0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xf8, 0x02, 0x00, 0x01,
+    0x3f, 0x04, 0xff, 0x01, 0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xe0, 0x02,
+    0x00, 0x04, 0xff, 0x01, 0xf0, 0x08, 0x00, 0x01, 0x01, 0x04, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x04, 0xff, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x7f, 0x01,
+    0xf8, 0x01, 0x00, 0x01, 0x01, 0x04, 0xff, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x01, 0xf0, 0x02, 0x00, 0x01, 0x3f, 0x04, 0xff, 0x03, 0x00, 0x01,
+    0x7f, 0x03, 0xff, 0x01, 0xc0, 0x02, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01,
+    0xe0, 0x09, 0x00, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x7f, 0x03,
+    0xff, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x03, 0xff, 0x01,
+    0xfe, 0x03, 0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xe0, 0x02, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01,
+    0x80, 0x02, 0x00, 0x01, 0x1f, 0x03, 0xff, 0x01, 0xc0, 0x09, 0x00, 0x01,
+    0x3f, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x3f, 0x02, 0xff, 0x01,
+    0xfe, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x01, 0xc0, 0x02,
+    0x00, 0x01, 0x3f, 0x03, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x0f, 0x02,
+    0xff, 0x01, 0xfe, 0x03, 0x00, 0x01, 0x0f, 0x03, 0xff, 0x0a, 0x00, 0x01,
+    0x0f, 0x02, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x0f, 0x02, 0xff, 0x01,
+    0xf8, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x1f, 0x02,
+    0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x07, 0x03, 0xff, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0xf0, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01,
+    0xf8, 0x03, 0x00, 0x01, 0x03, 0x02, 0xff, 0x01, 0xfe, 0x0a, 0x00, 0x01,
+    0x03, 0x02, 0xff, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x01, 0x02, 0xff, 0x01,
+    0xc0, 0x02, 0x00, 0x01, 0x7f, 0x01, 0xf8, 0x02, 0x00, 0x01, 0x07, 0x02,
+    0xff, 0x01, 0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xfc, 0x03, 0x00, 0x01,
+    0x3f, 0x03, 0xff, 0x01, 0x80, 0x04, 0x00, 0x01, 0x7f, 0x01, 0xff, 0x01,
+    0xc0, 0x04, 0x00, 0x02, 0xff, 0x01, 0xf8, 0x0b, 0x00, 0x01, 0x3f, 0x01,
+    0xfc, 0x05, 0x00, 0x01, 0x3f, 0x01, 0xfe, 0x08, 0x00, 0x01, 0xff, 0x01,
+    0xfe, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0x0c, 0x00, 0x01,
+    0x03, 0x01, 0xf8, 0x05, 0x00, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xc0, 0xff,
+    0x00, 0xff, 0x00, 0x0d, 0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e,
+    0x00, 0x01, 0x78, 0x0c, 0x00, 0x01, 0x3c, 0x2e, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x3c, 0x0c, 0x00, 0x01, 0x78, 0x0c,
+    0x00, 0x01, 0x3c, 0x21, 0x00, 0x01, 0x7c, 0x01, 0x00, 0x01, 0x3c, 0x01,
+    0x00, 0x01, 0x0f, 0x02, 0x00, 0x01, 0xe0, 0x01, 0x78, 0x02, 0x00, 0x01,
+    0x07, 0x01, 0x80, 0x01, 0x78, 0x01, 0x01, 0x01, 0xe0, 0x07, 0x00, 0x01,
+    0xf0, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x3c, 0x01, 0x00, 0x01, 0x03, 0x01,
+    0xc0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xc0, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0x7f, 0x01, 0xc0, 0x01, 0x7b, 0x01, 0xf9, 0x01, 0xfe, 0x01,
+    0x00, 0x01, 0x03, 0x01, 0x9f, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01, 0xbe, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x0f, 0x01, 0xf0, 0x1d, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01,
+    0xc1, 0x01, 0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x7f, 0x01,
+    0xfd, 0x01, 0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xbf, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x3f, 0x01, 0xfc, 0x01, 0x3e, 0x01, 0x07, 0x01, 0x80, 0x01,
+    0x1e, 0x01, 0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xbe, 0x02,
+    0x3c, 0x01, 0x1f, 0x01, 0xfc, 0x1d, 0x00, 0x01, 0x01, 0x01, 0xff, 0x01,
+    0x83, 0x01, 0xff, 0x01, 0xe1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x7f, 0x02,
+    0xff, 0x01, 0x00, 0x01, 0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x3f, 0x01, 0xfe, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x1f, 0x02, 0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xfe, 0x01, 0x3c, 0x01,
+    0x7c, 0x01, 0x3f, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x03, 0x01,
+    0xc3, 0x02, 0xe0, 0x01, 0xf0, 0x01, 0x7e, 0x01, 0x3f, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1c, 0x01,
+    0x3e, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xe0, 0x01, 0x3c, 0x01,
+    0xf8, 0x01, 0x3c, 0x01, 0x38, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xc1, 0x01, 0xe0, 0x01, 0x80, 0x01, 0xf0, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x10, 0x02, 0x1e, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0xf0, 0x01, 0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01,
+    0xe0, 0x01, 0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01,
+    0x1e, 0x02, 0x0e, 0x01, 0x00, 0x01, 0x0e, 0x01, 0x3f, 0x01, 0x8e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01,
+    0x3c, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x81, 0x01, 0xe0, 0x01,
+    0x00, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3f, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xe0, 0x01,
+    0x3e, 0x1f, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x87, 0x01, 0xe0, 0x01,
+    0x03, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x00, 0x01, 0x7e, 0x01,
+    0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01, 0x9e, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01,
+    0x3f, 0x01, 0x80, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xff, 0x01,
+    0xe0, 0x01, 0x7f, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x0f, 0x01,
+    0xfe, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x0f, 0x01, 0x3b, 0x01,
+    0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3f, 0x01,
+    0xc0, 0x01, 0x1f, 0x01, 0xe0, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01,
+    0xff, 0x01, 0xc1, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01,
+    0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01,
+    0x7f, 0x01, 0xfe, 0x01, 0x07, 0x01, 0x1c, 0x01, 0x00, 0x01, 0x0f, 0x01,
+    0x3b, 0x01, 0x9e, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01,
+    0x3f, 0x01, 0xc0, 0x01, 0x0f, 0x01, 0xf8, 0x1e, 0x00, 0x01, 0x3c, 0x01,
+    0x07, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfc, 0x01, 0xf0, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01,
+    0x78, 0x01, 0x7f, 0x01, 0x9e, 0x01, 0x07, 0x01, 0x9c, 0x01, 0x00, 0x01,
+    0x07, 0x01, 0x39, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01,
+    0xc0, 0x01, 0x3f, 0x01, 0xe0, 0x01, 0x03, 0x01, 0xfc, 0x1e, 0x00, 0x01,
+    0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01, 0xf0, 0x01,
+    0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xc0, 0x01,
+    0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01, 0xbc, 0x01,
+    0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xc3, 0x01, 0xc0, 0x01, 0x3d, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xfc, 0x1e,
+    0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01, 0x07, 0x01,
+    0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0x71, 0x01, 0xdc, 0x01, 0x1e, 0x01,
+    0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x7c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0x80, 0x01, 0x03, 0x01,
+    0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xc0, 0x01, 0xf8, 0x01, 0x78, 0x01, 0x7c, 0x01, 0x1e, 0x01,
+    0x03, 0x01, 0xb8, 0x01, 0x00, 0x01, 0x07, 0x01, 0xf1, 0x01, 0xfc, 0x01,
+    0x1e, 0x01, 0x07, 0x01, 0xc3, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0xf8, 0x01,
+    0x00, 0x01, 0x3c, 0x1e, 0x00, 0x01, 0x3c, 0x01, 0x07, 0x01, 0xc0, 0x01,
+    0x43, 0x01, 0xe0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xc0, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x7c, 0x01,
+    0x1e, 0x01, 0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01,
+    0xf8, 0x01, 0x1e, 0x01, 0x07, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x78, 0x01, 0x10, 0x02, 0x3c, 0x1d, 0x00, 0x01, 0x3c, 0x01, 0x43, 0x03,
+    0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xe1, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3c, 0x01, 0x3e, 0x01,
+    0x03, 0x01, 0xf8, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf1, 0x01, 0xf8, 0x01,
+    0x1f, 0x01, 0x0f, 0x01, 0x83, 0x01, 0xc0, 0x01, 0x3c, 0x01, 0x7c, 0x03,
+    0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe3, 0x01, 0xff, 0x01, 0xe1, 0x01,
+    0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01,
+    0x03, 0x01, 0xff, 0x01, 0xf0, 0x01, 0x78, 0x01, 0x3f, 0x01, 0xfe, 0x01,
+    0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xf0, 0x01, 0xf8, 0x01,
+    0x0f, 0x01, 0xff, 0x01, 0x83, 0x01, 0xc0, 0x02, 0x3c, 0x01, 0x7f, 0x01,
+    0xfc, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x3f, 0x01, 0xe1, 0x01, 0xff, 0x01,
+    0xe1, 0x01, 0xff, 0x01, 0x70, 0x01, 0x78, 0x01, 0x1e, 0x01, 0x0f, 0x01,
+    0x80, 0x01, 0x03, 0x01, 0xff, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x3f, 0x01,
+    0xee, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xe0, 0x01,
+    0xf8, 0x01, 0x0f, 0x01, 0xff, 0x01, 0x03, 0x01, 0xc0, 0x01, 0x3c, 0x01,
+    0x3e, 0x01, 0x3f, 0x01, 0xf8, 0x01, 0x3c, 0x1d, 0x00, 0x01, 0x1f, 0x01,
+    0xc0, 0x01, 0xff, 0x01, 0x80, 0x01, 0xfe, 0x01, 0x70, 0x01, 0x78, 0x01,
+    0x1e, 0x01, 0x0f, 0x01, 0x80, 0x01, 0x03, 0x01, 0xdf, 0x01, 0xc0, 0x01,
+    0x78, 0x01, 0x1f, 0x01, 0xce, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x00, 0x01,
+    0x03, 0x01, 0xe0, 0x01, 0xf8, 0x01, 0x03, 0x01, 0xfe, 0x01, 0x03, 0x01,
+    0xc0, 0x01, 0x7c, 0x02, 0x1f, 0x01, 0xf0, 0x01, 0x3c, 0x1d, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x01, 0x1e, 0x01, 0x00, 0x01, 0x10, 0x05, 0x00, 0x01,
+    0x03, 0x01, 0xc7, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0xe0, 0x05, 0x00, 0x01, 0xf0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x28,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x01, 0x01, 0xe0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x03, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x0f, 0x01, 0xc0, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x01, 0x80, 0x34,
+    0x00, 0x01, 0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x3f, 0x35, 0x00, 0x01,
+    0x03, 0x01, 0xc0, 0x04, 0x00, 0x01, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x6b, 0x00, 0xdc, 0x59, 0x17,
+    0x01, 0x03, 0x00, 0x00, 0x00, 0xdd, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xde, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe1, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe4, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe7, 0x59, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x59, 0x17,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x59, 0x17, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xc2, 0x5d, 0x18, 0x01, 0x00, 0xff, 0xff, 0x00, 0xc3, 0x5d, 0x18,
+    0x01, 0x00, 0xff, 0xff, 0x00, 0xa9, 0x61, 0x19, 0x02, 0x07, 0xff, 0xff,
+    0x00, 0xaa, 0x61, 0x19, 0x02, 0x01, 0xff, 0xff, 0x00, 0x48, 0x71, 0x1f,
+    0x01, 0x00, 0x00, 0x49, 0x71, 0x1f, 0x01, 0x00, 0x00, 0x4a, 0x71, 0x1f,
+    0x01, 0x02, 0x00, 0x4b, 0x71, 0x1f, 0x01, 0x02, 0x00, 0x4c, 0x71, 0x1f,
+    0x01, 0x00, 0x00,
+}; // MultiStepLoad_stage0
+
+const unsigned char MultiStepLoad_stage1[MultiStepLoad_stage1_Size] = {
+    0xe9, 0x03, 0x01, 0x01, 0xa1, 0x0f, 0x0e, 0x00, 0x5c, 0x2b, 0x07, 0x00,
+    0x06, 0x00, 0x50, 0x46, 0x0b, 0x00, 0x31, 0x00, 0x5d, 0x2b, 0x4c, 0x00,
+    0x0c, 0x00, 0x5e, 0x2b, 0x2d, 0x00, 0x37, 0x00, 0x5f, 0x2b, 0x2b, 0x00,
+    0xa8, 0x00, 0x44, 0x2f, 0x07, 0x00, 0x9f, 0x00, 0x45, 0x2f, 0x84, 0x00,
+    0x38, 0x00, 0x5d, 0x2f, 0x84, 0x00, 0x23, 0x00, 0xbd, 0x1b, 0x8b, 0x00,
+    0xa3, 0x00, 0x3a, 0x0c, 0x9d, 0x00, 0x80, 0x00, 0x60, 0x2b, 0x2f, 0x00,
+    0x84, 0x00, 0xbe, 0x1b, 0x8b, 0x00, 0xb1, 0x00, 0xbc, 0x1b, 0x9e, 0x00,
+    0x4e, 0x00, 0x21, 0x0c, 0x2c, 0x00, 0x61, 0x00, 0x1d, 0x0c, 0x03, 0x3c,
+    0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0x0c, 0x03, 0x3c, 0x00, 0x20, 0x00, 0x01, 0x01, 0x00, 0xde, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x0c, 0x03, 0x64, 0x00, 0x0f, 0x00, 0x00,
+    0x01, 0x00, 0xe4, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x0c, 0x03, 0x14,
+    0x00, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x46, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0xa1, 0x0f, 0x04, 0x01, 0x05, 0x00, 0xf0, 0x13, 0xed, 0x13, 0xee, 0x13,
+    0xef, 0x13, 0xec, 0x13, 0xec, 0x13, 0x05, 0x01, 0x05, 0x01, 0x00, 0xdc,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0xed, 0x13, 0x05, 0x01, 0x02, 0x01, 0x00,
+    0xe2, 0x50, 0x00, 0x00, 0x00, 0x00, 0xee, 0x13, 0x05, 0x01, 0x03, 0x01,
+    0x00, 0xe0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xef, 0x13, 0x05, 0x01, 0x04,
+    0x01, 0x00, 0xe1, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x13, 0x05, 0x01,
+    0x01, 0x02, 0x00, 0x1d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0xbc, 0x1b, 0x07, 0x0a, 0x14, 0x00, 0xd8, 0x59, 0xff,
+    0xff, 0x01, 0x01, 0x00, 0xbd, 0x1b, 0x09, 0x28, 0x00, 0x0b, 0x00, 0x07,
+    0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x02, 0x01, 0x00, 0xbe, 0x1b, 0x09, 0x28, 0x00, 0x0b,
+    0x00, 0x0d, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x01, 0x00, 0x5c, 0x2b, 0x0b, 0x39,
+    0x00, 0x0f, 0x00, 0x0e, 0xd9, 0x59, 0x00, 0xff, 0xff, 0x01, 0x04, 0x00,
+    0x49, 0x53, 0x4f, 0x20, 0x00, 0x5d, 0x2b, 0x0b, 0x70, 0x00, 0x10, 0x00,
+    0x0a, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x01, 0x0d, 0x00, 0x44, 0x65, 0x6d,
+    0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x5e,
+    0x2b, 0x0b, 0x4b, 0x00, 0x0e, 0x00, 0x0c, 0xd8, 0x59, 0x00, 0xff, 0xff,
+    0x01, 0x08, 0x00, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x00,
+    0x5f, 0x2b, 0x0b, 0x50, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x0a, 0x00, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x4e, 0x72,
+    0x2e, 0x3a, 0x00, 0x60, 0x2b, 0x0b, 0x48, 0x00, 0x0f, 0x00, 0x09, 0xd8,
+    0x59, 0x00, 0xff, 0xff, 0x01, 0x08, 0x00, 0x41, 0x75, 0x73, 0x77, 0x61,
+    0x68, 0x6c, 0x3a, 0x00, 0x44, 0x2f, 0x0c, 0x17, 0x00, 0x0e, 0x00, 0x01,
+    0xd8, 0x59, 0x00, 0x08, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x45, 0x2f, 0x0c,
+    0x2c, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0x09, 0x52, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x02, 0x00, 0x46, 0x2f, 0x0c, 0x14, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59,
+    0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x2f, 0x0c, 0x2c, 0x00,
+    0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x02, 0x00,
+    0xe4, 0x3e, 0x10, 0x13, 0x00, 0x0f, 0x00, 0xc0, 0x5d, 0xa8, 0x61, 0x02,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x50, 0x46, 0x12, 0x0f, 0x00, 0x64, 0x00, 0x00, 0x01, 0x21,
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x08, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0xdc, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf7, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0x76, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x17, 0x9f, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0x67, 0xef, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xfc, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x77, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0x79, 0xf7, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xfd, 0x1e, 0x77, 0xff,
+    0xeb, 0xff, 0xf0, 0xff, 0xfd, 0xe7, 0x97, 0xff, 0xeb, 0xff, 0xf0, 0xff,
+    0xfd, 0xf8, 0x60, 0x00, 0x0b, 0xff, 0xf0, 0xff, 0xfc, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xde,
+    0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x00,
+    0x07, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0x00,
+    0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xff, 0xf0,
+    0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x80, 0x00,
+    0x00, 0x1f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x1c, 0xf9, 0xcf, 0x0f, 0xff, 0xf0,
+    0xff, 0xff, 0x24, 0xaa, 0x24, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0x20, 0x22,
+    0x24, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0x18, 0x22, 0x24, 0x8f, 0xff, 0xf0,
+    0xff, 0xff, 0x04, 0x22, 0x27, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x24, 0x22,
+    0x24, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x38, 0x71, 0xce, 0x0f, 0xff, 0xf0,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x80, 0x00,
+    0x00, 0x1f, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf0,
+    0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0x00,
+    0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x00,
+    0x07, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0x50, 0x14, 0x3c,
+    0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc,
+    0x00, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xe0,
+    0x30, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x70, 0x00, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0x80, 0xe0, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x81,
+    0xe0, 0x00, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x03, 0xe0, 0x00, 0x3f, 0xff,
+    0xf0, 0xff, 0xff, 0x07, 0xfe, 0x00, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x0f,
+    0xff, 0x80, 0x3f, 0xff, 0xf0, 0xff, 0xfe, 0x07, 0xff, 0xc0, 0x1f, 0xff,
+    0xf0, 0xff, 0xfe, 0x03, 0xe3, 0xe0, 0x1f, 0xff, 0xf0, 0xff, 0xfe, 0x01,
+    0xe0, 0xe0, 0x1f, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0xe0, 0xe0, 0x1f, 0xff,
+    0xf0, 0xff, 0xff, 0x00, 0x70, 0xe0, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x00,
+    0x30, 0xe0, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x3f, 0xff,
+    0xf0, 0xff, 0xff, 0x80, 0x00, 0xe0, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0x80,
+    0x00, 0xe0, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xc0, 0x00, 0xe0, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+    0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0x00, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0xff, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xe1, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xfb, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe2,
+    0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xe6,
+    0x7f, 0xf9, 0x9f, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0,
+    0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xfc, 0xff, 0xdf,
+    0xbf, 0xf7, 0xef, 0xf0, 0xff, 0xfe, 0x7f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0,
+    0xff, 0xff, 0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xf8, 0x00, 0x1f, 0x9f,
+    0x9f, 0xe7, 0xe7, 0xf0, 0xf8, 0x00, 0x1f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0,
+    0xff, 0xff, 0x3f, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xfe, 0x7f, 0x9f,
+    0x9f, 0xe7, 0xe7, 0xf0, 0xff, 0xfc, 0xff, 0x9f, 0x9f, 0xe7, 0xe7, 0xf0,
+    0xff, 0xff, 0xff, 0xdf, 0xbf, 0xf7, 0xef, 0xf0, 0xff, 0xff, 0xff, 0xcf,
+    0x3f, 0xf3, 0xcf, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xf3, 0xcf, 0xf0,
+    0xff, 0xff, 0xff, 0xe6, 0x78, 0xf9, 0x9f, 0xf0, 0xff, 0xff, 0xff, 0xf0,
+    0xf8, 0x7c, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x08, 0x52, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x52, 0x15, 0x68, 0x04, 0x00, 0x00, 0xd8, 0x59,
+    0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd9, 0x59, 0x17, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0xc0, 0x5d, 0x18, 0x00, 0x01, 0xff, 0xff, 0x00, 0xa8, 0x61,
+    0x19, 0x02, 0x04, 0xff, 0xff, 0x00,
+}; // MultiStepLoad_stage1
+
+const unsigned char MultiStepLoad_stage2[MultiStepLoad_stage2_Size] = {
+    0x03, 0x00, 0x1c, 0x08, 0x00, 0xad, 0x00, 0x00, 0xe8, 0x03, 0xff, 0xff,
+    0xff, 0xea, 0x03, 0x01, 0x01, 0xaa, 0x0f, 0x10, 0x00, 0x94, 0x0c, 0x03,
+    0x00, 0x35, 0x00, 0xc0, 0x2b, 0x0a, 0x00, 0x04, 0x00, 0xc1, 0x2b, 0x0a,
+    0x00, 0x14, 0x00, 0xc2, 0x2b, 0x0a, 0x00, 0x24, 0x00, 0xc3, 0x2b, 0x07,
+    0x00, 0xab, 0x00, 0xa8, 0x2f, 0x10, 0x00, 0xb8, 0x00, 0xeb, 0x4e, 0x72,
+    0x00, 0x9a, 0x00, 0xec, 0x4e, 0x7e, 0x00, 0x9a, 0x00, 0xed, 0x4e, 0x51,
+    0x00, 0x99, 0x00, 0xfc, 0x4e, 0x4b, 0x00, 0x40, 0x00, 0xfd, 0x4e, 0x6b,
+    0x00, 0x40, 0x00, 0xfe, 0x4e, 0x8b, 0x00, 0x40, 0x00, 0xff, 0x4e, 0xa9,
+    0x00, 0x40, 0x00, 0xb1, 0x36, 0x6e, 0x00, 0x98, 0x00, 0x01, 0x4f, 0x99,
+    0x00, 0xa4, 0x00, 0x40, 0x51, 0xa5, 0x00, 0xaa, 0x00, 0xeb, 0x03, 0x01,
+    0x01, 0xa3, 0x0f, 0x09, 0x00, 0x84, 0x1c, 0x46, 0x00, 0x0c, 0x00, 0x20,
+    0x1c, 0x0e, 0x00, 0x09, 0x00, 0xc8, 0x32, 0x06, 0x00, 0x2d, 0x00, 0xb0,
+    0x36, 0x69, 0x00, 0x64, 0x00, 0x98, 0x3a, 0x0e, 0x00, 0x41, 0x00, 0xac,
+    0x3f, 0x85, 0x00, 0x27, 0x00, 0x68, 0x42, 0x09, 0x00, 0x64, 0x00, 0x38,
+    0x4a, 0x14, 0x00, 0x8f, 0x00, 0x82, 0x69, 0x82, 0x00, 0x64, 0x00, 0x94,
+    0x0c, 0x03, 0x46, 0x00, 0x71, 0x00, 0x00, 0x01, 0x00, 0x78, 0x69, 0x00,
+    0x00, 0x00, 0x00, 0xa3, 0x0f, 0x04, 0x01, 0x01, 0x00, 0x50, 0x14, 0xaa,
+    0x0f, 0x04, 0x01, 0x05, 0x00, 0xf6, 0x13, 0x51, 0x14, 0x51, 0x14, 0x50,
+    0x14, 0xec, 0x13, 0xf6, 0x13, 0x05, 0x01, 0x0a, 0x02, 0x00, 0xb2, 0x36,
+    0x0a, 0x00, 0x01, 0x00, 0xb2, 0x2f, 0x04, 0x00, 0x0a, 0x00, 0x50, 0x14,
+    0x05, 0x01, 0x65, 0x01, 0x01, 0xdd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x03, 0x51, 0x14, 0x05, 0x01, 0x64, 0x00, 0x00, 0x20, 0x1c, 0x0a, 0x14,
+    0x00, 0x14, 0x00, 0xff, 0xff, 0x00, 0x03, 0x01, 0x00, 0x56, 0x4f, 0x57,
+    0x4f, 0x58, 0x4f, 0x84, 0x1c, 0x08, 0x5b, 0x00, 0x0f, 0x00, 0x07, 0xd8,
+    0x59, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x01, 0x00, 0xc0, 0x2b, 0x0b, 0xb6,
+    0x00, 0x0e, 0x00, 0x0e, 0xda, 0x59, 0x00, 0xf0, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xc1, 0x2b, 0x0b, 0xb6, 0x00, 0x0e, 0x00, 0x0d, 0xda, 0x59, 0x00,
+    0xf1, 0x55, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x2b, 0x0b, 0xb6, 0x00, 0x0e,
+    0x00, 0x0e, 0xda, 0x59, 0x00, 0xf2, 0x55, 0x00, 0x00, 0x00, 0x00, 0xc3,
+    0x2b, 0x0b, 0x40, 0x00, 0x0e, 0x00, 0x01, 0xda, 0x59, 0x00, 0xff, 0xff,
+    0x00, 0x08, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x00,
+    0xa8, 0x2f, 0x0c, 0x28, 0x00, 0x0e, 0x00, 0x01, 0xda, 0x59, 0x01, 0xff,
+    0xff, 0x18, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0x23,
+    0x3c, 0x02, 0x00, 0x02, 0x00, 0xb2, 0x2f, 0x0c, 0x28, 0x00, 0x0e, 0x00,
+    0x01, 0xdb, 0x59, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0xd7, 0x23, 0x3c, 0x02, 0x00, 0x02, 0x00, 0xc8, 0x32,
+    0x0d, 0xc0, 0x5d, 0x64, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb0, 0x36, 0x0e,
+    0xc0, 0x5d, 0x14, 0x00, 0x46, 0x00, 0x00, 0xa8, 0x61, 0x00, 0xb1, 0x36,
+    0x0e, 0xc0, 0x5d, 0x1e, 0x00, 0x24, 0x00, 0x02, 0xff, 0xff, 0x00, 0xb2,
+    0x36, 0x0e, 0xc0, 0x5d, 0x24, 0x00, 0x1e, 0x00, 0x04, 0xa8, 0x61, 0x00,
+    0x98, 0x3a, 0x0f, 0xc1, 0x5d, 0x50, 0x00, 0x1e, 0x00, 0x02, 0x0a, 0xa5,
+    0xff, 0xff, 0x00, 0xac, 0x3f, 0x10, 0x3e, 0x00, 0x35, 0x00, 0xc1, 0x5d,
+    0xff, 0xff, 0x02, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x28, 0x00, 0x24,
+    0x00, 0x1e, 0x00, 0x29, 0x00, 0x32, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x00,
+    0x00, 0x68, 0x42, 0x11, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00,
+    0x5a, 0x00, 0x00, 0x64, 0x00, 0x0a, 0x52, 0x00, 0x00, 0x00, 0x38, 0x4a,
+    0x13, 0x3f, 0x00, 0x30, 0x00, 0x03, 0x00, 0x13, 0x00, 0x5a, 0x08, 0x00,
+    0x00, 0x00, 0x64, 0x00, 0x0a, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0xeb, 0x4e, 0x14, 0x08, 0x00, 0x08, 0x00, 0x20, 0x00, 0x01, 0x04,
+    0x01, 0x28, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x11, 0x01, 0x10,
+    0x01, 0x00, 0x01, 0x01, 0x02, 0x11, 0x08, 0x22, 0x08, 0x77, 0x08, 0x33,
+    0x08, 0x99, 0x08, 0x44, 0x08, 0xaa, 0x08, 0x55, 0x08, 0xbb, 0x08, 0x66,
+    0x08, 0xcc, 0x08, 0x88, 0x08, 0xdd, 0x09, 0xff, 0x07, 0xee, 0xec, 0x4e,
+    0x14, 0x08, 0x00, 0x08, 0x00, 0x20, 0x00, 0x00, 0x04, 0x01, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x01, 0xfe, 0x01, 0x1f, 0x01,
+    0x40, 0x01, 0x00, 0x02, 0xff, 0x0a, 0x00, 0x02, 0xff, 0x04, 0x00, 0x04,
+    0xff, 0x02, 0x00, 0x01, 0xff, 0x01, 0xab, 0xed, 0x4e, 0x14, 0x14, 0x00,
+    0x14, 0x00, 0x20, 0x00, 0x00, 0x04, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x1f, 0x01, 0xff, 0x01, 0xf0,
+    0x01, 0x40, 0x05, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0,
+    0x1e, 0x00, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff,
+    0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff,
+    0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x02, 0xff,
+    0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xff, 0x01, 0xf0,
+    0x01, 0x00, 0x01, 0xff, 0x01, 0xf0, 0x02, 0xff, 0x01, 0xf0, 0x01, 0xab,
+    0x01, 0xff, 0x01, 0xf0, 0xf3, 0x4e, 0x14, 0x46, 0x00, 0x46, 0x00, 0x71,
+    0x00, 0x01, 0x00, 0x01, 0x73, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x77, 0x77, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88,
+    0x77, 0x71, 0x11, 0x11, 0x17, 0x77, 0x77, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x87, 0x17, 0x78, 0x17, 0x77,
+    0x77, 0x77, 0x77, 0x78, 0xc7, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x17, 0x77, 0x88, 0x88, 0x88, 0x88,
+    0x77, 0x77, 0xcc, 0xc7, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x78, 0x88, 0x88, 0x44, 0xcc, 0x88, 0x86, 0x67,
+    0x7c, 0xcc, 0xc8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0xc4, 0x4c, 0xc6, 0x68, 0x87, 0x7c,
+    0xcc, 0xc7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x77, 0x78, 0x66, 0x66, 0x64, 0x4c, 0x4c, 0xcc, 0x8e, 0x77, 0x7c, 0xcc,
+    0xc7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77,
+    0x88, 0x66, 0x66, 0x66, 0x4c, 0xcc, 0xcc, 0x8e, 0x77, 0x7c, 0xcc, 0xc7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x44, 0x44,
+    0x46, 0x66, 0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x84, 0x44, 0x44, 0x46,
+    0x66, 0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0x44, 0x44, 0x4c, 0x66,
+    0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x86, 0x44, 0x44, 0x4c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x86, 0x64, 0x44, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x88, 0x77, 0x77, 0x17, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x40, 0x04, 0xcc, 0xcc, 0xcc, 0x88,
+    0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0x87, 0x71, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x87, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x17, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x08, 0x17,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x08, 0x17, 0x77,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x8f, 0x00, 0x00, 0x05, 0x17, 0x77, 0x77,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77,
+    0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x88, 0x88, 0x87, 0x77, 0x77, 0x87, 0x77, 0x77, 0x77, 0x87,
+    0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x77, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x45, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x87, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x88, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x44, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77,
+    0x77, 0x77, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x77,
+    0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x77, 0x71,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x11, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x77, 0x77, 0x77, 0x11, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0x87, 0x78, 0xcc, 0xcc, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0xcc, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0xcc, 0xcc, 0x8c, 0xcc, 0xcc, 0x88, 0x8c, 0x8c, 0xcc, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xcc, 0x44, 0x4c, 0xcc, 0x40, 0x00, 0x00, 0x04, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0xcc, 0x7c, 0xcc, 0xcc, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0xcc, 0x44, 0x8c, 0xcc, 0xc4, 0x00, 0x04, 0x4c, 0xcc, 0xcc,
+    0x8c, 0xcc, 0xcc, 0xc8, 0xcc, 0xc7, 0x7c, 0xcc, 0xcc, 0xcc, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0xcc, 0x4c, 0x17, 0x8c, 0xcc, 0xc4, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x78, 0x44, 0x71, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x7c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc7, 0xc8, 0x8c, 0xcc, 0xcc, 0xc8, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17,
+    0x44, 0x88, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x78, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x7c, 0xc7, 0x7c, 0xcc, 0xcc, 0xc8, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x44,
+    0x48, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xc8, 0x8c, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x7c, 0xc7, 0x87, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x44, 0x48,
+    0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0xc6, 0xcc, 0xcc, 0xcc, 0xc8,
+    0xcc, 0x88, 0xc8, 0x7c, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x44, 0x4c,
+    0xcc, 0xcc, 0xcc, 0xc6, 0xcc, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc,
+    0x8c, 0xcc, 0x88, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xcc,
+    0xcc, 0xc4, 0x4c, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0x78,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x4c, 0xcc, 0xc4,
+    0x44, 0x44, 0xcc, 0x8e, 0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xe7, 0x77,
+    0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x04, 0x44, 0x40, 0x00,
+    0x04, 0xc8, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0x7c,
+    0xcc, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0xcc,
+    0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xcc, 0x71, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0x77, 0xc8, 0x11, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x77, 0xcc, 0x71, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xcc, 0x87, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x88, 0x66, 0x64, 0xcc, 0x6c, 0xc8, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x48, 0x87, 0x88, 0x88, 0x88, 0x87, 0x18, 0x88, 0x88, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x08, 0x88, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x00, 0x00, 0x08, 0x71, 0x11, 0x11, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x87, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x00, 0x08, 0x71, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x00, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x00, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x78, 0x87,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00,
+    0x87, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x78, 0x88, 0x87,
+    0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+    0x77, 0x17, 0x71, 0x11, 0x11, 0x77, 0x77, 0x88, 0x00, 0x04, 0x88, 0x88,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x4e, 0x14, 0x20, 0x00, 0x20, 0x00, 0x4f,
+    0x00, 0x02, 0x00, 0x01, 0xe0, 0x09, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82,
+    0x89, 0x89, 0x3a, 0x82, 0x5e, 0x65, 0x5e, 0x5e, 0x34, 0x34, 0x5e, 0x5e,
+    0x34, 0x34, 0xad, 0x3b, 0x34, 0x88, 0x34, 0x58, 0x82, 0xa6, 0x82, 0xac,
+    0x04, 0x5e, 0x58, 0x82, 0x82, 0x04, 0x89, 0x82, 0x3a, 0x5e, 0x5e, 0x34,
+    0x34, 0x34, 0x5e, 0x82, 0x5e, 0x5e, 0x5e, 0x04, 0x8a, 0x58, 0x65, 0x82,
+    0x34, 0xae, 0x82, 0x58, 0x82, 0x04, 0x82, 0x04, 0x82, 0x58, 0x34, 0x5e,
+    0xa0, 0x8a, 0x65, 0x5e, 0x58, 0x5e, 0x34, 0x58, 0x00, 0x34, 0x82, 0x82,
+    0x5e, 0x5e, 0x58, 0x5e, 0xd8, 0xa6, 0xd9, 0xa6, 0x08, 0xcb, 0xa6, 0x5e,
+    0x34, 0x82, 0x82, 0x82, 0x04, 0x82, 0x04, 0x58, 0x5e, 0x34, 0x3a, 0x00,
+    0x5e, 0x34, 0x34, 0x82, 0x00, 0x00, 0x3b, 0x00, 0x34, 0x00, 0x00, 0x5f,
+    0xd2, 0x89, 0xd2, 0xa6, 0xae, 0xca, 0xa6, 0x5e, 0x58, 0x04, 0x82, 0x82,
+    0xac, 0xa6, 0x82, 0xa6, 0x82, 0x00, 0x34, 0x00, 0x3a, 0x5e, 0x3a, 0x5e,
+    0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x3b, 0xd2, 0xd8, 0xcb, 0xad,
+    0xca, 0x0c, 0xca, 0x82, 0x58, 0x5e, 0x58, 0x82, 0xa6, 0x82, 0x82, 0x5e,
+    0xa6, 0x5e, 0x34, 0x34, 0x88, 0x5e, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34,
+    0x5e, 0x58, 0x5e, 0x66, 0xb4, 0xd8, 0xca, 0xa0, 0xa0, 0xa0, 0xa6, 0x04,
+    0x5e, 0x58, 0x5e, 0x82, 0xa6, 0x82, 0x82, 0xac, 0x82, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x3a, 0x34, 0x00, 0x34, 0x34, 0x34, 0xb5,
+    0xcb, 0xac, 0x0c, 0x0c, 0xa0, 0xca, 0x04, 0x04, 0x5e, 0x34, 0x58, 0x82,
+    0xac, 0xa6, 0x5e, 0x5e, 0x34, 0x58, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x5e, 0x00, 0x5e, 0xa6, 0x5e, 0x58, 0xbb, 0xa6, 0xa6, 0xd0, 0xac,
+    0xca, 0x04, 0x58, 0x5e, 0x04, 0x04, 0x82, 0xa6, 0xa6, 0x88, 0x88, 0x34,
+    0x82, 0x58, 0x34, 0x34, 0x00, 0x34, 0x5e, 0x82, 0x34, 0x34, 0x5f, 0x88,
+    0x82, 0x82, 0x65, 0xd9, 0xa0, 0xa6, 0xac, 0xca, 0xa0, 0x3a, 0x34, 0x04,
+    0x82, 0x82, 0x04, 0x82, 0x82, 0x82, 0xa6, 0x82, 0x82, 0x58, 0x3a, 0x58,
+    0x00, 0x5e, 0x82, 0x34, 0x34, 0x88, 0xac, 0xb3, 0x58, 0x3a, 0xae, 0xd2,
+    0xa6, 0xa6, 0xa7, 0xca, 0x04, 0x34, 0x34, 0x5e, 0xa6, 0xa6, 0x82, 0x04,
+    0x82, 0x5e, 0x5e, 0xa0, 0x89, 0xac, 0x3a, 0x34, 0x00, 0x34, 0x88, 0x82,
+    0x34, 0xac, 0xb2, 0xad, 0x00, 0x82, 0xb4, 0xe0, 0x01, 0xe0, 0xd2, 0xa7,
+    0xb5, 0xa6, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xa6, 0x82, 0xb5,
+    0x01, 0x5e, 0x5e, 0x00, 0x00, 0x34, 0x5e, 0x82, 0x5e, 0x34, 0x88, 0xb3,
+    0x82, 0x82, 0xb5, 0x01, 0xe0, 0xad, 0xa6, 0xe0, 0xae, 0x0c, 0xac, 0x58,
+    0x3a, 0x89, 0x58, 0x5e, 0x82, 0x5e, 0xe0, 0x01, 0x01, 0x5e, 0x82, 0x5e,
+    0x34, 0x00, 0x5e, 0xa6, 0x82, 0x58, 0x5e, 0xb3, 0xad, 0xac, 0xe0, 0xdf,
+    0x89, 0xa6, 0xa0, 0xa6, 0x5e, 0x58, 0x82, 0x5e, 0x58, 0x3a, 0x88, 0x34,
+    0x34, 0x07, 0x01, 0x01, 0x01, 0x82, 0x82, 0x34, 0x5e, 0x34, 0x34, 0xac,
+    0x88, 0x82, 0x34, 0x89, 0xb3, 0x89, 0xe0, 0xad, 0x04, 0xa6, 0x82, 0x82,
+    0x3a, 0x00, 0x3a, 0x5e, 0x34, 0x34, 0x34, 0xac, 0x89, 0x01, 0x01, 0x01,
+    0xae, 0x82, 0xac, 0x00, 0x00, 0x82, 0x00, 0x5e, 0x58, 0x82, 0x00, 0x34,
+    0xb3, 0xae, 0xe0, 0x04, 0x82, 0xa6, 0x82, 0xac, 0x82, 0x5e, 0x00, 0x88,
+    0x34, 0x34, 0x00, 0x3a, 0x08, 0x01, 0x01, 0xda, 0x04, 0xac, 0x82, 0x82,
+    0x00, 0x04, 0x34, 0x5e, 0x58, 0x5e, 0x5e, 0x5e, 0x88, 0xd9, 0xd9, 0x82,
+    0x04, 0xa6, 0xa6, 0x88, 0xad, 0xad, 0x00, 0x34, 0x82, 0x82, 0x34, 0x00,
+    0xe0, 0x01, 0x01, 0xae, 0x04, 0xac, 0xa6, 0x82, 0x82, 0x82, 0x5e, 0x5e,
+    0x34, 0x82, 0x34, 0x58, 0x82, 0xb5, 0xb4, 0xa0, 0x82, 0xa0, 0xac, 0xa6,
+    0x3a, 0x5e, 0x5f, 0x34, 0x5e, 0x5e, 0x58, 0x5f, 0x01, 0x01, 0xe6, 0xae,
+    0x04, 0xac, 0xac, 0x88, 0x82, 0x82, 0x82, 0x82, 0x5e, 0x04, 0x82, 0x58,
+    0x82, 0xb5, 0xd2, 0x82, 0xa6, 0x0c, 0xa6, 0x5e, 0x82, 0x5e, 0x34, 0x00,
+    0x5e, 0xac, 0x82, 0x89, 0x01, 0xe6, 0x07, 0x66, 0x00, 0xac, 0xac, 0xac,
+    0xac, 0xac, 0x58, 0x34, 0x3a, 0x82, 0x58, 0x5e, 0x04, 0xbb, 0xad, 0xa6,
+    0xa0, 0x0c, 0x0c, 0x06, 0xb2, 0xb3, 0xac, 0x34, 0x5e, 0x82, 0x88, 0x89,
+    0xe0, 0xb5, 0x58, 0x00, 0x00, 0xac, 0xa6, 0xb3, 0xac, 0xb3, 0x82, 0x5e,
+    0x82, 0x5e, 0x58, 0x58, 0x5e, 0xb5, 0xd1, 0xa0, 0xa6, 0x0c, 0xa6, 0x82,
+    0x82, 0x88, 0x82, 0x5e, 0x5e, 0x5e, 0x5e, 0x82, 0xca, 0x07, 0x8b, 0x3a,
+    0x34, 0xac, 0xa6, 0x88, 0x88, 0xa6, 0xac, 0xa6, 0x58, 0x04, 0x5e, 0x58,
+    0x58, 0x07, 0xad, 0xa6, 0x0c, 0x0c, 0xa0, 0x5e, 0x82, 0x88, 0x34, 0x5e,
+    0x00, 0x34, 0xa6, 0x82, 0xa6, 0xe0, 0x01, 0xad, 0xa0, 0x04, 0x82, 0xa6,
+    0x04, 0xa6, 0x82, 0x82, 0x82, 0x82, 0x82, 0x04, 0x04, 0xbb, 0xd2, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x58, 0x34, 0x00, 0x3a, 0x00, 0x34, 0x5e, 0x88, 0xad,
+    0xac, 0xd9, 0x01, 0xa6, 0x58, 0x82, 0x04, 0x82, 0xac, 0x82, 0x82, 0x04,
+    0x82, 0x04, 0x82, 0x58, 0x82, 0x82, 0xad, 0xa6, 0x0c, 0x0c, 0x0c, 0xca,
+    0xa6, 0x00, 0x82, 0x82, 0x58, 0x82, 0xac, 0x5e, 0x82, 0x89, 0x01, 0xa7,
+    0x58, 0x58, 0x34, 0x5e, 0x82, 0x04, 0xa6, 0xa6, 0x82, 0x5e, 0x58, 0x04,
+    0x58, 0x5e, 0x89, 0xcb, 0xa0, 0x0c, 0x0c, 0x0c, 0xa0, 0x34, 0x3a, 0x82,
+    0x04, 0x88, 0x88, 0x58, 0x88, 0xac, 0x07, 0xb5, 0x58, 0xa6, 0x34, 0x5e,
+    0x82, 0x04, 0x82, 0x04, 0xa6, 0x58, 0x58, 0x5e, 0x04, 0x82, 0x82, 0xb4,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa0, 0x5e, 0x5e, 0x5e, 0x82, 0x82, 0x82,
+    0x04, 0x82, 0xae, 0x01, 0x82, 0xa6, 0x58, 0x58, 0x82, 0xa6, 0x82, 0x3a,
+    0x82, 0x82, 0x58, 0x58, 0x58, 0x58, 0x58, 0xb4, 0xa6, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xa0, 0xa6, 0x58, 0x58, 0x04, 0x82, 0xa6, 0x5e, 0xad, 0x01,
+    0xb3, 0x82, 0xac, 0x5e, 0x58, 0x3a, 0x04, 0x82, 0x58, 0x82, 0x58, 0x58,
+    0x5e, 0x58, 0x3a, 0x82, 0xb3, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xa6, 0x58, 0x82, 0x82, 0x82, 0x04, 0x5e, 0xe0, 0xa0, 0x58, 0x82, 0xa6,
+    0x34, 0x00, 0x34, 0xa6, 0x34, 0x82, 0x58, 0x58, 0x58, 0x34, 0x58, 0x04,
+    0xac, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa0, 0x0c, 0xa6, 0x58, 0x58,
+    0x58, 0x82, 0x83, 0xe0, 0x04, 0x58, 0x5e, 0x58, 0x5e, 0x34, 0x00, 0x34,
+    0x5e, 0x58, 0x04, 0x04, 0x58, 0x5e, 0x58, 0x58, 0x04, 0xa6, 0xa6, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0x0c, 0x82, 0xae, 0x90, 0xb5, 0x01, 0xe0,
+    0x82, 0x04, 0x58, 0x34, 0x00, 0x58, 0x34, 0x3a, 0x34, 0x00, 0x5e, 0x04,
+    0x58, 0x58, 0x58, 0x82, 0x58, 0x82, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0x82,
+    0xa6, 0xa0, 0xa6, 0x83, 0xb5, 0x01, 0x01, 0xd9, 0xa6, 0x04, 0x82, 0x34,
+    0x34, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00, 0x34, 0x82, 0x58, 0x58, 0x34,
+    0x58, 0x58, 0xa6, 0x0c, 0x0c, 0x0c, 0xa0, 0x04, 0x82, 0x04, 0x82, 0x34,
+    0x58, 0x5e, 0x08, 0xae, 0xae, 0x34, 0x3a, 0x34, 0x34, 0x5e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3a, 0x58, 0x58, 0x34, 0x5e, 0xa0,
+    0x0c, 0xa6, 0x04, 0x3a, 0x58, 0x04, 0x58, 0x00, 0x58, 0x04, 0x58, 0x82,
+    0x82, 0x58, 0x34, 0x5e, 0x34, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x5e, 0x58, 0x58, 0x82, 0xa0, 0x82, 0x58, 0x34,
+    0x04, 0x58, 0x3a, 0x34, 0x5e, 0x58, 0x5e, 0x04, 0x04, 0x04, 0x00, 0x58,
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x34, 0x58,
+    0x58, 0x82, 0x04, 0x58, 0x88, 0xa6, 0x58, 0x5e, 0x58, 0x58, 0x3a, 0x34,
+    0x58, 0x04, 0x58, 0x04, 0x82, 0x82, 0x34, 0x5e, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x00, 0x34, 0x34, 0x3a,
+    0x5e, 0xd8, 0x83, 0xa6, 0x58, 0x82, 0x58, 0x58, 0x04, 0x82, 0xa6, 0xa0,
+    0x82, 0x82, 0x34, 0x04, 0x04, 0x00, 0x34, 0xb4, 0x89, 0x5e, 0x89, 0x82,
+    0x89, 0x89, 0x82, 0x82, 0xb2, 0xae, 0xb3, 0xac, 0x88, 0x01, 0xb5, 0x01,
+    0xd9, 0x82, 0x58, 0x04, 0x04, 0x82, 0xa0, 0x82, 0xa6, 0x34, 0x82, 0x58,
+    0x82, 0x04, 0x88, 0x89, 0x82, 0xac, 0x88, 0x82, 0x89, 0xac, 0x89, 0xb3,
+    0xad, 0xb3, 0xb4, 0xb4, 0xb4, 0xe0, 0xe6, 0x01, 0x01, 0xe1, 0x89, 0x04,
+    0x04, 0xa6, 0xa6, 0xa6, 0xa0, 0x5e, 0x34, 0x34, 0x82, 0xac, 0x82, 0xac,
+    0x88, 0xad, 0xad, 0xb4, 0xad, 0xb4, 0xad, 0xb4, 0xb4, 0x90, 0xb5, 0xe0,
+    0xbb, 0xe1, 0x01, 0x01, 0x01, 0x01, 0xa7, 0xa6, 0xa6, 0xa0, 0xa6, 0xa0,
+    0x82, 0x5e, 0xb4, 0xad, 0x8a, 0xac, 0xb4, 0xb4, 0xb4, 0xb5, 0xbb, 0xbb,
+    0xbb, 0xe0, 0x07, 0xe6, 0xe6, 0xe1, 0x07, 0xe0, 0x07, 0xe0, 0x01, 0x01,
+    0x01, 0xad, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0xa6, 0x04, 0xb3, 0xad, 0xba,
+    0xb3, 0xdf, 0xb5, 0xbb, 0xbb, 0xe0, 0x07, 0xe0, 0xe0, 0x01, 0xe0, 0x07,
+    0xdf, 0xbb, 0xe6, 0xe0, 0xbb, 0xe0, 0x01, 0x01, 0xae, 0x58, 0xa6, 0xa6,
+    0x0c, 0x0c, 0x0c, 0xa0, 0x82, 0xb4, 0x90, 0xbb, 0xb4, 0xb4, 0xdf, 0xdf,
+    0xb5, 0xde, 0xb4, 0xbb, 0xbb, 0xdf, 0xbb, 0xe0, 0x07, 0xe0, 0x07, 0xdf,
+    0xbb, 0xe0, 0x01, 0xe0, 0x3a, 0xa0, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0xa0,
+    0x82, 0xb4, 0xdf, 0xba, 0xb4, 0xba, 0xb4, 0xba, 0xb4, 0xba, 0xdf, 0xbb,
+    0xde, 0xbb, 0xe0, 0x07, 0xdf, 0xbb, 0xdf, 0xba, 0xba, 0xe0, 0x01, 0x8a,
+    0x04, 0xa6, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0x04, 0x5e, 0x89, 0xb4,
+    0xb4, 0x89, 0x8a, 0x90, 0xb4, 0xb4, 0xbb, 0xe0, 0x07, 0xe6, 0xe0, 0xbb,
+    0xdf, 0xba, 0xb4, 0xba, 0xde, 0xb5, 0x01, 0xad, 0xa0, 0x82, 0xa0, 0xca,
+    0x0c, 0x0c, 0x0c, 0x04, 0x58, 0x34, 0x3a, 0x5e, 0x5e, 0x5f, 0xb4, 0xb4,
+    0xdf, 0xdf, 0x8a, 0x90, 0xbb, 0xb4, 0xba, 0xba, 0xd8, 0xba, 0xd8, 0xba,
+    0xd7, 0xb4, 0x01, 0xa7, 0xa6, 0xa6, 0x04, 0xa6, 0xa6, 0x0c, 0xa6, 0x58,
+    0x58, 0x5e, 0x82, 0x88, 0xb3, 0xb3, 0xb3, 0x82, 0xac, 0x88, 0x82, 0x5e,
+    0x58, 0x83, 0xac, 0x82, 0xb4, 0xbb, 0xe6, 0x07, 0xe6, 0xb5, 0x01, 0xd8,
+    0x04, 0x58, 0x04, 0x04, 0xa6, 0xa0, 0x04, 0x04, 0x04, 0x88, 0x82, 0xac,
+    0x88, 0xad, 0xb4, 0xb3, 0xb9, 0xb4, 0xad, 0x88, 0x82, 0x5e, 0x5e, 0xad,
+    0xad, 0xb4, 0xdf, 0xdf, 0xc2, 0xdf, 0xe6, 0x01, 0xe6, 0xb5, 0x82, 0x82,
+    0xa0, 0xa6, 0x04, 0x5e, 0xa6, 0x82, 0xb3, 0xb4, 0xb4, 0xe0, 0xbb, 0xe0,
+    0x01, 0x01, 0xe6, 0x07, 0x01, 0x01, 0x01, 0x01, 0xbb, 0x01, 0x01, 0xe6,
+    0x01, 0xe0, 0x01, 0x01, 0x01, 0x01, 0xad, 0xa0, 0xa6, 0x04, 0x5e, 0x04,
+    0x04, 0x08, 0xe6, 0x01, 0xdf, 0xbb, 0xe0, 0xe6, 0xe6, 0x01, 0x01, 0xe6,
+    0x01, 0x01, 0xe6, 0x07, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe0, 0x04, 0x82, 0xa0, 0x82, 0x58, 0x04, 0x82, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0xe6, 0xe0, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x82, 0x04,
+    0x82, 0x04, 0x04, 0x82, 0x04, 0x01, 0xe0, 0x01, 0x01, 0xe0, 0xbb, 0xe6,
+    0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0xe6, 0x01, 0x01,
+    0xe0, 0xbb, 0x01, 0x01, 0xdf, 0xa6, 0x04, 0x04, 0x04, 0x04, 0x58, 0x82,
+    0x04, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0xe0, 0x01, 0x01, 0xdf, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0x07, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xbb, 0xca, 0x82, 0x04, 0x82, 0x58, 0x04, 0x58, 0x04, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x01, 0xe6, 0x01,
+    0xe6, 0xdf, 0xba, 0xe6, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0xba, 0xa6, 0x04,
+    0x58, 0x04, 0x58, 0x82, 0xa6, 0x01, 0x01, 0xe6, 0xe0, 0xe6, 0x07, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xbb, 0xdf, 0x01, 0x01, 0xe6, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x04, 0x04, 0x58, 0x04, 0x82,
+    0xa0, 0x01, 0xe6, 0xbb, 0xdf, 0xe6, 0xdf, 0xbb, 0xd8, 0xbb, 0xdf, 0x01,
+    0xe6, 0xdf, 0xdf, 0x01, 0xe6, 0x01, 0x01, 0xe0, 0x01, 0xe6, 0x01, 0x01,
+    0x01, 0x01, 0xb4, 0x82, 0x58, 0x58, 0x04, 0x82, 0x0c, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0xe6, 0xe6, 0x01, 0xe6, 0xe6, 0x01, 0x01, 0x01, 0xe6,
+    0x01, 0xe6, 0xe0, 0xbb, 0xbb, 0xdf, 0xb4, 0x01, 0x01, 0x01, 0xd9, 0x04,
+    0x58, 0x82, 0xa7, 0xa0, 0xa6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe0, 0xb4, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdf, 0xe6,
+    0x01, 0xe6, 0xe0, 0x01, 0x01, 0x01, 0xae, 0x04, 0x34, 0x07, 0xd1, 0x82,
+    0xa0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xd8, 0x82, 0x66, 0x01, 0xa6, 0x04, 0xa6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xae, 0x58,
+    0xe0, 0xb4, 0x04, 0x82, 0xa0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xb5, 0xa6, 0x82, 0xd8, 0x04, 0x04, 0xa6,
+    0xa6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe6, 0xac, 0x04, 0x04, 0x58, 0x5e, 0x04, 0x82, 0x04, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xca, 0x58, 0x00,
+    0x3a, 0x34, 0x58, 0x04, 0x82, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xe6, 0xac, 0x04, 0x34, 0x34, 0x5e, 0x58, 0x58,
+    0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xdf, 0xa6, 0x58, 0x3a, 0x34, 0x58, 0x5e, 0x58, 0x58, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xde, 0xa6, 0x04, 0x5e,
+    0x58, 0x3a, 0x58, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe6, 0x01, 0xb4, 0xca, 0x04, 0x04, 0x58, 0x04, 0x04, 0x82,
+    0x7d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd9,
+    0xdf, 0xb5, 0xa7, 0x8a, 0x82, 0x83, 0x8a, 0x8a, 0xe0, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xe1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0xad, 0xb5, 0xb5, 0x08,
+    0xd9, 0x35, 0x8a, 0xb4, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xdf, 0xbb, 0xe1, 0xad, 0x8a, 0xb6, 0x08, 0xe0, 0x58, 0x8a,
+    0x8b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdf, 0xba,
+    0x8b, 0x07, 0x8a, 0x8a, 0xb5, 0x8b, 0x07, 0x5f, 0x83, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb4, 0x83, 0x08, 0xb6, 0x8a,
+    0x89, 0xb5, 0x08, 0xe0, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0xbb, 0xca, 0x5e, 0x58, 0xb4, 0xb6, 0x8a, 0x8a, 0xb4, 0x8b,
+    0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xa7, 0x04,
+    0x34, 0x3a, 0x34, 0x08, 0xb5, 0x8a, 0x5f, 0xad, 0x34, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xd9, 0x82, 0x34, 0x5e, 0x58, 0x3a, 0x34,
+    0xae, 0xb6, 0x8a, 0x34, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xae, 0x58, 0x5e, 0x58, 0x58, 0x34, 0x34, 0x3a, 0xa8, 0x90, 0x5e,
+    0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa7, 0x58, 0x34,
+    0x04, 0x58, 0x5e, 0x58, 0x00, 0x34, 0x5e, 0x34, 0x3a, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x58, 0x5e, 0x58, 0x58, 0x58, 0x3a,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe6, 0x04, 0x58, 0x5e, 0x34, 0x3a, 0x58, 0x58, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x04, 0x5e, 0x58,
+    0x5e, 0x34, 0x3a, 0x58, 0x3a, 0x00, 0x00, 0x34, 0x3b, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xdf, 0x04, 0x58, 0x58, 0x04, 0x58, 0x34, 0x3a,
+    0x58, 0x34, 0x00, 0x65, 0x8b, 0xfd, 0x4e, 0x14, 0x1f, 0x00, 0x1f, 0x00,
+    0x4f, 0x00, 0x02, 0x00, 0x01, 0x91, 0x09, 0x00, 0x00, 0x00, 0x82, 0x00,
+    0x34, 0x34, 0x34, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
+    0x5e, 0x5e, 0x82, 0x83, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x16, 0x66, 0x89,
+    0xb4, 0x58, 0x5e, 0x00, 0x00, 0x04, 0x58, 0x00, 0x34, 0x00, 0x34, 0x5e,
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x88, 0x88, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0x89, 0x8a, 0x5f, 0x88, 0x82, 0x34, 0x00, 0x00,
+    0x82, 0x82, 0x34, 0x00, 0x00, 0x34, 0x58, 0x5e, 0x00, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x5e, 0x3a, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3a, 0x5e,
+    0x5e, 0x89, 0x88, 0x88, 0x82, 0x82, 0x58, 0x82, 0x04, 0x82, 0x58, 0x00,
+    0x00, 0x34, 0x58, 0x00, 0x34, 0x5e, 0x34, 0x34, 0x00, 0x00, 0x00, 0x58,
+    0x3a, 0x3b, 0x34, 0x5f, 0x00, 0x34, 0xb4, 0xad, 0x88, 0x34, 0x5e, 0x58,
+    0x3a, 0x83, 0x04, 0x82, 0x04, 0x5e, 0x34, 0x34, 0x3a, 0x34, 0x00, 0x00,
+    0x3a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x65, 0xca, 0xa7, 0xca, 0x5f,
+    0x5e, 0xd2, 0xa7, 0x82, 0x58, 0x58, 0x5e, 0x5e, 0x5e, 0x88, 0x83, 0x88,
+    0x04, 0x58, 0x00, 0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x34, 0x34,
+    0x00, 0x5e, 0xa8, 0x0c, 0xa7, 0xca, 0xad, 0xa6, 0xb4, 0xad, 0x82, 0x88,
+    0x82, 0x34, 0x34, 0x3a, 0xac, 0x88, 0x04, 0x82, 0x34, 0x00, 0x00, 0x34,
+    0x3a, 0x34, 0x34, 0x34, 0x58, 0x04, 0x00, 0x3a, 0x82, 0xca, 0xca, 0xa6,
+    0xd6, 0xa6, 0xba, 0xd9, 0xb3, 0xa6, 0x5e, 0x58, 0x34, 0x3a, 0x58, 0x88,
+    0xa6, 0x88, 0x82, 0x58, 0x34, 0x00, 0x34, 0x34, 0x00, 0x00, 0x5e, 0x5e,
+    0x5e, 0x34, 0x34, 0x82, 0x82, 0x0c, 0xd0, 0xac, 0xd6, 0xb4, 0xdf, 0xbb,
+    0x5e, 0x5e, 0x34, 0x3a, 0x5e, 0x58, 0x82, 0x88, 0xb3, 0x88, 0xae, 0x04,
+    0x5e, 0x00, 0x00, 0x58, 0x00, 0x34, 0x00, 0xac, 0x3a, 0x34, 0x5e, 0x5e,
+    0xa0, 0xac, 0xd8, 0xb9, 0xb9, 0xde, 0xb9, 0xdf, 0x5e, 0x5e, 0x34, 0x00,
+    0x3a, 0xb5, 0xde, 0xbb, 0xdf, 0xe6, 0xb4, 0x58, 0x34, 0x00, 0x00, 0x00,
+    0x3a, 0xae, 0x5e, 0x00, 0x5e, 0x58, 0x3a, 0x5e, 0x82, 0xd6, 0xc0, 0xdd,
+    0xb8, 0xdc, 0xbb, 0x04, 0x5e, 0x34, 0x00, 0x34, 0xe6, 0x07, 0x82, 0xde,
+    0xbb, 0xb3, 0x04, 0x3a, 0x00, 0x00, 0x34, 0x3b, 0x65, 0x00, 0x34, 0x89,
+    0x5e, 0x34, 0x82, 0x58, 0xac, 0xb3, 0xdd, 0xb8, 0xd6, 0xba, 0x83, 0x5e,
+    0x3a, 0x34, 0x00, 0xdf, 0xad, 0x82, 0x82, 0xac, 0xac, 0xa6, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x88, 0x82, 0x8a, 0xad, 0xa0, 0xae,
+    0xd0, 0xb9, 0xb2, 0xd6, 0xb3, 0xae, 0x34, 0x00, 0x00, 0x5f, 0xe0, 0xac,
+    0xa0, 0xa6, 0xa6, 0xd0, 0xac, 0x82, 0x34, 0x34, 0x00, 0x00, 0x00, 0x34,
+    0x88, 0x82, 0x04, 0xad, 0x0c, 0xac, 0xd7, 0xac, 0xb3, 0xd6, 0xd0, 0xb2,
+    0xd8, 0x34, 0x16, 0x34, 0x00, 0xa6, 0x0c, 0xa0, 0x0c, 0x0c, 0xac, 0xd0,
+    0xb3, 0xac, 0x58, 0x00, 0x00, 0x00, 0x00, 0x34, 0x5e, 0x58, 0x34, 0x5e,
+    0x04, 0xa6, 0xd0, 0xac, 0xb2, 0xb3, 0xb2, 0xad, 0x00, 0x34, 0x34, 0x5e,
+    0xa0, 0xa0, 0x0c, 0x0c, 0x0c, 0xca, 0xb2, 0xde, 0x82, 0x58, 0x00, 0x00,
+    0x3a, 0x58, 0x00, 0x34, 0x82, 0x88, 0xac, 0x5e, 0x5e, 0xa6, 0xa6, 0xca,
+    0xa6, 0xd6, 0x89, 0x00, 0x34, 0x3a, 0x82, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xac, 0xe0, 0xa6, 0x3a, 0x00, 0x00, 0x34, 0x88, 0x5e, 0x5e, 0x34,
+    0x3a, 0x34, 0x82, 0x00, 0x5e, 0x90, 0xa7, 0xca, 0xac, 0x8a, 0x3a, 0x3a,
+    0x34, 0x5e, 0x82, 0x0c, 0xa6, 0x04, 0x04, 0xa0, 0xac, 0xe0, 0x04, 0x58,
+    0x00, 0x00, 0x00, 0x5e, 0x5e, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
+    0x8a, 0xa6, 0xa0, 0xd0, 0xad, 0x3a, 0x82, 0x89, 0xb2, 0x34, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x34, 0xdf, 0x5e, 0x82, 0x34, 0x00, 0x00, 0x00, 0x5e,
+    0x00, 0x34, 0x34, 0x34, 0x34, 0x65, 0x34, 0xb4, 0x82, 0xa0, 0xca, 0xb3,
+    0x34, 0x00, 0x5e, 0xa6, 0x00, 0x34, 0x34, 0x00, 0x00, 0x34, 0xa6, 0xb3,
+    0x34, 0x5e, 0x82, 0x5e, 0x5e, 0x34, 0x5e, 0x5e, 0x5e, 0x89, 0x5e, 0x66,
+    0xb3, 0x5e, 0xb5, 0x04, 0x04, 0xca, 0x8f, 0x00, 0x3b, 0xb4, 0x88, 0x00,
+    0x82, 0xa0, 0x82, 0x04, 0x0c, 0xac, 0x0c, 0x82, 0x34, 0x34, 0x00, 0x34,
+    0x5e, 0x5e, 0x34, 0x5e, 0x34, 0x3b, 0x5e, 0xb4, 0x5e, 0xdf, 0x58, 0x82,
+    0xca, 0xac, 0x34, 0x5e, 0x5e, 0x82, 0x34, 0x04, 0x0c, 0xa0, 0xa0, 0x0c,
+    0x0c, 0xa0, 0x58, 0x34, 0x00, 0x34, 0x00, 0x3a, 0x82, 0x3a, 0x34, 0x3a,
+    0x34, 0x00, 0x3a, 0xad, 0xd9, 0x82, 0x04, 0xd0, 0xb2, 0x89, 0x88, 0xad,
+    0x82, 0x00, 0x82, 0xa0, 0xa6, 0x58, 0xa0, 0xca, 0x82, 0x58, 0x00, 0x89,
+    0x5f, 0x3a, 0x83, 0x00, 0x5e, 0x89, 0x82, 0x5f, 0x00, 0x00, 0x90, 0xd8,
+    0x58, 0xa0, 0xac, 0xd0, 0xad, 0xad, 0x64, 0x82, 0x34, 0xa6, 0xad, 0x89,
+    0x58, 0x0c, 0xd0, 0x34, 0x00, 0x5e, 0x34, 0x65, 0x34, 0x5e, 0x5e, 0x34,
+    0x88, 0x89, 0x89, 0x8a, 0x5e, 0xb5, 0xd8, 0x04, 0xa0, 0xd0, 0xb3, 0x89,
+    0x5e, 0x5e, 0x5e, 0x34, 0x5e, 0xa0, 0xa0, 0x0c, 0xca, 0x88, 0x34, 0x34,
+    0x3a, 0x34, 0x34, 0x5e, 0xad, 0x89, 0x3a, 0x5e, 0x34, 0x34, 0x16, 0x5f,
+    0xbb, 0xd7, 0x82, 0x0c, 0xb2, 0xac, 0x82, 0x89, 0x89, 0x89, 0x58, 0x04,
+    0xca, 0x0c, 0x0c, 0xac, 0x58, 0x34, 0x88, 0x82, 0x82, 0x5e, 0x64, 0x5f,
+    0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x34, 0xae, 0xb4, 0xa0, 0xca, 0xb2,
+    0x82, 0x3a, 0x34, 0x00, 0x08, 0xa6, 0x04, 0xa0, 0x0c, 0x0c, 0xa6, 0x04,
+    0x3a, 0x5e, 0x5e, 0x3a, 0x00, 0x34, 0x00, 0x00, 0x5f, 0x88, 0x89, 0x89,
+    0x58, 0x82, 0x04, 0x04, 0xa0, 0x0c, 0xca, 0xad, 0x3b, 0x89, 0x89, 0x88,
+    0x04, 0x58, 0xa6, 0x0c, 0x0c, 0xa0, 0x58, 0x34, 0x00, 0x00, 0x58, 0x34,
+    0x65, 0x89, 0xb4, 0x88, 0x82, 0x04, 0x58, 0xa6, 0x04, 0x04, 0xa6, 0xa0,
+    0x0c, 0xa0, 0x5f, 0x65, 0xad, 0x88, 0x88, 0x58, 0xa6, 0x0c, 0x0c, 0x0c,
+    0xa6, 0x89, 0x8a, 0x8a, 0xb4, 0x8f, 0xb4, 0xad, 0x89, 0xad, 0xb4, 0x5e,
+    0x58, 0x82, 0xa6, 0x04, 0x82, 0xa0, 0x0c, 0x82, 0x34, 0x00, 0x34, 0x88,
+    0x82, 0x88, 0x04, 0x82, 0x0c, 0x0c, 0x0c, 0x0c, 0x89, 0xb3, 0xb3, 0x5f,
+    0x89, 0xb3, 0xb4, 0xb4, 0xb4, 0x5e, 0x3a, 0x04, 0xa6, 0xa0, 0xa6, 0xa0,
+    0x0c, 0xa6, 0x5e, 0x58, 0x00, 0x00, 0x5f, 0x89, 0x89, 0xa0, 0xa6, 0x0c,
+    0xa0, 0x0c, 0x0c, 0xa7, 0xad, 0x58, 0x65, 0x08, 0x07, 0x89, 0x11, 0x00,
+    0x34, 0x58, 0x04, 0x82, 0xa6, 0x0c, 0x0c, 0x0c, 0x3a, 0x34, 0x34, 0x3a,
+    0x3b, 0x34, 0x3a, 0x35, 0xa6, 0x04, 0xa0, 0xa6, 0x0c, 0xa6, 0x0c, 0x82,
+    0x04, 0xb4, 0x5f, 0x34, 0x00, 0x00, 0x34, 0x58, 0x58, 0x04, 0xa6, 0xa6,
+    0xa0, 0x0c, 0x82, 0x58, 0x89, 0x88, 0x82, 0x82, 0x5f, 0x5f, 0x34, 0x04,
+    0x5e, 0x04, 0x82, 0x04, 0x82, 0x04, 0x5e, 0x34, 0x00, 0x00, 0x34, 0x5e,
+    0x34, 0x04, 0x58, 0x82, 0xa6, 0xa6, 0xa0, 0x0c, 0x04, 0x34, 0x5e, 0x82,
+    0x82, 0x3a, 0x82, 0x5e, 0x82, 0x04, 0x82, 0x04, 0x82, 0xa6, 0x04, 0x04,
+    0x58, 0x34, 0x00, 0x00, 0x34, 0x04, 0x04, 0x5e, 0x58, 0x04, 0x04, 0x82,
+    0xa0, 0x0c, 0xa6, 0x5e, 0x82, 0x82, 0x88, 0x82, 0x5e, 0x82, 0x5e, 0x88,
+    0x82, 0x04, 0x82, 0x04, 0x04, 0x04, 0x58, 0x5e, 0x34, 0x34, 0x00, 0x82,
+    0xa6, 0x04, 0x58, 0x04, 0x04, 0x82, 0xa0, 0xa6, 0xac, 0x89, 0xad, 0xb3,
+    0xad, 0x89, 0xb4, 0xb3, 0x89, 0xb4, 0xb3, 0xb4, 0x82, 0x04, 0x82, 0x04,
+    0x04, 0x82, 0x58, 0x58, 0x34, 0x82, 0xa0, 0xa0, 0x04, 0x58, 0x58, 0x82,
+    0xa6, 0xa6, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb5, 0xb4, 0xb3, 0xae, 0xb5,
+    0xb5, 0xb4, 0xb4, 0xa6, 0x04, 0x04, 0x58, 0x04, 0x04, 0x82, 0x04, 0x82,
+    0x0c, 0x0c, 0x82, 0x04, 0x82, 0xa0, 0xa6, 0xae, 0xb4, 0xe0, 0xb5, 0xbb,
+    0xbb, 0xbb, 0xb5, 0xe0, 0xbb, 0xbb, 0xbb, 0xb4, 0xe0, 0xb5, 0x82, 0x04,
+    0x58, 0x04, 0x82, 0x82, 0xa6, 0xa0, 0x0c, 0x0c, 0xa0, 0x0c, 0x0c, 0x0c,
+    0xa6, 0x82, 0xb5, 0x90, 0x07, 0xdf, 0xb6, 0xdf, 0xb5, 0xe0, 0xc2, 0xb5,
+    0xd9, 0xbb, 0xdf, 0xe0, 0x07, 0x04, 0x34, 0x58, 0x04, 0x58, 0x04, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0xdf, 0xc2, 0xb4, 0x07, 0xb4,
+    0xe0, 0xbb, 0xbb, 0xb4, 0x8a, 0xdf, 0xb5, 0x90, 0xb4, 0xbb, 0xb4, 0xbb,
+    0x58, 0x5e, 0x58, 0x5e, 0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xa6, 0xd8, 0xe0, 0xe0, 0xbb, 0xe0, 0x07, 0xbb, 0xe0, 0x07, 0xe0, 0xc2,
+    0xe0, 0xe0, 0xb5, 0xba, 0x89, 0x8a, 0xe0, 0x58, 0x58, 0x5e, 0x34, 0x00,
+    0x00, 0x04, 0xa0, 0x0c, 0xca, 0x0c, 0xca, 0xad, 0xdf, 0xbb, 0xe6, 0xe6,
+    0x07, 0xe6, 0xe0, 0x07, 0xe0, 0xe6, 0xb5, 0xe6, 0xbb, 0x07, 0xdf, 0x07,
+    0xde, 0x07, 0x04, 0x58, 0x04, 0x58, 0x00, 0x00, 0x82, 0x0c, 0x0c, 0x0c,
+    0xca, 0xa6, 0xdf, 0xdf, 0x07, 0xdf, 0x07, 0xdf, 0xc2, 0xe0, 0xc2, 0xdf,
+    0xe0, 0xbb, 0xbb, 0xe0, 0xe0, 0xc2, 0xe0, 0xbb, 0xe0, 0x58, 0x04, 0x04,
+    0x58, 0x00, 0x5e, 0xa0, 0x0c, 0xca, 0xca, 0x0c, 0xb4, 0xdf, 0xbb, 0xe6,
+    0x01, 0xe6, 0xe0, 0xe6, 0xe6, 0xe0, 0xc2, 0xe6, 0xe6, 0xe0, 0xe6, 0xbb,
+    0xdf, 0xe6, 0x01, 0xe0, 0x34, 0x04, 0x5e, 0x04, 0x04, 0xa0, 0x0c, 0x0c,
+    0xac, 0xca, 0xac, 0xdf, 0xc2, 0xdf, 0xc2, 0xde, 0xdf, 0xc2, 0xe0, 0xe6,
+    0x01, 0xe6, 0xe0, 0xe6, 0xe6, 0xbb, 0xdf, 0x01, 0xbb, 0xe0, 0xe6, 0x58,
+    0x04, 0x04, 0x82, 0x0c, 0x0c, 0xca, 0xca, 0xac, 0xca, 0xba, 0xdf, 0xe6,
+    0xe6, 0xe0, 0xbb, 0xbb, 0xdf, 0xc1, 0xdf, 0xbb, 0xe6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x04, 0x5e, 0x04, 0x82, 0x0c, 0x0c,
+    0x0c, 0xa6, 0xca, 0xac, 0xdf, 0x07, 0xe6, 0xe0, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xa6, 0x04, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xa6, 0xd8, 0xe6,
+    0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa6, 0xa6, 0xa0, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xb5, 0x08, 0xb5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd2,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x07, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82, 0xa0,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xb4, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xe1, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x82, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01, 0x01,
+    0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xd2, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd9, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe6, 0x01, 0x01, 0x01, 0xe6,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x0c, 0x0c, 0xa0,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xdf, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0c, 0x0c, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xdf,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa0,
+    0xa6, 0x04, 0x82, 0x0c, 0x0c, 0x0c, 0xd1, 0xe6, 0xe6, 0x01, 0xe6, 0x01,
+    0x07, 0xe6, 0xe6, 0xe0, 0x01, 0x01, 0x07, 0xe0, 0x01, 0xe6, 0x07, 0x01,
+    0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x82, 0x04, 0x82, 0x0c, 0x0c,
+    0x0c, 0xa0, 0xb4, 0xe0, 0xe6, 0x01, 0xe0, 0xe0, 0xe6, 0x07, 0xe6, 0xbb,
+    0xdf, 0xe0, 0xe6, 0xe0, 0xb4, 0xdf, 0xe6, 0xba, 0xb4, 0xdf, 0xe6, 0xc2,
+    0xd9, 0xa6, 0x04, 0x04, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0xa0, 0xe6, 0x01,
+    0x01, 0xe6, 0x01, 0xe6, 0xe6, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0xe0, 0xe6, 0xe6, 0xe0, 0xdf, 0xa6, 0x04, 0xa6, 0xa6,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xe0,
+    0xe6, 0x07, 0xbb, 0x82, 0x04, 0x82, 0xa0, 0xca, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xa6, 0xe6, 0x01, 0x01, 0xbb, 0xe0, 0xe6, 0xe6, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x04, 0x82,
+    0xa0, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0xbb, 0xbb, 0xe0, 0xe6,
+    0xb4, 0xe6, 0xbb, 0xe0, 0x01, 0x01, 0x01, 0xe0, 0xe6, 0xe0, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0xdf, 0x04, 0x82, 0x82, 0x04, 0xa6, 0xa0, 0x0c,
+    0x0c, 0x0c, 0xa6, 0xe0, 0xbb, 0xdf, 0xe0, 0xe6, 0xe0, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x01, 0xba, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x04, 0x04, 0x82, 0x04, 0xa6, 0xa0, 0xa0, 0xa0, 0x0c, 0x0c, 0xd2, 0xe6,
+    0xb3, 0x83, 0xdf, 0xdf, 0xbb, 0xb3, 0xe6, 0x01, 0xe6, 0x01, 0x01, 0xdf,
+    0x01, 0x01, 0x01, 0xbb, 0xe0, 0xe6, 0x01, 0x82, 0xa0, 0x83, 0x8a, 0xb5,
+    0x83, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0xbb, 0xe0, 0xe6, 0x01, 0x01, 0xe6,
+    0xe0, 0x07, 0xde, 0xba, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0xe6, 0x04, 0xae, 0xb4, 0x8b, 0x8a, 0x5e, 0xa0, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xd9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe0, 0x01,
+    0xbb, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xaf, 0x5e, 0x8a,
+    0xa7, 0x58, 0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0xd9, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xbb, 0xde, 0xbb, 0xe0, 0x01, 0x01,
+    0x01, 0xe6, 0xe0, 0xe6, 0x07, 0xd3, 0x58, 0x5e, 0x58, 0x34, 0xa6, 0x0c,
+    0x0c, 0x0c, 0x0c, 0xd2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xe6, 0x01, 0xe0, 0xe6, 0xad, 0xd1, 0xb4, 0x07, 0x01, 0x01, 0x01, 0x8a,
+    0x8a, 0x58, 0x04, 0x5e, 0x58, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0xa7, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xd9,
+    0xba, 0x88, 0x07, 0x01, 0x01, 0x01, 0xae, 0x34, 0x58, 0x04, 0x04, 0x04,
+    0x82, 0x0c, 0x0c, 0x0c, 0x0c, 0xca, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0xd8, 0xb4, 0xe6, 0x01, 0x01,
+    0x01, 0x34, 0x58, 0x5e, 0x58, 0x58, 0x04, 0x82, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01,
+    0x01, 0x07, 0x01, 0xdf, 0xb4, 0x01, 0x01, 0x01, 0x34, 0x3a, 0x58, 0x58,
+    0x58, 0x04, 0xa6, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xdf, 0x01, 0xe6, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xe0, 0xbb, 0xd9,
+    0xb3, 0xae, 0x8a, 0x34, 0x3a, 0x34, 0x5e, 0x58, 0x04, 0xa6, 0xa6, 0x0c,
+    0x0c, 0x0c, 0x0c, 0xb5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xe6, 0xb5, 0xb4, 0x82, 0xa6, 0xba, 0xac, 0x34, 0x34,
+    0x3a, 0x58, 0x58, 0x04, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xd8, 0x01,
+    0x01, 0xe6, 0x01, 0xe0, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb3,
+    0x89, 0xb4, 0xdf, 0xe0, 0xbb, 0x3a, 0x00, 0x34, 0x5e, 0x04, 0x04, 0xa6,
+    0xa0, 0x0c, 0x0c, 0x0c, 0x0c, 0xae, 0x01, 0xe6, 0xe0, 0xe6, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xb5, 0xd8, 0xbb, 0xdf, 0x07, 0xe6, 0x01,
+    0x34, 0x34, 0x3a, 0x58, 0x04, 0x82, 0x82, 0xa6, 0xa0, 0x0c, 0x0c, 0x0c,
+    0xd2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6,
+    0x01, 0x01, 0x01, 0xe0, 0xc2, 0xe0, 0xe0, 0x34, 0x3a, 0x34, 0x58, 0x58,
+    0x04, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x0c, 0xae, 0xe6, 0x01, 0xe6, 0x01,
+    0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xbb, 0xb5, 0x01,
+    0x01, 0xe6, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x82, 0xa0, 0xa6, 0xa0, 0xca,
+    0x0c, 0x0c, 0xd9, 0x01, 0x01, 0xe0, 0xe6, 0x01, 0xe6, 0x01, 0x01, 0xe0,
+    0x01, 0xe6, 0xe6, 0xbb, 0xe0, 0xe6, 0x07, 0x07, 0xbb, 0x3a, 0x34, 0x34,
+    0x3a, 0x04, 0x04, 0x82, 0xa6, 0xa0, 0xa6, 0x0c, 0x0c, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x01, 0xe0, 0xe6, 0x01,
+    0xdf, 0x01, 0x01, 0x01, 0x34, 0x34, 0x3a, 0x34, 0x58, 0x04, 0x82, 0xa0,
+    0xa6, 0xa0, 0xca, 0xa0, 0x01, 0x01, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfe,
+    0x4e, 0x14, 0x1e, 0x00, 0x1e, 0x00, 0x4f, 0x00, 0x02, 0x04, 0x1f, 0x6a,
+    0x04, 0x00, 0x00, 0x00, 0x1a, 0xb9, 0x01, 0xb5, 0x01, 0x8a, 0x01, 0x83,
+    0x01, 0x04, 0x01, 0xb9, 0x01, 0xbb, 0x03, 0xb9, 0x01, 0xbb, 0x15, 0xb9,
+    0x01, 0x8b, 0x01, 0x83, 0x01, 0x7d, 0x01, 0xbb, 0x01, 0xb9, 0x01, 0xbb,
+    0x18, 0xb9, 0x01, 0x08, 0x01, 0x84, 0x01, 0x04, 0x01, 0x08, 0x1a, 0xb9,
+    0x01, 0xbb, 0x01, 0x8a, 0x01, 0x7d, 0x01, 0x08, 0x1b, 0xb9, 0x01, 0x8b,
+    0x02, 0x83, 0x01, 0x08, 0x1a, 0xb9, 0x01, 0x08, 0x01, 0x84, 0x01, 0x04,
+    0x01, 0x84, 0x01, 0x08, 0x19, 0xb9, 0x01, 0xbb, 0x01, 0x89, 0x01, 0x7d,
+    0x01, 0x83, 0x01, 0x8a, 0x01, 0x08, 0x16, 0xb9, 0x01, 0xbb, 0x01, 0xba,
+    0x01, 0xb3, 0x01, 0x89, 0x02, 0x7d, 0x01, 0x83, 0x01, 0x8b, 0x01, 0x08,
+    0x13, 0xb9, 0x01, 0xbb, 0x01, 0xb9, 0x03, 0xdc, 0x01, 0x8f, 0x03, 0x7d,
+    0x01, 0x83, 0x01, 0x8b, 0x01, 0x97, 0x10, 0xb9, 0x01, 0xbb, 0x01, 0xb9,
+    0x06, 0xdc, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x83, 0x01, 0x7d, 0x01, 0x83,
+    0x01, 0x08, 0x10, 0xb9, 0x01, 0xb3, 0x07, 0xdc, 0x02, 0x04, 0x01, 0x7d,
+    0x01, 0x04, 0x01, 0x7d, 0x01, 0x84, 0x01, 0x08, 0x0c, 0xb9, 0x01, 0xb4,
+    0x0a, 0xdc, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x83, 0x03, 0x04, 0x01, 0x8a,
+    0x01, 0x08, 0x0a, 0xb9, 0x01, 0xb3, 0x0b, 0xdc, 0x01, 0x04, 0x01, 0x7d,
+    0x02, 0x04, 0x01, 0x82, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x8a, 0x01, 0x08,
+    0x08, 0xb9, 0x01, 0xb3, 0x0c, 0xdc, 0x03, 0x04, 0x01, 0x7d, 0x03, 0x04,
+    0x01, 0x83, 0x01, 0x8b, 0x06, 0xb9, 0x01, 0xbb, 0x01, 0xb3, 0x0d, 0xdc,
+    0x01, 0x04, 0x03, 0x7d, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x04, 0x02, 0x83,
+    0x01, 0x08, 0x04, 0xb9, 0x01, 0xba, 0x0f, 0xdc, 0x02, 0x7d, 0x01, 0x04,
+    0x01, 0x7d, 0x02, 0x04, 0x03, 0x83, 0x01, 0x84, 0x01, 0x08, 0x02, 0xbb,
+    0x01, 0xb9, 0x10, 0xdc, 0x02, 0x7d, 0x02, 0x04, 0x02, 0x7d, 0x04, 0x83,
+    0x01, 0x8a, 0x01, 0x90, 0x01, 0xb3, 0x11, 0xdc, 0x03, 0x04, 0x01, 0x7d,
+    0x01, 0x04, 0x05, 0x83, 0x01, 0x5f, 0x01, 0x89, 0x01, 0xb3, 0x11, 0xdc,
+    0x01, 0x7d, 0x01, 0x04, 0x01, 0x7d, 0x01, 0x04, 0x05, 0x83, 0x01, 0x5f,
+    0x01, 0x42, 0x01, 0x43, 0x01, 0x8f, 0x01, 0xb3, 0x10, 0xdc, 0x01, 0x82,
+    0x07, 0x83, 0x01, 0x5f, 0x01, 0x42, 0x02, 0x1f, 0x01, 0x43, 0x01, 0x8f,
+    0x10, 0xdc, 0x01, 0x82, 0x06, 0x83, 0x01, 0x5f, 0x01, 0x42, 0x04, 0x1f,
+    0x01, 0x66, 0x01, 0x8f, 0x0f, 0xdc, 0x02, 0x83, 0x01, 0x82, 0x03, 0x83,
+    0x01, 0x5f, 0x01, 0x3c, 0x06, 0x1f, 0x01, 0x66, 0x01, 0x8f, 0x0e, 0xdc,
+    0x01, 0x83, 0x01, 0x82, 0x03, 0x83, 0x01, 0x59, 0x01, 0x3c, 0x08, 0x1f,
+    0x01, 0x6c, 0x01, 0xb3, 0x0d, 0xdc, 0x01, 0x83, 0x01, 0x82, 0x01, 0x04,
+    0x01, 0x83, 0x01, 0x7d, 0x01, 0x3b, 0x07, 0x1f, 0x01, 0x19, 0x02, 0x1f,
+    0x01, 0x66, 0x01, 0xb3, 0x0c, 0xdc, 0x02, 0x82, 0x01, 0x83, 0x01, 0x7d,
+    0x01, 0x3b, 0x01, 0x1e, 0x0b, 0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0b, 0xdc,
+    0x01, 0x04, 0x02, 0x7d, 0x01, 0x59, 0x01, 0x18, 0x0d, 0x1f, 0x01, 0x66,
+    0x01, 0x8f, 0x0a, 0xdc, 0x01, 0x7d, 0x01, 0x04, 0x01, 0x59, 0x01, 0x18,
+    0x0f, 0x1f, 0x01, 0x43, 0x02, 0xb3, 0x08, 0xdc, 0x01, 0x83, 0x01, 0x59,
+    0x01, 0x18, 0x11, 0x1f, 0x01, 0x66, 0x02, 0xb3, 0x07, 0xdc, 0x01, 0x83,
+    0x01, 0x18, 0x13, 0x1f, 0x01, 0x6c, 0x01, 0xb3, 0x07, 0xdc, 0x01, 0x60,
+    0x15, 0x1f, 0x01, 0x6c, 0x01, 0xb3, 0x06, 0xdc, 0x01, 0x43, 0x16, 0x1f,
+    0x01, 0x8f, 0x06, 0xdc, 0x05, 0x1f, 0x01, 0x19, 0x11, 0x1f, 0x01, 0x43,
+    0x01, 0x8f, 0x03, 0xdc, 0x01, 0xb3, 0x01, 0xe6, 0x18, 0x1f, 0x01, 0x42,
+    0x01, 0x8f, 0x01, 0xdc, 0x01, 0xb9, 0x02, 0xe6, 0x19, 0x1f, 0x01, 0x42,
+    0x01, 0x90, 0x01, 0xbb, 0x01, 0x07, 0x01, 0xe6, 0x01, 0x42, 0x18, 0x1f,
+    0x01, 0x1e, 0x01, 0x41, 0x01, 0x08, 0x01, 0xbb, 0x01, 0xe6, 0x01, 0x8f,
+    0x01, 0x66, 0x01, 0x43, 0x15, 0x1f, 0x01, 0x1d, 0x02, 0x40, 0x01, 0x65,
+    0x01, 0x08, 0x01, 0xbb, 0x02, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42,
+    0x01, 0x1e, 0x01, 0x18, 0x10, 0x1f, 0x01, 0x1e, 0x04, 0x41, 0x01, 0x6b,
+    0x01, 0x97, 0x04, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x01, 0x1e,
+    0x0e, 0x1f, 0x01, 0x1e, 0x03, 0x40, 0x01, 0x41, 0x02, 0x40, 0x01, 0x6b,
+    0x06, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x0c, 0x1f, 0x01, 0x1e,
+    0x01, 0x41, 0x07, 0x40, 0x08, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42,
+    0x02, 0x1f, 0x01, 0x19, 0x01, 0x1f, 0x01, 0x19, 0x05, 0x1f, 0x01, 0x41,
+    0x04, 0x40, 0x01, 0x41, 0x03, 0x40, 0x0a, 0xdc, 0x01, 0x06, 0x01, 0x65,
+    0x01, 0x42, 0x07, 0x19, 0x01, 0x1e, 0x02, 0x40, 0x01, 0x41, 0x06, 0x40,
+    0x0c, 0xdc, 0x01, 0x06, 0x01, 0x65, 0x01, 0x42, 0x05, 0x19, 0x01, 0x41,
+    0x09, 0x40, 0x0f, 0xdc, 0x01, 0x65, 0x01, 0x42, 0x01, 0x18, 0x01, 0x19,
+    0x01, 0x18, 0x0a, 0x40, 0x11, 0xdc, 0x01, 0x89, 0x01, 0x42, 0x01, 0x41,
+    0x0a, 0x40, 0x12, 0xdc, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0x41, 0x09, 0x40,
+    0x12, 0xdc, 0x01, 0xb3, 0x01, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x01, 0x41,
+    0x07, 0x40, 0x12, 0xdc, 0x01, 0xb4, 0x02, 0xe6, 0x02, 0x97, 0x01, 0x90,
+    0x01, 0x66, 0x01, 0x41, 0x04, 0x40, 0x12, 0xdc, 0x01, 0x08, 0x06, 0xe6,
+    0x01, 0x08, 0x01, 0x6b, 0x01, 0x41, 0x02, 0x40, 0x11, 0xdc, 0x01, 0xb3,
+    0x09, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x01, 0x40, 0x11, 0xdc, 0x01, 0xb4,
+    0x0b, 0xe6, 0x01, 0x08, 0x11, 0xdc, 0x01, 0xba, 0x0c, 0xe6, 0x11, 0xdc,
+    0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xb3, 0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xb9,
+    0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xb9, 0x0d, 0xe6, 0x10, 0xdc, 0x01, 0xba,
+    0x0d, 0xe6, 0x02, 0x41, 0x04, 0x65, 0x02, 0x89, 0x06, 0x8f, 0x02, 0xb3,
+    0x01, 0xb4, 0x0d, 0xe6, 0x05, 0x19, 0x01, 0x18, 0x01, 0x1e, 0x04, 0x19,
+    0x03, 0x43, 0x01, 0x19, 0x02, 0x42, 0x02, 0x41, 0x0a, 0x65, 0x01, 0x6c,
+    0x10, 0x19, 0x01, 0x42, 0x01, 0x40, 0x01, 0x41, 0x09, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x10, 0x19, 0x01, 0x42, 0x01, 0x41, 0x08, 0x40, 0x01, 0x41,
+    0x03, 0x40, 0x02, 0x19, 0x01, 0x1f, 0x0d, 0x19, 0x01, 0x42, 0x0d, 0x40,
+    0x10, 0x19, 0x01, 0x42, 0x0b, 0x40, 0x01, 0x41, 0x01, 0x40, 0x11, 0x19,
+    0x0d, 0x40, 0x11, 0x19, 0x0b, 0x40, 0x01, 0x41, 0x01, 0x40, 0x11, 0x19,
+    0x01, 0x41, 0x0a, 0x40, 0x02, 0x41, 0x11, 0x19, 0x01, 0x41, 0x06, 0x40,
+    0x01, 0x41, 0x01, 0x40, 0x02, 0x41, 0x01, 0x66, 0x01, 0x90, 0x11, 0x19,
+    0x01, 0x41, 0x06, 0x40, 0x02, 0x41, 0x01, 0x6c, 0x01, 0x08, 0x02, 0x07,
+    0x11, 0x19, 0x01, 0x1e, 0x02, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x01, 0x65, 0x01, 0x90, 0x01, 0x08, 0x04, 0x07, 0x0b, 0x19, 0x01, 0x1f,
+    0x05, 0x19, 0x01, 0x18, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x6c,
+    0x01, 0x08, 0x07, 0x07, 0x0f, 0x19, 0x02, 0x18, 0x01, 0x3c, 0x01, 0x65,
+    0x01, 0x90, 0x0a, 0x07, 0x0d, 0x19, 0x02, 0x18, 0x01, 0x42, 0x01, 0x89,
+    0x01, 0xb2, 0x01, 0xb3, 0x0b, 0x07, 0x0b, 0x19, 0x01, 0x18, 0x01, 0x3c,
+    0x01, 0x65, 0x01, 0x06, 0x04, 0xb2, 0x01, 0x90, 0x0a, 0x07, 0x07, 0x19,
+    0x03, 0x18, 0x01, 0x41, 0x01, 0x89, 0x07, 0xb2, 0x01, 0xb3, 0x0a, 0x07,
+    0x01, 0x1f, 0x06, 0x19, 0x01, 0x3b, 0x01, 0x65, 0x01, 0x06, 0x0a, 0xb2,
+    0x01, 0x90, 0x09, 0x07, 0x05, 0x19, 0x01, 0x41, 0x01, 0x88, 0x0e, 0xb2,
+    0x01, 0x90, 0x08, 0x07, 0x02, 0x19, 0x01, 0x3b, 0x01, 0x64, 0x01, 0x06,
+    0x10, 0xb2, 0x01, 0xb3, 0x01, 0x07, 0x01, 0x97, 0x05, 0x07, 0x01, 0x90,
+    0x01, 0x41, 0x01, 0x64, 0x01, 0x06, 0x13, 0xb2, 0x01, 0xb4, 0x04, 0x07,
+    0x01, 0xbb, 0x01, 0x90, 0x01, 0x40, 0x01, 0x06, 0x16, 0xb2, 0x01, 0xba,
+    0x03, 0x07, 0x01, 0x6c, 0x02, 0x40, 0xff, 0x4e, 0x14, 0x1f, 0x00, 0x1f,
+    0x00, 0x4f, 0x00, 0x02, 0x04, 0x01, 0x7e, 0x06, 0x00, 0x00, 0x00, 0x01,
+    0x82, 0x0e, 0x83, 0x02, 0x7d, 0x03, 0x83, 0x01, 0xbb, 0x0a, 0xb9, 0x09,
+    0x83, 0x01, 0x82, 0x03, 0x83, 0x01, 0x04, 0x03, 0x7d, 0x03, 0x83, 0x01,
+    0xbb, 0x0a, 0xb9, 0x01, 0x04, 0x01, 0x82, 0x11, 0x83, 0x01, 0x84, 0x01,
+    0x97, 0x07, 0xbb, 0x03, 0xb9, 0x01, 0x7d, 0x09, 0x83, 0x04, 0x60, 0x05,
+    0x3c, 0x01, 0x66, 0x01, 0xb4, 0x06, 0xb9, 0x04, 0xbb, 0x01, 0x7d, 0x04,
+    0x83, 0x01, 0x5f, 0x01, 0x60, 0x02, 0x3c, 0x01, 0x43, 0x09, 0x1f, 0x01,
+    0x66, 0x01, 0xb3, 0x02, 0xdc, 0x02, 0xb3, 0x01, 0xdc, 0x03, 0xb3, 0x01,
+    0xb9, 0x01, 0xba, 0x02, 0x83, 0x01, 0x60, 0x01, 0x3c, 0x01, 0x43, 0x0e,
+    0x1f, 0x01, 0x66, 0x03, 0xdc, 0x01, 0xb9, 0x07, 0xdc, 0x01, 0x3c, 0x12,
+    0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0a, 0xdc, 0x01, 0x42, 0x12, 0x1f, 0x01,
+    0x66, 0x0b, 0xdc, 0x01, 0x66, 0x12, 0x1f, 0x01, 0x66, 0x01, 0xb3, 0x0a,
+    0xdc, 0x01, 0x66, 0x12, 0x1f, 0x01, 0x66, 0x0b, 0xdc, 0x01, 0x89, 0x01,
+    0x42, 0x11, 0x1f, 0x01, 0x66, 0x0b, 0xdc, 0x01, 0x8f, 0x01, 0x42, 0x11,
+    0x1f, 0x01, 0x66, 0x0c, 0xdc, 0x01, 0x66, 0x11, 0x1f, 0x01, 0x66, 0x0c,
+    0xdc, 0x01, 0x89, 0x01, 0x43, 0x10, 0x1f, 0x01, 0x66, 0x0c, 0xdc, 0x01,
+    0x8f, 0x01, 0x66, 0x10, 0x1f, 0x01, 0x6c, 0x0d, 0xdc, 0x01, 0x66, 0x10,
+    0x1f, 0x01, 0x8f, 0x0d, 0xdc, 0x01, 0x89, 0x01, 0x42, 0x0f, 0x1f, 0x01,
+    0x8f, 0x01, 0xb3, 0x0c, 0xdc, 0x01, 0xb3, 0x01, 0x66, 0x0f, 0x1f, 0x01,
+    0x8f, 0x0e, 0xdc, 0x01, 0x66, 0x0f, 0x1f, 0x01, 0x8f, 0x0e, 0xdc, 0x01,
+    0x8f, 0x01, 0x43, 0x0e, 0x1f, 0x01, 0x8f, 0x0f, 0xdc, 0x01, 0x66, 0x0d,
+    0x1f, 0x01, 0x42, 0x01, 0xb3, 0x0f, 0xdc, 0x01, 0x89, 0x01, 0x43, 0x0c,
+    0x1f, 0x01, 0x43, 0x01, 0xb3, 0x0f, 0xdc, 0x01, 0xb3, 0x01, 0x66, 0x01,
+    0x92, 0x01, 0x43, 0x0a, 0x1f, 0x01, 0x43, 0x01, 0xb3, 0x10, 0xdc, 0x01,
+    0x89, 0x01, 0xbd, 0x01, 0x43, 0x0a, 0x1f, 0x01, 0x42, 0x11, 0xdc, 0x01,
+    0x8f, 0x01, 0x98, 0x0b, 0x1f, 0x01, 0x42, 0x01, 0xdc, 0x01, 0xb3, 0x0f,
+    0xdc, 0x01, 0xb3, 0x01, 0x6d, 0x05, 0x1f, 0x04, 0x1e, 0x01, 0x1d, 0x02,
+    0x41, 0x01, 0xba, 0x01, 0xbb, 0x05, 0xba, 0x01, 0xb9, 0x0a, 0xdc, 0x01,
+    0x66, 0x02, 0x1f, 0x01, 0x1e, 0x01, 0x1d, 0x05, 0x41, 0x02, 0x40, 0x01,
+    0x65, 0x05, 0xe6, 0x03, 0xbb, 0x03, 0xba, 0x01, 0xb9, 0x06, 0xdc, 0x01,
+    0x8f, 0x01, 0x66, 0x03, 0x41, 0x02, 0x40, 0x01, 0x41, 0x01, 0x40, 0x02,
+    0x41, 0x01, 0x40, 0x01, 0x6b, 0x0a, 0xe6, 0x01, 0xbb, 0x01, 0xba, 0x05,
+    0xdc, 0x01, 0xba, 0x01, 0xbb, 0x01, 0x66, 0x01, 0x41, 0x04, 0x40, 0x05,
+    0x41, 0x01, 0x6b, 0x0b, 0xe6, 0x01, 0x08, 0x03, 0xdc, 0x01, 0xba, 0x02,
+    0xbb, 0x01, 0x07, 0x01, 0x90, 0x02, 0x41, 0x02, 0x40, 0x01, 0x41, 0x01,
+    0x40, 0x04, 0x41, 0x01, 0x66, 0x0b, 0xe6, 0x01, 0x6c, 0x01, 0xdc, 0x01,
+    0xb3, 0x02, 0xbb, 0x01, 0xe6, 0x02, 0xbb, 0x01, 0x08, 0x02, 0x41, 0x03,
+    0x40, 0x03, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x6c, 0x0a, 0xe6, 0x02,
+    0x23, 0x01, 0xba, 0x06, 0xe6, 0x01, 0xbb, 0x01, 0x6c, 0x03, 0x41, 0x02,
+    0x40, 0x04, 0x41, 0x01, 0x6c, 0x0a, 0xe6, 0x01, 0x6c, 0x01, 0x23, 0x07,
+    0xe6, 0x01, 0xbb, 0x01, 0x90, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01,
+    0x40, 0x05, 0x41, 0x01, 0x6c, 0x0a, 0xe6, 0x02, 0x23, 0x08, 0xe6, 0x01,
+    0x97, 0x01, 0x6b, 0x02, 0x40, 0x06, 0x41, 0x01, 0x6c, 0x09, 0xe6, 0x03,
+    0x23, 0x08, 0xe6, 0x01, 0xbb, 0x01, 0x6c, 0x01, 0x46, 0x01, 0x40, 0x06,
+    0x41, 0x01, 0x6c, 0x09, 0xe6, 0x03, 0x23, 0x09, 0xe6, 0x01, 0x90, 0x01,
+    0x65, 0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x6c, 0x08,
+    0xe6, 0x04, 0x23, 0x09, 0xe6, 0x01, 0x97, 0x01, 0x6b, 0x01, 0x46, 0x01,
+    0x40, 0x05, 0x41, 0x01, 0x6c, 0x08, 0xe6, 0x01, 0x6c, 0x03, 0x23, 0x01,
+    0xbb, 0x09, 0xe6, 0x01, 0x6c, 0x01, 0x46, 0x04, 0x40, 0x02, 0x41, 0x01,
+    0x90, 0x08, 0xe6, 0x04, 0x23, 0x01, 0x08, 0x09, 0xe6, 0x01, 0x08, 0x01,
+    0x47, 0x03, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x90, 0x07,
+    0xe6, 0x05, 0x23, 0x01, 0x6c, 0x0a, 0xe6, 0x01, 0x6b, 0x01, 0x41, 0x02,
+    0x40, 0x03, 0x41, 0x01, 0x90, 0x07, 0xe6, 0x05, 0x23, 0x01, 0x40, 0x01,
+    0x6c, 0x09, 0xe6, 0x01, 0x6c, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01,
+    0x40, 0x02, 0x41, 0x01, 0x08, 0x06, 0xe6, 0x06, 0x23, 0x02, 0x40, 0x01,
+    0x6c, 0x01, 0xbb, 0x07, 0xe6, 0x01, 0x08, 0x01, 0x41, 0x01, 0x40, 0x01,
+    0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x08, 0x06, 0xe6, 0x02,
+    0x23, 0x01, 0x47, 0x03, 0x23, 0x02, 0x40, 0x01, 0x41, 0x01, 0x90, 0x08,
+    0xe6, 0x01, 0x6b, 0x05, 0x40, 0x01, 0x97, 0x05, 0xe6, 0x07, 0x23, 0x04,
+    0x40, 0x01, 0x90, 0x07, 0xe6, 0x01, 0x6c, 0x04, 0x40, 0x01, 0x46, 0x01,
+    0x97, 0x05, 0xe6, 0x01, 0x6b, 0x06, 0x23, 0x04, 0x40, 0x01, 0x41, 0x01,
+    0x08, 0x06, 0xe6, 0x01, 0x08, 0x03, 0x41, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x97, 0x04, 0xe6, 0x01, 0x23, 0x01, 0x47, 0x02, 0x23, 0x02, 0x47, 0x01,
+    0x23, 0x01, 0x47, 0x05, 0x40, 0x01, 0x41, 0x01, 0x08, 0x06, 0xe6, 0x01,
+    0x65, 0x01, 0x40, 0x03, 0x47, 0x01, 0x97, 0x04, 0xe6, 0x01, 0x6c, 0x03,
+    0x23, 0x01, 0x46, 0x03, 0x23, 0x02, 0x40, 0x01, 0x41, 0x03, 0x40, 0x01,
+    0x65, 0x01, 0x08, 0x05, 0xe6, 0x01, 0x6c, 0x01, 0x47, 0x01, 0x6b, 0x02,
+    0x47, 0x04, 0xe6, 0x01, 0x23, 0x02, 0x47, 0x02, 0x23, 0x01, 0x47, 0x02,
+    0x23, 0x01, 0xbb, 0x02, 0x40, 0x01, 0x41, 0x04, 0x40, 0x01, 0x6b, 0x01,
+    0x08, 0x04, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x03, 0x6b, 0x04, 0xe6, 0x01,
+    0x6c, 0x01, 0x46, 0x05, 0x23, 0x01, 0xbb, 0x01, 0xe6, 0x01, 0x41, 0x07,
+    0x40, 0x01, 0x6c, 0x01, 0x08, 0x04, 0xe6, 0x02, 0x6c, 0x02, 0x6b, 0x04,
+    0xe6, 0x06, 0x23, 0x01, 0xbb, 0x02, 0xe6, 0x01, 0x40, 0x01, 0x41, 0x07,
+    0x40, 0x01, 0x6c, 0x04, 0xe6, 0x01, 0x08, 0x03, 0x6c, 0x03, 0xe6, 0x01,
+    0x90, 0x05, 0x23, 0x01, 0xbb, 0x03, 0xe6, 0x01, 0x6c, 0x01, 0x41, 0x08,
+    0x40, 0x01, 0x90, 0x04, 0xe6, 0x01, 0x97, 0x05, 0xe6, 0x01, 0x6c, 0x01,
+    0x6b, 0x03, 0x23, 0x01, 0xbb, 0x05, 0xe6, 0x01, 0x08, 0x01, 0x6c, 0x01,
+    0x41, 0x06, 0x40, 0x01, 0x41, 0x01, 0x90, 0x01, 0xbb, 0x09, 0xe6, 0x01,
+    0x6c, 0x01, 0x23, 0x01, 0x6b, 0x09, 0xe6, 0x01, 0x97, 0x01, 0x6c, 0x01,
+    0x41, 0x06, 0x40, 0x01, 0xbb, 0x01, 0xe6, 0x01, 0xb5, 0x05, 0xae, 0x01,
+    0xb5, 0x02, 0xe6, 0x01, 0x23, 0x0c, 0xe6, 0x01, 0x97, 0x01, 0x6c, 0x01,
+    0x65, 0x03, 0x40, 0x01, 0x6b, 0x01, 0x07, 0x01, 0x90, 0x01, 0x7d, 0x02,
+    0xa7, 0x05, 0xae, 0x07, 0xe6, 0x01, 0x97, 0x01, 0x23, 0x08, 0xe6, 0x01,
+    0x90, 0x01, 0x65, 0x01, 0x41, 0x01, 0xbb, 0x01, 0xb5, 0x02, 0x04, 0x01,
+    0x7d, 0x01, 0xa7, 0x02, 0xae, 0x02, 0xa8, 0x01, 0xae, 0x01, 0xaf, 0x04,
+    0xe6, 0x01, 0x90, 0x02, 0x6b, 0x01, 0x47, 0x08, 0xe6, 0x01, 0x07, 0x01,
+    0xbb, 0x01, 0x97, 0x01, 0x07, 0x01, 0x84, 0x01, 0x7d, 0x02, 0x04, 0x01,
+    0xa7, 0x02, 0xae, 0x01, 0xa8, 0x03, 0xae, 0x01, 0xb5, 0x01, 0xe6, 0x06,
+    0x23, 0x08, 0xe6, 0x03, 0x07, 0x01, 0xbb, 0x01, 0x83, 0x03, 0x04, 0x03,
+    0xa7, 0x04, 0xae, 0x01, 0xb5, 0x01, 0xe6, 0x06, 0x23, 0x08, 0xe6, 0x03,
+    0x07, 0x01, 0x08, 0x02, 0x7d, 0x02, 0x04, 0x01, 0x83, 0x02, 0xa7, 0x01,
+    0xae, 0x02, 0xaf, 0x02, 0xae, 0x01, 0xe6, 0x06, 0x23, 0x06, 0x6c, 0x04,
+    0x90, 0x01, 0x07, 0x01, 0x08, 0x04, 0x04, 0x01, 0x83, 0x01, 0xa7, 0x04,
+    0xae, 0x02, 0xa7, 0x01, 0xe6, 0x01, 0x97, 0x01, 0x90, 0x04, 0x6c, 0x0a,
+    0x40, 0x01, 0x07, 0x01, 0x08, 0x02, 0x04, 0x03, 0x7d, 0x01, 0xa7, 0x03,
+    0xae, 0x01, 0xa7, 0x01, 0x83, 0x01, 0xa8, 0x07, 0xe6, 0x0a, 0x40, 0x01,
+    0xbb, 0x01, 0xb5, 0x01, 0x83, 0x01, 0x04, 0x03, 0x7d, 0x02, 0xa7, 0x03,
+    0xae, 0x01, 0x83, 0x01, 0xae, 0x07, 0xe6, 0x0a, 0x40, 0x01, 0x08, 0x01,
+    0x07, 0x01, 0x8a, 0x04, 0x04, 0x01, 0x83, 0x01, 0xa7, 0x03, 0xae, 0x01,
+    0x83, 0x01, 0xb5, 0x01, 0xe6, 0x01, 0xbb, 0x05, 0xe6, 0x02, 0x40, 0x01,
+    0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x65, 0x01, 0x08, 0x02, 0x07, 0x01,
+    0x08, 0x01, 0x83, 0x03, 0x04, 0x01, 0x7d, 0x02, 0xa7, 0x03, 0xae, 0x01,
+    0x07, 0x01, 0x08, 0x01, 0x65, 0x01, 0x90, 0x01, 0x97, 0x03, 0xe6, 0x05,
+    0x40, 0x01, 0x65, 0x01, 0x6c, 0x01, 0x97, 0x05, 0x07, 0x01, 0x08, 0x01,
+    0x83, 0x03, 0x04, 0x02, 0xa7, 0x02, 0xae, 0x02, 0x07, 0x01, 0x65, 0x01,
+    0x40, 0x01, 0x41, 0x01, 0x65, 0x01, 0x6c, 0x01, 0x08, 0x01, 0xe6, 0x01,
+    0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x66, 0x01, 0x08, 0x06, 0x07, 0x01,
+    0xbb, 0x01, 0x08, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x8a, 0x03, 0x83, 0x01,
+    0xae, 0x01, 0xaf, 0x02, 0x07, 0x01, 0x90, 0x01, 0x41, 0x01, 0x40, 0x01,
+    0x41, 0x01, 0x40, 0x02, 0x41, 0x01, 0x6c, 0x01, 0x41, 0x01, 0x6c, 0x01,
+    0x08, 0x07, 0x07, 0x01, 0xbb, 0x01, 0x65, 0x01, 0x41, 0x01, 0x90, 0x02,
+    0xbb, 0x01, 0xb5, 0x02, 0x08, 0x04, 0x07, 0x01, 0x08, 0x01, 0x66, 0x01,
+    0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x0a,
+    0x07, 0x01, 0x65, 0x03, 0x40, 0x01, 0x6c, 0x04, 0xbb, 0x01, 0x07, 0x01,
+    0xbb, 0x02, 0x07, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x6c, 0x03, 0x40, 0x02,
+    0x41, 0x08, 0x07, 0x01, 0x08, 0x01, 0x41, 0x04, 0x40, 0x01, 0x90, 0x02,
+    0xbb, 0x01, 0x08, 0x01, 0x65, 0x02, 0x23, 0x01, 0x08, 0x03, 0xbb, 0x01,
+    0x08, 0x01, 0x6c, 0x01, 0x40, 0x03, 0x41, 0x07, 0x07, 0x01, 0x08, 0x01,
+    0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x08, 0x02, 0xbb, 0x01, 0x08, 0x03,
+    0x23, 0x01, 0x90, 0x01, 0x08, 0x01, 0xbb, 0x02, 0x07, 0x01, 0x97, 0x01,
+    0x6c, 0x03, 0x41, 0x05, 0x07, 0x01, 0x08, 0x01, 0x90, 0x01, 0x41, 0x05,
+    0x40, 0x01, 0x6c, 0x02, 0x97, 0x02, 0x08, 0x04, 0x23, 0x01, 0x08, 0x04,
+    0x07, 0x01, 0x97, 0x01, 0x6c, 0x02, 0x41, 0x05, 0x07, 0x01, 0x90, 0x07,
+    0x40, 0x01, 0x08, 0x01, 0x97, 0x01, 0xbb, 0x01, 0x97, 0x01, 0x90, 0x04,
+    0x23, 0x01, 0x90, 0x05, 0x07, 0x01, 0x97, 0x01, 0x6c, 0x01, 0x41, 0x04,
+    0x07, 0x01, 0x90, 0x07, 0x40, 0x01, 0x6b, 0x01, 0xbb, 0x01, 0x97, 0x01,
+    0x08, 0x01, 0xbb, 0x01, 0x90, 0x04, 0x23, 0x01, 0x6c, 0x06, 0x07, 0x01,
+    0x97, 0x01, 0x6c, 0x03, 0x07, 0x01, 0x90, 0x08, 0x40, 0x01, 0x08, 0x04,
+    0xbb, 0x01, 0x08, 0x05, 0x23, 0x01, 0xbb, 0x06, 0x07, 0x01, 0xbb, 0x02,
+    0x07, 0x01, 0x90, 0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x02, 0x40, 0x01,
+    0x6c, 0x05, 0x07, 0x01, 0x90, 0x05, 0x23, 0x01, 0x90, 0x08, 0x07, 0x01,
+    0x90, 0x01, 0x40, 0x01, 0x41, 0x06, 0x40, 0x01, 0x41, 0x01, 0x97, 0x05,
+    0x07, 0x01, 0x90, 0x05, 0x23, 0x01, 0x6c, 0x07, 0x07, 0x01, 0x90, 0x07,
+    0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x6c, 0x06, 0x07, 0x01, 0x90, 0x06,
+    0x23, 0x01, 0x08, 0x06, 0x07, 0x02, 0x40, 0x01, 0x41, 0x04, 0x40, 0x01,
+    0x41, 0x02, 0x40, 0x01, 0x97, 0x06, 0x07, 0x01, 0x6c, 0x06, 0x23, 0x01,
+    0x6c, 0x06, 0x07, 0x01, 0x40, 0x01, 0x41, 0x05, 0x40, 0x01, 0x41, 0x01,
+    0x40, 0x01, 0x6b, 0x07, 0x07, 0x01, 0x6c, 0x06, 0x23, 0x01, 0x65, 0x01,
+    0x97, 0x05, 0x07, 0x09, 0x40, 0x01, 0x97, 0x07, 0x07, 0x01, 0x6c, 0x07,
+    0x23, 0x01, 0x08, 0x05, 0x07, 0x01, 0x4f, 0x14, 0x09, 0x00, 0x09, 0x00,
+    0x14, 0x00, 0x02, 0x04, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0b,
+    0x14, 0x30, 0x38, 0xa3, 0x19, 0xdc, 0x36, 0x34, 0x56, 0x4f, 0x14, 0x14,
+    0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44,
+    0x41, 0x11, 0x11, 0x44, 0x41, 0x11, 0x11, 0x11, 0x14, 0x11, 0x44, 0x11,
+    0x14, 0x41, 0x44, 0x11, 0x11, 0x11, 0x14, 0x41, 0x44, 0x11, 0x14, 0x41,
+    0x14, 0x11, 0x11, 0x11, 0x11, 0x44, 0x41, 0x11, 0x11, 0x44, 0x41, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41,
+    0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x57, 0x4f, 0x14,
+    0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0xc8, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f,
+    0xff, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11,
+    0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0xf1,
+    0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11,
+    0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f,
+    0x11, 0x11, 0xff, 0xf1, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11,
+    0xff, 0xf1, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0xff, 0xf1,
+    0x11, 0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0xf1, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11,
+    0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0xf1, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0xf1, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f,
+    0xff, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0x4f,
+    0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x01, 0x04, 0x01, 0x96, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x11, 0x06, 0x22, 0x04, 0x11, 0x06, 0x22, 0x04,
+    0x11, 0x01, 0x22, 0x01, 0x01, 0x02, 0x11, 0x01, 0x10, 0x01, 0x22, 0x04,
+    0x11, 0x01, 0x22, 0x01, 0x10, 0x02, 0x11, 0x01, 0x01, 0x01, 0x22, 0x04,
+    0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x01,
+    0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01,
+    0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01, 0x10, 0x01,
+    0x01, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01, 0x11, 0x01,
+    0x10, 0x01, 0x01, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01, 0x22, 0x01,
+    0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x01, 0x22, 0x04, 0x11, 0x01,
+    0x22, 0x01, 0x11, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x01, 0x22, 0x04,
+    0x11, 0x01, 0x22, 0x01, 0x10, 0x02, 0x11, 0x01, 0x01, 0x01, 0x22, 0x04,
+    0x11, 0x01, 0x22, 0x01, 0x01, 0x02, 0x11, 0x01, 0x10, 0x01, 0x22, 0x04,
+    0x11, 0x06, 0x22, 0x04, 0x11, 0x06, 0x22, 0x20, 0x11, 0xdd, 0x50, 0x14,
+    0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xe0, 0x01, 0xe3, 0x7f, 0x06, 0xff, 0xf0, 0xff, 0xf9,
+    0xf9, 0xcc, 0x7e, 0x78, 0xff, 0xf0, 0xff, 0xf9, 0xfd, 0x9e, 0x7d, 0xfc,
+    0xff, 0xf0, 0xff, 0xf9, 0xff, 0x9f, 0x79, 0xfc, 0xff, 0xf0, 0xff, 0xf9,
+    0xf7, 0x8f, 0x73, 0xfe, 0xff, 0xf0, 0xff, 0xf9, 0xf7, 0xc7, 0xf3, 0xff,
+    0xff, 0xf0, 0xff, 0xf8, 0x07, 0xe1, 0xf3, 0xff, 0xff, 0xf0, 0xff, 0xf9,
+    0xf7, 0xf8, 0xf3, 0xff, 0xff, 0xf0, 0xff, 0xf9, 0xf7, 0xfc, 0x73, 0xff,
+    0xff, 0xf0, 0xff, 0xf9, 0xff, 0xbe, 0x33, 0xff, 0xff, 0xf0, 0xff, 0xf9,
+    0xfe, 0xbf, 0x39, 0xfe, 0xff, 0xf0, 0xff, 0xf9, 0xfd, 0x9f, 0x39, 0xfd,
+    0xff, 0xf0, 0xff, 0xf9, 0xf9, 0x8e, 0x7c, 0x7b, 0xff, 0xf0, 0xff, 0xe0,
+    0x01, 0xb0, 0xff, 0x07, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x40, 0x51, 0x14, 0x16, 0x00, 0x0b,
+    0x00, 0x07, 0x00, 0x02, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x03, 0x0f, 0x04, 0x00, 0x04, 0x01, 0x03, 0x0f, 0x07, 0x01, 0x01,
+    0x00, 0x03, 0x0f, 0x05, 0x00, 0x03, 0x01, 0x03, 0x0b, 0x02, 0x02, 0x07,
+    0x0c, 0x02, 0x0f, 0x0d, 0x02, 0x06, 0x07, 0x03, 0x0f, 0x0a, 0x52, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x55, 0x16, 0x16, 0x00, 0x38, 0x36, 0x39,
+    0x35, 0x36, 0x20, 0x53, 0x63, 0x68, 0x6f, 0x6e, 0x67, 0x61, 0x75, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xf1, 0x55, 0x16, 0x16, 0x00,
+    0x54, 0x65, 0x6c, 0x65, 0x66, 0x6f, 0x6e, 0x20, 0x30, 0x38, 0x38, 0x36,
+    0x31, 0x2f, 0x39, 0x33, 0x30, 0x39, 0x35, 0x34, 0x32, 0x20, 0xf2, 0x55,
+    0x16, 0x16, 0x00, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x62, 0x7a, 0x2d, 0x65,
+    0x6e, 0x67, 0x69, 0x6e, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x64,
+    0x65, 0xda, 0x59, 0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdb, 0x59, 0x17,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0xc1, 0x5d, 0x18, 0x02, 0x02, 0xff, 0xff,
+    0x00, 0x78, 0x69, 0x1b, 0xf3, 0x4e, 0x82, 0x69, 0x1b, 0xff, 0xff,
+}; // MultiStepLoad_stage2
+
+const unsigned char MultiStepLoad_stage3[MultiStepLoad_stage3_Size] = {
+    0x4c, 0x04, 0x01, 0x01, 0xa3, 0x0f, 0x05, 0x00, 0x40, 0x9c, 0x1e, 0x00,
+    0x14, 0x00, 0x4d, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x9c, 0x5a, 0x00,
+    0x5a, 0x00, 0x4b, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x9c, 0x00, 0x00,
+    0x00, 0x00, 0xb0, 0x04, 0x02, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00,
+    0x78, 0x50, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x04, 0x02, 0x01, 0xff, 0xff,
+    0x00, 0x01, 0x01, 0x00, 0x79, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x50,
+    0x14, 0xb7, 0x00, 0xb7, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x08,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+    0x03, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x01,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x01, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x10, 0x7f, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xf8, 0x30, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf0, 0x38, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xf0, 0x78, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xe0, 0x7c, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xe0, 0xfc, 0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x9f, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
+    0xfe, 0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc1, 0xc6,
+    0x07, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x3f, 0x8f, 0xf8, 0xff,
+    0x3f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x81, 0xc7, 0x07,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0x3f, 0x07, 0xf0, 0x7f, 0x3f,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x83, 0x83, 0x03, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x07, 0xf0, 0x7f, 0x9f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x03, 0x83, 0x83, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x07, 0xf0, 0x7f, 0x9f, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x07, 0x83, 0x81, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x8f, 0xf8, 0xff, 0x9f, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x07, 0x83, 0xc1, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xfe, 0x0f, 0x83, 0xc0, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xfc, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xfc, 0x1f, 0x83, 0xe0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xf8, 0x1f, 0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
+    0x3f, 0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x3f,
+    0x83, 0xf0, 0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x7f, 0x83,
+    0xf8, 0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0x7f, 0x83, 0xf8,
+    0x1f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x0f, 0xff, 0xcf,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0xff, 0x83, 0xfc, 0x1f,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xf0, 0x03, 0xff, 0x9f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xff, 0x83, 0xfc, 0x0f, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xc3, 0xf0, 0xff, 0x9f, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xc1, 0xff, 0x83, 0xfe, 0x0f, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xfe, 0x7f, 0x8f, 0xfc, 0x7f, 0x9f, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0x81, 0xff, 0x83, 0xfe, 0x07, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0x3f, 0x1f, 0xfe, 0x3f, 0x3f, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0x83, 0xff, 0x83, 0xff, 0x07, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0x3e, 0x3f, 0xff, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0x03, 0xff, 0xc7, 0xff, 0x03, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0x9f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0x07, 0xff, 0xc7, 0xff, 0x83, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0x9f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe,
+    0x07, 0xff, 0xff, 0xff, 0x81, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x0f,
+    0xff, 0xff, 0xff, 0xc1, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x0f, 0xff,
+    0xff, 0xff, 0xc0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xff, 0xc7,
+    0xff, 0xe0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xff, 0x83, 0xff,
+    0xe0, 0x7f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf0,
+    0x7f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x3f,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x7f, 0xff, 0xc7, 0xff, 0xf8, 0x3f, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x50, 0x14, 0xb7,
+    0x00, 0xb7, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x08, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x83,
+    0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x03, 0xff,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf8, 0x10, 0x7f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xf8, 0x30, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xf0, 0x38, 0x3f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xf0, 0x78, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0,
+    0x7c, 0x1f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0, 0xfc,
+    0x0f, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0xfe, 0x0f,
+    0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc1, 0xc6, 0x07, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xf8, 0x0f, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x81, 0xc7, 0x07, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xf0, 0x07, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x83, 0x83, 0x03, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xe0, 0x03, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0x03, 0x83, 0x83, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xc0, 0x01, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0x07, 0x83, 0x81, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0x83, 0xff, 0xc1, 0xc1, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xfe, 0x07, 0x83, 0xc1, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc,
+    0x00, 0x0f, 0x83, 0xff, 0x83, 0xc0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xfe, 0x0f, 0x83, 0xc0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00,
+    0x0f, 0x84, 0x1f, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0xfc, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f,
+    0x80, 0x0f, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xfc,
+    0x1f, 0x83, 0xe0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0x00,
+    0x07, 0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8, 0x1f,
+    0x83, 0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07,
+    0x83, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf8, 0x3f, 0x83,
+    0xf0, 0x7f, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x83,
+    0xe0, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x3f, 0x83, 0xf0,
+    0x3f, 0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x7f, 0x83, 0xf8, 0x3f,
+    0xff, 0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0x7f, 0x83, 0xf8, 0x1f, 0xff,
+    0xe7, 0xe7, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0x83, 0x83, 0xe0, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xe0, 0xff, 0x83, 0xfc, 0x1f, 0xff, 0xe7,
+    0xe7, 0xff, 0xfc, 0x00, 0x0e, 0x0f, 0x83, 0x81, 0xc0, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xff, 0x83, 0xfc, 0x0f, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xfe, 0x07, 0x07, 0xc1, 0xc1, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xc1, 0xff, 0x83, 0xfe, 0x0f, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x07, 0xc0, 0x01, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0x81, 0xff, 0x83, 0xfe, 0x07, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x0f, 0xe0, 0x03, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0x83, 0xff, 0x83, 0xff, 0x07, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x1f, 0xf0, 0x07, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff,
+    0x03, 0xff, 0xc7, 0xff, 0x03, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x3f, 0xf8, 0x0f, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0x07,
+    0xff, 0xc7, 0xff, 0x83, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x07, 0xff,
+    0xff, 0xff, 0x81, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfe, 0x0f, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x0f, 0xff, 0xff, 0xff,
+    0xc0, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xff, 0xc7, 0xff, 0xe0,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xff, 0x83, 0xff, 0xe0, 0x7f,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x7f, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xf0, 0x3f, 0xff, 0x83, 0xff, 0xf0, 0x3f, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xf0, 0x7f, 0xff, 0xc7, 0xff, 0xf8, 0x3f, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xc0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x9c, 0x0c, 0x32, 0x00, 0x14,
+    0x00, 0x01, 0x4a, 0x9c, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x4a,
+    0x9c, 0x17, 0x00, 0x03, 0x00, 0x01, 0x00, 0x4b, 0x9c, 0x1b, 0xff, 0xff,
+    0x4d, 0x9c, 0x0e, 0xc1, 0x5d, 0x32, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x61,
+    0x00, 0x4e, 0x9c, 0x03, 0x64, 0x00, 0x32, 0x00, 0x00, 0x01, 0x00, 0x4f,
+    0x9c, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x9c, 0x14, 0x30, 0x00, 0x30, 0x00,
+    0x1b, 0x00, 0x02, 0x04, 0x00, 0xde, 0x01, 0x00, 0x00, 0x00, 0x16, 0x01,
+    0x06, 0x00, 0x1e, 0x01, 0x09, 0x00, 0x07, 0x01, 0x02, 0x00, 0x1b, 0x01,
+    0x03, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04, 0x01, 0x02, 0x00, 0x03, 0x01,
+    0x02, 0x00, 0x01, 0x01, 0x01, 0x00, 0x1a, 0x01, 0x01, 0x00, 0x05, 0x01,
+    0x04, 0x00, 0x05, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0x19, 0x01, 0x01, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x01,
+    0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x08, 0x01, 0x06, 0x00, 0x0a, 0x01,
+    0x01, 0x00, 0x06, 0x01, 0x07, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x0a, 0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x02, 0x00, 0x07, 0x01, 0x01, 0x00, 0x07, 0x01, 0x07, 0x00, 0x02, 0x01,
+    0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x06, 0x01, 0x02, 0x00, 0x03, 0x01,
+    0x03, 0x00, 0x04, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x0f, 0x01,
+    0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01,
+    0x03, 0x00, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x0f, 0x01,
+    0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01,
+    0x03, 0x00, 0x05, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0f, 0x01,
+    0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01,
+    0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x02, 0x00, 0x08, 0x01,
+    0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0b, 0x01,
+    0x01, 0x00, 0x0b, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01,
+    0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0f, 0x01,
+    0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x0e, 0x01,
+    0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x04, 0x01,
+    0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01,
+    0x01, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x07, 0x01,
+    0x01, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01,
+    0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x0e, 0x01,
+    0x02, 0x00, 0x06, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x06, 0x01,
+    0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x03, 0x01, 0x07, 0x00, 0x06, 0x01,
+    0x02, 0x00, 0x08, 0x01, 0x02, 0x00, 0x06, 0x01, 0x02, 0x00, 0x08, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x07, 0x00, 0x05, 0x01,
+    0x01, 0x00, 0x0c, 0x01, 0x06, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x06, 0x01,
+    0x04, 0x00, 0x06, 0x01, 0x01, 0x00, 0x1d, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x05, 0x01, 0x04, 0x00, 0x05, 0x01, 0x01, 0x00, 0x1d, 0x01,
+    0x01, 0x00, 0x03, 0x01, 0x03, 0x00, 0x03, 0x01, 0x02, 0x00, 0x04, 0x01,
+    0x02, 0x00, 0x1d, 0x01, 0x01, 0x00, 0x07, 0x01, 0x09, 0x00, 0x1d, 0x01,
+    0x02, 0x00, 0x2e, 0x01, 0x02, 0x00, 0x2e, 0x01,
+}; // MultiStepLoad_stage3
+
+const unsigned char MultiStepLoad_stage4[MultiStepLoad_stage4_Size] = {
+    0xb8, 0x0b, 0x03, 0xae, 0x01, 0x3a, 0x00, 0x00, 0x0b, 0x00, 0xf9, 0x2a,
+    0x00, 0x00, 0x1e, 0x00, 0xfa, 0x2a, 0x64, 0x00, 0x1e, 0x00, 0xfb, 0x2a,
+    0x64, 0x00, 0x2d, 0x00, 0xfc, 0x2a, 0x00, 0x00, 0x2d, 0x00, 0xfd, 0x2a,
+    0xf0, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0xf0, 0x00, 0x0f, 0x00, 0xff, 0x2a,
+    0xf0, 0x00, 0x1e, 0x00, 0x00, 0x2b, 0x54, 0x01, 0x0f, 0x00, 0x01, 0x2b,
+    0x54, 0x01, 0x1e, 0x00, 0x02, 0x2b, 0xf0, 0x00, 0x2d, 0x00, 0x03, 0x2b,
+    0x54, 0x01, 0x2d, 0x00, 0xc3, 0x0b, 0x03, 0x98, 0x01, 0x15, 0x00, 0x00,
+    0x0b, 0x00, 0xb3, 0x36, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x0b, 0x04, 0x00,
+    0x02, 0x00, 0xba, 0x0b, 0x2c, 0x00, 0x02, 0x00, 0xbb, 0x0b, 0x54, 0x00,
+    0x02, 0x00, 0xbc, 0x0b, 0x7c, 0x00, 0x02, 0x00, 0xbd, 0x0b, 0xa4, 0x00,
+    0x02, 0x00, 0xbe, 0x0b, 0xcc, 0x00, 0x02, 0x00, 0xbf, 0x0b, 0xf4, 0x00,
+    0x02, 0x00, 0xc0, 0x0b, 0x1c, 0x01, 0x02, 0x00, 0xc1, 0x0b, 0x44, 0x01,
+    0x02, 0x00, 0xc2, 0x0b, 0x6c, 0x01, 0x02, 0x00, 0xc4, 0x0b, 0x03, 0xbe,
+    0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0xfd, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x2a, 0x00, 0x00, 0x0a, 0x00, 0xff, 0x2a, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x2b, 0x64, 0x00, 0x0a, 0x00, 0x01, 0x2b, 0x64, 0x00, 0x14, 0x00,
+    0x02, 0x2b, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x2b, 0x64, 0x00, 0x1e, 0x00,
+    0x95, 0x0c, 0x03, 0x46, 0x00, 0x71, 0x00, 0x01, 0x01, 0x00, 0xf3, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x96, 0x0c, 0x03, 0x46, 0x00, 0x71, 0x00, 0x01,
+    0x01, 0x00, 0xf4, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x03, 0x46,
+    0x00, 0x71, 0x00, 0x01, 0x01, 0x00, 0xf5, 0x4e, 0x00, 0x00, 0x00, 0x00,
+    0xa2, 0x0f, 0x04, 0x01, 0x03, 0x00, 0x50, 0x14, 0xec, 0x13, 0xf6, 0x13,
+    0x70, 0x17, 0x06, 0x14, 0x00, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xea, 0x4e, 0x14, 0x3b, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x02, 0x04,
+    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x28, 0x00, 0xff, 0x01,
+    0x28, 0x01, 0xff, 0x02, 0x28, 0x02, 0xff, 0x07, 0x28, 0x07, 0xff, 0x03,
+    0x28, 0x03, 0xff, 0x09, 0x28, 0x09, 0xff, 0x04, 0x28, 0x04, 0xff, 0x0a,
+    0x28, 0x0a, 0xff, 0x05, 0x28, 0x05, 0xff, 0x0b, 0x28, 0x0b, 0xff, 0x06,
+    0x28, 0x06, 0xff, 0x0c, 0x28, 0x0c, 0xff, 0x08, 0x28, 0x08, 0xff, 0x0d,
+    0x28, 0x0d, 0xff, 0x0f, 0x28, 0x0f, 0xff, 0x0e, 0x28, 0x0e, 0xee, 0x4e,
+    0x14, 0x09, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0x04, 0x01, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01, 0x80, 0x01, 0xff, 0x01,
+    0x80, 0x26, 0x00, 0xef, 0x4e, 0x14, 0x21, 0x00, 0x21, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x01, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xf0, 0x4e, 0x14, 0x28, 0x00, 0x28, 0x00, 0x50, 0x00, 0x01, 0x00, 0x01,
+    0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0x4e, 0x14,
+    0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x00, 0x01, 0x73, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x87,
+    0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x58, 0x71, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x58, 0x77, 0x11, 0x78, 0x77, 0x71, 0x71, 0x17, 0x78, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x87, 0x77, 0x11, 0x77, 0x77, 0x77, 0x77, 0x87, 0x7c, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17,
+    0x78, 0x78, 0x88, 0x4c, 0xc8, 0x88, 0x8e, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x88, 0x87, 0x88, 0x88,
+    0x88, 0x8c, 0x4c, 0xcc, 0x88, 0x88, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x11, 0x78, 0x66, 0x86, 0x88,
+    0x4c, 0xcc, 0xcc, 0x87, 0x78, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x71, 0x78, 0x88, 0x86, 0x66, 0x66, 0x66, 0xcc,
+    0xcc, 0xcc, 0x77, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x71, 0x78, 0x44, 0x4c, 0x44, 0x66, 0x66, 0x68, 0xcc, 0xcc,
+    0xcc, 0x87, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x78, 0x84, 0x44, 0x44, 0x4c, 0x66, 0x66, 0x66, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x78, 0x64, 0x44, 0x44, 0x4c, 0x66, 0x66, 0x6c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x86,
+    0x66, 0x64, 0x44, 0x44, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x44, 0x46,
+    0x66, 0x44, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x88, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x04, 0x66,
+    0x44, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0x87, 0x71, 0x11, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4c,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0x71, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc,
+    0xcc, 0x87, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0x77,
+    0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x77, 0x88,
+    0x88, 0x88, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x17, 0x00,
+    0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x81, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x80, 0x00, 0x00,
+    0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x17, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x70, 0x00, 0x00, 0x00, 0x00, 0x81,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x77, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x71, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x81, 0x77, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x77, 0x77, 0x71, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x87, 0x77,
+    0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x77, 0x77,
+    0x78, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88,
+    0x88, 0x88, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x84,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x87, 0x77, 0x77, 0x77, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0x77, 0x77, 0x77, 0x71, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x47, 0x77, 0x77, 0x77, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x77, 0x77, 0x77, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77,
+    0x77, 0x71, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0x87, 0x77,
+    0x77, 0x77, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78,
+    0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc8, 0x8c, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0xcc,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87,
+    0x7c, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xc4,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0xcc, 0x8c, 0xcc, 0xcc, 0x78, 0xcc,
+    0x7c, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0x44, 0x4c, 0xcc, 0xc0,
+    0x00, 0x00, 0x0c, 0xcc, 0xcc, 0x8c, 0xc8, 0xcc, 0xc8, 0x8c, 0xc7, 0x7c,
+    0xcc, 0xcc, 0xc4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0x44, 0x77, 0xcc, 0xcc, 0x40,
+    0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0xcc, 0xc7, 0xcc, 0x8c,
+    0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0xcc, 0x48, 0x11, 0x7c, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0xc8, 0xcc, 0xcc,
+    0xcc, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x18, 0x44, 0x77, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc8, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0xc7, 0x7c, 0xcc, 0xcc,
+    0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x17, 0x44, 0x48, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8,
+    0x88, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0xc7, 0x78, 0xcc, 0xcc, 0xcc,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x11, 0x44, 0x48, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc,
+    0xec, 0xcc, 0xcc, 0xcc, 0xc8, 0x8c, 0x87, 0xc7, 0x8c, 0xcc, 0xcc, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x77, 0x44, 0x45, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x8c, 0xc8,
+    0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0x7c, 0xcc, 0x7c, 0xcc, 0xcc, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x44, 0x40, 0x4c, 0xcc, 0xcc, 0xcc, 0x4c, 0xc7, 0x8c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x8c, 0xcc, 0x8c, 0xcc, 0x88, 0xcc, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x40, 0x4c, 0xcc, 0xcc, 0x44, 0x4c, 0xcc, 0xc8, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0x77, 0x8c, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x40, 0x4c, 0xc4, 0x44, 0x00, 0x04, 0xc8, 0x76, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc8, 0x77, 0x8c, 0xcc, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40,
+    0x04, 0x40, 0x00, 0x00, 0x04, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x88, 0x78, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x87, 0xc8, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x77,
+    0xc7, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x87, 0xcc,
+    0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xcc, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xcc, 0x77,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0x86, 0xc6, 0xcc, 0xcc,
+    0xcc, 0xc8, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x58, 0x88,
+    0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x88, 0x88, 0x88, 0x87, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x77, 0x17, 0x77,
+    0x78, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x08, 0x77,
+    0x71, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x11, 0x11, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x81, 0x11, 0x11,
+    0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x08, 0x71, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x00, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x17, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x11, 0x11, 0x11, 0x11, 0x17, 0x77,
+    0x77, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x87, 0x77, 0x77, 0x71, 0x11, 0x17, 0x77, 0x88, 0x80,
+    0x00, 0x00, 0x08, 0x88, 0x87, 0x77, 0x77, 0x77, 0x77, 0x11, 0x71, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x88, 0x88, 0x77, 0x78, 0x88, 0x85, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x4e, 0x14,
+    0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x04, 0x01, 0xa4, 0x06, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x2a, 0x00, 0x01, 0x88, 0x20, 0x00, 0x01, 0x77,
+    0x02, 0x11, 0x01, 0x78, 0x01, 0x88, 0x1a, 0x00, 0x01, 0x04, 0x01, 0x78,
+    0x01, 0x17, 0x01, 0x78, 0x01, 0x17, 0x02, 0x77, 0x02, 0x11, 0x01, 0x18,
+    0x01, 0x80, 0x17, 0x00, 0x01, 0x88, 0x01, 0x77, 0x01, 0x11, 0x01, 0x71,
+    0x01, 0x11, 0x01, 0x77, 0x01, 0x87, 0x03, 0x77, 0x01, 0x71, 0x01, 0x10,
+    0x14, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x87, 0x03, 0x77, 0x01, 0x87,
+    0x01, 0x77, 0x01, 0x88, 0x01, 0xcc, 0x01, 0xc7, 0x03, 0x77, 0x01, 0x78,
+    0x13, 0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x17, 0x01, 0x78, 0x02, 0x88,
+    0x01, 0x6e, 0x01, 0x8e, 0x01, 0x78, 0x02, 0xcc, 0x01, 0xc7, 0x01, 0xe7,
+    0x02, 0x77, 0x01, 0x70, 0x13, 0x00, 0x01, 0x07, 0x01, 0x78, 0x01, 0x88,
+    0x01, 0x84, 0x01, 0x48, 0x01, 0x88, 0x01, 0x66, 0x01, 0xe7, 0x01, 0x7c,
+    0x02, 0xcc, 0x01, 0xc7, 0x01, 0x77, 0x01, 0x78, 0x01, 0xc8, 0x14, 0x00,
+    0x01, 0x08, 0x02, 0x88, 0x01, 0x84, 0x01, 0x4c, 0x01, 0xc6, 0x01, 0x66,
+    0x01, 0x6e, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc7, 0x01, 0x77, 0x01, 0x7c,
+    0x01, 0x78, 0x14, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x68, 0x01, 0x4c,
+    0x01, 0x44, 0x01, 0xcc, 0x01, 0x68, 0x01, 0x8e, 0x01, 0x7c, 0x02, 0xcc,
+    0x01, 0xc7, 0x01, 0x77, 0x01, 0x7c, 0x01, 0x78, 0x14, 0x00, 0x01, 0x71,
+    0x01, 0x88, 0x01, 0x66, 0x01, 0x64, 0x02, 0xcc, 0x01, 0x66, 0x01, 0xee,
+    0x01, 0x8c, 0x03, 0xcc, 0x01, 0x77, 0x01, 0x78, 0x01, 0x70, 0x13, 0x00,
+    0x01, 0x08, 0x01, 0x78, 0x01, 0x85, 0x02, 0x66, 0x09, 0xcc, 0x01, 0xc8,
+    0x01, 0x20, 0x13, 0x00, 0x01, 0x08, 0x01, 0x84, 0x01, 0x44, 0x01, 0x46,
+    0x01, 0x66, 0x07, 0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc0, 0x15, 0x00,
+    0x01, 0x84, 0x02, 0x44, 0x01, 0x64, 0x08, 0xcc, 0x01, 0x8c, 0x01, 0xc0,
+    0x17, 0x00, 0x01, 0x04, 0x01, 0x4c, 0x05, 0xcc, 0x01, 0x88, 0x02, 0x77,
+    0x01, 0x8c, 0x01, 0xc0, 0x18, 0x00, 0x01, 0x4c, 0x02, 0xcc, 0x01, 0xc8,
+    0x01, 0x87, 0x01, 0x71, 0x03, 0x11, 0x01, 0x17, 0x01, 0xc4, 0x18, 0x00,
+    0x01, 0x0c, 0x01, 0xcc, 0x01, 0x88, 0x01, 0x71, 0x06, 0x11, 0x01, 0x74,
+    0x18, 0x00, 0x01, 0x04, 0x01, 0xc7, 0x01, 0x71, 0x07, 0x11, 0x01, 0x17,
+    0x02, 0x88, 0x01, 0x50, 0x15, 0x00, 0x01, 0x04, 0x01, 0x71, 0x04, 0x11,
+    0x01, 0x18, 0x06, 0x11, 0x01, 0x17, 0x01, 0x80, 0x14, 0x00, 0x01, 0x88,
+    0x05, 0x11, 0x01, 0x87, 0x08, 0x11, 0x01, 0x80, 0x12, 0x00, 0x01, 0x08,
+    0x05, 0x11, 0x01, 0x18, 0x01, 0x71, 0x08, 0x11, 0x01, 0x17, 0x13, 0x00,
+    0x05, 0x11, 0x01, 0x77, 0x0a, 0x11, 0x01, 0x70, 0x12, 0x00, 0x10, 0x11,
+    0x01, 0x18, 0x11, 0x00, 0x01, 0x08, 0x11, 0x11, 0x01, 0x80, 0x10, 0x00,
+    0x01, 0x0f, 0x01, 0x71, 0x0d, 0x11, 0x01, 0x18, 0x01, 0x88, 0x01, 0x81,
+    0x01, 0x70, 0x11, 0x00, 0x01, 0x71, 0x0d, 0x11, 0x01, 0x80, 0x01, 0x00,
+    0x01, 0x08, 0x01, 0x88, 0x10, 0x00, 0x01, 0x80, 0x01, 0x71, 0x0c, 0x11,
+    0x01, 0x17, 0x02, 0x00, 0x01, 0x08, 0x01, 0x88, 0x10, 0x00, 0x01, 0x80,
+    0x01, 0x81, 0x0c, 0x11, 0x01, 0x18, 0x03, 0x00, 0x01, 0x88, 0x10, 0x00,
+    0x01, 0x80, 0x01, 0x81, 0x01, 0x71, 0x0b, 0x11, 0x01, 0x17, 0x03, 0x00,
+    0x01, 0x07, 0x10, 0x00, 0x01, 0x80, 0x01, 0x81, 0x01, 0x71, 0x0b, 0x11,
+    0x01, 0x17, 0x01, 0x80, 0x02, 0x00, 0x01, 0x81, 0x01, 0x80, 0x10, 0x00,
+    0x01, 0x81, 0x01, 0x77, 0x03, 0x11, 0x01, 0x77, 0x01, 0x71, 0x07, 0x11,
+    0x01, 0x78, 0x01, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x80, 0x10, 0x00,
+    0x01, 0x87, 0x01, 0x77, 0x01, 0x71, 0x01, 0x11, 0x01, 0x17, 0x02, 0x77,
+    0x03, 0x11, 0x02, 0x77, 0x03, 0x11, 0x01, 0x77, 0x02, 0x11, 0x01, 0x80,
+    0x10, 0x00, 0x01, 0x87, 0x0c, 0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x80,
+    0x10, 0x00, 0x01, 0x07, 0x0d, 0x77, 0x04, 0x11, 0x11, 0x00, 0x01, 0x07,
+    0x01, 0x88, 0x0c, 0x77, 0x02, 0x71, 0x01, 0x11, 0x01, 0x17, 0x11, 0x00,
+    0x01, 0x08, 0x01, 0x88, 0x0d, 0x77, 0x01, 0x71, 0x01, 0x11, 0x01, 0x18,
+    0x11, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x87, 0x0d, 0x77, 0x01, 0x11,
+    0x01, 0x70, 0x11, 0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x87, 0x02, 0x77,
+    0x01, 0x87, 0x02, 0x77, 0x01, 0x78, 0x03, 0x88, 0x05, 0x77, 0x01, 0x80,
+    0x11, 0x00, 0x01, 0x08, 0x01, 0x84, 0x01, 0x08, 0x01, 0x87, 0x01, 0x77,
+    0x08, 0x88, 0x03, 0x77, 0x01, 0x78, 0x15, 0x00, 0x01, 0x88, 0x01, 0x87,
+    0x09, 0x88, 0x02, 0x77, 0x01, 0x80, 0x15, 0x00, 0x01, 0x08, 0x01, 0x88,
+    0x01, 0x78, 0x0a, 0x88, 0x0f, 0x00, 0x01, 0x48, 0x07, 0x00, 0x07, 0x88,
+    0x01, 0x58, 0x02, 0x88, 0x01, 0x50, 0x10, 0x00, 0x01, 0x71, 0x01, 0x80,
+    0x06, 0x00, 0x01, 0x08, 0x06, 0x88, 0x01, 0x44, 0x01, 0x40, 0x12, 0x00,
+    0x01, 0x11, 0x01, 0x70, 0x07, 0x00, 0x01, 0x87, 0x01, 0x77, 0x04, 0x88,
+    0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x70, 0x07, 0x00, 0x01, 0x87,
+    0x02, 0x77, 0x01, 0x88, 0x01, 0x87, 0x01, 0x78, 0x13, 0x00, 0x01, 0x08,
+    0x01, 0x11, 0x01, 0x18, 0x07, 0x00, 0x01, 0x07, 0x04, 0x77, 0x01, 0x18,
+    0x13, 0x00, 0x01, 0x07, 0x01, 0x11, 0x01, 0x18, 0x07, 0x00, 0x01, 0x07,
+    0x04, 0x77, 0x01, 0x15, 0x13, 0x00, 0x01, 0x07, 0x01, 0x11, 0x01, 0x77,
+    0x07, 0x00, 0x01, 0x07, 0x03, 0x77, 0x01, 0x71, 0x01, 0x10, 0x13, 0x00,
+    0x01, 0x07, 0x01, 0x11, 0x01, 0x77, 0x07, 0x00, 0x01, 0x08, 0x03, 0x77,
+    0x01, 0x11, 0x01, 0x74, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x78,
+    0x07, 0x00, 0x01, 0xcc, 0x01, 0xc8, 0x03, 0x77, 0x01, 0x7c, 0x01, 0x40,
+    0x12, 0x00, 0x01, 0x08, 0x01, 0x78, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x4c,
+    0x05, 0xcc, 0x01, 0x8c, 0x01, 0xc4, 0x12, 0x00, 0x01, 0x0c, 0x02, 0xcc,
+    0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x02, 0xcc, 0x01, 0x8c, 0x02, 0xcc,
+    0x01, 0xc8, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc4, 0x11, 0x00, 0x01, 0x4c,
+    0x01, 0xc4, 0x02, 0xcc, 0x01, 0x40, 0x03, 0x00, 0x01, 0x4c, 0x05, 0xcc,
+    0x01, 0x88, 0x02, 0x8c, 0x02, 0xcc, 0x01, 0x40, 0x0f, 0x00, 0x01, 0xcc,
+    0x01, 0x44, 0x01, 0x4c, 0x01, 0xcc, 0x01, 0xc4, 0x02, 0x00, 0x01, 0x04,
+    0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0x7c,
+    0x03, 0xcc, 0x01, 0x40, 0x0d, 0x00, 0x01, 0x0c, 0x01, 0xcc, 0x01, 0xc4,
+    0x01, 0x71, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc4, 0x01, 0x4c, 0x06, 0xcc,
+    0x01, 0xc8, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0x7c, 0x04, 0xcc, 0x0d, 0x00,
+    0x01, 0x08, 0x01, 0xcc, 0x01, 0x44, 0x01, 0x71, 0x01, 0x18, 0x05, 0xcc,
+    0x01, 0x7c, 0x05, 0xcc, 0x01, 0xc7, 0x02, 0x8c, 0x02, 0xcc, 0x01, 0xc8,
+    0x01, 0x40, 0x0c, 0x00, 0x01, 0x08, 0x01, 0x17, 0x01, 0x84, 0x01, 0x87,
+    0x01, 0x77, 0x05, 0xcc, 0x01, 0x77, 0x05, 0xcc, 0x01, 0xc7, 0x01, 0xcc,
+    0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0xc0, 0x0c, 0x00, 0x01, 0x08,
+    0x01, 0x11, 0x01, 0x84, 0x01, 0x48, 0x01, 0x78, 0x04, 0xcc, 0x01, 0xc8,
+    0x01, 0x88, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x77,
+    0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x11, 0x01, 0x74,
+    0x01, 0x44, 0x01, 0x7c, 0x04, 0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xce,
+    0x04, 0xcc, 0x01, 0x8c, 0x01, 0xc7, 0x01, 0x8c, 0x01, 0x7c, 0x02, 0xcc,
+    0x01, 0x40, 0x0d, 0x00, 0x01, 0x77, 0x01, 0x84, 0x01, 0x44, 0x01, 0x8c,
+    0x04, 0xcc, 0x01, 0x6c, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x6c, 0x03, 0xcc,
+    0x01, 0x8c, 0x01, 0xc7, 0x01, 0xcc, 0x01, 0x87, 0x02, 0xcc, 0x01, 0x40,
+    0x0d, 0x00, 0x01, 0x08, 0x02, 0x44, 0x01, 0x4c, 0x03, 0xcc, 0x01, 0xc4,
+    0x01, 0xcc, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xce, 0x01, 0xcc, 0x01, 0xc8,
+    0x01, 0xcc, 0x01, 0x88, 0x02, 0xcc, 0x01, 0x40, 0x0e, 0x00, 0x01, 0x44,
+    0x01, 0x40, 0x01, 0x0c, 0x02, 0xcc, 0x02, 0x44, 0x01, 0xc8, 0x01, 0xcc,
+    0x01, 0x6c, 0x05, 0xcc, 0x01, 0xc7, 0x01, 0x78, 0x03, 0xcc, 0x01, 0x40,
+    0x0e, 0x00, 0x01, 0x44, 0x01, 0x40, 0x01, 0x04, 0x01, 0xcc, 0x01, 0x44,
+    0x01, 0x00, 0x01, 0x04, 0x01, 0xcc, 0x01, 0x78, 0x07, 0xcc, 0x01, 0xc7,
+    0x01, 0x78, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x40, 0x0e, 0x00, 0x01, 0x44,
+    0x01, 0x40, 0x01, 0x00, 0x01, 0x40, 0x02, 0x00, 0x01, 0x04, 0x01, 0xc6,
+    0x01, 0x6c, 0x06, 0xcc, 0x01, 0xc8, 0x01, 0x88, 0x01, 0xc7, 0x02, 0xcc,
+    0x01, 0x40, 0x0e, 0x00, 0x01, 0x44, 0x01, 0x40, 0x05, 0x00, 0x01, 0x4c,
+    0x08, 0xcc, 0x01, 0xc8, 0x01, 0x8c, 0x01, 0xc7, 0x01, 0x7c, 0x0f, 0x00,
+    0x01, 0x44, 0x01, 0x40, 0x05, 0x00, 0x01, 0x4c, 0x08, 0xcc, 0x01, 0x87,
+    0x01, 0x8c, 0x01, 0x71, 0x01, 0x18, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40,
+    0x05, 0x00, 0x08, 0xcc, 0x01, 0xc8, 0x01, 0x77, 0x01, 0x8c, 0x01, 0x71,
+    0x01, 0x17, 0x0f, 0x00, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
+    0x09, 0xcc, 0x01, 0xc7, 0x01, 0x8c, 0x01, 0x87, 0x01, 0x18, 0x0f, 0x00,
+    0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x01, 0xcc, 0x01, 0xc8,
+    0x07, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x87, 0x01, 0x80, 0x0f, 0x00,
+    0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04, 0x0b, 0xcc, 0x01, 0x88,
+    0x0f, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
+    0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00,
+    0x01, 0x04, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x04, 0x00, 0x01, 0x04, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x40, 0x05, 0x00, 0x01, 0x4c, 0x08, 0xcc, 0x01, 0xc8, 0x01, 0x86,
+    0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x06, 0x00, 0x01, 0x48,
+    0x01, 0x86, 0x02, 0x6c, 0x03, 0xcc, 0x01, 0x88, 0x01, 0x60, 0x11, 0x00,
+    0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x07, 0x00, 0x06, 0x88, 0x01, 0x80,
+    0x12, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x07, 0x00, 0x01, 0x08,
+    0x01, 0x78, 0x03, 0x88, 0x01, 0x78, 0x13, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x40, 0x03, 0x00, 0x01, 0x08, 0x03, 0x88, 0x01, 0x87, 0x01, 0x77,
+    0x02, 0x88, 0x01, 0x87, 0x03, 0x77, 0x01, 0x78, 0x02, 0x88, 0x0e, 0x00,
+    0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x02, 0x00, 0x01, 0x87, 0x01, 0x71,
+    0x01, 0x11, 0x01, 0x17, 0x04, 0x77, 0x01, 0x87, 0x03, 0x77, 0x01, 0x71,
+    0x04, 0x11, 0x01, 0x80, 0x0c, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40,
+    0x01, 0x00, 0x01, 0x87, 0x04, 0x11, 0x01, 0x17, 0x07, 0x77, 0x01, 0x71,
+    0x05, 0x11, 0x0c, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01, 0x08,
+    0x01, 0x71, 0x07, 0x11, 0x05, 0x77, 0x01, 0x71, 0x05, 0x11, 0x01, 0x80,
+    0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01, 0x08, 0x01, 0x71,
+    0x06, 0x11, 0x01, 0x17, 0x01, 0x77, 0x01, 0x87, 0x04, 0x77, 0x05, 0x11,
+    0x01, 0x10, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01, 0x08,
+    0x01, 0x71, 0x05, 0x11, 0x01, 0x17, 0x02, 0x77, 0x01, 0x88, 0x04, 0x77,
+    0x01, 0x71, 0x04, 0x11, 0x01, 0x10, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44,
+    0x01, 0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x71, 0x04, 0x11, 0x02, 0x77,
+    0x03, 0x88, 0x06, 0x77, 0x02, 0x11, 0x01, 0x10, 0x0e, 0x00, 0x01, 0x08,
+    0x03, 0x77, 0x02, 0x11, 0x01, 0x77, 0x01, 0x78, 0x01, 0x80, 0x03, 0x00,
+    0x02, 0x88, 0x04, 0x77, 0x01, 0x71, 0x01, 0x17, 0x01, 0x70, 0x0e, 0x00,
+    0x01, 0x08, 0x02, 0x88, 0x01, 0x87, 0x01, 0x77, 0x02, 0x88, 0x07, 0x00,
+    0x01, 0x08, 0x05, 0x88, 0xff, 0x00, 0xff, 0x00, 0xc6, 0x00, 0xf5, 0x4e,
+    0x14, 0x46, 0x00, 0x46, 0x00, 0x71, 0x00, 0x01, 0x04, 0x01, 0x8e, 0x06,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x4a, 0x00, 0x01, 0x04, 0x01, 0x58, 0x01,
+    0x88, 0x01, 0x50, 0x1e, 0x00, 0x01, 0x04, 0x01, 0x71, 0x03, 0x11, 0x01,
+    0x77, 0x01, 0x11, 0x01, 0x78, 0x01, 0x88, 0x01, 0x84, 0x17, 0x00, 0x01,
+    0x08, 0x01, 0x80, 0x01, 0x88, 0x06, 0x77, 0x03, 0x11, 0x01, 0x78, 0x15,
+    0x00, 0x01, 0x47, 0x01, 0x77, 0x02, 0x17, 0x01, 0x77, 0x01, 0x8c, 0x01,
+    0x88, 0x02, 0x77, 0x01, 0x78, 0x03, 0x77, 0x01, 0x71, 0x01, 0x70, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x17, 0x03, 0x77, 0x01, 0x78, 0x02, 0xcc, 0x01,
+    0xc8, 0x01, 0xee, 0x01, 0x7e, 0x02, 0x77, 0x01, 0x88, 0x01, 0x77, 0x01,
+    0x18, 0x13, 0x00, 0x01, 0x08, 0x03, 0x88, 0x01, 0x78, 0x01, 0x8c, 0x03,
+    0xcc, 0x01, 0x8e, 0x01, 0xee, 0x01, 0x77, 0x01, 0x7c, 0x01, 0xcc, 0x01,
+    0x77, 0x01, 0x80, 0x13, 0x00, 0x01, 0x81, 0x02, 0x88, 0x01, 0x68, 0x01,
+    0xe8, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0x7e, 0x01, 0xee, 0x01,
+    0x77, 0x02, 0xcc, 0x01, 0x71, 0x01, 0x78, 0x13, 0x00, 0x02, 0x88, 0x01,
+    0x4c, 0x01, 0x66, 0x01, 0x6e, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x01,
+    0xe7, 0x02, 0x77, 0x02, 0xcc, 0x01, 0x77, 0x01, 0x71, 0x01, 0x80, 0x12,
+    0x00, 0x01, 0x08, 0x01, 0x88, 0x01, 0x4c, 0x01, 0x66, 0x01, 0x8e, 0x01,
+    0x8c, 0x03, 0xcc, 0x01, 0x8e, 0x02, 0x77, 0x01, 0xcc, 0x01, 0xc8, 0x01,
+    0x78, 0x01, 0x87, 0x01, 0x80, 0x13, 0x00, 0x01, 0x06, 0x01, 0x6c, 0x01,
+    0xc8, 0x01, 0x7e, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xc8, 0x01, 0x7c, 0x01,
+    0xcc, 0x01, 0xc7, 0x01, 0x78, 0x01, 0x87, 0x01, 0x80, 0x14, 0x00, 0x01,
+    0x84, 0x01, 0xcc, 0x01, 0x6c, 0x08, 0xcc, 0x01, 0x87, 0x02, 0x88, 0x15,
+    0x00, 0x01, 0x68, 0x01, 0x4c, 0x06, 0xcc, 0x01, 0xc8, 0x02, 0xcc, 0x01,
+    0x88, 0x01, 0x87, 0x17, 0x00, 0x01, 0x4c, 0x07, 0xcc, 0x01, 0x8c, 0x01,
+    0xcc, 0x01, 0xc8, 0x01, 0x88, 0x17, 0x00, 0x01, 0x4c, 0x02, 0xcc, 0x01,
+    0x87, 0x03, 0x77, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0x8c, 0x01, 0xc4, 0x18,
+    0x00, 0x01, 0x4c, 0x01, 0xc8, 0x01, 0x71, 0x05, 0x11, 0x01, 0x78, 0x01,
+    0xcc, 0x01, 0x40, 0x18, 0x00, 0x01, 0x05, 0x01, 0x71, 0x07, 0x11, 0x01,
+    0x7c, 0x01, 0x40, 0x18, 0x00, 0x01, 0x07, 0x08, 0x11, 0x01, 0x17, 0x01,
+    0x40, 0x18, 0x00, 0x01, 0x81, 0x09, 0x11, 0x01, 0x80, 0x17, 0x00, 0x01,
+    0x08, 0x01, 0x71, 0x09, 0x11, 0x01, 0x18, 0x16, 0x00, 0x01, 0x08, 0x01,
+    0x77, 0x0b, 0x11, 0x01, 0x70, 0x15, 0x00, 0x01, 0x01, 0x01, 0x17, 0x0b,
+    0x11, 0x01, 0x17, 0x15, 0x00, 0x01, 0x81, 0x01, 0x77, 0x0c, 0x11, 0x01,
+    0x80, 0x14, 0x00, 0x01, 0x71, 0x01, 0x77, 0x04, 0x11, 0x01, 0x17, 0x01,
+    0x77, 0x06, 0x11, 0x01, 0x70, 0x14, 0x00, 0x01, 0x11, 0x01, 0x77, 0x03,
+    0x11, 0x01, 0x18, 0x01, 0xf0, 0x01, 0x05, 0x01, 0x88, 0x05, 0x11, 0x01,
+    0x10, 0x14, 0x00, 0x01, 0x11, 0x01, 0x71, 0x03, 0x11, 0x01, 0x80, 0x02,
+    0x00, 0x01, 0xff, 0x01, 0x81, 0x04, 0x11, 0x01, 0x18, 0x13, 0x00, 0x01,
+    0x08, 0x01, 0x11, 0x01, 0x71, 0x03, 0x11, 0x01, 0x80, 0x02, 0x00, 0x01,
+    0x08, 0x01, 0x81, 0x04, 0x11, 0x01, 0x17, 0x13, 0x00, 0x01, 0x08, 0x01,
+    0x17, 0x01, 0x71, 0x02, 0x11, 0x01, 0x17, 0x01, 0x40, 0x03, 0x00, 0x01,
+    0x81, 0x04, 0x11, 0x01, 0x17, 0x13, 0x00, 0x01, 0x08, 0x01, 0x17, 0x01,
+    0x71, 0x03, 0x11, 0x01, 0x80, 0x03, 0x00, 0x01, 0x81, 0x04, 0x11, 0x01,
+    0x17, 0x13, 0x00, 0x01, 0x08, 0x01, 0x17, 0x01, 0x71, 0x03, 0x11, 0x01,
+    0x78, 0x02, 0x00, 0x01, 0x08, 0x01, 0x71, 0x04, 0x11, 0x01, 0x17, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x77, 0x01, 0x71, 0x03, 0x11, 0x01, 0x77, 0x02,
+    0x88, 0x01, 0x87, 0x05, 0x11, 0x01, 0x17, 0x13, 0x00, 0x01, 0x03, 0x02,
+    0x77, 0x02, 0x11, 0x01, 0x17, 0x04, 0x77, 0x05, 0x11, 0x01, 0x18, 0x14,
+    0x00, 0x09, 0x77, 0x01, 0x71, 0x03, 0x11, 0x01, 0x17, 0x01, 0x18, 0x14,
+    0x00, 0x09, 0x77, 0x01, 0x71, 0x03, 0x11, 0x01, 0x17, 0x01, 0x78, 0x14,
+    0x00, 0x01, 0x87, 0x09, 0x77, 0x03, 0x11, 0x01, 0x77, 0x01, 0x80, 0x14,
+    0x00, 0x02, 0x87, 0x09, 0x77, 0x02, 0x11, 0x01, 0x77, 0x01, 0x80, 0x14,
+    0x00, 0x01, 0x08, 0x01, 0x88, 0x09, 0x77, 0x01, 0x71, 0x01, 0x17, 0x01,
+    0x77, 0x16, 0x00, 0x01, 0x88, 0x01, 0x87, 0x01, 0x77, 0x03, 0x88, 0x01,
+    0x87, 0x04, 0x77, 0x02, 0x78, 0x16, 0x00, 0x01, 0x48, 0x07, 0x88, 0x01,
+    0x87, 0x02, 0x77, 0x01, 0x88, 0x01, 0x80, 0x18, 0x00, 0x07, 0x88, 0x01,
+    0x77, 0x02, 0x88, 0x19, 0x00, 0x01, 0x48, 0x07, 0x88, 0x01, 0x80, 0x12,
+    0x00, 0x01, 0x01, 0x01, 0x80, 0x06, 0x00, 0x01, 0x08, 0x01, 0x84, 0x06,
+    0x88, 0x13, 0x00, 0x01, 0x81, 0x01, 0x70, 0x07, 0x00, 0x05, 0x88, 0x01,
+    0x87, 0x01, 0x80, 0x13, 0x00, 0x01, 0x71, 0x01, 0x70, 0x07, 0x00, 0x01,
+    0x87, 0x03, 0x88, 0x01, 0x87, 0x01, 0x77, 0x13, 0x00, 0x01, 0x08, 0x01,
+    0x11, 0x01, 0x18, 0x07, 0x00, 0x01, 0x07, 0x01, 0x77, 0x01, 0x88, 0x01,
+    0x87, 0x01, 0x77, 0x01, 0x17, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01,
+    0x17, 0x07, 0x00, 0x01, 0x07, 0x03, 0x77, 0x01, 0x71, 0x01, 0x18, 0x13,
+    0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x17, 0x01, 0x40, 0x06, 0x00, 0x01,
+    0x08, 0x03, 0x77, 0x01, 0x71, 0x01, 0x18, 0x13, 0x00, 0x01, 0x08, 0x01,
+    0x11, 0x01, 0x77, 0x01, 0x80, 0x06, 0x00, 0x01, 0x08, 0x03, 0x77, 0x01,
+    0x11, 0x01, 0x10, 0x13, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x77, 0x01,
+    0x40, 0x06, 0x00, 0x01, 0x4c, 0x03, 0x77, 0x01, 0x11, 0x01, 0x1c, 0x01,
+    0x40, 0x12, 0x00, 0x01, 0x08, 0x01, 0x11, 0x01, 0x78, 0x06, 0x00, 0x01,
+    0x04, 0x03, 0xcc, 0x01, 0x77, 0x01, 0x88, 0x01, 0x7c, 0x01, 0xc0, 0x12,
+    0x00, 0x01, 0x05, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0x40, 0x05, 0x00, 0x01,
+    0x4c, 0x01, 0xcc, 0x01, 0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0x78, 0x01,
+    0xcc, 0x01, 0x40, 0x11, 0x00, 0x01, 0x0c, 0x02, 0xcc, 0x01, 0xc4, 0x04,
+    0x00, 0x01, 0x04, 0x05, 0xcc, 0x01, 0xc7, 0x01, 0x78, 0x01, 0xc7, 0x01,
+    0xcc, 0x01, 0x44, 0x10, 0x00, 0x01, 0x4c, 0x01, 0xc4, 0x01, 0x4c, 0x01,
+    0xcc, 0x01, 0xc0, 0x03, 0x00, 0x01, 0x4c, 0x01, 0xcc, 0x01, 0xc8, 0x03,
+    0xcc, 0x01, 0x88, 0x01, 0x8c, 0x01, 0x87, 0x02, 0xcc, 0x01, 0xc4, 0x0f,
+    0x00, 0x01, 0xcc, 0x01, 0xc4, 0x01, 0xc8, 0x02, 0xcc, 0x02, 0x00, 0x01,
+    0x4c, 0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01,
+    0x78, 0x01, 0xc8, 0x03, 0xcc, 0x0d, 0x00, 0x01, 0x08, 0x01, 0xcc, 0x01,
+    0xc4, 0x01, 0x81, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0x4c, 0x02, 0xcc, 0x01,
+    0x8c, 0x02, 0xcc, 0x01, 0xc8, 0x03, 0xcc, 0x01, 0x7c, 0x01, 0x8c, 0x01,
+    0xcc, 0x01, 0xc8, 0x01, 0x8c, 0x01, 0x40, 0x0c, 0x00, 0x01, 0x08, 0x01,
+    0x88, 0x01, 0xc4, 0x01, 0x81, 0x01, 0x17, 0x05, 0xcc, 0x01, 0x78, 0x03,
+    0xcc, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xc7, 0x02, 0x7c, 0x02, 0xcc, 0x01,
+    0xc7, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x71, 0x01, 0x84, 0x01, 0x48, 0x01,
+    0x77, 0x05, 0xcc, 0x01, 0x87, 0x05, 0xcc, 0x01, 0xc7, 0x01, 0xcc, 0x01,
+    0x77, 0x03, 0xcc, 0x01, 0xc0, 0x0d, 0x00, 0x01, 0x71, 0x01, 0x74, 0x01,
+    0x44, 0x01, 0x77, 0x04, 0xcc, 0x01, 0xc7, 0x01, 0xcc, 0x01, 0x88, 0x04,
+    0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0x77, 0x01, 0x7c, 0x02, 0xcc, 0x01,
+    0xc0, 0x0d, 0x00, 0x01, 0x71, 0x01, 0x74, 0x01, 0x44, 0x01, 0x88, 0x04,
+    0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0xec, 0x03, 0xcc, 0x01,
+    0x8c, 0x01, 0xc8, 0x01, 0x7c, 0x01, 0x77, 0x02, 0xcc, 0x01, 0xc0, 0x0d,
+    0x00, 0x01, 0x87, 0x01, 0x84, 0x01, 0x44, 0x01, 0x4c, 0x05, 0xcc, 0x01,
+    0xce, 0x05, 0xcc, 0x01, 0x8c, 0x01, 0xc7, 0x01, 0xcc, 0x01, 0x87, 0x02,
+    0xcc, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01, 0x04, 0x03, 0xcc, 0x01,
+    0xc4, 0x01, 0xc8, 0x01, 0x8c, 0x04, 0xcc, 0x01, 0xc8, 0x01, 0xcc, 0x01,
+    0xc7, 0x01, 0x8c, 0x03, 0xcc, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01,
+    0x04, 0x02, 0xcc, 0x02, 0x44, 0x01, 0xcc, 0x01, 0xc8, 0x01, 0xec, 0x05,
+    0xcc, 0x01, 0xce, 0x01, 0x77, 0x01, 0x7c, 0x02, 0xcc, 0x01, 0xc0, 0x0e,
+    0x00, 0x02, 0x44, 0x01, 0x04, 0x01, 0xc4, 0x01, 0x44, 0x02, 0x00, 0x01,
+    0xcc, 0x01, 0x78, 0x07, 0xcc, 0x01, 0xc7, 0x01, 0x77, 0x01, 0xcc, 0x01,
+    0xc8, 0x01, 0xc0, 0x0e, 0x00, 0x02, 0x44, 0x01, 0x00, 0x01, 0x40, 0x03,
+    0x00, 0x01, 0xc6, 0x07, 0xcc, 0x01, 0xc8, 0x02, 0x88, 0x02, 0xcc, 0x01,
+    0x40, 0x0e, 0x00, 0x02, 0x44, 0x05, 0x00, 0x01, 0x4c, 0x08, 0xcc, 0x01,
+    0xc8, 0x01, 0x7c, 0x01, 0x87, 0x01, 0x17, 0x0f, 0x00, 0x02, 0x44, 0x05,
+    0x00, 0x01, 0x4c, 0x07, 0xcc, 0x01, 0x88, 0x01, 0x77, 0x01, 0x8c, 0x01,
+    0x71, 0x01, 0x11, 0x0f, 0x00, 0x02, 0x44, 0x05, 0x00, 0x09, 0xcc, 0x01,
+    0x87, 0x01, 0x7c, 0x01, 0x77, 0x01, 0x17, 0x0f, 0x00, 0x02, 0x44, 0x05,
+    0x00, 0x01, 0xcc, 0x01, 0xc8, 0x07, 0xcc, 0x01, 0xc7, 0x01, 0x7c, 0x01,
+    0xc7, 0x01, 0x78, 0x0f, 0x00, 0x02, 0x44, 0x05, 0x00, 0x09, 0xcc, 0x01,
+    0xc8, 0x01, 0xcc, 0x01, 0xc7, 0x01, 0x80, 0x0f, 0x00, 0x02, 0x44, 0x05,
+    0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01, 0x44, 0x01, 0x40, 0x05,
+    0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01, 0x44, 0x01, 0x40, 0x05,
+    0x00, 0x0b, 0xcc, 0x01, 0x40, 0x10, 0x00, 0x01, 0x44, 0x01, 0x40, 0x05,
+    0x00, 0x0b, 0xcc, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x05,
+    0x00, 0x01, 0x46, 0x01, 0x6c, 0x07, 0xcc, 0x01, 0xc8, 0x01, 0x60, 0x10,
+    0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x06, 0x00, 0x01, 0x06, 0x01,
+    0x88, 0x01, 0x86, 0x01, 0x6c, 0x02, 0xcc, 0x01, 0xc8, 0x01, 0x88, 0x01,
+    0x40, 0x11, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x07, 0x00, 0x01,
+    0x08, 0x05, 0x88, 0x01, 0x80, 0x12, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01,
+    0x40, 0x07, 0x00, 0x01, 0x08, 0x01, 0x78, 0x03, 0x88, 0x01, 0x77, 0x02,
+    0x88, 0x01, 0x84, 0x10, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x03,
+    0x00, 0x01, 0x88, 0x06, 0x77, 0x01, 0x88, 0x03, 0x77, 0x01, 0x71, 0x02,
+    0x11, 0x01, 0x77, 0x01, 0x88, 0x0d, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01,
+    0x40, 0x01, 0x00, 0x01, 0x08, 0x01, 0x77, 0x03, 0x11, 0x08, 0x77, 0x01,
+    0x71, 0x04, 0x11, 0x01, 0x18, 0x0c, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01,
+    0x40, 0x01, 0x00, 0x01, 0x87, 0x05, 0x11, 0x01, 0x17, 0x06, 0x77, 0x06,
+    0x11, 0x01, 0x80, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01,
+    0x08, 0x01, 0x71, 0x07, 0x11, 0x01, 0x17, 0x04, 0x77, 0x01, 0x71, 0x05,
+    0x11, 0x01, 0x10, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01,
+    0x08, 0x01, 0x71, 0x06, 0x11, 0x01, 0x17, 0x05, 0x77, 0x01, 0x71, 0x05,
+    0x11, 0x01, 0x18, 0x0b, 0x00, 0x01, 0x04, 0x01, 0x44, 0x01, 0x40, 0x01,
+    0x08, 0x01, 0x71, 0x05, 0x11, 0x01, 0x17, 0x02, 0x77, 0x01, 0x88, 0x04,
+    0x77, 0x01, 0x71, 0x04, 0x11, 0x01, 0x18, 0x0e, 0x00, 0x01, 0x08, 0x01,
+    0x77, 0x01, 0x71, 0x04, 0x11, 0x02, 0x77, 0x01, 0x88, 0x01, 0x48, 0x01,
+    0x88, 0x01, 0x87, 0x04, 0x77, 0x01, 0x71, 0x02, 0x11, 0x01, 0x18, 0x0e,
+    0x00, 0x01, 0x08, 0x06, 0x77, 0x01, 0x88, 0x01, 0x80, 0x03, 0x00, 0x01,
+    0x05, 0x02, 0x88, 0x05, 0x77, 0x01, 0x70, 0x0f, 0x00, 0x01, 0x58, 0x04,
+    0x88, 0x0a, 0x00, 0x01, 0x08, 0x02, 0x88, 0xff, 0x00, 0xff, 0x00, 0xa4,
+    0x00, 0xe3, 0x50, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xbe,
+    0xff, 0xff, 0x01, 0xff, 0xff, 0xf0, 0xff, 0xbe, 0xff, 0xff, 0xed, 0xff,
+    0xff, 0xf0, 0xff, 0x9c, 0x1f, 0xff, 0xef, 0xff, 0xff, 0xf0, 0xff, 0xc1,
+    0xf8, 0xf8, 0x6f, 0xff, 0x9f, 0xf0, 0xf9, 0xdd, 0xf3, 0x7b, 0xef, 0xfe,
+    0x7f, 0xf0, 0xfd, 0xdd, 0xf6, 0x7b, 0xef, 0xf8, 0xff, 0xf0, 0xfc, 0x99,
+    0xf0, 0x7b, 0xff, 0xe3, 0xff, 0xf0, 0xfe, 0x7b, 0xff, 0x7b, 0xff, 0xcf,
+    0xff, 0xf0, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0x8e, 0x20, 0x60, 0xe1, 0xf0, 0xff, 0xff, 0xfc, 0x79, 0xfb, 0xee,
+    0x6c, 0xf0, 0xff, 0xff, 0xf3, 0xfb, 0xfb, 0xef, 0x6e, 0xf0, 0xff, 0xff,
+    0xcf, 0xfb, 0xfb, 0xef, 0x60, 0xf0, 0xff, 0xff, 0xff, 0xf9, 0xfb, 0xdf,
+    0x6f, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x7b, 0xdf, 0x6f, 0xf0, 0xff, 0xff,
+    0xff, 0xbf, 0x7b, 0xdf, 0x6f, 0xf0, 0xff, 0xff, 0xff, 0x9f, 0x7b, 0xe0,
+    0xef, 0xf0, 0xff, 0xff, 0xff, 0xe6, 0x73, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x41, 0x51,
+    0x14, 0x30, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0f, 0x01, 0x00, 0x01, 0xfe, 0x01,
+    0x00, 0x01, 0x07, 0x01, 0xe0, 0x04, 0x00, 0x01, 0xff, 0x01, 0x00, 0xa4,
+    0x51, 0x14, 0x3c, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf9, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xcf,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa5, 0x51, 0x14, 0x3c,
+    0x00, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xfd, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x90, 0x65, 0x1a, 0x00, 0x06, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x48, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xe3,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x49, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xa4,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x71, 0x1f, 0x01, 0x02, 0x01, 0xa5,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x71, 0x1f, 0x01, 0x02, 0x01, 0xe2,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x71, 0x1f, 0x01, 0x00, 0x01, 0xa5,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0f,
+    0x0f, 0x0f, 0x05, 0x0f, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x02, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x0e,
+    0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x31, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x32,
+    0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x33, 0x75, 0x14, 0x30,
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x34, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x35, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e,
+    0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x36,
+    0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x37, 0x75, 0x14, 0x30,
+    0x00, 0x21, 0x00, 0x20, 0x00, 0x02, 0x04, 0x00, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f,
+    0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01,
+    0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f,
+    0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01,
+    0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f,
+    0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01,
+    0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f,
+    0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01,
+    0x09, 0x09, 0x0e, 0x0f, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0f,
+    0x09, 0x08, 0x0e, 0x01, 0x09, 0x01, 0x0e, 0x1e, 0x09, 0x01, 0x0e, 0x01,
+    0x09, 0x02, 0x0e, 0x1c, 0x09, 0x02, 0x0e, 0x01, 0x09, 0x03, 0x0e, 0x1a,
+    0x09, 0x03, 0x0e, 0x01, 0x09, 0x04, 0x0e, 0x18, 0x09, 0x04, 0x0e, 0x01,
+    0x09, 0x05, 0x0e, 0x16, 0x09, 0x05, 0x0e, 0x01, 0x09, 0x06, 0x0e, 0x14,
+    0x09, 0x06, 0x0e, 0x01, 0x09, 0x07, 0x0e, 0x12, 0x09, 0x07, 0x0e, 0x01,
+    0x09, 0x08, 0x0e, 0x10, 0x09, 0x08, 0x0e, 0x01, 0x09, 0x09, 0x0e, 0x0e,
+    0x09, 0x09, 0x0e, 0x01, 0x09, 0x0a, 0x0e, 0x0c, 0x09, 0x0a, 0x0e, 0x01,
+    0x09, 0x0b, 0x0e, 0x0a, 0x09, 0x0b, 0x0e, 0x01, 0x09, 0x0c, 0x0e, 0x08,
+    0x09, 0x0c, 0x0e, 0x01, 0x09, 0x0d, 0x0e, 0x06, 0x09, 0x0d, 0x0e, 0x01,
+    0x09, 0x0e, 0x0e, 0x04, 0x09, 0x0e, 0x0e, 0x01, 0x09, 0x0f, 0x0e, 0x02,
+    0x09, 0x0f, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01, 0x09, 0x20, 0x0e, 0x01,
+    0x09, 0x38, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x02, 0x04,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x0e, 0x01, 0x0c, 0x1e, 0x0e,
+    0x02, 0x0c, 0x1d, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e,
+    0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x1c, 0x0e,
+    0x03, 0x0c, 0x1c, 0x0e, 0x03, 0x0c, 0x17, 0x0e, 0x05, 0x00, 0x03, 0x0c,
+    0x0b, 0x0e, 0x05, 0x00, 0x08, 0x0e, 0x05, 0x00, 0x02, 0x0c, 0x0c, 0x0e,
+    0x05, 0x00, 0x08, 0x0e, 0x05, 0x00, 0x01, 0x0c, 0x0d, 0x0e, 0x05, 0x00,
+    0xff, 0x0e, 0xe5, 0x0e, 0x39, 0x75, 0x14, 0x30, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x44, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00,
+    0xff, 0xff, 0x00, 0x09, 0x00, 0x53, 0x43, 0x43, 0x20, 0x54, 0x65, 0x73,
+    0x74, 0x20, 0x00, 0x45, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8,
+    0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x31, 0x00,
+    0x46, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x32, 0x00, 0x47, 0x75, 0x0b,
+    0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04,
+    0x00, 0x56, 0x65, 0x6e, 0x31, 0x00, 0x48, 0x75, 0x0b, 0x18, 0x00, 0x0e,
+    0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x56, 0x65,
+    0x6e, 0x32, 0x00, 0x49, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8,
+    0x59, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x48, 0x79, 0x64, 0x4f, 0x66,
+    0x66, 0x20, 0x20, 0x00, 0x4a, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01,
+    0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x48,
+    0x00, 0x4b, 0x75, 0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00,
+    0xff, 0xff, 0x00, 0x04, 0x00, 0x48, 0x79, 0x64, 0x53, 0x00, 0x4c, 0x75,
+    0x0b, 0x18, 0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00,
+    0x05, 0x00, 0x56, 0x65, 0x4f, 0x66, 0x66, 0x00, 0x4d, 0x75, 0x0b, 0x18,
+    0x00, 0x0e, 0x00, 0x01, 0xd8, 0x59, 0x00, 0xff, 0xff, 0x00, 0x04, 0x00,
+    0x56, 0x65, 0x4f, 0x6e, 0x00, 0x50, 0x78, 0x14, 0x30, 0x00, 0x23, 0x00,
+    0x1c, 0x00, 0x02, 0x04, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x55, 0xbb,
+    0x06, 0x08, 0x12, 0xbb, 0x04, 0x08, 0x05, 0xbb, 0x02, 0x08, 0x06, 0x01,
+    0x02, 0x08, 0x05, 0xbb, 0x04, 0x08, 0x06, 0xbb, 0x01, 0x08, 0x04, 0x01,
+    0x05, 0x08, 0x03, 0x01, 0x04, 0x00, 0x03, 0x01, 0x05, 0x08, 0x04, 0x01,
+    0x01, 0x08, 0x05, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x02, 0x04, 0x07, 0x01,
+    0x02, 0x00, 0x04, 0x01, 0x02, 0x00, 0x07, 0x01, 0x02, 0x04, 0x01, 0x01,
+    0x01, 0x08, 0x05, 0xbb, 0x01, 0x08, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01,
+    0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01,
+    0x01, 0x08, 0x06, 0xbb, 0x02, 0x08, 0x06, 0x01, 0x01, 0x00, 0x0a, 0x01,
+    0x01, 0x00, 0x06, 0x01, 0x03, 0x08, 0x08, 0xbb, 0x01, 0x08, 0x04, 0xbb,
+    0x01, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0xbb,
+    0x01, 0x08, 0x08, 0xbb, 0x04, 0x08, 0x04, 0xbb, 0x01, 0x01, 0x01, 0x00,
+    0x0a, 0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0xbb, 0x04, 0x08, 0x04, 0xbb,
+    0x01, 0x08, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x09, 0x01,
+    0x01, 0x08, 0x03, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+    0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+    0x01, 0x08, 0x03, 0xbb, 0x01, 0x08, 0x08, 0x01, 0x01, 0x00, 0x0c, 0x01,
+    0x01, 0x00, 0x08, 0x01, 0x01, 0x08, 0x03, 0xbb, 0x01, 0x08, 0x07, 0xbb,
+    0x01, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0xbb,
+    0x01, 0x08, 0x04, 0xbb, 0x01, 0x08, 0x07, 0xbb, 0x01, 0x01, 0x01, 0x00,
+    0x0c, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0xbb, 0x02, 0x08, 0x02, 0xbb,
+    0x01, 0x08, 0x09, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x09, 0x01,
+    0x01, 0x08, 0x01, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x06, 0x04, 0x02, 0x01,
+    0x01, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x02, 0x01, 0x06, 0x04, 0x01, 0x01,
+    0x01, 0x08, 0x01, 0xbb, 0x01, 0x08, 0x08, 0x01, 0x01, 0x00, 0x0e, 0x01,
+    0x01, 0x00, 0x08, 0x01, 0x01, 0x08, 0x02, 0xbb, 0x07, 0x08, 0x01, 0x01,
+    0x01, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01, 0x07, 0x08, 0x09, 0xbb,
+    0x01, 0x08, 0x01, 0x01, 0x01, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x08, 0x0f, 0xbb, 0x01, 0x08, 0x01, 0x01, 0x01, 0x00, 0x0e, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb, 0x01, 0x08, 0x01, 0x01,
+    0x01, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb,
+    0x01, 0x08, 0x01, 0x01, 0x10, 0x00, 0x01, 0x01, 0x01, 0x08, 0x0f, 0xbb,
+    0x01, 0x08, 0x07, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01,
+    0x01, 0x08, 0x10, 0xbb, 0x06, 0x08, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x06, 0x08, 0x16, 0xbb, 0x01, 0x08, 0x01, 0x01,
+    0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x1b, 0xbb,
+    0x01, 0x08, 0x06, 0x01, 0x01, 0x08, 0x1c, 0xbb, 0x06, 0x08, 0x0e, 0xbb,
+    0x00, 0x7d, 0x22, 0x01, 0x01, 0x00, 0x01, 0x00, 0x44, 0x75, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x64, 0x7d, 0x23, 0x00, 0x45, 0x75, 0xff,
+    0xff, 0x02, 0x00, 0xec, 0x13, 0xed, 0x13, 0xc8, 0x7d, 0x27, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x11, 0x12, 0x0f, 0x14, 0x09, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x02, 0x23,
+    0x24, 0x03, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x0a, 0x2f,
+    0x30, 0x31, 0x32, 0x0b, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x04, 0x7d, 0x7e, 0x05, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x06, 0x8f,
+    0x90, 0x08, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b,
+    0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0x07, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0x0c, 0xc5, 0xc6, 0xc7, 0xc8, 0x0d, 0xca, 0xcb,
+    0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0x0e, 0xe3,
+    0xe4, 0xe5, 0xe6, 0x01, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb,
+    0xfc, 0xfd, 0xfe, 0xff,
+}; // MultiStepLoad_stage4
+
+const unsigned char* const MultiStepLoad_stages[MultiStepLoad_StageCount] = {
+    MultiStepLoad_stage0,
+    MultiStepLoad_stage1,
+    MultiStepLoad_stage2,
+    MultiStepLoad_stage3,
+    MultiStepLoad_stage4,
+};
+
+const unsigned long MultiStepLoad_stageSizes[MultiStepLoad_StageCount] = {
+    MultiStepLoad_stage0_Size,
+    MultiStepLoad_stage1_Size,
+    MultiStepLoad_stage2_Size,
+    MultiStepLoad_stage3_Size,
+    MultiStepLoad_stage4_Size,
+};
+
+const unsigned short MultiStepLoad_stageNumObjs[MultiStepLoad_StageCount] = {
+    MultiStepLoad_stage0_NumObjs,
+    MultiStepLoad_stage1_NumObjs,
+    MultiStepLoad_stage2_NumObjs,
+    MultiStepLoad_stage3_NumObjs,
+    MultiStepLoad_stage4_NumObjs,
+};
@@ -0,0 +1,50 @@
+// Generated by tools/PoolSplitter from MultiStepLoad.c
+// Do not change!
+
+#ifndef MULTISTEPLOAD_SPLIT_H
+#define MULTISTEPLOAD_SPLIT_H
+
+#define MultiStepLoad_split_SourceSize 48651
+#define MultiStepLoad_split_SourceHash 0x56B071CA6974D5E0ULL
+
+#define MultiStepLoad_base_Size 7431
+#define MultiStepLoad_base_NumObjs 53
+
+#define MultiStepLoad_secondary_Size 41249
+#define MultiStepLoad_secondary_NumObjs 145
+
+#define MultiStepLoad_gAux_Size 8553
+#define MultiStepLoad_gAux_NumObjs 57
+
+#define MultiStepLoad_stage0_Size 7431
+#define MultiStepLoad_stage0_NumObjs 53
+
+#define MultiStepLoad_stage1_Size 2310
+#define MultiStepLoad_stage1_NumObjs 37
+
+#define MultiStepLoad_stage2_Size 13679
+#define MultiStepLoad_stage2_NumObjs 48
+
+#define MultiStepLoad_stage3_Size 4856
+#define MultiStepLoad_stage3_NumObjs 11
+
+#define MultiStepLoad_stage4_Size 20404
+#define MultiStepLoad_stage4_NumObjs 49
+
+extern const unsigned char MultiStepLoad_base[MultiStepLoad_base_Size];
+extern const unsigned char MultiStepLoad_secondary[MultiStepLoad_secondary_Size];
+extern const unsigned char MultiStepLoad_gAux[MultiStepLoad_gAux_Size];
+extern const unsigned char MultiStepLoad_stage0[MultiStepLoad_stage0_Size];
+extern const unsigned char MultiStepLoad_stage1[MultiStepLoad_stage1_Size];
+extern const unsigned char MultiStepLoad_stage2[MultiStepLoad_stage2_Size];
+extern const unsigned char MultiStepLoad_stage3[MultiStepLoad_stage3_Size];
+extern const unsigned char MultiStepLoad_stage4[MultiStepLoad_stage4_Size];
+
+// upload stages; see PoolStages.h
+#define MultiStepLoad_StageCount 5
+
+extern const unsigned char* const MultiStepLoad_stages[MultiStepLoad_StageCount];
+extern const unsigned long MultiStepLoad_stageSizes[MultiStepLoad_StageCount];
+extern const unsigned short MultiStepLoad_stageNumObjs[MultiStepLoad_StageCount];
+
+#endif
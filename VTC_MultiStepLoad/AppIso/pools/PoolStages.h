@@ -0,0 +1,22 @@
+#ifndef POOLSTAGES_C36FCA404E774BADA460EC6010EDC239
+#define POOLSTAGES_C36FCA404E774BADA460EC6010EDC239
+#include "PreparePool.h"
+#include "MultiStepLoad/Output/MultiStepLoad.iop.h"
+
+// Upload stages of the MultiStepLoad pool; see PreparePool::splitPool().
+// Each stage is uploaded through IsoPoolReload() after the preceding one has finished;
+// objects not reachable from any stage are uploaded as additional last stage.
+static const iso_u16 s_poolStage0[] = { WorkingSet_0, DataMask_1000 };                      // loader screen
+static const iso_u16 s_poolStage1[] = { DataMask_1001 };                                    // first working mask
+static const iso_u16 s_poolStage2[] = { DataMask_1002, DataMask_1003 };
+static const iso_u16 s_poolStage3[] = { DataMask_1100, AlarmMask_1200, AlarmMask_1201 };
+
+static const PreparePool::PoolStage s_poolStages[] =
+{
+    { s_poolStage0, sizeof(s_poolStage0) / sizeof(s_poolStage0[0]) },
+    { s_poolStage1, sizeof(s_poolStage1) / sizeof(s_poolStage1[0]) },
+    { s_poolStage2, sizeof(s_poolStage2) / sizeof(s_poolStage2[0]) },
+    { s_poolStage3, sizeof(s_poolStage3) / sizeof(s_poolStage3[0]) },
+};
+
+#endif /* POOLSTAGES_C36FCA404E774BADA460EC6010EDC239 */
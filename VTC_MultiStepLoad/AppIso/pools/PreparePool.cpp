@@ -1,843 +1,778 @@
 #include <stdint.h>
-#include <map>
+#include <algorithm>
 #include <vector>
 #include <string.h>
-#include <malloc.h>
 #include "PreparePool.h"
 #include "IsoVtcApi.h"
 
 namespace PreparePool
 {
 
-static void itemizePool(
+enum PoolId
+{
+    poolSource = 0,     // object has not been moved; it remains in the secondary pool
+    poolBase,           // object has been moved into the base pool
+    poolAux,            // object has been moved into the gAux pool
+    poolStage           // object has been moved into upload stage 1; further stages follow
+};
+
+// Index entry of a single object. The object data remain in the source pool
+// and are only copied when the derived pools are written.
+struct PoolItem
+{
+    iso_u16 objectID;   // object ID
+    iso_u32 offset;     // offset of the object within the source pool
+    iso_u32 size;       // size of the object in bytes
+    iso_u8 pool;        // PoolId of the pool (or upload stage) the object has been moved to
+    bool auxStub;       // base pool contains this AuxiliaryFunction2 without its child objects
+};
+
+// Flat object table of the source pool sorted by object ID.
+struct PoolItems
+{
+    const iso_u8* poolData;
+    std::vector<PoolItem> items;
+    std::vector<iso_u32> refBegin;  // refs[refBegin[idx] .. refBegin[idx + 1]] are the children of items[idx]
+    std::vector<iso_u32> refs;      // child references as index into items
+    std::vector<iso_u32> stack;     // work list of moveItem()
+
+    PoolItem* find(iso_u16 objectID);
+    const iso_u8* data(const PoolItem& item) const
+    {
+        return &poolData[item.offset];
+    }
+};
+
+static const iso_u32 auxStubSize = 6U;  // AuxiliaryFunction2 header with object count 0
+
+static const iso_u8 noRef = 0xFFU;
+
+// List of object references within an object record.
+struct RefList
+{
+    iso_u8 countOffset;     // offset of the number of entries; 0: no list
+    iso_u8 countSize;       // size of the number of entries in bytes
+    iso_u8 startOffset;     // offset of the first entry; 0: the list follows the preceding list
+    iso_u8 stride;          // size of an entry in bytes
+    iso_u8 refOffsets[2];   // offsets of the object references within an entry; noRef: unused
+};
+
+// Reference layout of an object type; all offsets are relative to the object record.
+// Macro references are located at the end of the record, followed by the trailer (if any).
+struct ObjectLayout
+{
+    iso_u8 refOffsets[3];       // offsets of single object references; 0: unused
+    RefList lists[2];           // lists of object references
+    iso_u8 macroCountOffset;    // offset of the number of macros; 0: no macros
+    iso_u8 macroShiftOffset;    // offset of a length field, which shifts the number of macros; 0: none
+    iso_u8 macroShiftSize;      // size of this length field in bytes
+    iso_u8 trailerCountOffset;  // offset of the number of 2 byte entries following the macros; 0: none
+};
+
+#define NO_LIST                      { 0U, 0U, 0U, 0U, { noRef, noRef } }
+#define XYREF_LIST(count, start)     { count, 1U, start, 6U, { 0U, noRef } }
+#define REF_LIST(count, start)       { count, 1U, start, 2U, { 0U, noRef } }
+
+// ISO 11783-6 Annex B and J; indexed by OBJTYP_e
+static const ObjectLayout s_objectLayouts[] =
+{
+    { {  5U,  0U,  0U }, { XYREF_LIST(7U, 10U), NO_LIST }, 8U, 0U, 0U, 9U },     /*  0, WorkingSet */
+    { {  4U,  0U,  0U }, { XYREF_LIST(6U, 8U), NO_LIST }, 7U, 0U, 0U, 0U },      /*  1, DataMask */
+    { {  4U,  0U,  0U }, { XYREF_LIST(8U, 10U), NO_LIST }, 9U, 0U, 0U, 0U },     /*  2, AlarmMask */
+    { {  0U,  0U,  0U }, { XYREF_LIST(8U, 10U), NO_LIST }, 9U, 0U, 0U, 0U },     /*  3, Container */
+    { {  0U,  0U,  0U }, { REF_LIST(4U, 6U), NO_LIST }, 5U, 0U, 0U, 0U },        /*  4, SoftKeyMask */
+    { {  0U,  0U,  0U }, { XYREF_LIST(5U, 7U), NO_LIST }, 6U, 0U, 0U, 0U },      /*  5, Key */
+    { {  0U,  0U,  0U }, { XYREF_LIST(11U, 13U), NO_LIST }, 12U, 0U, 0U, 0U },   /*  6, Button */
+    { {  6U,  8U,  0U }, { NO_LIST, NO_LIST }, 12U, 0U, 0U, 0U },                /*  7, InputBooleanField */
+    { {  8U, 10U, 13U }, { NO_LIST, NO_LIST }, 18U, 16U, 1U, 0U },               /*  8, InputStringField */
+    { {  8U, 11U,  0U }, { NO_LIST, NO_LIST }, 37U, 0U, 0U, 0U },                /*  9, InputNumberField */
+    { {  7U,  0U,  0U }, { REF_LIST(10U, 13U), NO_LIST }, 12U, 0U, 0U, 0U },     /* 10, InputListField */
+    { {  8U, 11U,  0U }, { NO_LIST, NO_LIST }, 16U, 14U, 2U, 0U },               /* 11, OutputStringField */
+    { {  8U, 11U,  0U }, { NO_LIST, NO_LIST }, 28U, 0U, 0U, 0U },                /* 12, OutputNumberField */
+    { {  3U,  0U,  0U }, { NO_LIST, NO_LIST }, 10U, 0U, 0U, 0U },                /* 13, TypLine */
+    { {  3U, 10U,  0U }, { NO_LIST, NO_LIST }, 12U, 0U, 0U, 0U },                /* 14, TypRectangle */
+    { {  3U, 12U,  0U }, { NO_LIST, NO_LIST }, 14U, 0U, 0U, 0U },                /* 15, TypEllipse */
+    { {  7U,  9U,  0U }, { NO_LIST, NO_LIST }, 13U, 0U, 0U, 0U },                /* 16, TypPolygon */
+    { { 16U,  0U,  0U }, { NO_LIST, NO_LIST }, 20U, 0U, 0U, 0U },                /* 17, Meter */
+    { { 15U, 19U,  0U }, { NO_LIST, NO_LIST }, 23U, 0U, 0U, 0U },                /* 18, LinearBarGraph */
+    { { 18U, 22U,  0U }, { NO_LIST, NO_LIST }, 26U, 0U, 0U, 0U },                /* 19, ArchedBarGraph */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 16U, 0U, 0U, 0U },                /* 20, PictureGraphic */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 21, NumberVariable */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 22, StringVariable */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 7U, 0U, 0U, 0U },                 /* 23, FontAttributesObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 7U, 0U, 0U, 0U },                 /* 24, LineAttributesObject */
+    { {  5U,  0U,  0U }, { NO_LIST, NO_LIST }, 7U, 0U, 0U, 0U },                 /* 25, FillAttributesObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 5U, 4U, 1U, 0U },                 /* 26, InputAttributesObject */
+    { {  3U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 27, ObjectPointer */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 28, Macro; commands are not evaluated */
+    { {  0U,  0U,  0U }, { XYREF_LIST(5U, 6U), NO_LIST }, 0U, 0U, 0U, 0U },      /* 29, AuxiliaryFunction */
+    { {  0U,  0U,  0U }, { XYREF_LIST(6U, 7U), NO_LIST }, 0U, 0U, 0U, 0U },      /* 30, AuxiliaryInput */
+    { {  0U,  0U,  0U }, { XYREF_LIST(5U, 6U), NO_LIST }, 0U, 0U, 0U, 0U },      /* 31, AuxiliaryFunction2 */
+    { {  0U,  0U,  0U }, { XYREF_LIST(5U, 6U), NO_LIST }, 0U, 0U, 0U, 0U },      /* 32, AuxiliaryInput2 */
+    { {  4U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 33, AuxiliaryConDesigObjPoi */
+    { {  8U, 10U, 12U }, { REF_LIST(14U, 17U), XYREF_LIST(15U, 0U) }, 16U, 0U, 0U, 0U },  /* 34, WindowMaskObject */
+    { {  4U,  6U,  0U }, { REF_LIST(8U, 10U), NO_LIST }, 9U, 0U, 0U, 0U },       /* 35, KeyGroupObject */
+    { { 25U, 27U, 29U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 36, GraphicsContextObject */
+    { {  7U,  0U,  0U }, { REF_LIST(10U, 12U), NO_LIST }, 11U, 0U, 0U, 0U },     /* 37, OutputListObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 38, ExtInputAttributeObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 39, ColourMapObject */
+    { {  0U,  0U,  0U }, { { 3U, 2U, 5U, 7U, { 2U, 5U } }, NO_LIST }, 0U, 0U, 0U, 0U },   /* 40, ObjectLabelReferList */
+    { {  0U,  0U,  0U }, { REF_LIST(4U, 5U), NO_LIST }, 0U, 0U, 0U, 0U },        /* 41, ExternalObjectDef */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 42, ExternalRefName */
+    { {  3U,  5U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 43, ExternalObjectPointer */
+    { {  0U,  0U,  0U }, { XYREF_LIST(15U, 17U), NO_LIST }, 16U, 0U, 0U, 0U },   /* 44, AnimationObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 45, ColourPaletteObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 46, GraphicDataObject */
+    { {  0U,  0U,  0U }, { NO_LIST, NO_LIST }, 0U, 0U, 0U, 0U },                 /* 47, WSSpecialControlsObject; not evaluated */
+    { {  9U,  0U,  0U }, { NO_LIST, NO_LIST }, 11U, 0U, 0U, 0U },                /* 48, ScaledGraphicObject */
+};
+
+#undef NO_LIST
+#undef XYREF_LIST
+#undef REF_LIST
+
+static bool itemizePool(
     const iso_u8* poolData, iso_u32 poolSize,
-    std::map<uint16_t, std::vector<uint8_t>>& poolItems);
+    PoolItems& poolItems);
 
 static bool preparePool(
     const iso_u8* srcPool, iso_u32 srcPoolSize,
     const iso_u8* macroList, iso_u8 macroListSize,
-    iso_u8** basePool, iso_s32* basePoolSize,
-    iso_u8** secondaryPool, iso_s32* secondaryPoolSize,
-    iso_u8** gAuxPool, iso_s32* gAuxPoolSize);
+    std::vector<iso_u8>& basePool,
+    std::vector<iso_u8>& secondaryPool,
+    std::vector<iso_u8>& gAuxPool);
 
-static void releasePool(
-    iso_u8** basePool,
-    iso_u8** secondaryPool,
-    iso_u8** gAuxPool);
+static iso_u32 writeObject(iso_u8* dst, const PoolItems& poolItems, const PoolItem& item, bool auxStub);
 
 static iso_u16 getU16(const iso_u8 data[])
 {
     return static_cast<iso_u16>((data[1] << 8) + data[0]);
 }
 
-static void moveObject(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-static void moveWorkingSet(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveContainer(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveDataMask(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveOutputStringField(iso_u16 objectID,
-    std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-    std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveOutputNumberField(iso_u16 objectID,
-    std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-    std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveTypRectangle(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveLineAttributesObject(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveFillAttributesObject(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveObjectPointer(iso_u16 objectID,
-            std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-            std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveMacro(iso_u16 objectID,
-            std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-            std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveAuxiliaryFunction2(iso_u16 objectID,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems,
-                bool recursive = true);
-
-static void moveObjectList(const std::vector<uint8_t>& poolItem,
-                iso_u8 objectCount, uint32_t objectOffset,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-static void moveMacroList(const std::vector<uint8_t>& poolItem,
-                iso_u8 macroCount, uint32_t macroOffset,
-                std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems);
-
-void itemizePool(const iso_u8* poolData, iso_u32 poolSize,
-                   std::map<uint16_t, std::vector<uint8_t>>& poolItems)
+static bool buildReferences(PoolItems& poolItems);
+static bool getReferences(const iso_u8* poolItem, iso_u32 size, std::vector<iso_u16>& objectIDs);
+
+static bool prepareBasePool(
+    const iso_u8* srcPool, iso_u32 srcPoolSize,
+    const iso_u8* macroList, iso_u8 macroListSize,
+    PoolItems& poolItems,
+    std::vector<iso_u32>& auxFunction2Items);
+
+static iso_u32 getStage(const PoolItem& item, iso_u32 poolCount);
+static void appendObject(std::vector<iso_u8>& dst, const PoolItems& poolItems, const PoolItem& item, bool auxStub);
+
+static void moveObject(iso_u16 objectID, iso_u8 dstPool, PoolItems& poolItems);
+static void moveItem(iso_u32 itemIdx, iso_u8 dstPool, PoolItems& poolItems);
+
+static bool lessObjectID(const PoolItem& lhs, const PoolItem& rhs)
 {
-    poolItems.clear();
-    iso_u32 u32PoolSrcIdx = 0;
-    while (u32PoolSrcIdx < poolSize)
+    return lhs.objectID < rhs.objectID;
+}
+
+PoolItem* PoolItems::find(iso_u16 objectID)
+{
+    PoolItem key = { objectID, 0U, 0U, poolSource, false };
+    std::vector<PoolItem>::iterator it = std::lower_bound(items.begin(), items.end(), key, lessObjectID);
+    if ((it == items.end()) || (it->objectID != objectID))
     {
-        const iso_u8* objectPoolData = &poolData[u32PoolSrcIdx];
-        iso_u16 objectID = getU16(objectPoolData);
-        iso_u32 objectSize = IsoPoolObjSize(objectPoolData);
-        std::vector<uint8_t> poolItem(objectSize);
-        memcpy(poolItem.data(), objectPoolData, objectSize);
-        poolItems[objectID] = poolItem;
-        u32PoolSrcIdx += objectSize;
+        return nullptr;
     }
+
+    return &(*it);
 }
 
-bool parsePool(const iso_u8 *srcPool, iso_u32 srcPoolSize, const iso_u8 *macroList, iso_u8 macroListSize, std::vector<iso_u8> &basePool, std::vector<iso_u8> &secondaryPool, std::vector<iso_u8> &gAuxPool)
+// false: an object exceeds the pool; the objects before it are indexed
+bool itemizePool(const iso_u8* poolData, iso_u32 poolSize,
+                   PoolItems& poolItems)
 {
     bool qRet = true;
-    iso_u8* pBasePool = nullptr;
-    iso_s32 basePoolSize = 0;
-    iso_u8* pSecondaryPool = nullptr;
-    iso_s32 secondaryPoolSize = 0;
-    iso_u8* pGAuxPool = nullptr;
-    iso_s32 gAuxPoolSize = 0;
-    basePool.clear();
-    secondaryPool.clear();
-    gAuxPool.clear();
-    if (preparePool(srcPool, srcPoolSize,
-                    macroList, macroListSize,
-                    &pBasePool, &basePoolSize,
-                    &pSecondaryPool, &secondaryPoolSize,
-                    &pGAuxPool, &gAuxPoolSize) == ISO_FALSE)
-    {
-        releasePool(&pBasePool, &pSecondaryPool, &pGAuxPool);
-        qRet = ISO_FALSE;
-    }
-    else
+    poolItems.poolData = poolData;
+    poolItems.items.clear();
+    iso_u32 u32PoolSrcIdx = 0;
+    while (u32PoolSrcIdx < poolSize)
     {
-        if (basePoolSize > 0)
+        const iso_u8* objectPoolData = &poolData[u32PoolSrcIdx];
+        PoolItem item = { getU16(objectPoolData), u32PoolSrcIdx, 0U, poolSource, false };
+        if ((poolSize - u32PoolSrcIdx) >= 3U)
         {
-            basePool.resize(static_cast<size_t>(basePoolSize));
-            memcpy(basePool.data(),      pBasePool,      static_cast<size_t>(basePoolSize));
-            basePoolSize = IsoGetNumofPoolObjs(pBasePool, basePoolSize);
+            item.size = IsoPoolObjSize(objectPoolData);
         }
 
-        if (secondaryPoolSize > 0)
+        if ((item.size < 3U) || (item.size > (poolSize - u32PoolSrcIdx)))
         {
-            secondaryPool.resize(static_cast<size_t>(secondaryPoolSize));
-            memcpy(secondaryPool.data(), pSecondaryPool, static_cast<size_t>(secondaryPoolSize));
-            secondaryPoolSize = IsoGetNumofPoolObjs(pSecondaryPool, secondaryPoolSize);
+            qRet = false;
+            break;
         }
 
-        if (gAuxPoolSize > 0)
+        poolItems.items.push_back(item);
+        u32PoolSrcIdx += item.size;
+    }
+
+    // sort by object ID; a later definition of an object ID replaces the former one.
+    std::stable_sort(poolItems.items.begin(), poolItems.items.end(), lessObjectID);
+    std::vector<PoolItem>::iterator itDst = poolItems.items.begin();
+    for (std::vector<PoolItem>::iterator it = poolItems.items.begin(); it != poolItems.items.end(); ++it)
+    {
+        if ((it + 1 != poolItems.items.end()) && ((it + 1)->objectID == it->objectID))
         {
-            gAuxPool.resize(static_cast<size_t>(gAuxPoolSize));
-            memcpy(gAuxPool.data(),      pGAuxPool,      static_cast<size_t>(gAuxPoolSize));
-            gAuxPoolSize = IsoGetNumofPoolObjs(pGAuxPool, gAuxPoolSize);
+            continue;
         }
 
-        releasePool(&pBasePool, &pSecondaryPool, &pGAuxPool);
+        *itDst++ = *it;
     }
 
+    poolItems.items.erase(itDst, poolItems.items.end());
     return qRet;
 }
 
-bool preparePool(const iso_u8* srcPoolData, iso_u32 srcPoolSize,
+bool parsePool(const iso_u8 *srcPool, iso_u32 srcPoolSize, const iso_u8 *macroList, iso_u8 macroListSize, std::vector<iso_u8> &basePool, std::vector<iso_u8> &secondaryPool, std::vector<iso_u8> &gAuxPool)
+{
+    // the derived pools are written directly into the given vectors; no intermediate copies.
+    return preparePool(srcPool, srcPoolSize,
+                       macroList, macroListSize,
+                       basePool,
+                       secondaryPool,
+                       gAuxPool);
+}
+
+bool splitPool(const iso_u8* srcPool, iso_u32 srcPoolSize,
     const iso_u8* macroList, iso_u8 macroListSize,
-    iso_u8** pBasePool, iso_s32* pBasePoolSize,
-    iso_u8** pSecondaryPool, iso_s32* pSecondaryPoolSize,
-    iso_u8** pGAuxPool, iso_s32* pGAuxPoolSize)
+    const PoolStage* stages, iso_u8 stageCount,
+    std::vector<std::vector<iso_u8>>& stagePools)
 {
     bool qRet = true;   // be positive
-    iso_u16 u16NumberObjects = IsoGetNumofPoolObjs(srcPoolData, static_cast<iso_s32>(srcPoolSize));   //NumberObjects_glw
-    if (u16NumberObjects == 0)
+    stagePools.clear();
+    iso_u16 u16NumberObjects = IsoGetNumofPoolObjs(srcPool, static_cast<iso_s32>(srcPoolSize));
+    if ((u16NumberObjects == 0) || (stageCount > (0xFFU - poolStage)))
     {
         srcPoolSize = 0;
         qRet = false;
     }
 
-    // split source pool into individual objects
-    std::map<uint16_t, std::vector<uint8_t>> poolItems;
-    itemizePool(srcPoolData, srcPoolSize, poolItems);
-
-    // move objects relevant for the loader screen
-    // 1. everything belonging to the working set
-    // 2. all AuxiliaryFunction2 (with removed child objects)
-    // 3. all relevent macros
-    std::map<uint16_t, std::vector<uint8_t>> basePoolItems;
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = poolItems.find(0);
-    if (it != poolItems.end())
+    PoolItems poolItems;
+    std::vector<iso_u32> auxFunction2Items;
+    qRet = prepareBasePool(srcPool, srcPoolSize, macroList, macroListSize, poolItems, auxFunction2Items) && qRet;
+    if (qRet)
     {
-        std::vector<uint8_t>& poolItem = it->second;
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == WorkingSet)
+        // stage 0 is the base pool; each further stage gets the objects reachable from its roots,
+        // which are not part of a preceding stage.
+        for (iso_u8 stage = 0U; stage < stageCount; ++stage)
         {
-            // object '0' needs to be working set
-            moveWorkingSet(0, basePoolItems, poolItems);
-        }
-        else
-        {
-            poolItems.clear();
-            qRet = false;
+            iso_u8 dstPool = (stage == 0U) ? static_cast<iso_u8>(poolBase) : static_cast<iso_u8>(poolStage + stage - 1U);
+            for (iso_u8 idx = 0U; idx < stages[stage].rootCount; ++idx)
+            {
+                moveObject(stages[stage].rootIDs[idx], dstPool, poolItems);
+            }
         }
-    }
-    else
-    {
-        poolItems.clear();
-        qRet = false;
-    }
-
-    it = poolItems.begin();
-    while (it != poolItems.end())
-    {
-        std::vector<uint8_t>& poolItem = it->second;
-        iso_u16 objectID = getU16(&poolItem[0]);
-        std::map<uint16_t, std::vector<uint8_t>>::iterator itDst = basePoolItems.find(objectID);
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if ((eObjTyp == AuxiliaryFunction2) && (itDst == basePoolItems.end()))
-        {
-            moveAuxiliaryFunction2(objectID, basePoolItems, poolItems, false);
 
-            // restaret loop, since the iterator has become invalid.
-            it = poolItems.begin();
-        }
-        else
+        // the remaining objects are uploaded by an additional last stage
+        iso_u32 poolCount = (stageCount > 0U) ? (stageCount + 1U) : 2U;
+        std::vector<iso_u32> poolSizes(poolCount, 0U);
+        for (const PoolItem& item : poolItems.items)
         {
-            ++it;
-        }
-    }
+            iso_u32 stage = getStage(item, poolCount);
+            if ((item.auxStub) && (stage != 0U))
+            {
+                poolSizes[0] += auxStubSize;
+            }
 
-    if ((qRet) && (macroList != nullptr) && (macroListSize>0))
-    {
-        for (iso_u8 idx = 0; idx < macroListSize; idx++)
-        {
-            moveObject(macroList[idx], basePoolItems, poolItems);
+            poolSizes[stage] += item.size;
         }
-    }
 
-    std::map<uint16_t, std::vector<uint8_t>> auxPoolItems;
-#if(1)
-    it = poolItems.begin();
-    while (it != poolItems.end())
-    {
-        std::vector<uint8_t> poolItem = it->second;
-        iso_u16 objectID = getU16(&poolItem[0]);
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == AuxiliaryFunction2)
-        {
-            moveAuxiliaryFunction2(objectID, auxPoolItems, poolItems);
-
-            // restaret loop, since the iterator has become invalid.
-            it = poolItems.begin();
-        }
-        else
+        // sizing pass above; each stage pool is allocated once with its final size.
+        std::vector<std::vector<iso_u8>> pools(poolCount);
+        for (iso_u32 stage = 0U; stage < poolCount; ++stage)
         {
-            ++it;
+            pools[stage].reserve(poolSizes[stage]);
         }
-    }
-#endif
 
-    //size_t basePoolSize = 0;
-    //size_t secondaryPoolSize = 0;
-    //size_t gAuxPoolSize = 0;
-    uint32_t auxFunction2Count = 0;
-    if (qRet)
-    {
-        // add aux into secondaryPool
-        for (auto poolItem : auxPoolItems)
+        iso_u32 auxStubCount = 0U;
+        for (const PoolItem& item : poolItems.items)
         {
-            OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem.second[2]);
-            if (eObjTyp == AuxiliaryFunction2)
+            iso_u32 stage = getStage(item, poolCount);
+            if ((item.auxStub) && (stage != 0U))
             {
-                ++auxFunction2Count;
+                appendObject(pools[0], poolItems, item, true);
+                ++auxStubCount;
             }
 
-            poolItems[poolItem.first] = poolItem.second;
+            appendObject(pools[stage], poolItems, item, false);
         }
 
-        // add basePool into aux
-        for (auto poolItem : basePoolItems)
+        iso_u32 numberOfObjects = 0U;
+        for (iso_u32 stage = 0U; stage < poolCount; ++stage)
         {
-            if (auxPoolItems.find(poolItem.first) == auxPoolItems.end())
+            // empty stages are skipped; the base pool is always the first one.
+            if ((stage == 0U) || (!pools[stage].empty()))
             {
-                auxPoolItems[poolItem.first] = poolItem. second;
+                numberOfObjects += IsoGetNumofPoolObjs(pools[stage].data(), static_cast<iso_s32>(pools[stage].size()));
+                stagePools.push_back(std::vector<iso_u8>());
+                stagePools.back().swap(pools[stage]);
             }
         }
 
-        iso_s32 basePoolSize = 0;
-        for (auto poolItem : basePoolItems)
+        if ((numberOfObjects - auxStubCount) != poolItems.items.size())
         {
-            basePoolSize = basePoolSize + static_cast<iso_s32>(poolItem.second.size());
+            stagePools.clear();
+            qRet = false;
         }
+    }
 
-        iso_s32 secondaryPoolSize = 0;
-        for (auto poolItem : poolItems)
-        {
-            secondaryPoolSize = secondaryPoolSize + static_cast<iso_s32>(poolItem.second.size());
-        }
+    return qRet;
+}
 
-        iso_s32 gAuxPoolSize = 0;
-        for (auto poolItem : auxPoolItems)
-        {
-            gAuxPoolSize = gAuxPoolSize + static_cast<iso_s32>(poolItem.second.size());
-        }
+bool diffPool(const iso_u8* basePool, iso_u32 basePoolSize,
+    const iso_u8* languagePool, iso_u32 languagePoolSize,
+    std::vector<iso_u8>& deltaPool)
+{
+    deltaPool.clear();
+    if ((basePool == nullptr) || (languagePool == nullptr))
+    {
+        return false;
+    }
 
-        iso_u8* basePool = (iso_u8*)malloc(basePoolSize);
-        iso_u8* secondaryPool = (iso_u8*)malloc(secondaryPoolSize + gAuxPoolSize);
-        iso_u8* gAuxPool = (iso_u8*)malloc(basePoolSize + gAuxPoolSize);
+    PoolItems baseItems;
+    PoolItems languageItems;
+    if ((!itemizePool(basePool, basePoolSize, baseItems))
+        || (!itemizePool(languagePool, languagePoolSize, languageItems)))
+    {
+        return false;
+    }
 
-        iso_s32 poolIdx = 0;
-        for (auto poolItem : basePoolItems)
+    // objects which are identical in the base language are not part of the delta pool
+    iso_u32 deltaSize = 0U;
+    for (PoolItem& item : languageItems.items)
+    {
+        const PoolItem* baseItem = baseItems.find(item.objectID);
+        if ((baseItem == nullptr)
+            || (baseItem->size != item.size)
+            || (memcmp(baseItems.data(*baseItem), languageItems.data(item), item.size) != 0))
         {
-            memcpy((basePool) + poolIdx, poolItem.second.data(), poolItem.second.size());
-            poolIdx += static_cast<iso_s32>(poolItem.second.size());
+            item.pool = poolBase;
+            deltaSize += item.size;
         }
-        basePoolSize = poolIdx;
+    }
 
-        poolIdx = 0;
-        for (auto poolItem : poolItems)
+    deltaPool.resize(deltaSize);
+    iso_u32 idx = 0U;
+    for (const PoolItem& item : languageItems.items)
+    {
+        if (item.pool == poolBase)
         {
-            memcpy((secondaryPool) + poolIdx, poolItem.second.data(), poolItem.second.size());
-            poolIdx += static_cast<iso_s32>(poolItem.second.size());
+            idx += writeObject(deltaPool.data() + idx, languageItems, item, false);
         }
-        secondaryPoolSize = poolIdx;
+    }
 
-        poolIdx = 0;
-        for (auto poolItem : auxPoolItems)
-        {
-            memcpy((gAuxPool) + poolIdx, poolItem.second.data(), poolItem.second.size());
-            poolIdx += static_cast<iso_s32>(poolItem.second.size());
-        }
-        gAuxPoolSize = poolIdx;
+    return true;
+}
+
+bool preparePool(const iso_u8* srcPoolData, iso_u32 srcPoolSize,
+    const iso_u8* macroList, iso_u8 macroListSize,
+    std::vector<iso_u8>& basePool,
+    std::vector<iso_u8>& secondaryPool,
+    std::vector<iso_u8>& gAuxPool)
+{
+    bool qRet = true;   // be positive
+    basePool.clear();
+    secondaryPool.clear();
+    gAuxPool.clear();
+    iso_u16 u16NumberObjects = IsoGetNumofPoolObjs(srcPoolData, static_cast<iso_s32>(srcPoolSize));   //NumberObjects_glw
+    if (u16NumberObjects == 0)
+    {
+        srcPoolSize = 0;
+        qRet = false;
+    }
 
-        iso_u32 baseSize = IsoGetNumofPoolObjs(basePool, basePoolSize);
-        iso_u32 secondarySize = IsoGetNumofPoolObjs(secondaryPool, secondaryPoolSize);
-        iso_u32 gAuxSize = IsoGetNumofPoolObjs(gAuxPool, gAuxPoolSize);
-        (void)gAuxSize;
+    PoolItems poolItems;
+    std::vector<iso_u32> auxFunction2Items;
+    qRet = prepareBasePool(srcPoolData, srcPoolSize, macroList, macroListSize, poolItems, auxFunction2Items) && qRet;
 
-        if ((secondarySize + baseSize - auxFunction2Count) != u16NumberObjects)
-        {
-            qRet = false;
-        }
+#if(1)
+    // AuxiliaryFunction2 already moved as child object of a former one are skipped.
+    for (iso_u32 itemIdx : auxFunction2Items)
+    {
+        moveItem(itemIdx, poolAux, poolItems);
+    }
+#endif
 
-        if (pBasePool != nullptr)
+    uint32_t auxFunction2Count = 0;
+    if (qRet)
+    {
+        // base pool:      objects of the base pool and AuxiliaryFunction2 stubs
+        // secondary pool: remaining objects and objects of the gAux pool
+        // gAux pool:      objects of the gAux pool and objects of the base pool
+        iso_s32 basePoolSize = 0;
+        iso_s32 secondaryPoolSize = 0;
+        iso_s32 gAuxPoolSize = 0;
+        for (const PoolItem& item : poolItems.items)
         {
-            if ((*pBasePool) != nullptr)
+            switch (item.pool)
             {
-                free(*pBasePool);
-                *pBasePool = nullptr;
+            case poolBase:
+                basePoolSize += static_cast<iso_s32>(item.size);
+                gAuxPoolSize += static_cast<iso_s32>(item.size);
+                break;
+
+            case poolAux:
+                if (static_cast<OBJTYP_e>(poolItems.data(item)[2]) == AuxiliaryFunction2)
+                {
+                    ++auxFunction2Count;
+                }
+
+                secondaryPoolSize += static_cast<iso_s32>(item.size);
+                gAuxPoolSize += static_cast<iso_s32>(item.size);
+                break;
+
+            case poolSource:
+            default:
+                secondaryPoolSize += static_cast<iso_s32>(item.size);
+                if (item.auxStub)
+                {
+                    gAuxPoolSize += static_cast<iso_s32>(auxStubSize);
+                }
+                break;
             }
 
-            if (pBasePoolSize != nullptr)
-            {
-                *pBasePool = basePool;
-                *pBasePoolSize = basePoolSize;
-            }
-            else
+            if ((item.auxStub) && (item.pool != poolBase))
             {
-                free(basePool);
+                basePoolSize += static_cast<iso_s32>(auxStubSize);
             }
         }
 
-        if (pSecondaryPool != nullptr)
+        // sizing pass above; each pool is allocated once with its final size.
+        basePool.resize(static_cast<size_t>(basePoolSize));
+        secondaryPool.resize(static_cast<size_t>(secondaryPoolSize));
+        gAuxPool.resize(static_cast<size_t>(gAuxPoolSize));
+
+        iso_u32 baseIdx = 0U;
+        iso_u32 secondaryIdx = 0U;
+        iso_u32 gAuxIdx = 0U;
+        iso_u32 baseSize = 0U;
+        iso_u32 secondarySize = 0U;
+        for (const PoolItem& item : poolItems.items)
         {
-            if ((*pSecondaryPool) != nullptr)
+            bool baseStub = (item.auxStub) && (item.pool != poolBase);
+            if ((item.pool == poolBase) || (baseStub))
             {
-                free(*pSecondaryPool);
-                *pSecondaryPool = nullptr;
+                baseIdx += writeObject(basePool.data() + baseIdx, poolItems, item, baseStub);
+                ++baseSize;
             }
 
-            if (pSecondaryPoolSize != nullptr)
+            if (item.pool != poolBase)
             {
-                *pSecondaryPool = secondaryPool;
-                *pSecondaryPoolSize = secondaryPoolSize;
+                secondaryIdx += writeObject(secondaryPool.data() + secondaryIdx, poolItems, item, false);
+                ++secondarySize;
             }
-            else
-            {
-                free(secondaryPool);
-            }
-        }
 
-        if (pGAuxPool != nullptr)
-        {
-            if ((*pGAuxPool) != nullptr)
+            if (item.pool != poolSource)
             {
-                free(*pGAuxPool);
-                *pGAuxPool = nullptr;
+                gAuxIdx += writeObject(gAuxPool.data() + gAuxIdx, poolItems, item, false);
             }
-
-            if (pGAuxPoolSize != nullptr)
+            else if (item.auxStub)
             {
-                *pGAuxPool = gAuxPool;
-                *pGAuxPoolSize = gAuxPoolSize;
-            }
-            else
-            {
-                free(gAuxPool);
+                gAuxIdx += writeObject(gAuxPool.data() + gAuxIdx, poolItems, item, true);
             }
         }
+
+        // a later definition of an object ID replaces the former one
+        if ((secondarySize + baseSize - auxFunction2Count) != poolItems.items.size())
+        {
+            qRet = false;
+        }
+    }
+
+    if (!qRet)
+    {
+        basePool.clear();
+        secondaryPool.clear();
+        gAuxPool.clear();
     }
 
     return qRet;
 }
 
-void releasePool(
-    iso_u8** basePool,
-    iso_u8** secondaryPool,
-    iso_u8** gAuxPool)
+// Indexes the source pool and moves the objects relevant for the loader screen into the base pool:
+// 1. everything belonging to the working set
+// 2. all AuxiliaryFunction2 (with removed child objects)
+// 3. all relevent macros
+bool prepareBasePool(const iso_u8* srcPoolData, iso_u32 srcPoolSize,
+    const iso_u8* macroList, iso_u8 macroListSize,
+    PoolItems& poolItems,
+    std::vector<iso_u32>& auxFunction2Items)
 {
-    if ((basePool != nullptr) && ((*basePool) != nullptr))
+    bool qRet = true;
+
+    // index the source pool and its object references; the objects are not copied.
+    qRet = itemizePool(srcPoolData, srcPoolSize, poolItems) && buildReferences(poolItems);
+
+    PoolItem* workingSet = qRet ? poolItems.find(0) : nullptr;
+    if (workingSet != nullptr)
+    {
+        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItems.data(*workingSet)[2]);
+        if (eObjTyp == WorkingSet)
+        {
+            // object '0' needs to be working set
+            moveObject(0, poolBase, poolItems);
+        }
+        else
+        {
+            poolItems.items.clear();
+            qRet = false;
+        }
+    }
+    else
     {
-        free(*basePool);
-        *basePool = nullptr;
+        poolItems.items.clear();
+        qRet = false;
     }
 
-    if ((secondaryPool != nullptr) && ((*secondaryPool) != nullptr))
+    // collect all AuxiliaryFunction2 in a single pass; moving objects does not change the index.
+    auxFunction2Items.clear();
+    for (iso_u32 itemIdx = 0U; itemIdx < poolItems.items.size(); ++itemIdx)
     {
-        free(*secondaryPool);
-        *secondaryPool = nullptr;
+        if (static_cast<OBJTYP_e>(poolItems.data(poolItems.items[itemIdx])[2]) == AuxiliaryFunction2)
+        {
+            auxFunction2Items.push_back(itemIdx);
+        }
     }
 
-    if ((gAuxPool != nullptr) && ((*gAuxPool) != nullptr))
+    for (iso_u32 itemIdx : auxFunction2Items)
     {
-        free(*gAuxPool);
-        *gAuxPool = nullptr;
+        // the object remains in the source pool; the base pool gets a copy without child objects.
+        PoolItem& item = poolItems.items[itemIdx];
+        item.auxStub = (item.pool == poolSource);
     }
-}
 
-// Note: only relevent object types are moved recursively.
-void moveObject(iso_u16 objectID,
-                              std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-                              std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems)
-{
-    // TODO: recursive move
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    if ((qRet) && (macroList != nullptr) && (macroListSize>0))
     {
-        std::vector<uint8_t> poolItem = it->second;
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        switch (eObjTyp)
+        for (iso_u8 idx = 0; idx < macroListSize; idx++)
         {
-        case WorkingSet:               /*  0,  Top level object describes an implement (working set). */
-            // error! There should be only one working set.
-            moveWorkingSet(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case DataMask:                /*  1,  Top level object that contains other objects. */
-            moveDataMask(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case Container:               /*  3,  Used to group objects. */
-            moveContainer(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case OutputStringField:       /* 11,   Used to output a character string. */
-            moveOutputStringField(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case OutputNumberField:       /* 12,   Used to output an integer or float numeric. */
-            moveOutputNumberField(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case TypRectangle:            /* 14,   Used to output a rectangle or square. */
-            moveTypRectangle(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case LineAttributesObject:    /* 24,   Used to group line based attributes. */
-            moveLineAttributesObject(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case FillAttributesObject:    /* 25,   Used to group fill based attributes. */
-            moveFillAttributesObject(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case ObjectPointer:           /* 27,   Used to reference another object. */
-            moveObjectPointer(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case Macro:                   /* 28,   Special object that contains a list of commands. */
-            moveMacro(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-        case AuxiliaryFunction2:      /* 31,   Defines the designator and function type 2. */
-            //J.4.3     Auxiliary Function Type 2 object
-            moveAuxiliaryFunction2(objectID, dstPoolItems, srcPoolItems);
-            break;
-
-//            /* Working set object */
-//        case AlarmMask:               /*  2,  Top level object: Describes an alarm display. */
-//            /* Key objects */
-//        case SoftKeyMask:             /*  4,   Top level object that contains key objects. */
-//        case Key:                     /*  5,   Used to describe a soft key. */
-//        case Button:                  /*  6,   Used to describe a button control. */
-//            /* Input field objects */
-//        case InputBooleanField:       /*  7,   Used to input a ISO_TRUE/ISO_FALSE type input. */
-//        case InputStringField:        /*  8,   Used to input a character string. */
-//        case InputNumberField:        /*  9,   Used to input an integer or float numeric. */
-//        case InputListField:          /* 10,   Used to select an item from a pre-defined list. */
-//            /* Output field objects */
-//        case TypLine:                 /* 13,   Used to output a line. */
-//        case TypEllipse:              /* 15,   Used to output an ellipse or circle. */
-//        case TypPolygon:              /* 16,   Used to output a polygon. */
-//            /* Output graphic objects */
-//        case Meter:                   /* 17,   Used to output a meter. */
-//        case LinearBarGraph:          /* 18,   Used to output a linear bar graph. */
-//        case ArchedBarGraph:          /* 19,   Used to output an arched bar graph. */
-//            /* Picture graphic object */
-        case PictureGraphic:          /* 20,   Used to output a picture graphic (bitmap). */
-//            /* Variable objects */
-//        case NumberVariable:          /* 21,   Used to store a 32-bit unsigned integer value. */
-//        case StringVariable:          /* 22,   Used to store a fixed length string value. */
-//            /* Attribute object */
-        case FontAttributesObject:    /* 23,   Used to group font based attributes. */
-//        case InputAttributesObject:   /* 26,   Used to specify a list of valid characters. */
-//            /* Pointer object */
-//            /* Macro object */
-//            /* Auxiliary control */
-//        case AuxiliaryFunction:       /* 29,   Defines the designator and function type. */
-//        case AuxiliaryInput:          /* 30,   Defines the designator, key number, and function type. */
-//        case AuxiliaryInput2:         /* 32,   Defines the designator, key number, and function type 2 */
-//        case AuxiliaryConDesigObjPoi: /* 33,   Defines the auxiliary control designator object pointer */
-//            /* Version 4 objects */
-//        case WindowMaskObject:        /* 34,   Special (parent) object for user layout DM */
-//        case KeyGroupObject:          /* 35,   Parent object of user layout SKM */
-//        case GraphicsContextObject:   /* 36,   Graphics Context object */
-//        case OutputListObject:        /* 37,   Used to output a output list */
-//        case ExtInputAttributeObject: /* 38,   Extended input attribute object */
-//        case ColourMapObject:         /* 39,   Changing the colour table */
-//        case ObjectLabelReferList:    /* 40,   For assigning (textual/graphical) label to objects  */
-//            /* Version 5 objects */
-//        case ExternalObjectDef:       /* 41,   Lists objects which another WS can reference */
-//        case ExternalRefName:         /* 42,   Identifies a WSM of a WS which can be referenced */
-//        case ExternalObjectPointer:   /* 43,   Allows a WS to display objects from another WS */
-//        case AnimationObject:         /* 44,   Used to display animations */
-//            /* Version 6 objects */
-//        case ColourPaletteObject:     /* 45,   Used for replacing VT standard colour palette */
-//        case GraphicDataObject:       /* 46,   Graphic Data object; Used for displaying Portable Network Graphic object */
-//        case WSSpecialControlsObject: /* 47,   Working Set Special Controls object */
-//        case ScaledGraphicObject:     /* 48,   Scaled Graphic object */
-            dstPoolItems[objectID] = poolItem;
-            it = srcPoolItems.erase(it);
-            it = srcPoolItems.end();
-            eObjTyp = ObjectUndef;
-            break;
-
-        case ObjectUndef:
-        default:
-            dstPoolItems[objectID] = poolItem;
-            it = srcPoolItems.erase(it);
-            it = srcPoolItems.end();
-            eObjTyp = ObjectUndef;
-            break;
+            moveObject(macroList[idx], poolBase, poolItems);
         }
     }
+
+    return qRet;
 }
 
-void moveWorkingSet(iso_u16 objectID,
-                                  std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems,
-                                  std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+// Copies the object from the source pool; returns the number of bytes written.
+iso_u32 writeObject(iso_u8* dst, const PoolItems& poolItems, const PoolItem& item, bool auxStub)
 {
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    const iso_u8* poolItem = poolItems.data(item);
+    if (auxStub)
     {
-        // Table B.2 — Working Set attributes and record format
-
-        // move working set sub-objects
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        uint16_t avtiveMask = getU16(&poolItem[5]);
-        moveObject(avtiveMask, dstPoolItems, srcPoolItems);
-
-        uint8_t objectCount = poolItem[7];
-        uint32_t objectOffset = 10;
-        moveObjectList(poolItem, objectCount, objectOffset, dstPoolItems, srcPoolItems);
-
-        uint8_t macroCount = poolItem[8];
-        uint32_t macroOffset = objectOffset + (6*objectCount);
-        moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+        // AuxiliaryFunction2 without child objects
+        memcpy(dst, poolItem, auxStubSize - 1U);
+        dst[auxStubSize - 1U] = 0;
+        return auxStubSize;
     }
+
+    memcpy(dst, poolItem, item.size);
+    return item.size;
 }
 
-void moveContainer(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+// Builds the child reference graph of all objects; false: an object record is inconsistent.
+bool buildReferences(PoolItems& poolItems)
 {
-    // B.4   Container object
-    // Table B.8 — Container attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    bool qRet = true;
+    std::vector<iso_u16> objectIDs;
+    poolItems.refBegin.clear();
+    poolItems.refs.clear();
+    poolItems.refBegin.reserve(poolItems.items.size() + 1U);
+    for (const PoolItem& item : poolItems.items)
     {
-        // Table B.2 — Working Set attributes and record format
-
-        // move working set sub-objects
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == Container)
-        {
-            uint8_t objectCount = poolItem[8];
-            uint32_t objectOffset = 10;
-            moveObjectList(poolItem, objectCount, objectOffset, dstPoolItems, srcPoolItems);
-
-            uint8_t macroCount = poolItem[9];
-            uint32_t macroOffset = objectOffset + (6*objectCount);
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+        poolItems.refBegin.push_back(static_cast<iso_u32>(poolItems.refs.size()));
+        objectIDs.clear();
+        qRet = getReferences(poolItems.data(item), item.size, objectIDs) && qRet;
+        for (iso_u16 objectID : objectIDs)
+        {
+            // references to the NULL object or to missing objects are ignored
+            PoolItem* child = poolItems.find(objectID);
+            if (child != nullptr)
+            {
+                poolItems.refs.push_back(static_cast<iso_u32>(child - poolItems.items.data()));
+            }
         }
     }
+
+    poolItems.refBegin.push_back(static_cast<iso_u32>(poolItems.refs.size()));
+    return qRet;
 }
 
-void moveDataMask(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+// Appends the IDs of all objects referenced by the object record.
+// false: an offset of the layout exceeds the record (truncated or inconsistent object).
+bool getReferences(const iso_u8* poolItem, iso_u32 size, std::vector<iso_u16>& objectIDs)
 {
-    // Table B.4 — Data mask attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    if (size < 3U)
     {
-        // Table B.2 — Working Set attributes and record format
+        return false;
+    }
 
-        // move working set sub-objects
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
+    iso_u8 objectType = poolItem[2];
+    if (objectType >= (sizeof(s_objectLayouts) / sizeof(s_objectLayouts[0])))
+    {
+        // unknown object type; no references
+        return true;
+    }
 
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == DataMask)
+    const ObjectLayout& layout = s_objectLayouts[objectType];
+    for (iso_u8 refOffset : layout.refOffsets)
+    {
+        if (refOffset != 0U)
         {
-            uint16_t softkeyMask = getU16(&poolItem[4]);
-            moveObject(softkeyMask, dstPoolItems, srcPoolItems);
-
-            uint8_t objectCount = poolItem[6];
-            uint32_t objectOffset = 8;
-            moveObjectList(poolItem, objectCount, objectOffset, dstPoolItems, srcPoolItems);
+            if ((refOffset + 2U) > size)
+            {
+                return false;
+            }
 
-            uint8_t macroCount = poolItem[7];
-            uint32_t macroOffset = objectOffset + (6*objectCount);
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+            objectIDs.push_back(getU16(&poolItem[refOffset]));
         }
     }
-}
 
-void moveOutputStringField(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
-{
-    // B.9.2   Output String object
-    // Table B.22 — Output String attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
-    {
-        // move working set sub-objects
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == OutputStringField)
+    iso_u32 listEnd = 0U;
+    for (const RefList& list : layout.lists)
+    {
+        if (list.countOffset == 0U)
         {
-            uint16_t fontObject = getU16(&poolItem[8]);
-            moveObject(fontObject, dstPoolItems, srcPoolItems);
+            continue;
         }
-    }
-}
 
-void moveOutputNumberField(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems, std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems)
-{
-    // B.9.3   Output Number object
-    // Table B.23 — Output Number attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
-    {
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
+        if ((list.countOffset + list.countSize) > size)
+        {
+            return false;
+        }
 
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == OutputNumberField)
+        iso_u32 count = (list.countSize == 2U) ? getU16(&poolItem[list.countOffset]) : poolItem[list.countOffset];
+        iso_u32 offset = (list.startOffset != 0U) ? list.startOffset : listEnd;
+        for (iso_u32 idx = 0U; idx < count; ++idx)
         {
-            uint16_t fontAttributes = getU16(&poolItem[8]);
-            moveObject(fontAttributes, dstPoolItems, srcPoolItems);
+            if ((offset + list.stride) > size)
+            {
+                return false;
+            }
 
-            uint16_t variableReference = getU16(&poolItem[11]);
-            moveObject(variableReference, dstPoolItems, srcPoolItems);
+            for (iso_u8 refOffset : list.refOffsets)
+            {
+                if (refOffset != noRef)
+                {
+                    objectIDs.push_back(getU16(&poolItem[offset + refOffset]));
+                }
+            }
 
-            uint8_t macroCount = poolItem[28];
-            uint32_t macroOffset = 29;
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+            offset += list.stride;
         }
-    }
-}
-
 
+        listEnd = offset;
+    }
 
-void moveTypRectangle(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
-{
-    // Table B.29 — Output Rectangle attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    if (layout.macroCountOffset != 0U)
     {
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == TypRectangle)
+        iso_u32 macroCountOffset = layout.macroCountOffset;
+        if (layout.macroShiftOffset != 0U)
         {
-            uint16_t lineAttributes = getU16(&poolItem[3]);
-            moveObject(lineAttributes, dstPoolItems, srcPoolItems);
-
-            uint16_t fillAttributes = getU16(&poolItem[10]);
-            moveObject(fillAttributes, dstPoolItems, srcPoolItems);
+            if ((layout.macroShiftOffset + layout.macroShiftSize) > size)
+            {
+                return false;
+            }
 
-            uint8_t macroCount = poolItem[12];
-            uint32_t macroOffset = 13;
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+            macroCountOffset += (layout.macroShiftSize == 2U) ? getU16(&poolItem[layout.macroShiftOffset]) : poolItem[layout.macroShiftOffset];
         }
-    }
-}
 
-void moveLineAttributesObject(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
-{
-    // Table B.48 — Line Attributes attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
-    {
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == LineAttributesObject)
+        if ((macroCountOffset >= size) || ((layout.trailerCountOffset != 0U) && (layout.trailerCountOffset >= size)))
         {
-            uint8_t macroCount = poolItem[7];
-            uint32_t macroOffset = 8;
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+            return false;
         }
-    }
-}
 
-void moveFillAttributesObject(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
-{
-    // Table B.50 — Fill Attributes attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
-    {
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
+        // macros: event ID, macro ID
+        iso_u32 trailerSize = (layout.trailerCountOffset != 0U) ? (2U * poolItem[layout.trailerCountOffset]) : 0U;
+        iso_u32 macroSize = 2U * poolItem[macroCountOffset];
+        if ((macroCountOffset + 1U + macroSize + trailerSize) > size)
+        {
+            return false;
+        }
 
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == FillAttributesObject)
+        for (iso_u32 offset = size - trailerSize - macroSize; offset < (size - trailerSize); offset += 2U)
         {
-            uint8_t macroCount = poolItem[7];
-            uint32_t macroOffset = 8;
-            moveMacroList(poolItem, macroCount, macroOffset, dstPoolItems, srcPoolItems);
+            objectIDs.push_back(poolItem[offset + 1U]);
         }
     }
+
+    return true;
 }
 
-void moveObjectPointer(iso_u16 objectID, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+bool getObjectReferences(const iso_u8* object, iso_u32 size, std::vector<iso_u16>& objectIDs)
 {
-    // B.15 Object Pointer object
+    return getReferences(object, size, objectIDs);
+}
 
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+uint64_t poolHash(uint64_t hash, const iso_u8* data, iso_u32 size)
+{
+    for (iso_u32 idx = 0U; idx < size; ++idx)
     {
-        // move working set sub-objects
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == ObjectPointer)
-        {
-            uint16_t nextObject = getU16(&poolItem[3]);
-            moveObject(nextObject, dstPoolItems, srcPoolItems);
-        }
+        hash ^= data[idx];
+        hash *= 0x100000001B3ULL;
     }
+
+    return hash;
 }
 
-static void moveMacro(iso_u16 objectID,
-            std::map<uint16_t, std::vector<uint8_t>>& dstPoolItems,
-            std::map<uint16_t, std::vector<uint8_t>>& srcPoolItems)
+// Returns the upload stage of the object; objects not assigned to a stage belong to the last one.
+iso_u32 getStage(const PoolItem& item, iso_u32 poolCount)
 {
-    // B.16 Macro object
-    // Table B.56 — Macro attributes and record format
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
+    iso_u32 stage = poolCount - 1U;
+    if (item.pool == poolBase)
     {
-        std::vector<uint8_t> poolItem = it->second;
-        dstPoolItems[objectID] = poolItem;
-        it = srcPoolItems.erase(it);
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == Macro)
-        {
-            //TODO: check wether additional dependencies are required
-        }
+        stage = 0U;
     }
+    else if (item.pool >= poolStage)
+    {
+        stage = item.pool - poolStage + 1U;
+    }
+    else
+    {
+        // not assigned to a stage
+    }
+
+    return stage;
 }
 
-void moveAuxiliaryFunction2(iso_u16 objectID,
-                                          std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems,
-                                          std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems,
-                                          bool recursive)
+void appendObject(std::vector<iso_u8>& dst, const PoolItems& poolItems, const PoolItem& item, bool auxStub)
 {
-    //J.4.3     Auxiliary Function Type 2 object
-    std::map<uint16_t, std::vector<uint8_t>>::iterator it = srcPoolItems.find(objectID);
-    if (it != srcPoolItems.end())
-    {
-        std::vector<uint8_t> poolItem = it->second;
-        if (recursive)
-        {
-            dstPoolItems[objectID] = poolItem;
-            it = srcPoolItems.erase(it);
-        }
-
-        OBJTYP_e eObjTyp = static_cast<OBJTYP_e>(poolItem[2]);
-        if (eObjTyp == AuxiliaryFunction2)
-        {
-            if (recursive)
-            {
-                uint8_t objectCount = poolItem[5];
-                moveObjectList(poolItem, objectCount, 6, dstPoolItems, srcPoolItems);
-            }
-            else
-            {
-                poolItem.resize(6);
-                poolItem[5] = 0;
-                dstPoolItems[objectID] = poolItem;
-            }
-        }
-    }
+    size_t dstSize = dst.size();
+    dst.resize(dstSize + (auxStub ? auxStubSize : item.size));
+    (void)writeObject(dst.data() + dstSize, poolItems, item, auxStub);
 }
 
-void moveObjectList(const std::vector<uint8_t> &poolItem, iso_u8 objectCount, uint32_t objectOffset, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+// Moves the object and all objects reachable from it into the destination pool.
+// Objects which have been moved before are neither moved nor traversed.
+void moveObject(iso_u16 objectID, iso_u8 dstPool, PoolItems& poolItems)
 {
-    for (uint8_t idx = 0; idx < objectCount; ++idx)
+    PoolItem* item = poolItems.find(objectID);
+    if (item != nullptr)
     {
-        uint16_t objectID = getU16(&poolItem[objectOffset + (6*idx)]);
-        moveObject(objectID, dstPoolItems, srcPoolItems);
+        moveItem(static_cast<iso_u32>(item - poolItems.items.data()), dstPool, poolItems);
     }
 }
 
-void moveMacroList(const std::vector<uint8_t> &poolItem, iso_u8 macroCount, uint32_t macroOffset, std::map<uint16_t, std::vector<uint8_t> > &dstPoolItems, std::map<uint16_t, std::vector<uint8_t> > &srcPoolItems)
+void moveItem(iso_u32 itemIdx, iso_u8 dstPool, PoolItems& poolItems)
 {
-    for (uint8_t idx = 0; idx < macroCount; ++idx)
+    if (poolItems.items[itemIdx].pool == poolSource)
     {
-        uint8_t objectID = poolItem[macroOffset + (2*idx) + 1];
-        moveObject(objectID, dstPoolItems, srcPoolItems);
+        poolItems.items[itemIdx].pool = dstPool;
+        poolItems.stack.push_back(itemIdx);
+        while (!poolItems.stack.empty())
+        {
+            iso_u32 parentIdx = poolItems.stack.back();
+            poolItems.stack.pop_back();
+            for (iso_u32 refIdx = poolItems.refBegin[parentIdx]; refIdx < poolItems.refBegin[parentIdx + 1U]; ++refIdx)
+            {
+                PoolItem& child = poolItems.items[poolItems.refs[refIdx]];
+                if (child.pool == poolSource)
+                {
+                    child.pool = dstPool;
+                    poolItems.stack.push_back(poolItems.refs[refIdx]);
+                }
+            }
+        }
     }
 }
 
@@ -3,6 +3,7 @@
 
 #include "IsoCommonDef.h"
 #ifdef __cplusplus
+#include <stdint.h>
 #include <vector>
 
 namespace PreparePool
@@ -14,6 +15,39 @@ bool parsePool(const iso_u8* srcPool, iso_u32 srcPoolSize,
     std::vector<iso_u8>& secondaryPool,
     std::vector<iso_u8>& gAuxPool);
 
+// Root objects of an upload stage. A stage contains all objects reachable from its roots,
+// which are not part of a preceding stage.
+struct PoolStage
+{
+    const iso_u16* rootIDs;
+    iso_u8 rootCount;
+};
+
+// Splits the pool into incremental pools to be uploaded one after another.
+// stagePools[0] is the base pool (working set, AuxiliaryFunction2 without child objects,
+// macros and the objects of stages[0]); all remaining objects are appended as last stage.
+bool splitPool(const iso_u8* srcPool, iso_u32 srcPoolSize,
+    const iso_u8* macroList, iso_u8 macroListSize,
+    const PoolStage* stages, iso_u8 stageCount,
+    std::vector<std::vector<iso_u8>>& stagePools);
+
+// Writes all objects of the language pool, which are missing in the base language pool
+// or differ from it, into the delta pool. The language pool may be a complete pool
+// or contain the translated objects only.
+bool diffPool(const iso_u8* basePool, iso_u32 basePoolSize,
+    const iso_u8* languagePool, iso_u32 languagePoolSize,
+    std::vector<iso_u8>& deltaPool);
+
+// Appends the IDs of all objects referenced by the object record (child objects, attributes and macros),
+// as used by parsePool() and splitPool() to move an object together with its children.
+// false: the record is shorter than its object type requires; the pool is rejected.
+bool getObjectReferences(const iso_u8* object, iso_u32 size, std::vector<iso_u16>& objectIDs);
+
+// Continues a FNV-1a hash (64 bit) over the pool data; a new hash starts with poolHashOffsetBasis.
+// Used for the pool labels and for the source hash of the pools split by tools/PoolSplitter.
+const uint64_t poolHashOffsetBasis = 0xCBF29CE484222325ULL;
+uint64_t poolHash(uint64_t hash, const iso_u8* data, iso_u32 size);
+
 } /* namespace PreparePool */
 #endif /* __cplusplus */
 #endif /* PREPARE_POOL_C36FCA404E774BADA460EC6010EDC239 */
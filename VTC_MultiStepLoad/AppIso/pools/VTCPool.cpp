@@ -1,26 +1,73 @@
 #include "VTCPool.h"
 #include "PreparePool.h"
 
+// 1: the derived pools are split at build time by tools/PoolSplitter and used from flash;
+//    they are split at start-up if MultiStepLoad_split.c does not match the pool.
+// 0: the derived pools are split at start-up (requires RAM for all derived pools).
+#ifndef VTCPOOL_PRESPLIT_POOLS
+#define VTCPOOL_PRESPLIT_POOLS 1
+#endif
+
+// 1: the secondary pool is uploaded in the stages of PoolStages.h; one IsoPoolReload() per stage.
+// 0: the secondary pool is uploaded by a single IsoPoolReload().
+#ifndef VTCPOOL_STAGED_UPLOAD
+#define VTCPOOL_STAGED_UPLOAD 1
+#endif
+
 #include <iostream>
 #include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include "AppCommon/AppLog.h"
 
 extern "C"
 {
 #include "MultiStepLoad/Output/MultiStepLoad.c.h"
 #include "MultiStepLoad/Output/MultiStepLoad.ext.h"
 #include "MultiStepLoad/Output/MultiStepLoad.iop.h"
-#include "MultiStepLoad/Output/MultiStepLoad_de.iop.h"
+#include "MultiStepLoad_lang.h"
+#if (VTCPOOL_PRESPLIT_POOLS)
+#include "MultiStepLoad_split.h"
+#endif
 }
 
+#if (VTCPOOL_STAGED_UPLOAD)
+#include "PoolStages.h"
+#endif
+
 static bool vtcContainsLanguage(VTCPool* vtcPool,       // This function checks wether a given language code is available.
     VTCLanguageCode lc);
+static bool vtcAddStoredLanguage(VTCPool* vtcPool,      // This function adds a language code to the stored pools; false: no free entry.
+    VTCLanguageCode lc);
 
-static const char s_basePoolLabel[LENVERSIONSTR + 1] = "xxWHEPS                         ";  // 7 characters filled with blanks
+static_assert(MultiStepLoad_DefaultLanguage == lcEN,
+    "the default language of the ISO-Designer project must be lcEN");
 
+// Pool label: 2 language bytes, 13 characters of the pool hash and the application name, filled with blanks.
+// VTs prior to version 5 store the first 7 characters only (language and 25 bits of the hash).
+static const char s_basePoolLabel[LENVERSIONSTR + 1] = "xx------------- WHEPS           ";
+static const iso_u8 s_legacyLabelLength = 7U;
+
+static const char s_telemetryCsvHeader[] = "time_ms,delta_ms,event,language,stage,bytes,objects,retries\n";
+
+static bool s_poolHashesValid = false;
+static uint64_t s_baseHash = 0U;        // hash of the base pool; label lcBase
+static uint64_t s_secondaryHash = 0U;   // hash of the base and secondary pool; label lcEN
+static uint64_t s_gAuxHash = 0U;        // hash of the gAux pool; label lcA3
+
+#if (VTCPOOL_PRESPLIT_POOLS)
+static_assert(MultiStepLoad_split_SourceSize == ISO_OP_MultiStepLoad_Size,
+    "MultiStepLoad_split.c is outdated; run tools/PoolSplitter");
+static bool s_presplitPoolsValid = false;   // MultiStepLoad_split.c matches the pool; set by vtcPoolParsePool()
+#endif
+// derived pools split at start-up; empty if the pools of MultiStepLoad_split.c are used
 static std::vector<iso_u8> s_basePool;      // derived pool; used as a start screen and for aux pool scan of isobus driver.
 static std::vector<iso_u8> s_secondaryPool; // derived pool; english pool to be loaded after basePool.
                                             // incremental language pool are included as header
 static std::vector<iso_u8> s_gAuxPool;      // derived pool; used for GAux / A3.
+#if (VTCPOOL_STAGED_UPLOAD)
+static std::vector<std::vector<iso_u8>> s_stagePools;   // derived pools; upload stages, stage 0 replaces the base pool.
+#endif
 #if(0) // temporary variables for pool debugging
 static std::map<uint16_t, std::vector<uint8_t>> evalItems;
 static std::map<uint16_t, std::vector<uint8_t>> poolItems;
@@ -30,41 +77,56 @@ static std::map<uint16_t, std::vector<uint8_t>> gAuxPoolItems;
 #endif
 
 static enum VTCLanguageCode vtcPoolGetFinalLanguage(enum VTCLanguageCode vtLanguage);
+static const struct PoolLanguage* vtcPoolFindLanguage(enum VTCLanguageCode lc);     // This looks up a VT language in the language table.
+static const struct PoolLanguage* vtcPoolGetPoolLanguage(enum VTCLanguageCode lc);  // This follows the fallback chain to the language providing the pool.
+static uint64_t vtcPoolGetPoolHash(enum VTCLanguageCode lc);                        // This returns the hash of all pools stored with the label.
+static bool vtcPoolIsCurrentLabel(const iso_u8* versionString, enum VTCLanguageCode lc);  // This checks a stored label against the pool content.
+static iso_u32 vtcPoolTelemetryCsvLine(const struct VTCPoolTelemetryEntry* entry, iso_u32 startMs, char* buffer, iso_u32 bufferSize);
+static void vtcPoolTelemetryPrint(const VTCPool* vt);   // This prints the recorded steps as CSV.
 static iso_bool vtcPoolParsePool(void);         // This will initialize the required pools.
 static iso_bool s_init = vtcPoolParsePool();
+#if (VTCPOOL_STAGED_UPLOAD)
+static iso_bool vtcPoolLoadNextStage(VTCPool* vt);  // This uploads the next stage of the secondary pool.
+#endif
 
 void vtcPoolInit(VTCPool* vt, iso_bool auxVT, enum VTCLanguageCode vtLanguage_in, iso_u8 au8VersionStrings[][LENVERSIONSTR], iso_u8 count)
 {
     vtcPoolClear(vt);
+    memset(&vt->m_telemetry, 0, sizeof(vt->m_telemetry));
     vt->m_vtLanguage = vtLanguage_in;
     vt->initialized = true;
     vt->m_countStoredLanguages = 0;
     for (iso_u8 idx = 0; idx < count; ++idx)
     {
         const iso_u8* versionString = &au8VersionStrings[idx][0];
+        VTCLanguageCode lc = vtcPoolGetLanguageCode(versionString);
 
-        if (memcmp(&s_basePoolLabel[2], &versionString[2], LENVERSIONSTR - 2) != 0)
+        if ((lc == lcUndefined) || (!vtcPoolIsCurrentLabel(versionString, lc)))
         {
-            // the pool label does not match the last 30 Bytes (excluding the language bytes)
+            // the pool label does not match the hash of the current pool content
             IsoDeleteVersion(versionString);
         }
         else
         {
-            VTCLanguageCode lc = vtcPoolGetLanguageCode(versionString);
-            switch (lc)
+            // stored pools of all languages of the language table are kept
+            const PoolLanguage* language = vtcPoolFindLanguage(lc);
+            if ((lc == lcBase) || (lc == lcEN) || (lc == lcA3)
+                || ((language != nullptr) && (language->pool != nullptr)))
+            {
+                if (vtcAddStoredLanguage(vt, lc))
+                {
+                    APP_LOG_DEBUG(APP_LOG_MOD_POOL, "storedPool[%d]=%.7s.\n", idx, versionString);
+                }
+                else
+                {
+                    // uploaded again if required
+                    APP_LOG_WARN(APP_LOG_MOD_POOL, "storedPool[%d]=%.7s: too many stored pools.\n", idx, versionString);
+                }
+            }
+            else
             {
-            case lcBase:
-            case lcEN:
-            case lcDE:
-            case lcA3:
-                vt->m_storedLanguages[vt->m_countStoredLanguages++] = lc;
-                iso_DebugPrint("storedPool[%d]=%.7s.\n", idx, versionString);
-                break;
-
-            default:
                 // language is not supported
                 IsoDeleteVersion(versionString);
-                break;
             }
         }
     }
@@ -98,7 +160,7 @@ void vtcPoolInit(VTCPool* vt, iso_bool auxVT, enum VTCLanguageCode vtLanguage_in
 
         vt->m_transferLanguage = lc;
         vt->m_firstLanguage = lc;
-        iso_DebugPrint("getInitialLanguage %c%c\n", (char)(lc >> 8), (char)(lc));
+        APP_LOG_INFO(APP_LOG_MOD_POOL, "getInitialLanguage %c%c\n", (char)(lc >> 8), (char)(lc));
     }
 }
 
@@ -130,25 +192,66 @@ bool vtcContainsLanguage(VTCPool* vt, VTCLanguageCode lc)
     return qRet;
 }
 
-enum VTCLanguageCode vtcPoolGetFinalLanguage(enum VTCLanguageCode vtLanguage)
+bool vtcAddStoredLanguage(VTCPool* vt, VTCLanguageCode lc)
 {
-    VTCLanguageCode lc = lcUndefined;
-    switch (vtLanguage)
+    bool qRet = true;
+    if (!vtcContainsLanguage(vt, lc))
     {
-    case lcDE:
-    case lcSV:
-        lc = lcDE;
-        break;
+        if (vt->m_countStoredLanguages < (sizeof(vt->m_storedLanguages) / sizeof(vt->m_storedLanguages[0])))
+        {
+            vt->m_storedLanguages[vt->m_countStoredLanguages++] = lc;
+        }
+        else
+        {
+            qRet = false;
+        }
+    }
 
-    case lcEN:
-    default:
-        lc = lcEN;
-        break;
+    return qRet;
+}
+
+enum VTCLanguageCode vtcPoolGetFinalLanguage(enum VTCLanguageCode vtLanguage)
+{
+    VTCLanguageCode lc = lcEN;
+    const PoolLanguage* language = vtcPoolGetPoolLanguage(vtLanguage);
+    if (language != nullptr)
+    {
+        lc = static_cast<VTCLanguageCode>(language->languageCode);
     }
 
     return lc;
 }
 
+const PoolLanguage* vtcPoolFindLanguage(enum VTCLanguageCode lc)
+{
+    // language codes consist of two lower case letters
+    iso_u8 first = static_cast<iso_u8>((lc >> 8) - 'a');
+    iso_u8 second = static_cast<iso_u8>((lc & 0xFF) - 'a');
+    const PoolLanguage* language = nullptr;
+    if ((first < 26U) && (second < 26U))
+    {
+        iso_u8 idx = MultiStepLoad_languageIndex[first][second];
+        if (idx < MultiStepLoad_LanguageCount)
+        {
+            language = &MultiStepLoad_languages[idx];
+        }
+    }
+
+    return language;
+}
+
+const PoolLanguage* vtcPoolGetPoolLanguage(enum VTCLanguageCode lc)
+{
+    const PoolLanguage* language = vtcPoolFindLanguage(lc);
+    for (iso_u8 step = 0U; (language != nullptr) && (language->pool == nullptr) && (step < MultiStepLoad_LanguageCount); ++step)
+    {
+        // the chains are checked by the generator; a fallback out of range is the default language
+        language = (language->fallback < MultiStepLoad_LanguageCount) ? &MultiStepLoad_languages[language->fallback] : nullptr;
+    }
+
+    return ((language != nullptr) && (language->pool != nullptr)) ? language : nullptr;
+}
+
 extern "C"
 void vtcPoolGetPool(enum VTCLanguageCode lc, iso_u8** pData, iso_u32* pSize, iso_u16* pu16NumberObjects)
 {
@@ -159,39 +262,206 @@ void vtcPoolGetPool(enum VTCLanguageCode lc, iso_u8** pData, iso_u32* pSize, iso
     switch (lc)
     {
     case lcA3:
+#if (VTCPOOL_PRESPLIT_POOLS)
+        if (s_presplitPoolsValid)
+        {
+            data = (iso_u8*)MultiStepLoad_gAux;
+            size = sizeof(MultiStepLoad_gAux);
+            numberOfObjects = MultiStepLoad_gAux_NumObjs;
+            break;
+        }
+#endif
         data = s_gAuxPool.data();
         size = s_gAuxPool.size();
         break;
 
     case lcBase:
+#if (VTCPOOL_STAGED_UPLOAD)
+        {
+            // stage 0 contains the objects of the base pool and of the first stage
+            iso_u32 stageSize = 0U;
+            vtcPoolGetPoolStage(0U, &data, &stageSize, &numberOfObjects);
+            size = stageSize;
+        }
+#else
+#if (VTCPOOL_PRESPLIT_POOLS)
+        if (s_presplitPoolsValid)
+        {
+            data = (iso_u8*)MultiStepLoad_base;
+            size = sizeof(MultiStepLoad_base);
+            numberOfObjects = MultiStepLoad_base_NumObjs;
+            break;
+        }
+#endif
         data = s_basePool.data();
         size = s_basePool.size();
-        break;
-
-    case lcDE:
-    case lcSV:
-        data = (iso_u8*)MultiStepLoad_de_iop;
-        size = sizeof(MultiStepLoad_de_iop);
+#endif
         break;
 
     case lcEN:
     default:
-        data = s_secondaryPool.data();
-        size = s_secondaryPool.size();
+    {
+        const PoolLanguage* language = vtcPoolGetPoolLanguage(lc);
+        if (language != nullptr)
+        {
+            // delta pool; loaded after the secondary pool
+            data = (iso_u8*)language->pool;
+            size = language->size;
+            numberOfObjects = language->numObjs;
+        }
+#if (VTCPOOL_PRESPLIT_POOLS)
+        else if (s_presplitPoolsValid)
+        {
+            data = (iso_u8*)MultiStepLoad_secondary;
+            size = sizeof(MultiStepLoad_secondary);
+            numberOfObjects = MultiStepLoad_secondary_NumObjs;
+        }
+#endif
+        else
+        {
+            data = s_secondaryPool.data();
+            size = s_secondaryPool.size();
+        }
         break;
     }
+    }
+
+    if (numberOfObjects == 0U)
+    {
+        numberOfObjects = IsoGetNumofPoolObjs(data, static_cast<iso_s32>(size));
+    }
 
-    numberOfObjects = IsoGetNumofPoolObjs(data, static_cast<iso_s32>(size));
     *pData = data;
     *pSize = static_cast<iso_u32>(size);
     *pu16NumberObjects = numberOfObjects;
 }
 
+#if (VTCPOOL_STAGED_UPLOAD)
+iso_u8 vtcPoolGetStageCount(void)
+{
+#if (VTCPOOL_PRESPLIT_POOLS)
+    if (s_presplitPoolsValid)
+    {
+        return MultiStepLoad_StageCount;
+    }
+#endif
+    return static_cast<iso_u8>(s_stagePools.size());
+}
+
+void vtcPoolGetPoolStage(iso_u8 stage, iso_u8** pData, iso_u32* pSize, iso_u16* pu16NumberObjects)
+{
+    iso_u8* data = nullptr;
+    iso_u32 size = 0U;
+    iso_u16 numberOfObjects = 0U;
+    if (stage < vtcPoolGetStageCount())
+    {
+#if (VTCPOOL_PRESPLIT_POOLS)
+        if (s_presplitPoolsValid)
+        {
+            data = (iso_u8*)MultiStepLoad_stages[stage];
+            size = static_cast<iso_u32>(MultiStepLoad_stageSizes[stage]);
+            numberOfObjects = MultiStepLoad_stageNumObjs[stage];
+        }
+#endif
+        if (data == nullptr)
+        {
+            data = s_stagePools[stage].data();
+            size = static_cast<iso_u32>(s_stagePools[stage].size());
+            numberOfObjects = IsoGetNumofPoolObjs(data, static_cast<iso_s32>(size));
+        }
+    }
+
+    *pData = data;
+    *pSize = size;
+    *pu16NumberObjects = numberOfObjects;
+}
+#endif
+
 void vtcPoolGetPoolLabel(enum VTCLanguageCode lc, char* label)
 {
+    static const char base32[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
     memcpy(label, s_basePoolLabel, LENVERSIONSTR + 1);
     label[0] = (char)(lc >> 8);
     label[1] = (char)(lc);
+
+    // 13 * 5 bits; the first characters are part of the legacy label
+    uint64_t hash = vtcPoolGetPoolHash(lc);
+    for (iso_u8 idx = 2U; idx < 15U; ++idx)
+    {
+        label[idx] = base32[hash & 0x1FU];
+        hash >>= 5;
+    }
+}
+
+uint64_t vtcPoolGetPoolHash(enum VTCLanguageCode lc)
+{
+    iso_u8* poolData = nullptr;
+    iso_u32 poolSize = 0U;
+    iso_u16 u16NumberObjects = 0U;
+    if (!s_poolHashesValid)
+    {
+        // once at start-up; each label covers the pools being uploaded before it is stored.
+        vtcPoolGetPool(lcBase, &poolData, &poolSize, &u16NumberObjects);
+        s_baseHash = PreparePool::poolHash(PreparePool::poolHashOffsetBasis, poolData, poolSize);
+        s_secondaryHash = s_baseHash;
+#if (VTCPOOL_STAGED_UPLOAD)
+        for (iso_u8 stage = 1U; stage < vtcPoolGetStageCount(); ++stage)
+        {
+            vtcPoolGetPoolStage(stage, &poolData, &poolSize, &u16NumberObjects);
+            s_secondaryHash = PreparePool::poolHash(s_secondaryHash, poolData, poolSize);
+        }
+#else
+        vtcPoolGetPool(lcEN, &poolData, &poolSize, &u16NumberObjects);
+        s_secondaryHash = PreparePool::poolHash(s_secondaryHash, poolData, poolSize);
+#endif
+        vtcPoolGetPool(lcA3, &poolData, &poolSize, &u16NumberObjects);
+        s_gAuxHash = PreparePool::poolHash(PreparePool::poolHashOffsetBasis, poolData, poolSize);
+        s_poolHashesValid = true;
+    }
+
+    uint64_t hash = s_secondaryHash;
+    switch (lc)
+    {
+    case lcBase:
+        hash = s_baseHash;
+        break;
+
+    case lcA3:
+        hash = s_gAuxHash;
+        break;
+
+    case lcEN:
+        break;
+
+    default:
+        // the delta pool is loaded after the secondary pool
+        if (vtcPoolGetPoolLanguage(lc) != nullptr)
+        {
+            vtcPoolGetPool(lc, &poolData, &poolSize, &u16NumberObjects);
+            hash = PreparePool::poolHash(s_secondaryHash, poolData, poolSize);
+        }
+        break;
+    }
+
+    return hash;
+}
+
+bool vtcPoolIsCurrentLabel(const iso_u8* versionString, enum VTCLanguageCode lc)
+{
+    char label[LENVERSIONSTR + 1];
+    vtcPoolGetPoolLabel(lc, label);
+    bool qRet = (memcmp(label, versionString, s_legacyLabelLength) == 0);
+    for (iso_u8 idx = s_legacyLabelLength; (qRet) && (idx < LENVERSIONSTR); ++idx)
+    {
+        if (versionString[idx] != ' ')
+        {
+            // extended version label
+            qRet = (memcmp(label, versionString, LENVERSIONSTR) == 0);
+            break;
+        }
+    }
+
+    return qRet;
 }
 
 void vtcPoolSetPoolManipulation(void)
@@ -226,12 +496,31 @@ void vtcPoolSetPoolManipulation(void)
 
 iso_bool vtcPoolParsePool(void)
 {
+#if (VTCPOOL_PRESPLIT_POOLS)
+    // the size is checked at compile time; a pool edited without running tools/PoolSplitter
+    // is split here instead of uploading the content of the former pool.
+    s_presplitPoolsValid = (PreparePool::poolHash(PreparePool::poolHashOffsetBasis, isoOP_MultiStepLoad, ISO_OP_MultiStepLoad_Size)
+        == MultiStepLoad_split_SourceHash);
+    if (s_presplitPoolsValid)
+    {
+        return ISO_TRUE;
+    }
+
+    APP_LOG_ERROR(APP_LOG_MOD_POOL, "MultiStepLoad_split.c is outdated; the pool is split at start-up. Run tools/PoolSplitter\n");
+#endif
+
     //note: depending on the ISO Desigenr version the offset '1' is required.
     bool qRet = PreparePool::parsePool(isoOP_MultiStepLoad + 1, ISO_OP_MultiStepLoad_Size - 1,
         nullptr, 0,
         s_basePool,
         s_secondaryPool,
         s_gAuxPool);
+#if (VTCPOOL_STAGED_UPLOAD)
+    qRet = qRet && PreparePool::splitPool(isoOP_MultiStepLoad + 1, ISO_OP_MultiStepLoad_Size - 1,
+        nullptr, 0,
+        s_poolStages, sizeof(s_poolStages) / sizeof(s_poolStages[0]),
+        s_stagePools);
+#endif
 
 #if(0) // temporary variables for pool debugging  
     itemizePool((iso_u8*)x0000602a00840aa0_xxWHEPS_iop, sizeof(x0000602a00840aa0_xxWHEPS_iop), evalItems);
@@ -243,23 +532,23 @@ iso_bool vtcPoolParsePool(void)
 
     if (!qRet)
     {
-        iso_DebugPrint("pool parsing has failed.\n");
+        APP_LOG_ERROR(APP_LOG_MOD_POOL, "pool parsing has failed.\n");
     }
     else
     {
         if (s_basePool.empty())
         {
-            iso_DebugPrint("s_basePool is empty\n");
+            APP_LOG_WARN(APP_LOG_MOD_POOL, "s_basePool is empty\n");
         }
 
         if (s_secondaryPool.empty())
         {
-            iso_DebugPrint("s_secondaryPool is empty\n");
+            APP_LOG_WARN(APP_LOG_MOD_POOL, "s_secondaryPool is empty\n");
         }
 
         if (s_gAuxPool.empty())
         {
-            iso_DebugPrint("s_gAuxPool is empty\n");
+            APP_LOG_WARN(APP_LOG_MOD_POOL, "s_gAuxPool is empty\n");
         }
     }
 
@@ -269,7 +558,7 @@ iso_bool vtcPoolParsePool(void)
 void vtcSetVTLanguage(VTCPool* vt, VTCLanguageCode lc)
 {
     //    case IsoEvMaskLanguageCmd:
-    iso_DebugPrint("setVTLanguage %c%c\n", (char)(lc >> 8), (char)(lc));
+    APP_LOG_INFO(APP_LOG_MOD_POOL, "setVTLanguage %c%c\n", (char)(lc >> 8), (char)(lc));
     vt->m_vtLanguage = lc;
 }
 
@@ -280,18 +569,10 @@ VTCLanguageCode vtcPoolGetLanguageCode(const iso_u8* lc)
     {
         iso_u16 temp = static_cast<iso_u16>((lc[0] << 8) | lc[1]);
         languageCode = static_cast<VTCLanguageCode>(temp);
-        switch (languageCode)
+        if ((languageCode != lcBase) && (languageCode != lcA3) && (languageCode != lcEN)
+            && (vtcPoolFindLanguage(languageCode) == nullptr))
         {
-        case lcBase:
-        case lcA3:
-        case lcDE:
-        case lcEN:
-        case lcSV:
-            break;
-
-        default:
             languageCode = lcUndefined;
-            break;
         }
     }
 
@@ -301,24 +582,35 @@ VTCLanguageCode vtcPoolGetLanguageCode(const iso_u8* lc)
 void vtcPoolLoadHandler(VTCPool* vt)
 {
     vt->m_retryPoolLoad = false;
+#if (VTCPOOL_STAGED_UPLOAD)
+    if (vtcPoolLoadNextStage(vt))
+    {
+        // the secondary pool is incomplete; it is stored after its last stage.
+        return;
+    }
+#endif
+
     if (vt->m_transferLanguage != lcUndefined)
     {
         if (vtcContainsLanguage(vt, vt->m_transferLanguage) == false)      
         {
             //TODO: this fails if being called through case "IsoEvMaskActivated"
             //      it works when being called through case "IsoEvMaskPoolReloadFinished" or "IsoEvAuxActivated"
-            char actPoolLabel[LENVERSIONSTR + 1] = "xxWHEPS                         ";  // 7 characters filled with blanks
-            actPoolLabel[0] = (char)(vt->m_transferLanguage >> 8);
-            actPoolLabel[1] = (char)(vt->m_transferLanguage);
+            char actPoolLabel[LENVERSIONSTR + 1];
+            vtcPoolGetPoolLabel(vt->m_transferLanguage, actPoolLabel);
             if (vt->m_activeLanguage != lcUndefined)
             {
                 // pool has not been stored through initial load
                 IsoCmd_NumericValueRef(OutputNumber_12000, 0);
                 IsoStoreVersion((iso_u8*)actPoolLabel);
+                vtcPoolTelemetryEvent(vt, vtcEvStoreVersion, 0U, 0U);
             }
 
-            vt->m_storedLanguages[vt->m_countStoredLanguages++] = vt->m_transferLanguage;
-            iso_DebugPrint("poolLoadHandler: store pool %s\n", actPoolLabel);
+            if (!vtcAddStoredLanguage(vt, vt->m_transferLanguage))
+            {
+                APP_LOG_WARN(APP_LOG_MOD_POOL, "poolLoadHandler: too many stored pools\n");
+            }
+            APP_LOG_INFO(APP_LOG_MOD_POOL, "poolLoadHandler: store pool %s\n", actPoolLabel);
         }
 
         vt->m_activeLanguage = vt->m_transferLanguage;
@@ -330,7 +622,9 @@ void vtcPoolLoadHandler(VTCPool* vt)
     {
         // no further pool upload; change to active mask.
         iso_s16 s16Err = IsoCmd_ActiveMask(0, 1001);  /* Test of relaoded objects */
-        iso_DebugPrint("poolLoadHandler: change active mask %d 1001\n", s16Err);
+        APP_LOG_DEBUG(APP_LOG_MOD_POOL, "poolLoadHandler: change active mask %d 1001\n", s16Err);
+        vtcPoolTelemetryEvent(vt, vtcEvMaskActivated, 0U, 0U);
+        vtcPoolTelemetryPrint(vt);
     }
     else
     {
@@ -348,22 +642,199 @@ void vtcPoolLoadHandler(VTCPool* vt)
             vt->m_transferLanguage = lcBase;
         }
 
-        iso_u8* poolData = nullptr;
-        iso_u32 poolSize = 0;
-        iso_u16 u16NumberObjects = 0U;
-        vtcPoolGetPool(vt->m_transferLanguage, &poolData, &poolSize, &u16NumberObjects);
-        iso_bool success = IsoPoolReload(poolData, u16NumberObjects);
-        iso_DebugPrint("poolLoadHandler, IsoPoolReload: %d = %x %d %d\n", success, vt->m_transferLanguage, poolSize, u16NumberObjects);
-        if (success == ISO_FALSE)
+#if (VTCPOOL_STAGED_UPLOAD)
+        if ((vt->m_transferLanguage == lcEN) && (vtcPoolGetStageCount() > 1U))
         {
-            vt->m_transferLanguage = lcUndefined;
-            vt->m_retryPoolLoad = true;
-            iso_DebugPrint("poolReload -- failed:\n");
+            // stage 0 has been uploaded as base pool
+            vt->m_transferStage = 1U;
+            (void)vtcPoolLoadNextStage(vt);
         }
         else
+#endif
+        {
+            iso_u8* poolData = nullptr;
+            iso_u32 poolSize = 0;
+            iso_u16 u16NumberObjects = 0U;
+            vtcPoolGetPool(vt->m_transferLanguage, &poolData, &poolSize, &u16NumberObjects);
+            iso_bool success = IsoPoolReload(poolData, u16NumberObjects);
+            APP_LOG_INFO(APP_LOG_MOD_POOL, "poolLoadHandler, IsoPoolReload: %d = %x %d %d\n", success, vt->m_transferLanguage, poolSize, u16NumberObjects);
+            if (success == ISO_FALSE)
+            {
+                vtcPoolTelemetryEvent(vt, vtcEvPoolReloadFailed, poolSize, u16NumberObjects);
+                vt->m_transferLanguage = lcUndefined;
+                vt->m_retryPoolLoad = true;
+                APP_LOG_ERROR(APP_LOG_MOD_POOL, "poolReload -- failed:\n");
+            }
+            else
+            {
+                vtcPoolTelemetryEvent(vt, vtcEvPoolReload, poolSize, u16NumberObjects);
+                vtcPoolSetPoolManipulation();
+                APP_LOG_INFO(APP_LOG_MOD_POOL, "poolReload -- next pool: %x\n", vt->m_transferLanguage);// << u16NumberObjects << iso_BaseGetTimeMs();
+            }
+        }
+    }
+}
+
+#if (VTCPOOL_STAGED_UPLOAD)
+// Returns ISO_TRUE as long as stages of the secondary pool are pending.
+iso_bool vtcPoolLoadNextStage(VTCPool* vt)
+{
+    iso_bool qPending = ISO_FALSE;
+    if (vt->m_transferStage != 0U)
+    {
+        if (vt->m_transferStage < vtcPoolGetStageCount())
+        {
+            iso_u8* poolData = nullptr;
+            iso_u32 poolSize = 0;
+            iso_u16 u16NumberObjects = 0U;
+            vtcPoolGetPoolStage(vt->m_transferStage, &poolData, &poolSize, &u16NumberObjects);
+            iso_bool success = IsoPoolReload(poolData, u16NumberObjects);
+            APP_LOG_INFO(APP_LOG_MOD_POOL, "poolLoadHandler, IsoPoolReload stage %d: %d = %d %d\n", vt->m_transferStage, success, poolSize, u16NumberObjects);
+            if (success == ISO_FALSE)
+            {
+                // retry this stage in next cycle
+                vtcPoolTelemetryEvent(vt, vtcEvPoolReloadFailed, poolSize, u16NumberObjects);
+                vt->m_retryPoolLoad = true;
+                APP_LOG_ERROR(APP_LOG_MOD_POOL, "poolReload -- failed:\n");
+            }
+            else
+            {
+                vtcPoolTelemetryEvent(vt, vtcEvPoolReload, poolSize, u16NumberObjects);
+                vtcPoolSetPoolManipulation();
+                vt->m_transferStage++;
+            }
+
+            qPending = ISO_TRUE;
+        }
+        else
+        {
+            // all stages have been uploaded
+            vt->m_transferStage = 0U;
+        }
+    }
+
+    return qPending;
+}
+#endif
+
+void vtcPoolTelemetryEvent(VTCPool* vt, enum VTCPoolEvent event, iso_u32 bytes, iso_u16 objects)
+{
+    // entries kept free for the steps completing the upload: the last reload finished,
+    // IsoStoreVersion and the mask activation are recorded even if a long upload fills entries.
+    static const iso_u8 reservedEntries[] = { 3U, 3U, 3U, 3U, 2U, 1U, 0U };
+    static_assert((sizeof(reservedEntries) / sizeof(reservedEntries[0])) == (vtcEvMaskActivated + 1),
+        "one entry of reservedEntries per VTCPoolEvent");
+    VTCPoolTelemetry* telemetry = &vt->m_telemetry;
+    if (event == vtcEvPoolReloadFailed)
+    {
+        // retried in each cycle; counted only and recorded with the next step
+        telemetry->retries++;
+        if (telemetry->pendingRetries < 0xFFU)
+        {
+            telemetry->pendingRetries++;
+        }
+        return;
+    }
+
+    if ((telemetry->count + reservedEntries[event]) < VTCPOOL_TELEMETRY_ENTRIES)
+    {
+        VTCPoolTelemetryEntry* entry = &telemetry->entries[telemetry->count++];
+        entry->timeMs = static_cast<iso_u32>(iso_BaseGetTimeMs());
+        entry->event = event;
+        entry->language = (vt->m_transferLanguage != lcUndefined) ? vt->m_transferLanguage : vt->m_activeLanguage;
+        entry->stage = vt->m_transferStage;
+        if ((event == vtcEvPoolReloadFinished) && (entry->stage != 0U))
+        {
+            // m_transferStage already refers to the next stage
+            entry->stage--;
+        }
+        entry->retries = telemetry->pendingRetries;
+        entry->objects = objects;
+        entry->bytes = bytes;
+    }
+    else
+    {
+        telemetry->dropped++;
+    }
+
+    telemetry->pendingRetries = 0U;
+}
+
+const VTCPoolTelemetry* vtcPoolGetTelemetry(const VTCPool* vt)
+{
+    return &vt->m_telemetry;
+}
+
+iso_u32 vtcPoolTelemetryCsv(const VTCPool* vt, char* buffer, iso_u32 bufferSize)
+{
+    const VTCPoolTelemetry* telemetry = &vt->m_telemetry;
+    iso_u32 length = 0U;
+    if ((buffer != nullptr) && (bufferSize > sizeof(s_telemetryCsvHeader)))
+    {
+        memcpy(buffer, s_telemetryCsvHeader, sizeof(s_telemetryCsvHeader));
+        length = sizeof(s_telemetryCsvHeader) - 1U;
+        for (iso_u8 idx = 0U; idx < telemetry->count; ++idx)
+        {
+            // only complete lines are written
+            iso_u32 lineLength = vtcPoolTelemetryCsvLine(&telemetry->entries[idx], telemetry->entries[0].timeMs,
+                &buffer[length], bufferSize - length);
+            if (lineLength == 0U)
+            {
+                break;
+            }
+
+            length += lineLength;
+        }
+    }
+
+    return length;
+}
+
+iso_u32 vtcPoolTelemetryCsvLine(const VTCPoolTelemetryEntry* entry, iso_u32 startMs, char* buffer, iso_u32 bufferSize)
+{
+    static const char* const eventNames[] =
+    {
+        "LoadObjects", "PoolActivated", "PoolReload", "PoolReloadFailed", "PoolReloadFinished", "StoreVersion", "MaskActivated"
+    };
+
+    const char* eventName = (static_cast<iso_u32>(entry->event) < (sizeof(eventNames) / sizeof(eventNames[0])))
+        ? eventNames[entry->event] : "?";
+    char language[3] = { (char)(entry->language >> 8), (char)(entry->language), '\0' };
+    if (entry->language == lcUndefined)
+    {
+        language[0] = '-';
+        language[1] = '-';
+    }
+
+    int length = snprintf(buffer, bufferSize, "%lu,%lu,%s,%s,%u,%lu,%u,%u\n",
+        static_cast<unsigned long>(entry->timeMs), static_cast<unsigned long>(entry->timeMs - startMs),
+        eventName, language, static_cast<unsigned>(entry->stage), static_cast<unsigned long>(entry->bytes),
+        static_cast<unsigned>(entry->objects), static_cast<unsigned>(entry->retries));
+    if ((length < 0) || (static_cast<iso_u32>(length) >= bufferSize))
+    {
+        // truncated; the caller stops at the previous line
+        buffer[0] = '\0';
+        length = 0;
+    }
+
+    return static_cast<iso_u32>(length);
+}
+
+void vtcPoolTelemetryPrint(const VTCPool* vt)
+{
+    const VTCPoolTelemetry* telemetry = &vt->m_telemetry;
+    char line[96];
+    if (!APP_LOG_ENABLED(APP_LOG_MOD_POOL, APP_LOG_LEVEL_INFO))
+    {
+        return;
+    }
+    APP_LOG_INFO(APP_LOG_MOD_POOL, "poolTelemetry: retries %u, dropped %u\n", telemetry->retries, telemetry->dropped);
+    APP_LOG_INFO(APP_LOG_MOD_POOL, "%s", s_telemetryCsvHeader);
+    for (iso_u8 idx = 0U; idx < telemetry->count; ++idx)
+    {
+        if (vtcPoolTelemetryCsvLine(&telemetry->entries[idx], telemetry->entries[0].timeMs, line, sizeof(line)) > 0U)
         {
-            vtcPoolSetPoolManipulation();
-            iso_DebugPrint("poolReload -- next pool: %x\n", vt->m_transferLanguage);// << u16NumberObjects << iso_BaseGetTimeMs();
+            APP_LOG_INFO(APP_LOG_MOD_POOL, "%s", line);
         }
     }
 }
@@ -381,6 +852,8 @@ void vtcPoolClear(VTCPool* vt)
     }
 
     vt->m_countStoredLanguages = 0;
+    vt->m_transferStage = 0U;                          // next stage of the secondary pool to be transferred
     vt->m_retryPoolLoad = false;                       // set if IsoPoolReload() has failed; retry in next cycle.
     vt->initialized = false;                                // true: structure / class is properly initialized.
+    // m_telemetry is kept for diagnosis after a connection loss; it is reset by vtcPoolInit()
 }
@@ -3,16 +3,49 @@
 #include "IsoDef.h"
 
 /* https://de.wikipedia.org/wiki/Liste_der_ISO-639-1-Codes */
+/* Further languages are any ISO 639-1 codes of the language table MultiStepLoad_lang.h. */
 enum VTCLanguageCode
 {
     lcUndefined = 0,
     lcBase = (('x' << 8) + 'x'),  // initial loader language
     lcEN =   (('e' << 8) + 'n'),  // default pool language
-    lcDE =   (('d' << 8) + 'e'),  // german language
-    lcSV =   (('s' << 8) + 'v'),  // swedish language
     lcA3 =   (('A' << 8) + '3')   // pool to be used for aux and CCI-A3
 };
 
+#define VTCPOOL_TELEMETRY_ENTRIES 32u    // number of recorded steps per pool upload
+
+/* Steps of a (multi-step) pool upload */
+enum VTCPoolEvent
+{
+    vtcEvLoadObjects = 0,   // IsoEvMaskLoadObjects / IsoEvAuxLoadObjects; initial pool passed to IsoPoolInit()
+    vtcEvPoolActivated,     // IsoEvMaskActivated / IsoEvAuxActivated
+    vtcEvPoolReload,        // IsoPoolReload() has been accepted
+    vtcEvPoolReloadFailed,  // IsoPoolReload() has been rejected; retried in the next cycle; counted, not recorded
+    vtcEvPoolReloadFinished,// IsoEvMaskPoolReloadFinished / IsoEvAuxPoolReloadFinished
+    vtcEvStoreVersion,      // IsoStoreVersion()
+    vtcEvMaskActivated      // final pool is active; working mask has been activated
+};
+
+struct VTCPoolTelemetryEntry
+{
+    iso_u32 timeMs;                         // iso_BaseGetTimeMs()
+    enum VTCPoolEvent event;
+    enum VTCLanguageCode language;          // pool label being transferred
+    iso_u8 stage;                           // stage of the secondary pool; 0: none
+    iso_u8 retries;                         // failed attempts preceding this step
+    iso_u16 objects;                        // number of objects being uploaded
+    iso_u32 bytes;                          // number of bytes being uploaded
+};
+
+struct VTCPoolTelemetry
+{
+    struct VTCPoolTelemetryEntry entries[VTCPOOL_TELEMETRY_ENTRIES];
+    iso_u8 count;                           // number of valid entries
+    iso_u8 pendingRetries;                  // failed attempts since the last recorded step
+    iso_u16 retries;                        // failed attempts of the whole upload
+    iso_u16 dropped;                        // steps not recorded; entries is full
+};
+
 struct VTCPool
 {
     enum VTCLanguageCode m_firstLanguage;                   // pool label being transferred first
@@ -22,8 +55,10 @@ struct VTCPool
     enum VTCLanguageCode m_vtLanguage;                      // VT Language
     enum VTCLanguageCode m_storedLanguages[POOLVERSIONS];   // list of stored labels on VT
     iso_u8 m_countStoredLanguages;                          // number of pools stored in VT
+    iso_u8 m_transferStage;                                 // next stage of the secondary pool to be transferred; 0: none
     iso_bool m_retryPoolLoad;                               // set if IsoPoolReload() has failed; retry in next cycle.
     iso_bool initialized;                                   // true: struct is properly initialized.
+    struct VTCPoolTelemetry m_telemetry;                    // steps of the last pool upload; kept until the next vtcPoolInit()
 };
 
 #ifdef __cplusplus
@@ -40,11 +75,22 @@ void vtcPoolInit(struct VTCPool* vtcPool,                       // This function
 iso_bool vtcPoolUpdateVtLanguage(struct VTCPool* vt, enum VTCLanguageCode lc);
 
 void vtcPoolGetPool(enum VTCLanguageCode lc, iso_u8** pData, iso_u32* pSize, iso_u16* pu16NumberObjects);
+iso_u8 vtcPoolGetStageCount(void);                              // number of upload stages (VTCPOOL_STAGED_UPLOAD)
+void vtcPoolGetPoolStage(iso_u8 stage, iso_u8** pData, iso_u32* pSize, iso_u16* pu16NumberObjects);
 void vtcPoolGetPoolLabel(enum VTCLanguageCode lc, char* label);
 void vtcPoolSetPoolManipulation(void);
 enum VTCLanguageCode vtcPoolGetLanguageCode(const iso_u8* lcLabel);
 
 void vtcPoolLoadHandler(struct VTCPool* vtcPool);               // This module processes the loading of the pools.
+
+void vtcPoolTelemetryEvent(struct VTCPool* vtcPool,             // This records a step of the pool upload.
+    enum VTCPoolEvent event,
+    iso_u32 bytes,
+    iso_u16 objects);
+const struct VTCPoolTelemetry* vtcPoolGetTelemetry(const struct VTCPool* vtcPool);
+iso_u32 vtcPoolTelemetryCsv(const struct VTCPool* vtcPool,      // This writes the recorded steps as CSV; returns the length.
+    char* buffer,
+    iso_u32 bufferSize);
                                                                 
 #ifdef __cplusplus
 }
@@ -0,0 +1,20 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief      Linux entry point; app_main() is the ESP-IDF entry point of App_Main.c
+   \details    app_main() returns after CTRL+C; hw_CanClose() prints the CAN statistics.
+*/
+/* ************************************************************************ */
+
+#include "AppCommon/AppHW.h"
+
+void app_main(void);
+
+int main(void)
+{
+   app_main();
+   hw_CanClose();
+   return 0;
+}
+
+/* ************************************************************************ */
@@ -9,186 +9,141 @@
 #include <windows.h>
 #include <stdio.h>
 #include <stdint.h>
-#include "settings.h"
+#include <string.h>
+#include "settingsBackend.h"
+#include "AppLog.h"
 
 /* ************************************************************************ */
 
 static const char FILENAME[] = ".\\settings.ini";
 #define MAXSTRLEN      1024U
+#define MAXBLOBLEN     512U     /* largest blob of getBlob(); stored as 2 * MAXBLOBLEN hexadecimal digits */
 
 /* ************************************************************************ */
 
-int8_t getS8(const char section[], const char key[], const int8_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT8_MAX) || (ret < INT8_MIN)) ? defaultValue : (int8_t)(ret);
-}
-
-int16_t getS16(const char section[], const char key[], const int16_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT16_MAX) || (ret < INT16_MIN)) ? defaultValue : (int16_t)(ret);
-}
-
-int32_t getS32(const char section[], const char key[], const int32_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT32_MAX) || (ret < INT32_MIN)) ? defaultValue : (int32_t)(ret);
-}
-
-int64_t getS64(const char section[], const char key[], const int64_t defaultValue)
+uint8_t settingsBackendGetS64(const char section[], const char key[], int64_t* value)
 {
    char buffer[MAXSTRLEN];
-   int64_t ret = defaultValue;
    uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
    if (charCount == 0U)
    {
-      sprintf_s(buffer, sizeof(buffer), "%I64d", defaultValue);
-      WritePrivateProfileStringA(section, key, buffer, FILENAME);
-   }
-   else
-   {
-      ret = _strtoi64(buffer, NULL, 10);
+      return 0U;
    }
 
-   return ret;
-}
-
-uint8_t getU8(const char section[], const char key[], const uint8_t defaultValue)
-{
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT8_MAX) ? defaultValue : (uint8_t)(ret);
+   *value = _strtoi64(buffer, NULL, 10);
+   return 1U;
 }
 
-uint16_t getU16(const char section[], const char key[], const uint16_t defaultValue)
-{
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT16_MAX) ? defaultValue : (uint16_t)(ret);
-}
-
-uint32_t getU32(const char section[], const char key[], const uint32_t defaultValue)
-{
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT32_MAX) ? defaultValue : (uint32_t)(ret);
-}
-
-uint64_t getU64(const char section[], const char key[], const uint64_t defaultValue)
+uint8_t settingsBackendGetU64(const char section[], const char key[], uint64_t* value, uint8_t hex)
 {
    char buffer[MAXSTRLEN];
-   uint64_t ret = defaultValue;
    uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
    if (charCount == 0U)
    {
-      sprintf_s(buffer, sizeof(buffer), "%I64d", defaultValue);
-      WritePrivateProfileStringA(section, key, buffer, FILENAME);
-   }
-   else
-   {
-      ret = _strtoui64(buffer, NULL, 10);
+      return 0U;
    }
 
-   return ret;
+   *value = _strtoui64(buffer, NULL, (hex != 0U) ? 16 : 10);
+   return 1U;
 }
 
-uint64_t getX64(const char section[], const char key[], const uint64_t defaultValue)
+uint8_t settingsBackendGetString(const char section[], const char key[], char value[], size_t size)
 {
-   char buffer[MAXSTRLEN];
-   uint64_t ret = defaultValue;
-   uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
-   if (charCount == 0U)
-   {
-      sprintf_s(buffer, sizeof(buffer), "%I64x", defaultValue);
-      WritePrivateProfileStringA(section, key, buffer, FILENAME);
-   }
-   else
-   {
-      ret = _strtoui64(buffer, NULL, 16);
-   }
-
-   return ret;
+   return (GetPrivateProfileStringA(section, key, NULL, value, (DWORD)size, FILENAME) != 0U) ? 1U : 0U;
 }
 
-void getString(const char section[], const char key[], const char defaultValue[], char caption[], size_t size)
+uint8_t settingsBackendGetBlob(const char section[], const char key[], void* data, size_t size, size_t* storedSize)
 {
-   static char buffer[MAXSTRLEN];
-   uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
-   if (charCount == 0U)
-   {
-      WritePrivateProfileStringA(section, key, defaultValue, FILENAME);
-      strcpy_s(caption, size, defaultValue);
-   }
-   else
+   /* one character more than the text of the largest blob, so that a longer text is rejected */
+   char buffer[(2U * MAXBLOBLEN) + 2U];
+   if ((settingsBackendGetString(section, key, buffer, sizeof(buffer)) == 0U) || (strlen(buffer) > (2U * size)))
    {
-      strcpy_s(caption, size, buffer);
+      return 0U;
    }
-}
-
-void setS8(const char section[], const char key[], const int8_t value)
-{
-   setS64(section, key, value);
-}
-
-void setS16(const char section[], const char key[], const int16_t value)
-{
-   setS64(section, key, value);
-}
 
-void setS32(const char section[], const char key[], const int32_t value)
-{
-   setS64(section, key, value);
+   *storedSize = blobFromText(buffer, data, size);
+   return (*storedSize != 0U) ? 1U : 0U;
 }
 
-void setS64(const char section[], const char key[], const int64_t value)
+void settingsBackendSetS64(const char section[], const char key[], int64_t value)
 {
    char buffer[MAXSTRLEN];
    sprintf_s(buffer, sizeof(buffer), "%I64d", value);
    WritePrivateProfileStringA(section, key, buffer, FILENAME);
 }
 
-void setU8(const char section[], const char key[], const uint8_t value)
+void settingsBackendSetU64(const char section[], const char key[], uint64_t value, uint8_t hex)
 {
-    setU64(section, key, value);
+   char buffer[MAXSTRLEN];
+   sprintf_s(buffer, sizeof(buffer), (hex != 0U) ? "%I64x" : "%I64u", value);
+   WritePrivateProfileStringA(section, key, buffer, FILENAME);
 }
 
-void setU16(const char section[], const char key[], const uint16_t value)
+void settingsBackendSetBlob(const char section[], const char key[], const void* data, size_t size)
 {
-    setU64(section, key, value);
+   char buffer[(2U * MAXBLOBLEN) + 1U];
+   if (size > MAXBLOBLEN)
+   {
+      APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "setBlob(%s, %s): %u bytes, at most %u\n", section, key, (unsigned)size, MAXBLOBLEN);
+      return;
+   }
+   (void)blobToText(data, size, buffer, sizeof(buffer));
+   settingsBackendSetString(section, key, buffer);
 }
 
-void setU32(const char section[], const char key[], const uint32_t value)
+void settingsBackendSetString(const char section[], const char key[], const char value[])
 {
-    setU64(section, key, value);
+   // key NULL erases the complete section, value NULL the key
+   WritePrivateProfileStringA(section, key, value, FILENAME);
 }
 
-void setU64(const char section[], const char key[], const uint64_t value)
+size_t settingsBackendGetSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context)
 {
-    char buffer[MAXSTRLEN];
-    sprintf_s(buffer, sizeof(buffer), "%I64u", value);
-    WritePrivateProfileStringA(section, key, buffer, FILENAME);
-}
+   DWORD size = MAXSTRLEN;
+   DWORD sectionChars = 0U;
+   char* buffer = NULL;
+   char* entry;
+   size_t calls = 0U;
 
-void setX64(const char section[], const char key[], const uint64_t value)
-{
-    char buffer[MAXSTRLEN];
-    sprintf_s(buffer, sizeof(buffer), "%I64x", value);
-    WritePrivateProfileStringA(section, key, buffer, FILENAME);
-}
+   do
+   {  // GetPrivateProfileSectionA() returns size - 2 if the buffer is too small
+      size *= 2U;
+      free(buffer);
+      buffer = (char*)malloc(size);
+      if (buffer == NULL)
+      {
+         return 0U;
+      }
+      sectionChars = GetPrivateProfileSectionA(section, buffer, size, FILENAME);
+   } while (sectionChars == (size - 2U));
 
-void setString(const char section[], const char key[], const char value[])
-{
-    WritePrivateProfileStringA(section, key, value, FILENAME);
+   for (entry = buffer; *entry != '\0'; entry += strlen(entry) + 1U)
+   {
+      char* equal = strchr(entry, '=');
+      if (equal != NULL)
+      {
+         *equal = '\0';
+         calls++;
+         if (entryCb(entry, equal + 1, context) == 0U)
+         {
+            break;
+         }
+         *equal = '=';   // strlen() of the next step
+      }
+   }
+
+   free(buffer);
+   return calls;
 }
 
-size_t getSection(const char section[], char string[], size_t stringSize)
+void settingsBackendFlush(void)
 {
-   size_t sectionChars = (size_t)GetPrivateProfileSectionA(section, string, (DWORD)stringSize, FILENAME);
-   return sectionChars;
+   // WritePrivateProfileStringA() writes the file at once
 }
 
-void clearSection(const char section[])
+uint8_t settingsBackendWritesDefaults(void)
 {
-   // erase complete section
-   WritePrivateProfileStringA(section, NULL, NULL, FILENAME);
+   return 1U;
 }
 
 /* ************************************************************************ */
@@ -39,9 +39,28 @@ extern "C" {
     void setX64(const char section[], const char key[], const uint64_t value);
     void setString(const char section[], const char key[], const char value[]);
 
+    /*! \brief Reads binary data (at most 512 bytes); copies at most size bytes; returns the stored size, 0: not stored */
+    size_t getBlob(const char section[], const char key[], void* data, size_t size);
+    /*! \brief Writes binary data; removed with setString(section, key, NULL) */
+    void   setBlob(const char section[], const char key[], const void* data, size_t size);
+
+    /*! \brief Binary data as hexadecimal text (value of a blob in getSectionEntries()); returns the characters */
+    size_t blobToText(const void* data, size_t size, char text[], size_t textSize);
+    /*! \brief Hexadecimal text to binary data; returns the bytes, 0: invalid text or data[] too small */
+    size_t blobFromText(const char text[], void* data, size_t size);
+
+    /*! \brief Called by getSectionEntries() for each key of the section; return 0 stops the iteration */
+    typedef uint8_t (*SettingsEntryCb_t)(const char key[], const char value[], void* context);
+
+    /*! \brief "key=value\0" entries terminated by an additional '\0'; as many complete entries as fit */
     size_t getSection(const char section[], char string[], size_t stringSize);
+    /*! \brief Calls entryCb for each key of the section with the value as text; returns the number of calls */
+    size_t getSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context);
     void   clearSection(const char section[]);
 
+    /*! \brief Writes modified settings to the storage now (backends with write-behind, e.g. settingsGlib.cpp) */
+    void   settingsFlush(void);
+
 /* ************************************************************************ */
 #ifdef __cplusplus
 } /* extern "C" { */
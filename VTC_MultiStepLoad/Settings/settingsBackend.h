@@ -0,0 +1,63 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief       Storage of the settings behind the cache of settingsCache.cpp.
+
+   \details     Implemented by settings.c (Windows), settingsGlib.cpp (Linux),
+                settingsNVS.cpp (ESP32), settingsVoid.cpp and the VT simulator.
+                The functions of settings.h are implemented once in settingsCache.cpp;
+                it calls the backend only for values which are not cached yet and for
+                values which have changed.
+                settingsBackendGetSectionEntries() enumerates a section: glib
+                g_key_file_get_keys(), NVS nvs_entry_find() in the namespace of the section,
+                Windows GetPrivateProfileSectionA() with a growing heap buffer. getSection()
+                writes the entries directly into the buffer of the caller.
+*/
+/* ************************************************************************ */
+
+#ifndef DEF_SETTINGS_BACKEND_H
+#define DEF_SETTINGS_BACKEND_H
+
+#include <stdint.h>
+#include <stdlib.h>   // required for 'size_t'
+#include "settings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* ************************************************************************ */
+
+    /*! \brief Reads a value; return 0: not stored */
+    uint8_t settingsBackendGetS64(const char section[], const char key[], int64_t* value);
+    /*! \brief Reads a value; hex 1: stored as hexadecimal text (getX64()); return 0: not stored */
+    uint8_t settingsBackendGetU64(const char section[], const char key[], uint64_t* value, uint8_t hex);
+    /*! \brief Reads a string with '\0' into value[size]; return 0: not stored */
+    uint8_t settingsBackendGetString(const char section[], const char key[], char value[], size_t size);
+    /*! \brief Reads binary data into data[size]; *storedSize: size of the stored data; return 0: not stored
+               or larger than size. Text backends store blobToText(). */
+    uint8_t settingsBackendGetBlob(const char section[], const char key[], void* data, size_t size, size_t* storedSize);
+
+    void settingsBackendSetS64(const char section[], const char key[], int64_t value);
+    void settingsBackendSetU64(const char section[], const char key[], uint64_t value, uint8_t hex);
+    /*! \brief Writes binary data; the text backends reject more than 512 bytes (getBlob()) */
+    void settingsBackendSetBlob(const char section[], const char key[], const void* data, size_t size);
+    /*! \brief Writes a string; value NULL: removes the key; key NULL: removes the section */
+    void settingsBackendSetString(const char section[], const char key[], const char value[]);
+
+    /*! \brief Calls entryCb for each key of the section (getSectionEntries()); the backend
+               does not hold a lock during the call, entryCb may call the settings functions */
+    size_t settingsBackendGetSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context);
+    /*! \brief Writes pending changes to the storage; called without the lock of the cache,
+               concurrently with the other backend functions */
+    void settingsBackendFlush(void);
+
+    /*! \brief 1: a missing value is written with its default (editable settings files) */
+    uint8_t settingsBackendWritesDefaults(void);
+
+/* ************************************************************************ */
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* DEF_SETTINGS_BACKEND_H */
+/* ************************************************************************ */
@@ -0,0 +1,495 @@
+/* ************************************************************************ */
+/*!
+   \file
+   \brief       Typed cache of the settings in front of the backend (settingsBackend.h).
+
+   \details     Each value is read once from the backend and kept with the type of the
+                get or set function (signed, unsigned, hexadecimal, string); later reads
+                are a hash table lookup without text conversion. A missing value is
+                cached as missing, or written with its default if the backend keeps
+                defaults (settings.ini). A set function writes to the backend only if the
+                value differs from the cached one; the backend batches the writes to the
+                storage (settingsFlush()).
+                Reading a value with another type than cached reads it again from the
+                backend, e.g. getU8() after setString() of the same key.
+                tools/SettingsBenchmark compares the time per call of the cached functions
+                with the backend functions for the glib, simulator and NVS mock backends.
+*/
+/* ************************************************************************ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "settings.h"
+#include "settingsBackend.h"
+
+/* ************************************************************************ */
+
+#define MAXSTRLEN      1024U
+#define MAXBLOBLEN     512U
+
+typedef enum
+{
+   SETTINGS_NONE = 0,      /* not cached (section cleared) */
+   SETTINGS_S64,
+   SETTINGS_U64,
+   SETTINGS_X64,
+   SETTINGS_STRING,
+   SETTINGS_BLOB
+} SettingsType_e;
+
+struct SettingsEntry
+{
+   std::string section;
+   std::string key;
+   uint32_t hash;
+   SettingsType_e type;
+   bool stored;            /* false: missing in the backend */
+   uint64_t value;         /* S64 (two's complement), U64, X64 */
+   std::string text;       /* STRING; BLOB: the bytes */
+};
+
+static std::mutex s_cacheMutex;
+static std::vector<SettingsEntry> s_entries;
+static std::vector<int32_t> s_slots;      /* open addressing: index of s_entries or -1 */
+
+/* ************************************************************************ */
+
+/* FNV-1a of section, a separator and key */
+static uint32_t settingsHash(const char section[], const char key[])
+{
+   uint32_t hash = 2166136261UL;
+   for (const char* pc = section; *pc != '\0'; pc++)
+   {
+      hash = (hash ^ (uint8_t)*pc) * 16777619UL;
+   }
+   hash = (hash ^ 0xFFU) * 16777619UL;
+   for (const char* pc = key; *pc != '\0'; pc++)
+   {
+      hash = (hash ^ (uint8_t)*pc) * 16777619UL;
+   }
+   return hash;
+}
+
+static void settingsRehash(size_t slotCount)
+{
+   s_slots.assign(slotCount, -1);
+   for (size_t idx = 0U; idx < s_entries.size(); idx++)
+   {
+      size_t slot = s_entries[idx].hash & (slotCount - 1U);
+      while (s_slots[slot] >= 0)
+      {
+         slot = (slot + 1U) & (slotCount - 1U);
+      }
+      s_slots[slot] = (int32_t)idx;
+   }
+}
+
+/* entry of section and key; a new entry has the type SETTINGS_NONE */
+static SettingsEntry* settingsEntry(const char section[], const char key[])
+{
+   uint32_t hash = settingsHash(section, key);
+   if (s_slots.empty())
+   {
+      settingsRehash(64U);
+   }
+
+   size_t slot = hash & (s_slots.size() - 1U);
+   while (s_slots[slot] >= 0)
+   {
+      SettingsEntry* entry = &s_entries[(size_t)s_slots[slot]];
+      if ((entry->hash == hash) && (entry->key == key) && (entry->section == section))
+      {
+         return entry;
+      }
+      slot = (slot + 1U) & (s_slots.size() - 1U);
+   }
+
+   SettingsEntry newEntry = { section, key, hash, SETTINGS_NONE, false, 0U, std::string() };
+   s_entries.push_back(newEntry);
+   if ((s_entries.size() * 2U) > s_slots.size())
+   {  /* load factor 0.5 */
+      settingsRehash(s_slots.size() * 2U);
+   }
+   else
+   {
+      s_slots[slot] = (int32_t)(s_entries.size() - 1U);
+   }
+   return &s_entries.back();
+}
+
+/* cached integer of the type; reads the backend on a miss */
+static SettingsEntry* settingsGetInteger(const char section[], const char key[], SettingsType_e type, uint64_t defaultValue)
+{
+   SettingsEntry* entry = settingsEntry(section, key);
+   if (entry->type == type)
+   {
+      return entry;
+   }
+
+   if (type == SETTINGS_S64)
+   {
+      int64_t value = 0;
+      entry->stored = (settingsBackendGetS64(section, key, &value) != 0U);
+      entry->value = (uint64_t)value;
+   }
+   else
+   {
+      entry->stored = (settingsBackendGetU64(section, key, &entry->value, (type == SETTINGS_X64) ? 1U : 0U) != 0U);
+   }
+   entry->type = type;
+
+   if (!entry->stored && (settingsBackendWritesDefaults() != 0U))
+   {
+      if (type == SETTINGS_S64)
+      {
+         settingsBackendSetS64(section, key, (int64_t)defaultValue);
+      }
+      else
+      {
+         settingsBackendSetU64(section, key, defaultValue, (type == SETTINGS_X64) ? 1U : 0U);
+      }
+      entry->stored = true;
+      entry->value = defaultValue;
+   }
+   return entry;
+}
+
+static void settingsSetInteger(const char section[], const char key[], SettingsType_e type, uint64_t value)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   SettingsEntry* entry = settingsEntry(section, key);
+   if ((entry->type == type) && entry->stored && (entry->value == value))
+   {
+      return;
+   }
+
+   if (type == SETTINGS_S64)
+   {
+      settingsBackendSetS64(section, key, (int64_t)value);
+   }
+   else
+   {
+      settingsBackendSetU64(section, key, value, (type == SETTINGS_X64) ? 1U : 0U);
+   }
+   entry->type = type;
+   entry->stored = true;
+   entry->value = value;
+}
+
+/* getSection(): "key=value\0" entries; stops at the first entry which does not fit */
+struct SettingsSectionBuffer
+{
+   char* string;
+   size_t size;
+   size_t length;          /* without the final '\0' */
+};
+
+static uint8_t settingsAppendEntry(const char key[], const char value[], void* context)
+{
+   SettingsSectionBuffer* buffer = (SettingsSectionBuffer*)context;
+   size_t keyLength = strlen(key);
+   size_t valueLength = strlen(value);
+   size_t entryLength = keyLength + 1U + valueLength + 1U;
+
+   if ((buffer->length + entryLength + 1U) > buffer->size)
+   {
+      return 0U;
+   }
+
+   char* entry = &buffer->string[buffer->length];
+   memcpy(entry, key, keyLength);
+   entry[keyLength] = '=';
+   memcpy(&entry[keyLength + 1U], value, valueLength + 1U);
+   buffer->length += entryLength;
+   return 1U;
+}
+
+/* ************************************************************************ */
+
+int8_t getS8(const char section[], const char key[], const int8_t defaultValue)
+{
+   int64_t ret = getS64(section, key, defaultValue);
+   return ((ret > INT8_MAX) || (ret < INT8_MIN)) ? defaultValue : (int8_t)(ret);
+}
+
+int16_t getS16(const char section[], const char key[], const int16_t defaultValue)
+{
+   int64_t ret = getS64(section, key, defaultValue);
+   return ((ret > INT16_MAX) || (ret < INT16_MIN)) ? defaultValue : (int16_t)(ret);
+}
+
+int32_t getS32(const char section[], const char key[], const int32_t defaultValue)
+{
+   int64_t ret = getS64(section, key, defaultValue);
+   return ((ret > INT32_MAX) || (ret < INT32_MIN)) ? defaultValue : (int32_t)(ret);
+}
+
+int64_t getS64(const char section[], const char key[], const int64_t defaultValue)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   const SettingsEntry* entry = settingsGetInteger(section, key, SETTINGS_S64, (uint64_t)defaultValue);
+   return entry->stored ? (int64_t)entry->value : defaultValue;
+}
+
+uint8_t getU8(const char section[], const char key[], const uint8_t defaultValue)
+{
+   uint64_t ret = getU64(section, key, defaultValue);
+   return (ret > UINT8_MAX) ? defaultValue : (uint8_t)(ret);
+}
+
+uint16_t getU16(const char section[], const char key[], const uint16_t defaultValue)
+{
+   uint64_t ret = getU64(section, key, defaultValue);
+   return (ret > UINT16_MAX) ? defaultValue : (uint16_t)(ret);
+}
+
+uint32_t getU32(const char section[], const char key[], const uint32_t defaultValue)
+{
+   uint64_t ret = getU64(section, key, defaultValue);
+   return (ret > UINT32_MAX) ? defaultValue : (uint32_t)(ret);
+}
+
+uint64_t getU64(const char section[], const char key[], const uint64_t defaultValue)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   const SettingsEntry* entry = settingsGetInteger(section, key, SETTINGS_U64, defaultValue);
+   return entry->stored ? entry->value : defaultValue;
+}
+
+uint64_t getX64(const char section[], const char key[], const uint64_t defaultValue)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   const SettingsEntry* entry = settingsGetInteger(section, key, SETTINGS_X64, defaultValue);
+   return entry->stored ? entry->value : defaultValue;
+}
+
+void getString(const char section[], const char key[], const char defaultValue[], char string[], size_t stringSize)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   SettingsEntry* entry = settingsEntry(section, key);
+   if (entry->type != SETTINGS_STRING)
+   {
+      char buffer[MAXSTRLEN];
+      entry->stored = (settingsBackendGetString(section, key, buffer, sizeof(buffer)) != 0U);
+      entry->text = entry->stored ? buffer : "";
+      entry->type = SETTINGS_STRING;
+      if (!entry->stored && (settingsBackendWritesDefaults() != 0U))
+      {
+         settingsBackendSetString(section, key, defaultValue);
+         entry->stored = true;
+         entry->text = defaultValue;
+      }
+   }
+
+   if (stringSize > 0U)
+   {
+      snprintf(string, stringSize, "%s", entry->stored ? entry->text.c_str() : defaultValue);
+   }
+}
+
+void setS8(const char section[], const char key[], const int8_t value)
+{
+   setS64(section, key, value);
+}
+
+void setS16(const char section[], const char key[], const int16_t value)
+{
+   setS64(section, key, value);
+}
+
+void setS32(const char section[], const char key[], const int32_t value)
+{
+   setS64(section, key, value);
+}
+
+void setS64(const char section[], const char key[], const int64_t value)
+{
+   settingsSetInteger(section, key, SETTINGS_S64, (uint64_t)value);
+}
+
+void setU8(const char section[], const char key[], const uint8_t value)
+{
+   setU64(section, key, value);
+}
+
+void setU16(const char section[], const char key[], const uint16_t value)
+{
+   setU64(section, key, value);
+}
+
+void setU32(const char section[], const char key[], const uint32_t value)
+{
+   setU64(section, key, value);
+}
+
+void setU64(const char section[], const char key[], const uint64_t value)
+{
+   settingsSetInteger(section, key, SETTINGS_U64, value);
+}
+
+void setX64(const char section[], const char key[], const uint64_t value)
+{
+   settingsSetInteger(section, key, SETTINGS_X64, value);
+}
+
+/* value NULL: removes the key */
+void setString(const char section[], const char key[], const char value[])
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   SettingsEntry* entry = settingsEntry(section, key);
+   bool stored = (value != NULL);
+   if ((entry->type == SETTINGS_STRING) && (entry->stored == stored) && (!stored || (entry->text == value)))
+   {
+      return;
+   }
+
+   settingsBackendSetString(section, key, value);
+   entry->type = SETTINGS_STRING;
+   entry->stored = stored;
+   entry->text = stored ? value : "";
+}
+
+size_t getBlob(const char section[], const char key[], void* data, size_t size)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   SettingsEntry* entry = settingsEntry(section, key);
+   if (entry->type != SETTINGS_BLOB)
+   {
+      uint8_t buffer[MAXBLOBLEN];
+      size_t storedSize = 0U;
+      entry->stored = (settingsBackendGetBlob(section, key, buffer, sizeof(buffer), &storedSize) != 0U);
+      entry->text.assign((const char*)buffer, entry->stored ? storedSize : 0U);
+      entry->type = SETTINGS_BLOB;
+   }
+
+   if (!entry->stored)
+   {
+      return 0U;
+   }
+   memcpy(data, entry->text.data(), (entry->text.size() < size) ? entry->text.size() : size);
+   return entry->text.size();
+}
+
+void setBlob(const char section[], const char key[], const void* data, size_t size)
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   SettingsEntry* entry = settingsEntry(section, key);
+   if ((entry->type == SETTINGS_BLOB) && entry->stored && (entry->text.size() == size)
+      && (memcmp(entry->text.data(), data, size) == 0))
+   {
+      return;
+   }
+
+   settingsBackendSetBlob(section, key, data, size);
+   entry->type = SETTINGS_BLOB;
+   entry->stored = true;
+   entry->text.assign((const char*)data, size);
+}
+
+size_t blobToText(const void* data, size_t size, char text[], size_t textSize)
+{
+   static const char hexDigits[] = "0123456789ABCDEF";
+   const uint8_t* bytes = (const uint8_t*)data;
+   size_t idx;
+
+   if (textSize == 0U)
+   {
+      return 0U;
+   }
+   for (idx = 0U; (idx < size) && (((idx * 2U) + 2U) < textSize); idx++)
+   {
+      text[idx * 2U] = hexDigits[bytes[idx] >> 4];
+      text[(idx * 2U) + 1U] = hexDigits[bytes[idx] & 0x0FU];
+   }
+   text[idx * 2U] = '\0';
+   return idx * 2U;
+}
+
+static int settingsHexDigit(char digit)
+{
+   if ((digit >= '0') && (digit <= '9'))
+   {
+      return digit - '0';
+   }
+   if ((digit >= 'A') && (digit <= 'F'))
+   {
+      return digit - 'A' + 10;
+   }
+   if ((digit >= 'a') && (digit <= 'f'))
+   {
+      return digit - 'a' + 10;
+   }
+   return -1;
+}
+
+size_t blobFromText(const char text[], void* data, size_t size)
+{
+   uint8_t* bytes = (uint8_t*)data;
+   size_t length = strlen(text);
+   size_t idx;
+
+   if (((length % 2U) != 0U) || ((length / 2U) > size))
+   {
+      return 0U;
+   }
+   for (idx = 0U; idx < (length / 2U); idx++)
+   {
+      int high = settingsHexDigit(text[idx * 2U]);
+      int low = settingsHexDigit(text[(idx * 2U) + 1U]);
+      if ((high < 0) || (low < 0))
+      {
+         return 0U;
+      }
+      bytes[idx] = (uint8_t)((high << 4) | low);
+   }
+   return length / 2U;
+}
+
+/* entries are not cached: read from the backend without the cache lock */
+size_t getSection(const char section[], char string[], size_t stringSize)
+{
+   SettingsSectionBuffer buffer = { string, stringSize, 0U };
+   if (stringSize < 2U)
+   {
+      return 0U;
+   }
+
+   (void)settingsBackendGetSectionEntries(section, &settingsAppendEntry, &buffer);
+   string[buffer.length] = '\0';
+   if (buffer.length == 0U)
+   {
+      string[1] = '\0';
+   }
+   return buffer.length;
+}
+
+size_t getSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context)
+{
+   return settingsBackendGetSectionEntries(section, entryCb, context);
+}
+
+void clearSection(const char section[])
+{
+   std::lock_guard<std::mutex> lock(s_cacheMutex);
+   for (size_t idx = 0U; idx < s_entries.size(); idx++)
+   {
+      if (s_entries[idx].section == section)
+      {
+         s_entries[idx].type = SETTINGS_NONE;
+      }
+   }
+   // erase complete section
+   settingsBackendSetString(section, NULL, NULL);
+}
+
+void settingsFlush(void)
+{
+   // without s_cacheMutex: the backend copies its pending changes under its own lock,
+   // so the get and set functions of other tasks do not wait for the storage
+   settingsBackendFlush();
+}
+
+/* ************************************************************************ */
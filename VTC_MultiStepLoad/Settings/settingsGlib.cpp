@@ -3,6 +3,11 @@
    \file
    \brief       Helper functions for reading and writing settings to a file.
 
+   \details     Linux backend of the settings: settings.ini is kept in a GKeyFile and written
+                behind (class Settings). setString(section, key, NULL) removes the key and
+                clearSection() the section. tools/SettingsBenchmark measures the time of
+                updateAuxAssignment() with the write-behind and with FlushDelayMs=0 (one write
+                of settings.ini per change).
 */
 /* ************************************************************************ */
 #ifdef WIN32
@@ -11,8 +16,16 @@
 #include <glib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
 #include <string>
-#include "settings.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "settingsBackend.h"
+#include "AppLog.h"
 
 #if defined(linux)
 #define vswprintf_s swprintf
@@ -28,7 +41,13 @@
 
 static const char FILENAME[] = ".\\settings.ini";
 #define MAXSTRLEN      1024U
+#define MAXBLOBLEN     512U     /* largest blob of getBlob(); stored as 2 * MAXBLOBLEN hexadecimal digits */
 
+/*! Write-behind: a mutation marks the key file dirty; the flush thread writes settings.ini
+    after FlushDelayMs without further mutations (at the latest FlushMaxDelayMs after the
+    first one), settingsFlush() and the destructor at once. The new file replaces the old
+    one by rename (g_file_set_contents()), so a crash leaves either the old or the new file.
+    Section "Settings": FlushDelayMs=0 writes each mutation at once as before. */
 static class Settings
 {
 public :
@@ -39,6 +58,7 @@ public :
         GError *error = nullptr;
         if (!g_key_file_load_from_file (keyfile, "./settings.ini", flags, &error))
         {
+            g_clear_error(&error);
             FILE* handle = fopen("settings.ini", "w");
             if (handle != nullptr)
             {
@@ -46,52 +66,219 @@ public :
             }
         }
 
-        g_key_file_set_string(keyfile, "HW", "test1", "Hello World!");
-        g_key_file_set_integer(keyfile, "HW", "test2", 123);
-        g_key_file_save_to_file(keyfile, "./settings.ini", nullptr);
+        flushDelay = std::chrono::milliseconds(getConfig("FlushDelayMs", 1000));
+        flushMaxDelay = std::chrono::milliseconds(getConfig("FlushMaxDelayMs", 10000));
+
+        if (flushDelay.count() > 0)
+        {
+            flushThread = std::thread(&Settings::flushLoop, this);
+        }
         return;
     }
 
     ~Settings()
     {
-        g_key_file_save_to_file(keyfile, "./settings.ini", nullptr);
+        if (flushThread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopFlush = true;
+            }
+            changed.notify_one();
+            flushThread.join();
+        }
+        flush();
+        g_key_file_free(keyfile);
     }
 
+    /* key nullptr: removes the section; value nullptr: removes the key */
     void setString(const char* section, const char* key, const char* value)
     {
-        g_key_file_set_string(keyfile, section, key, value);
-        g_key_file_save_to_file(keyfile, "./settings.ini", nullptr);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (key == nullptr)
+            {
+                g_key_file_remove_group(keyfile, section, nullptr);
+            }
+            else if (value == nullptr)
+            {
+                g_key_file_remove_key(keyfile, section, key, nullptr);
+            }
+            else
+            {
+                g_key_file_set_string(keyfile, section, key, value);
+            }
+            markDirty();
+        }
+        if (!flushThread.joinable())
+        {
+            flush();
+        }
     }
 
     uint32_t getString(const char* section, const char* key, const char* defaultValue, char* captionOut, uint32_t captionSize)
     {
+        (void)defaultValue;
+        std::lock_guard<std::mutex> lock(mutex);
         char *captionTemp = g_key_file_get_string(keyfile, section, key , nullptr);
         if (captionTemp == nullptr)
         {
             return 0U;
         }
 
-        std::string caption(captionTemp);
-        strcpy(captionOut, caption.c_str());
-        return static_cast<uint32_t>(caption.size());
+        // as GetPrivateProfileString(): the number of characters copied without '\0'
+        size_t length = g_strlcpy(captionOut, captionTemp, captionSize);
+        g_free(captionTemp);
+        if (length >= captionSize)
+        {
+            length = (captionSize > 0U) ? (captionSize - 1U) : 0U;
+        }
+        return static_cast<uint32_t>(length);
     }
 
-    int64_t getS64(const char* section, const char* key, const int64_t defaultValue)
+    bool getS64(const char* section, const char* key, int64_t* value)
     {
         GError *error = nullptr;
-        gint64 value = g_key_file_get_int64(keyfile, section, key, &error);
+        std::lock_guard<std::mutex> lock(mutex);
+        gint64 valueTemp = g_key_file_get_int64(keyfile, section, key, &error);
         if (error != nullptr)
         {
-            g_key_file_set_int64(keyfile, section, key, defaultValue);
-            g_key_file_save_to_file(keyfile, "./settings.ini", nullptr);
-            return defaultValue;
+            g_error_free(error);
+            return false;
+        }
+
+        *value = valueTemp;
+        return true;
+    }
+
+    /* entryCb is called without the lock; keys removed meanwhile are skipped */
+    size_t getSectionEntries(const char* section, SettingsEntryCb_t entryCb, void* context)
+    {
+        gchar** keys = nullptr;
+        size_t calls = 0U;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            keys = g_key_file_get_keys(keyfile, section, nullptr, nullptr);
+        }
+        if (keys == nullptr)
+        {
+            return 0U;
+        }
+
+        for (gchar** key = keys; *key != nullptr; key++)
+        {
+            gchar* value = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                value = g_key_file_get_string(keyfile, section, *key, nullptr);
+            }
+            if (value != nullptr)
+            {
+                calls++;
+                uint8_t next = entryCb(*key, value, context);
+                g_free(value);
+                if (next == 0U)
+                {
+                    break;
+                }
+            }
+        }
+        g_strfreev(keys);
+        return calls;
+    }
+
+    /* writes settings.ini if modified; the file is written outside of the key file lock */
+    void flush()
+    {
+        std::lock_guard<std::mutex> fileLock(fileMutex);
+        gchar* data = nullptr;
+        gsize length = 0U;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!dirty)
+            {
+                return;
+            }
+            data = g_key_file_to_data(keyfile, &length, nullptr);
+            dirty = false;
+        }
+
+        GError *error = nullptr;
+        if (!g_file_set_contents("./settings.ini", data, static_cast<gssize>(length), &error))
+        {
+            APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "settings.ini not written: %s\n", error->message);
+            g_error_free(error);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!dirty)
+            {   /* retry with the next flush */
+                dirty = true;
+                firstChange = std::chrono::steady_clock::now();
+            }
+            lastChange = std::chrono::steady_clock::now();
         }
+        g_free(data);
+    }
+
+private :
+    /* called with the lock held */
+    void markDirty()
+    {
+        lastChange = std::chrono::steady_clock::now();
+        if (!dirty)
+        {
+            dirty = true;
+            firstChange = lastChange;
+            changed.notify_one();
+        }
+    }
 
-        return value;
+    int64_t getConfig(const char* key, int64_t defaultValue)
+    {
+        GError *error = nullptr;
+        gint64 value = g_key_file_get_int64(keyfile, "Settings", key, &error);
+        if (error != nullptr)
+        {
+            g_error_free(error);
+            return defaultValue;
+        }
+        return (value < 0) ? 0 : value;
     }
 
+    void flushLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopFlush)
+        {
+            if (!dirty)
+            {
+                changed.wait(lock);
+                continue;
+            }
+
+            std::chrono::steady_clock::time_point due = std::min(lastChange + flushDelay, firstChange + flushMaxDelay);
+            if (std::chrono::steady_clock::now() < due)
+            {
+                changed.wait_until(lock, due);
+                continue;
+            }
+
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
 
     GKeyFile *keyfile = nullptr;
+    std::mutex mutex;                   /* key file and flags */
+    std::mutex fileMutex;               /* one writer of settings.ini */
+    std::condition_variable changed;
+    std::thread flushThread;
+    bool dirty = false;
+    bool stopFlush = false;
+    std::chrono::steady_clock::time_point firstChange;
+    std::chrono::steady_clock::time_point lastChange;
+    std::chrono::milliseconds flushDelay;
+    std::chrono::milliseconds flushMaxDelay;
 
 } s_settings;
 
@@ -119,176 +306,88 @@ bool WritePrivateProfileStringA(
     return true;
 }
 
-uint32_t GetPrivateProfileSectionA(
-    const char* section,
-    char* lpReturnedString,
-    uint32_t nSize,
-    const char* lpFileName
-    )
-{
-    return 0;
-}
-
 /* ************************************************************************ */
 
-int8_t getS8(const char section[], const char key[], const int8_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT8_MAX) || (ret < INT8_MIN)) ? defaultValue : (int8_t)(ret);
-}
-
-int16_t getS16(const char section[], const char key[], const int16_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT16_MAX) || (ret < INT16_MIN)) ? defaultValue : (int16_t)(ret);
-}
-
-int32_t getS32(const char section[], const char key[], const int32_t defaultValue)
-{
-   int64_t ret = getS64(section, key, defaultValue);
-   return ((ret > INT32_MAX) || (ret < INT32_MIN)) ? defaultValue : (int32_t)(ret);
-}
-
-int64_t getS64(const char section[], const char key[], const int64_t defaultValue)
-{
-    return s_settings.getS64(section, key, defaultValue);
-}
-
-uint8_t getU8(const char section[], const char key[], const uint8_t defaultValue)
-{
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT8_MAX) ? defaultValue : (uint8_t)(ret);
-}
-
-uint16_t getU16(const char section[], const char key[], const uint16_t defaultValue)
-{
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT16_MAX) ? defaultValue : (uint16_t)(ret);
-}
-
-uint32_t getU32(const char section[], const char key[], const uint32_t defaultValue)
+uint8_t settingsBackendGetS64(const char section[], const char key[], int64_t* value)
 {
-   uint64_t ret = getU64(section, key, defaultValue);
-   return (ret > UINT32_MAX) ? defaultValue : (uint32_t)(ret);
+   return s_settings.getS64(section, key, value) ? 1U : 0U;
 }
 
-uint64_t getU64(const char section[], const char key[], const uint64_t defaultValue)
+uint8_t settingsBackendGetU64(const char section[], const char key[], uint64_t* value, uint8_t hex)
 {
    char buffer[MAXSTRLEN];
-   uint64_t ret = defaultValue;
    uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
    if (charCount == 0U)
    {
-      sprintf_s(buffer, sizeof(buffer), "%ld", defaultValue);
-      WritePrivateProfileStringA(section, key, buffer, FILENAME);
-   }
-   else
-   {
-      ret = _strtoui64(buffer, NULL, 10);
+      return 0U;
    }
 
-   return ret;
+   *value = _strtoui64(buffer, NULL, (hex != 0U) ? 16 : 10);
+   return 1U;
 }
 
-uint64_t getX64(const char section[], const char key[], const uint64_t defaultValue)
+uint8_t settingsBackendGetString(const char section[], const char key[], char value[], size_t size)
 {
-   char buffer[MAXSTRLEN];
-   uint64_t ret = defaultValue;
-   uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
-   if (charCount == 0U)
-   {
-      sprintf_s(buffer, sizeof(buffer), "%lx", defaultValue);
-      WritePrivateProfileStringA(section, key, buffer, FILENAME);
-   }
-   else
-   {
-      ret = _strtoui64(buffer, NULL, 16);
-   }
-
-   return ret;
+   return (GetPrivateProfileStringA(section, key, NULL, value, (uint32_t)size, FILENAME) != 0U) ? 1U : 0U;
 }
 
-void getString(const char section[], const char key[], const char defaultValue[], char caption[], size_t size)
+uint8_t settingsBackendGetBlob(const char section[], const char key[], void* data, size_t size, size_t* storedSize)
 {
-   static char buffer[MAXSTRLEN];
-   uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
-   if (charCount == 0U)
+   // one character more than the text of the largest blob, so that a longer text is rejected
+   char buffer[(2U * MAXBLOBLEN) + 2U];
+   if ((settingsBackendGetString(section, key, buffer, sizeof(buffer)) == 0U) || (strlen(buffer) > (2U * size)))
    {
-      WritePrivateProfileStringA(section, key, defaultValue, FILENAME);
-      strcpy_s(caption, defaultValue);
+      return 0U;
    }
-   else
-   {
-      strcpy_s(caption, buffer);
-   }
-}
-
-void setS8(const char section[], const char key[], const int8_t value)
-{
-   setS64(section, key, value);
-}
-
-void setS16(const char section[], const char key[], const int16_t value)
-{
-   setS64(section, key, value);
-}
 
-void setS32(const char section[], const char key[], const int32_t value)
-{
-   setS64(section, key, value);
+   *storedSize = blobFromText(buffer, data, size);
+   return (*storedSize != 0U) ? 1U : 0U;
 }
 
-void setS64(const char section[], const char key[], const int64_t value)
+void settingsBackendSetS64(const char section[], const char key[], int64_t value)
 {
    char buffer[MAXSTRLEN];
-   sprintf_s(buffer, sizeof(buffer), "%ld", value);
+   sprintf_s(buffer, sizeof(buffer), "%" PRId64, value);
    WritePrivateProfileStringA(section, key, buffer, FILENAME);
 }
 
-void setU8(const char section[], const char key[], const uint8_t value)
-{
-    setU64(section, key, value);
-}
-
-void setU16(const char section[], const char key[], const uint16_t value)
-{
-    setU64(section, key, value);
-}
-
-void setU32(const char section[], const char key[], const uint32_t value)
+void settingsBackendSetU64(const char section[], const char key[], uint64_t value, uint8_t hex)
 {
-    setU64(section, key, value);
+   char buffer[MAXSTRLEN];
+   sprintf_s(buffer, sizeof(buffer), (hex != 0U) ? "%" PRIx64 : "%" PRIu64, value);
+   WritePrivateProfileStringA(section, key, buffer, FILENAME);
 }
 
-void setU64(const char section[], const char key[], const uint64_t value)
+void settingsBackendSetBlob(const char section[], const char key[], const void* data, size_t size)
 {
-    char buffer[MAXSTRLEN];
-    sprintf_s(buffer, sizeof(buffer), "%lu", value);
-    WritePrivateProfileStringA(section, key, buffer, FILENAME);
+   char buffer[(2U * MAXBLOBLEN) + 1U];
+   if (size > MAXBLOBLEN)
+   {
+      APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "setBlob(%s, %s): %u bytes, at most %u\n", section, key, (unsigned)size, MAXBLOBLEN);
+      return;
+   }
+   (void)blobToText(data, size, buffer, sizeof(buffer));
+   settingsBackendSetString(section, key, buffer);
 }
 
-void setX64(const char section[], const char key[], const uint64_t value)
+void settingsBackendSetString(const char section[], const char key[], const char value[])
 {
-    char buffer[MAXSTRLEN];
-    sprintf_s(buffer, sizeof(buffer), "%lx", value);
-    WritePrivateProfileStringA(section, key, buffer, FILENAME);
+   WritePrivateProfileStringA(section, key, value, FILENAME);
 }
 
-void setString(const char section[], const char key[], const char value[])
+size_t settingsBackendGetSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context)
 {
-    WritePrivateProfileStringA(section, key, value, FILENAME);
+   return s_settings.getSectionEntries(section, entryCb, context);
 }
 
-size_t getSection(const char section[], char string[], size_t stringSize)
+void settingsBackendFlush(void)
 {
-   size_t sectionChars = (size_t)GetPrivateProfileSectionA(section, string, (uint32_t)stringSize, FILENAME);
-   return sectionChars;
+   s_settings.flush();
 }
 
-void clearSection(const char section[])
+uint8_t settingsBackendWritesDefaults(void)
 {
-   // erase complete section
-   WritePrivateProfileStringA(section, NULL, NULL, FILENAME);
+   return 1U;
 }
 
 /* ************************************************************************ */
@@ -1,18 +1,42 @@
 /* ************************************************************************ */
 /*!
    \file
-   \brief       Helper functions for reading and writing settings to a file.
-
+   \brief       Helper functions for reading and writing settings to the NVS (ESP32).
+
+   \details     Each section is an NVS namespace, each key an NVS entry. Integers are
+                stored as u64 or i64 entries, strings as str entries and binary data
+                (setBlob()) as blob entries, so that the values are read without text
+                conversion. Section and key names longer than
+                15 characters are shortened to the first 7 characters, '#' and a 28 bit
+                hash of the full name.
+                The set functions write to the NVS at once; nvs_commit() is done for all
+                modified sections by a timer after FlushDelayMs without further changes (at
+                the latest FlushMaxDelayMs after the first change) or by settingsFlush().
+                Defaults of missing values are not written to the NVS
+                (settingsBackendWritesDefaults()). getSectionEntries() passes the
+                shortened names of long keys and skips values with more than
+                ENTRY_TEXT_LEN - 1 characters as text (strings, blobs of more than 63 bytes).
+                The iterator API of ESP-IDF 4 and 5 is supported (ESP_IDF_VERSION).
+                The preferred VT (CF-A.preferredVT), its boot time and the claimed source
+                address are kept over a power-up, so the client connects to the stored VT
+                without waiting bootTimeVT.
+                tools/HostTests/NvsTests checks the backend with an NVS mock, e.g. an update
+                every 100 ms is committed at most once per FlushMaxDelayMs.
 */
 /* ************************************************************************ */
 #include <stdio.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <string.h>
 #include <string>
-#include "settings.h"
+#include <mutex>
+#include "settingsBackend.h"
+#include "AppLog.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_idf_version.h"
 #include "nvs_flash.h"
 #include "nvs.h"
 
@@ -29,74 +53,490 @@
 /* ************************************************************************ */
 
 static const char FILENAME[] = ".\\settings.ini";
-#define MAXSTRLEN      1024U
-static class Settings 
+#define ENTRY_TEXT_LEN 128U     /* value text in getSectionEntries(); aux records: 48 characters */
+#define SECTIONS_MAX   16U      /* open namespaces */
+#define NAME_MAX_LEN   15U      /* NVS_KEY_NAME_MAX_SIZE - 1; also for namespaces */
+
+static void settingsTimerCallback(void* arg);
+
+static class Settings
 {
 private:
-	nvs_handle_t my_handle;
+    struct Section
+    {
+        char name[NAME_MAX_LEN + 1U];
+        nvs_handle_t handle;
+        bool writable;
+        bool dirty;
+    };
+
+    std::mutex mutex;
+    Section sections[SECTIONS_MAX];
+    uint32_t sectionCount = 0U;
+    bool initialized = false;
+    esp_timer_handle_t timer = nullptr;
+    int64_t flushDelayUs = 0;
+    int64_t flushMaxDelayUs = 0;
+    int64_t firstChangeUs = 0;
+    bool dirty = false;
+
 public :
     Settings()
     {
-    	my_handle = 0;
-    }
-    void init(void)
-    {
-		// Initialize NVS
-		esp_err_t err = nvs_flash_init();
-		if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) 
-		{
-			// NVS partition was truncated and needs to be erased
-			// Retry nvs_flash_init
-			ESP_ERROR_CHECK (nvs_flash_erase());
-			err = nvs_flash_init();
-		}
-		ESP_ERROR_CHECK(err);
-		// Open
-		printf("\n");
-		printf("Opening Non-Volatile Storage (NVS) handle... ");
-		err = nvs_open("storage", NVS_READWRITE, &my_handle);
-		if (err != ESP_OK) {
-			printf("Error (%s) opening NVS handle!\n", esp_err_to_name(err));
-		} else {
-			printf("Done\n");
-		}
-        return;
     }
 
     ~Settings()
     {
-        // Close
-        nvs_close(my_handle);
+        flush();
+        for (uint32_t idx = 0U; idx < sectionCount; idx++)
+        {
+            nvs_close(sections[idx].handle);
+        }
     }
 
-    void setString(const char* section, const char* key, const char* value)
+    bool getU64(const char* section, const char* key, uint64_t* value)
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (!open(section, false, &handle))
+        {
+            return false;
+        }
+        nvsName(key, name);
+        if (nvs_get_u64(handle, name, value) == ESP_OK)
+        {
+            return true;
+        }
+        int64_t signedValue = 0;   /* written by a setS function */
+        if ((nvs_get_i64(handle, name, &signedValue) == ESP_OK) && (signedValue >= 0))
+        {
+            *value = static_cast<uint64_t>(signedValue);
+            return true;
+        }
+        return false;
+    }
 
+    bool getS64(const char* section, const char* key, int64_t* value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (!open(section, false, &handle))
+        {
+            return false;
+        }
+        nvsName(key, name);
+        if (nvs_get_i64(handle, name, value) == ESP_OK)
+        {
+            return true;
+        }
+        uint64_t unsignedValue = 0U;   /* written by a setU function */
+        if ((nvs_get_u64(handle, name, &unsignedValue) == ESP_OK) && (unsignedValue <= INT64_MAX))
+        {
+            *value = static_cast<int64_t>(unsignedValue);
+            return true;
+        }
+        return false;
     }
 
     uint32_t getString(const char* section, const char* key, const char* defaultValue, char* captionOut, uint32_t captionSize)
     {
-        char *captionTemp = nullptr;
-        if (captionTemp == nullptr)
+        (void)defaultValue;
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        size_t length = captionSize;
+        if (!open(section, false, &handle))
         {
             return 0U;
         }
+        nvsName(key, name);
+        if ((captionSize == 0U) || (nvs_get_str(handle, name, captionOut, &length) != ESP_OK) || (length == 0U))
+        {
+            return 0U;
+        }
+        return static_cast<uint32_t>(length - 1U);   /* without '\0' */
+    }
 
-        std::string caption(captionTemp);
-        strcpy(captionOut, caption.c_str());
-        return static_cast<uint32_t>(caption.size());
+    /* false: not stored or larger than size; *storedSize: size of the blob */
+    bool getBlob(const char* section, const char* key, void* data, size_t size, size_t* storedSize)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        size_t length = 0U;
+        if (!open(section, false, &handle))
+        {
+            return false;
+        }
+        nvsName(key, name);
+        if ((nvs_get_blob(handle, name, nullptr, &length) != ESP_OK) || (length > size)
+           || (nvs_get_blob(handle, name, data, &length) != ESP_OK))
+        {
+            return false;
+        }
+        *storedSize = length;
+        return true;
     }
 
-    int64_t getS64(const char* section, const char* key, const int64_t defaultValue)
+    void setBlob(const char* section, const char* key, const void* data, size_t size)
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (open(section, true, &handle))
+        {
+            nvsName(key, name);
+            check(nvs_set_blob(handle, name, data, size), section, key);
+        }
+    }
 
+    void setU64(const char* section, const char* key, uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (open(section, true, &handle))
+        {
+            nvsName(key, name);
+            check(nvs_set_u64(handle, name, value), section, key);
+        }
+    }
 
-        return 0;
+    void setS64(const char* section, const char* key, int64_t value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (open(section, true, &handle))
+        {
+            nvsName(key, name);
+            check(nvs_set_i64(handle, name, value), section, key);
+        }
     }
 
+    /* key nullptr: removes the section; value nullptr: removes the key */
+    void setString(const char* section, const char* key, const char* value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        nvs_handle_t handle = 0;
+        char name[NAME_MAX_LEN + 1U];
+        if (!open(section, true, &handle))
+        {
+            return;
+        }
+        if (key == nullptr)
+        {
+            check(nvs_erase_all(handle), section, "*");
+            return;
+        }
+        nvsName(key, name);
+        if (value == nullptr)
+        {
+            esp_err_t err = nvs_erase_key(handle, name);
+            check((err == ESP_ERR_NVS_NOT_FOUND) ? ESP_OK : err, section, key);
+        }
+        else
+        {
+            check(nvs_set_str(handle, name, value), section, key);
+        }
+    }
+
+    /* entryCb is called without the lock; keys with names longer than 15 characters are passed hashed */
+    size_t getSectionEntries(const char* section, SettingsEntryCb_t entryCb, void* context)
+    {
+        char space[NAME_MAX_LEN + 1U];
+        size_t calls = 0U;
+        nvsName(section, space);
+        nvs_iterator_t iterator = firstEntry(space);
+        while (iterator != nullptr)
+        {
+            nvs_entry_info_t info;
+            char value[ENTRY_TEXT_LEN];
+            bool found = false;
+            nvs_entry_info(iterator, &info);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                nvs_handle_t handle = 0;
+                found = open(section, false, &handle) && valueText(handle, &info, value, sizeof(value));
+            }
+            if (found)
+            {
+                calls++;
+                if (entryCb(info.key, value, context) == 0U)
+                {
+                    nvs_release_iterator(iterator);
+                    break;
+                }
+            }
+            iterator = nextEntry(iterator);
+        }
+        return calls;
+    }
+
+    /* nvs_commit() of the modified sections */
+    void flush(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (uint32_t idx = 0U; idx < sectionCount; idx++)
+        {
+            Section* entry = &sections[idx];
+            if (entry->dirty)
+            {
+                esp_err_t err = nvs_commit(entry->handle);
+                if (err != ESP_OK)
+                {
+                    APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "NVS commit of %s failed (%s)\n", entry->name, esp_err_to_name(err));
+                }
+                entry->dirty = false;
+            }
+        }
+        dirty = false;
+    }
+
+private:
+    /* called with the lock held */
+    void init(void)
+    {
+        // Initialize NVS
+        esp_err_t err = nvs_flash_init();
+        if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND)
+        {
+            // NVS partition was truncated and needs to be erased
+            // Retry nvs_flash_init
+            ESP_ERROR_CHECK (nvs_flash_erase());
+            err = nvs_flash_init();
+        }
+        ESP_ERROR_CHECK(err);
+        initialized = true;
+
+        nvs_handle_t handle = 0;
+        uint64_t delayMs = 1000U;
+        uint64_t maxDelayMs = 10000U;
+        if (open("Settings", false, &handle))
+        {
+            (void)nvs_get_u64(handle, "FlushDelayMs", &delayMs);
+            (void)nvs_get_u64(handle, "FlushMaxDelayMs", &maxDelayMs);
+        }
+        flushDelayUs = static_cast<int64_t>(delayMs) * 1000;
+        flushMaxDelayUs = static_cast<int64_t>(maxDelayMs) * 1000;
+
+        const esp_timer_create_args_t timerArgs = { settingsTimerCallback, this, ESP_TIMER_TASK, "settings" };
+        err = esp_timer_create(&timerArgs, &timer);
+        if (err != ESP_OK)
+        {
+            APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "Error (%s) creating the NVS commit timer\n", esp_err_to_name(err));
+            timer = nullptr;
+        }
+        APP_LOG_INFO(APP_LOG_MOD_SETTINGS, "Non-Volatile Storage (NVS) initialized\n");
+    }
+
+    /* handle of the namespace of the section; false: does not exist (read) or error */
+    bool open(const char* section, bool write, nvs_handle_t* handle)
+    {
+        char name[NAME_MAX_LEN + 1U];
+        uint32_t idx;
+
+        if (!initialized)
+        {
+            init();
+        }
+
+        nvsName(section, name);
+        for (idx = 0U; idx < sectionCount; idx++)
+        {
+            if (strcmp(sections[idx].name, name) == 0)
+            {
+                break;
+            }
+        }
+
+        if ((idx < sectionCount) && (!write || sections[idx].writable))
+        {
+            *handle = sections[idx].handle;
+            return true;
+        }
+
+        if ((idx == sectionCount) && (sectionCount == SECTIONS_MAX))
+        {
+            APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "NVS: more than %u sections, %s not opened\n", SECTIONS_MAX, section);
+            return false;
+        }
+
+        nvs_handle_t newHandle = 0;
+        esp_err_t err = nvs_open(name, write ? NVS_READWRITE : NVS_READONLY, &newHandle);
+        if (err != ESP_OK)
+        {
+            if (err != ESP_ERR_NVS_NOT_FOUND)
+            {   /* not found: nothing written to the section yet */
+                APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "Error (%s) opening NVS namespace %s\n", esp_err_to_name(err), name);
+            }
+            return false;
+        }
+
+        if (idx < sectionCount)
+        {   /* read only handle replaced by a read-write handle */
+            nvs_close(sections[idx].handle);
+        }
+        else
+        {
+            strcpy(sections[idx].name, name);
+            sections[idx].dirty = false;
+            sectionCount++;
+        }
+        sections[idx].handle = newHandle;
+        sections[idx].writable = write;
+        *handle = newHandle;
+        return true;
+    }
+
+    /* called with the lock held after a set or erase of the section */
+    void check(esp_err_t err, const char* section, const char* key)
+    {
+        if (err != ESP_OK)
+        {
+            APP_LOG_ERROR(APP_LOG_MOD_SETTINGS, "Error (%s) writing NVS %s.%s\n", esp_err_to_name(err), section, key);
+            return;
+        }
+
+        char name[NAME_MAX_LEN + 1U];
+        nvsName(section, name);
+        for (uint32_t idx = 0U; idx < sectionCount; idx++)
+        {
+            if (strcmp(sections[idx].name, name) == 0)
+            {
+                sections[idx].dirty = true;
+            }
+        }
+
+        int64_t nowUs = esp_timer_get_time();
+        if (!dirty)
+        {
+            dirty = true;
+            firstChangeUs = nowUs;
+        }
+
+        int64_t delayUs = firstChangeUs + flushMaxDelayUs - nowUs;
+        delayUs = (delayUs < flushDelayUs) ? delayUs : flushDelayUs;
+        if ((timer == nullptr) || (delayUs <= 0))
+        {   /* commit at once */
+            for (uint32_t idx = 0U; idx < sectionCount; idx++)
+            {
+                if (sections[idx].dirty)
+                {
+                    (void)nvs_commit(sections[idx].handle);
+                    sections[idx].dirty = false;
+                }
+            }
+            dirty = false;
+            return;
+        }
+
+        (void)esp_timer_stop(timer);
+        (void)esp_timer_start_once(timer, static_cast<uint64_t>(delayUs));
+    }
+
+    /* first entry of the namespace; nullptr: empty or not found */
+    static nvs_iterator_t firstEntry(const char* space)
+    {
+#if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0))
+        nvs_iterator_t iterator = nullptr;
+        if (nvs_entry_find(NVS_DEFAULT_PART_NAME, space, NVS_TYPE_ANY, &iterator) != ESP_OK)
+        {
+            nvs_release_iterator(iterator);
+            return nullptr;
+        }
+        return iterator;
+#else
+        return nvs_entry_find(NVS_DEFAULT_PART_NAME, space, NVS_TYPE_ANY);
+#endif
+    }
+
+    /* next entry; nullptr: the iterator is released after the last entry */
+    static nvs_iterator_t nextEntry(nvs_iterator_t iterator)
+    {
+#if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0))
+        if (nvs_entry_next(&iterator) != ESP_OK)
+        {
+            nvs_release_iterator(iterator);
+            return nullptr;
+        }
+        return iterator;
+#else
+        return nvs_entry_next(iterator);
+#endif
+    }
+
+    /* value of an entry as text; false: type not written by the set functions or too long */
+    static bool valueText(nvs_handle_t handle, const nvs_entry_info_t* info, char* value, size_t size)
+    {
+        switch (info->type)
+        {
+        case NVS_TYPE_U64:
+        {
+            uint64_t number = 0U;
+            if (nvs_get_u64(handle, info->key, &number) != ESP_OK)
+            {
+                return false;
+            }
+            snprintf(value, size, "%" PRIu64, number);
+            return true;
+        }
+        case NVS_TYPE_I64:
+        {
+            int64_t number = 0;
+            if (nvs_get_i64(handle, info->key, &number) != ESP_OK)
+            {
+                return false;
+            }
+            snprintf(value, size, "%" PRId64, number);
+            return true;
+        }
+        case NVS_TYPE_STR:
+            return (nvs_get_str(handle, info->key, value, &size) == ESP_OK);
+        case NVS_TYPE_BLOB:
+        {   /* as hexadecimal text (blobToText()) */
+            uint8_t data[(ENTRY_TEXT_LEN - 1U) / 2U];
+            size_t length = sizeof(data);
+            if (nvs_get_blob(handle, info->key, data, &length) != ESP_OK)
+            {
+                return false;
+            }
+            (void)blobToText(data, length, value, size);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    /* names with more than 15 characters: first 7 characters, '#' and 7 hex digits of the FNV-1a hash */
+    static void nvsName(const char* name, char out[NAME_MAX_LEN + 1U])
+    {
+        size_t length = strlen(name);
+        if (length <= NAME_MAX_LEN)
+        {
+            memcpy(out, name, length + 1U);
+            return;
+        }
+
+        uint32_t hash = 2166136261UL;
+        for (size_t idx = 0U; idx < length; idx++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(name[idx])) * 16777619UL;
+        }
+        snprintf(out, NAME_MAX_LEN + 1U, "%.7s#%07X", name, static_cast<unsigned int>(hash & 0x0FFFFFFFUL));
+    }
 
 } s_settings;
 
+static void settingsTimerCallback(void* arg)
+{
+    (void)arg;
+    s_settings.flush();
+}
+
 uint32_t GetPrivateProfileStringA(
     const char* section,
     const char* lpKeyName,
@@ -121,138 +561,63 @@ bool WritePrivateProfileStringA(
     return true;
 }
 
-uint32_t GetPrivateProfileSectionA(
-    const char* section,
-    char* lpReturnedString,
-    uint32_t nSize,
-    const char* lpFileName
-    )
-{
-    return 0;
-}
-
 /* ************************************************************************ */
 
-int8_t getS8(const char section[], const char key[], const int8_t defaultValue)
+uint8_t settingsBackendGetS64(const char section[], const char key[], int64_t* value)
 {
-   return 0;
+   return s_settings.getS64(section, key, value) ? 1U : 0U;
 }
 
-int16_t getS16(const char section[], const char key[], const int16_t defaultValue)
+uint8_t settingsBackendGetU64(const char section[], const char key[], uint64_t* value, uint8_t hex)
 {
-	   return 0;
+   (void)hex;  /* stored as number */
+   return s_settings.getU64(section, key, value) ? 1U : 0U;
 }
 
-int32_t getS32(const char section[], const char key[], const int32_t defaultValue)
+uint8_t settingsBackendGetString(const char section[], const char key[], char value[], size_t size)
 {
-	   return 0;
+   return (GetPrivateProfileStringA(section, key, NULL, value, (uint32_t)size, FILENAME) != 0U) ? 1U : 0U;
 }
 
-int64_t getS64(const char section[], const char key[], const int64_t defaultValue)
+uint8_t settingsBackendGetBlob(const char section[], const char key[], void* data, size_t size, size_t* storedSize)
 {
-    return s_settings.getS64(section, key, defaultValue);
+   return s_settings.getBlob(section, key, data, size, storedSize) ? 1U : 0U;
 }
 
-uint8_t getU8(const char section[], const char key[], const uint8_t defaultValue)
+void settingsBackendSetS64(const char section[], const char key[], int64_t value)
 {
-	   return 0;
+   s_settings.setS64(section, key, value);
 }
 
-uint16_t getU16(const char section[], const char key[], const uint16_t defaultValue)
+void settingsBackendSetU64(const char section[], const char key[], uint64_t value, uint8_t hex)
 {
-	   return 0;
+   (void)hex;
+   s_settings.setU64(section, key, value);
 }
 
-uint32_t getU32(const char section[], const char key[], const uint32_t defaultValue)
+void settingsBackendSetBlob(const char section[], const char key[], const void* data, size_t size)
 {
-	   return 0;
+   s_settings.setBlob(section, key, data, size);
 }
 
-uint64_t getU64(const char section[], const char key[], const uint64_t defaultValue)
+void settingsBackendSetString(const char section[], const char key[], const char value[])
 {
-	   return 0;
+   WritePrivateProfileStringA(section, key, value, FILENAME);
 }
 
-uint64_t getX64(const char section[], const char key[], const uint64_t defaultValue)
+size_t settingsBackendGetSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context)
 {
-	   return 0;
+   return s_settings.getSectionEntries(section, entryCb, context);
 }
 
-void getString(const char section[], const char key[], const char defaultValue[], char caption[], size_t size)
+void settingsBackendFlush(void)
 {
-   static char buffer[MAXSTRLEN];
-   uint32_t charCount = GetPrivateProfileStringA(section, key, NULL, buffer, sizeof(buffer), FILENAME);
-   if (charCount == 0U)
-   {
-      WritePrivateProfileStringA(section, key, defaultValue, FILENAME);
-      strcpy_s(caption, defaultValue);
-   }
-   else
-   {
-      strcpy_s(caption, buffer);
-   }
-}
-
-void setS8(const char section[], const char key[], const int8_t value)
-{
-
-}
-
-void setS16(const char section[], const char key[], const int16_t value)
-{
-
-}
-
-void setS32(const char section[], const char key[], const int32_t value)
-{
-
-}
-
-void setS64(const char section[], const char key[], const int64_t value)
-{
-
-}
-
-void setU8(const char section[], const char key[], const uint8_t value)
-{
-
+   s_settings.flush();
 }
 
-void setU16(const char section[], const char key[], const uint16_t value)
+uint8_t settingsBackendWritesDefaults(void)
 {
-
-}
-
-void setU32(const char section[], const char key[], const uint32_t value)
-{
-
-}
-
-void setU64(const char section[], const char key[], const uint64_t value)
-{
-
-}
-
-void setX64(const char section[], const char key[], const uint64_t value)
-{
-
-}
-
-void setString(const char section[], const char key[], const char value[])
-{
-
-}
-
-size_t getSection(const char section[], char string[], size_t stringSize)
-{
-   size_t sectionChars = 0;
-   return sectionChars;
-}
-
-void clearSection(const char section[])
-{
-   // erase complete section
-
+   return 0U;
 }
 
 /* ************************************************************************ */
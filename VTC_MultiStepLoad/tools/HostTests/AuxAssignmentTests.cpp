@@ -0,0 +1,221 @@
+// Host tests of the stored aux assignments (AppIso/AppMemAccess.cpp): record format, round
+// trip, records with a wrong CRC, version or key, the capacity of getAuxAssignment() and,
+// with the NVS mock (HOST_TEST_NVS), the writes of setAuxAssignment() and updateAuxAssignment().
+
+#include <cstring>
+#include "IsoDef.h"
+#include "AppMemAccess.h"
+#include "settings.h"
+#include "HostTest.h"
+#if defined(HOST_TEST_NVS)
+#include "NvsMock.h"
+#endif // defined(HOST_TEST_NVS)
+
+static const char s_section[] = "CF-A-AuxAssignment";
+static const iso_s16 s_assigns = 12;
+static const size_t s_recordSize = 24U;
+
+// CRC-32 (IEEE 802.3), bitwise; independent of the implementation under test
+static iso_u32 crc32(const iso_u8* data, size_t size)
+{
+    iso_u32 crc = 0xFFFFFFFFU;
+    for (size_t idx = 0U; idx < size; ++idx)
+    {
+        crc ^= data[idx];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 1U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+static void setCrc(iso_u8* record)
+{
+    iso_u32 crc = crc32(record, 20U);
+    for (size_t idx = 0U; idx < 4U; ++idx)
+    {
+        record[20U + idx] = static_cast<iso_u8>(crc >> (8U * idx));
+    }
+}
+
+static VT_AUXAPP_T auxEntry(iso_u16 index)
+{
+    VT_AUXAPP_T entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.wObjID_Fun = static_cast<iso_u16>(5000U + index);
+    entry.wObjID_Input = static_cast<iso_u16>(20000U + index);
+    entry.eAuxType = static_cast<VTAUXTYP_e>(1);
+    entry.wManuCode = 69U;
+    entry.wModelIdentCode = 3U;
+    entry.qPrefAssign = ISO_TRUE;
+    entry.bFuncAttribute = 2U;
+    memset(&entry.baAuxName[0], 0xA0 + index, sizeof(entry.baAuxName));
+    return entry;
+}
+
+static bool sameEntry(const VT_AUXAPP_T& left, const VT_AUXAPP_T& right)
+{
+    return (left.wObjID_Fun == right.wObjID_Fun) && (left.wObjID_Input == right.wObjID_Input)
+        && (left.eAuxType == right.eAuxType) && (left.wManuCode == right.wManuCode)
+        && (left.wModelIdentCode == right.wModelIdentCode) && (left.qPrefAssign == right.qPrefAssign)
+        && (left.bFuncAttribute == right.bFuncAttribute)
+        && (memcmp(&left.baAuxName[0], &right.baAuxName[0], sizeof(left.baAuxName)) == 0);
+}
+
+// nullptr: no assignment of the function in entries[count]
+static const VT_AUXAPP_T* findEntry(const VT_AUXAPP_T entries[], int count, iso_u16 objIdFun)
+{
+    for (int idx = 0; idx < count; ++idx)
+    {
+        if (entries[idx].wObjID_Fun == objIdFun)
+        {
+            return &entries[idx];
+        }
+    }
+    return nullptr;
+}
+
+static void storeAssignment(VT_AUXAPP_T assigns[])
+{
+    for (iso_u16 idx = 0U; idx < static_cast<iso_u16>(s_assigns); ++idx)
+    {
+        assigns[idx] = auxEntry(idx);
+    }
+    setAuxAssignment(s_section, assigns, s_assigns);
+}
+
+static void testRoundTrip(void)
+{
+    VT_AUXAPP_T assigns[20];
+    VT_AUXAPP_T readBack[20];
+    storeAssignment(assigns);
+
+    int count = getAuxAssignment(s_section, readBack, 20U);
+    HOST_CHECK(count == s_assigns);
+    for (iso_s16 idx = 0; idx < s_assigns; ++idx)
+    {
+        const VT_AUXAPP_T* entry = findEntry(readBack, count, assigns[idx].wObjID_Fun);
+        HOST_CHECK((entry != nullptr) && sameEntry(*entry, assigns[idx]));
+    }
+}
+
+// version, fields little endian, name, CRC-32 over bytes 0 .. 19
+static void testRecordFormat(void)
+{
+    iso_u8 record[32];
+    HOST_CHECK(getBlob(s_section, "5003", record, sizeof(record)) == s_recordSize);
+    HOST_CHECK(record[0] == 1U);
+    HOST_CHECK(record[1] == 1U);
+    HOST_CHECK((record[2] == 0x8BU) && (record[3] == 0x13U));     // 5003
+    HOST_CHECK((record[4] == 0x23U) && (record[5] == 0x4EU));     // 20003
+    HOST_CHECK((record[6] == 69U) && (record[7] == 0U));
+    HOST_CHECK((record[8] == 3U) && (record[9] == 0U));
+    HOST_CHECK((record[10] == 1U) && (record[11] == 2U));
+    HOST_CHECK((record[12] == 0xA3U) && (record[19] == 0xA3U));
+
+    iso_u8 expected[32];
+    memcpy(expected, record, sizeof(expected));
+    setCrc(expected);
+    HOST_CHECK(memcmp(record, expected, s_recordSize) == 0);
+
+    const iso_u8 check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    HOST_CHECK(crc32(check, sizeof(check)) == 0xCBF43926U);
+}
+
+// records with a wrong CRC, another version, another key or in the former text format are ignored
+static void testInvalidRecords(void)
+{
+    VT_AUXAPP_T readBack[20];
+    iso_u8 record[s_recordSize];
+
+    HOST_CHECK(getBlob(s_section, "5000", record, sizeof(record)) == s_recordSize);
+    record[5] ^= 0x01U;
+    setBlob(s_section, "5000", record, sizeof(record));
+    int count = getAuxAssignment(s_section, readBack, 20U);
+    HOST_CHECK(count == s_assigns - 1);
+    HOST_CHECK(findEntry(readBack, count, 5000U) == nullptr);
+
+    HOST_CHECK(getBlob(s_section, "5001", record, sizeof(record)) == s_recordSize);
+    record[0] = 2U;
+    setCrc(record);
+    setBlob(s_section, "5001", record, sizeof(record));
+    count = getAuxAssignment(s_section, readBack, 20U);
+    HOST_CHECK(count == s_assigns - 2);
+    HOST_CHECK(findEntry(readBack, count, 5001U) == nullptr);
+
+    HOST_CHECK(getBlob(s_section, "5002", record, sizeof(record)) == s_recordSize);
+    setBlob(s_section, "7000", record, sizeof(record));
+    setString(s_section, "7001", "20001,1,69,3,1,2,A1A1A1A1A1A1A1A1");
+    HOST_CHECK(getAuxAssignment(s_section, readBack, 20U) == s_assigns - 2);
+
+    // setAuxAssignment() rewrites the invalid records and removes the keys without function
+    VT_AUXAPP_T assigns[20];
+    storeAssignment(assigns);
+    HOST_CHECK(getAuxAssignment(s_section, readBack, 20U) == s_assigns);
+    HOST_CHECK(getBlob(s_section, "7000", record, sizeof(record)) == 0U);
+}
+
+static void testCapacity(void)
+{
+    VT_AUXAPP_T readBack[6];
+    memset(readBack, 0x55, sizeof(readBack));
+    HOST_CHECK(getAuxAssignment(s_section, readBack, 5U) == 5);
+    HOST_CHECK((readBack[5].wObjID_Fun == 0x5555U) && (readBack[5].wObjID_Input == 0x5555U));
+    HOST_CHECK(getAuxAssignment(s_section, readBack, 0U) == 0);
+    HOST_CHECK(getAuxAssignment("CF-A-NoAssignment", readBack, 5U) == 0);
+}
+
+static void testUpdate(void)
+{
+    VT_AUXAPP_T readBack[20];
+    VT_AUXAPP_T entry = auxEntry(4U);
+    entry.wObjID_Input = 30004U;
+    updateAuxAssignment(s_section, &entry);
+    int count = getAuxAssignment(s_section, readBack, 20U);
+    HOST_CHECK(count == s_assigns);
+    HOST_CHECK((findEntry(readBack, count, 5004U) != nullptr) && (findEntry(readBack, count, 5004U)->wObjID_Input == 30004U));
+
+    entry.wObjID_Input = 0xFFFFU;
+    updateAuxAssignment(s_section, &entry);
+    count = getAuxAssignment(s_section, readBack, 20U);
+    HOST_CHECK(count == s_assigns - 1);
+    HOST_CHECK(findEntry(readBack, count, 5004U) == nullptr);
+}
+
+#if defined(HOST_TEST_NVS)
+// only removed and changed functions are written
+static void testWrites(void)
+{
+    VT_AUXAPP_T assigns[20];
+    storeAssignment(assigns);
+    int writes = nvsMockWrites();
+    setAuxAssignment(s_section, assigns, s_assigns);
+    HOST_CHECK(nvsMockWrites() == writes);
+
+    assigns[4].wObjID_Input = 1U;
+    setAuxAssignment(s_section, assigns, s_assigns - 1);
+    HOST_CHECK(nvsMockWrites() == writes + 2);
+
+    updateAuxAssignment(s_section, &assigns[4]);
+    HOST_CHECK(nvsMockWrites() == writes + 2);
+    assigns[4].wObjID_Input = 2U;
+    updateAuxAssignment(s_section, &assigns[4]);
+    HOST_CHECK(nvsMockWrites() == writes + 3);
+}
+#endif // defined(HOST_TEST_NVS)
+
+int main()
+{
+    testRoundTrip();
+    testRecordFormat();
+    testInvalidRecords();
+    testCapacity();
+    testUpdate();
+#if defined(HOST_TEST_NVS)
+    testWrites();
+    return hostTestResult("AuxAssignmentTestsNvs");
+#else
+    return hostTestResult("AuxAssignmentTests");
+#endif // defined(HOST_TEST_NVS)
+}
@@ -0,0 +1,27 @@
+// Debug output of the host tests without AppHW.cpp and AppLog.cpp: errors only, printed at once.
+
+#include <cstdarg>
+#include <cstdio>
+#include "AppLog.h"
+
+uint8_t AppLog_IsEnabled(AppLogModule_e eModule, uint8_t level_u8)
+{
+    (void)eModule;
+    return (level_u8 <= APP_LOG_LEVEL_ERROR) ? 1U : 0U;
+}
+
+void hw_DebugPrint(const char_t format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+void hw_DebugTrace(const char_t format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
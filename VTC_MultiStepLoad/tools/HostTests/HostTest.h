@@ -0,0 +1,26 @@
+// Checks of the host tests: a failed check is printed with its location and counted;
+// main() returns hostTestResult(), so that ctest reports the test as failed.
+#ifndef HOSTTEST_H
+#define HOSTTEST_H
+
+#include <cstdio>
+
+static int s_hostTestFailures = 0;
+
+#define HOST_CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++s_hostTestFailures; \
+        } \
+    } while (0)
+
+static inline int hostTestResult(const char* name)
+{
+    printf("%s: %s (%d failed checks)\n", name, (s_hostTestFailures == 0) ? "passed" : "FAILED", s_hostTestFailures);
+    return (s_hostTestFailures == 0) ? 0 : 1;
+}
+
+#endif /* HOSTTEST_H */
@@ -0,0 +1,373 @@
+// In-memory NVS for the host tests of Settings/settingsNVS.cpp: entries are looked up by
+// namespace, key and type like in the IDF storage. Set and erase calls and commits are
+// counted; the timer runs on simulated time.
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "nvs.h"
+#include "nvs_flash.h"
+#include "esp_timer.h"
+#include "NvsMock.h"
+
+struct NvsItem
+{
+    nvs_type_t type;
+    uint64_t number;
+    std::string data;       // string or blob
+};
+
+typedef std::map<std::string, NvsItem> NvsNamespace;
+
+struct NvsHandle
+{
+    std::string space;
+    bool writable;
+};
+
+struct nvs_opaque_iterator_t
+{
+    std::string space;
+    std::vector<std::pair<std::string, nvs_type_t>> entries;
+    size_t index;
+};
+
+static std::map<std::string, NvsNamespace> s_namespaces;
+static std::vector<NvsHandle> s_handles;
+static int s_writes = 0;
+static int s_commits = 0;
+static int s_openIterators = 0;
+static int64_t s_nowUs = 0;
+static esp_timer_cb_t s_timerCallback = nullptr;
+static void* s_timerArg = nullptr;
+static int64_t s_timerDueUs = -1;
+
+int nvsMockWrites(void)
+{
+    return s_writes;
+}
+
+int nvsMockCommits(void)
+{
+    return s_commits;
+}
+
+int nvsMockOpenIterators(void)
+{
+    return s_openIterators;
+}
+
+void nvsMockAdvanceUs(int64_t us)
+{
+    s_nowUs += us;
+    if ((s_timerDueUs >= 0) && (s_nowUs >= s_timerDueUs))
+    {
+        s_timerDueUs = -1;
+        s_timerCallback(s_timerArg);
+    }
+}
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    static char text[16];
+    snprintf(text, sizeof(text), "0x%X", static_cast<unsigned>(code));
+    return text;
+}
+
+esp_err_t nvs_flash_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void)
+{
+    s_namespaces.clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle)
+{
+    if (strlen(name) >= NVS_KEY_NAME_MAX_SIZE)
+    {
+        return ESP_ERR_NVS_KEY_TOO_LONG;
+    }
+    if ((open_mode == NVS_READONLY) && (s_namespaces.find(name) == s_namespaces.end()))
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+
+    s_namespaces[name];
+    s_handles.push_back(NvsHandle{ name, open_mode == NVS_READWRITE });
+    *out_handle = static_cast<nvs_handle_t>(s_handles.size());
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    (void)handle;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    (void)handle;
+    ++s_commits;
+    return ESP_OK;
+}
+
+static NvsNamespace& handleNamespace(nvs_handle_t handle)
+{
+    return s_namespaces[s_handles[handle - 1U].space];
+}
+
+// nullptr: the handle is read only or the key is too long
+static NvsNamespace* writeNamespace(nvs_handle_t handle, const char* key, esp_err_t* err)
+{
+    if (!s_handles[handle - 1U].writable)
+    {
+        *err = ESP_ERR_NVS_READ_ONLY;
+        return nullptr;
+    }
+    if ((key != nullptr) && (strlen(key) >= NVS_KEY_NAME_MAX_SIZE))
+    {
+        *err = ESP_ERR_NVS_KEY_TOO_LONG;
+        return nullptr;
+    }
+    ++s_writes;
+    *err = ESP_OK;
+    return &handleNamespace(handle);
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    esp_err_t err = ESP_OK;
+    NvsNamespace* space = writeNamespace(handle, nullptr, &err);
+    if (space != nullptr)
+    {
+        space->clear();
+    }
+    return err;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key)
+{
+    esp_err_t err = ESP_OK;
+    NvsNamespace* space = writeNamespace(handle, key, &err);
+    if ((space != nullptr) && (space->erase(key) == 0U))
+    {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    }
+    return err;
+}
+
+static esp_err_t setItem(nvs_handle_t handle, const char* key, const NvsItem& item)
+{
+    esp_err_t err = ESP_OK;
+    NvsNamespace* space = writeNamespace(handle, key, &err);
+    if (space != nullptr)
+    {
+        (*space)[key] = item;
+    }
+    return err;
+}
+
+esp_err_t nvs_set_u64(nvs_handle_t handle, const char* key, uint64_t value)
+{
+    return setItem(handle, key, NvsItem{ NVS_TYPE_U64, value, std::string() });
+}
+
+esp_err_t nvs_set_i64(nvs_handle_t handle, const char* key, int64_t value)
+{
+    return setItem(handle, key, NvsItem{ NVS_TYPE_I64, static_cast<uint64_t>(value), std::string() });
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value)
+{
+    return setItem(handle, key, NvsItem{ NVS_TYPE_STR, 0U, std::string(value) });
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length)
+{
+    return setItem(handle, key, NvsItem{ NVS_TYPE_BLOB, 0U, std::string(static_cast<const char*>(value), length) });
+}
+
+// nullptr: no entry with this key and type
+static const NvsItem* getItem(nvs_handle_t handle, const char* key, nvs_type_t type)
+{
+    const NvsNamespace& space = handleNamespace(handle);
+    NvsNamespace::const_iterator it = space.find(key);
+    return ((it != space.end()) && (it->second.type == type)) ? &it->second : nullptr;
+}
+
+esp_err_t nvs_get_u64(nvs_handle_t handle, const char* key, uint64_t* out_value)
+{
+    const NvsItem* item = getItem(handle, key, NVS_TYPE_U64);
+    if (item == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *out_value = item->number;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_i64(nvs_handle_t handle, const char* key, int64_t* out_value)
+{
+    const NvsItem* item = getItem(handle, key, NVS_TYPE_I64);
+    if (item == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *out_value = static_cast<int64_t>(item->number);
+    return ESP_OK;
+}
+
+// out_value nullptr: *length is set to the required size
+static esp_err_t getData(const NvsItem* item, size_t size, void* out_value, size_t* length)
+{
+    if (item == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (out_value == nullptr)
+    {
+        *length = size;
+        return ESP_OK;
+    }
+    if (*length < size)
+    {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    memcpy(out_value, item->data.c_str(), size);
+    *length = size;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length)
+{
+    const NvsItem* item = getItem(handle, key, NVS_TYPE_STR);
+    return getData(item, (item != nullptr) ? (item->data.size() + 1U) : 0U, out_value, length);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length)
+{
+    const NvsItem* item = getItem(handle, key, NVS_TYPE_BLOB);
+    return getData(item, (item != nullptr) ? item->data.size() : 0U, out_value, length);
+}
+
+// nullptr: the namespace has no entries
+static nvs_iterator_t findEntries(const char* namespace_name)
+{
+    std::map<std::string, NvsNamespace>::const_iterator it = s_namespaces.find(namespace_name);
+    if ((it == s_namespaces.end()) || it->second.empty())
+    {
+        return nullptr;
+    }
+
+    nvs_iterator_t iterator = new nvs_opaque_iterator_t;
+    iterator->space = namespace_name;
+    iterator->index = 0U;
+    for (NvsNamespace::const_iterator entry = it->second.begin(); entry != it->second.end(); ++entry)
+    {
+        iterator->entries.push_back(std::make_pair(entry->first, entry->second.type));
+    }
+    ++s_openIterators;
+    return iterator;
+}
+
+// false: the iterator was at the last entry and has been released
+static bool nextEntry(nvs_iterator_t iterator)
+{
+    if (++iterator->index < iterator->entries.size())
+    {
+        return true;
+    }
+    nvs_release_iterator(iterator);
+    return false;
+}
+
+static void entryInfo(nvs_iterator_t iterator, nvs_entry_info_t* out_info)
+{
+    snprintf(out_info->namespace_name, sizeof(out_info->namespace_name), "%s", iterator->space.c_str());
+    snprintf(out_info->key, sizeof(out_info->key), "%s", iterator->entries[iterator->index].first.c_str());
+    out_info->type = iterator->entries[iterator->index].second;
+}
+
+#if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0))
+esp_err_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type, nvs_iterator_t* output_iterator)
+{
+    (void)part_name;
+    (void)type;
+    *output_iterator = findEntries(namespace_name);
+    return (*output_iterator != nullptr) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator)
+{
+    if (!nextEntry(*iterator))
+    {
+        *iterator = nullptr;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_info(nvs_iterator_t iterator, nvs_entry_info_t* out_info)
+{
+    entryInfo(iterator, out_info);
+    return ESP_OK;
+}
+#else
+nvs_iterator_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type)
+{
+    (void)part_name;
+    (void)type;
+    return findEntries(namespace_name);
+}
+
+nvs_iterator_t nvs_entry_next(nvs_iterator_t iterator)
+{
+    return nextEntry(iterator) ? iterator : nullptr;
+}
+
+void nvs_entry_info(nvs_iterator_t iterator, nvs_entry_info_t* out_info)
+{
+    entryInfo(iterator, out_info);
+}
+#endif
+
+void nvs_release_iterator(nvs_iterator_t iterator)
+{
+    if (iterator != nullptr)
+    {
+        delete iterator;
+        --s_openIterators;
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return s_nowUs;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+    s_timerCallback = create_args->callback;
+    s_timerArg = create_args->arg;
+    *out_handle = reinterpret_cast<esp_timer_handle_t>(&s_timerDueUs);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    (void)timer;
+    s_timerDueUs = s_nowUs + static_cast<int64_t>(timeout_us);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    (void)timer;
+    s_timerDueUs = -1;
+    return ESP_OK;
+}
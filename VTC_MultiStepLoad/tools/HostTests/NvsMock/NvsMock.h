@@ -0,0 +1,14 @@
+// Counters and simulated time of the NVS mock (NvsMock.cpp).
+#ifndef NVS_MOCK_H
+#define NVS_MOCK_H
+
+#include <stdint.h>
+
+int nvsMockWrites(void);            // set and erase calls
+int nvsMockCommits(void);           // nvs_commit() calls
+int nvsMockOpenIterators(void);     // iterators not released yet
+
+// Advances esp_timer_get_time() and runs the timer callback when it is due.
+void nvsMockAdvanceUs(int64_t us);
+
+#endif // NVS_MOCK_H
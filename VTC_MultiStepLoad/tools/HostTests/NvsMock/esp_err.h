@@ -0,0 +1,20 @@
+// Error codes of the ESP-IDF used by the settings (NVS mock).
+#ifndef ESP_ERR_H
+#define ESP_ERR_H
+
+typedef int esp_err_t;
+
+#define ESP_OK                          0
+#define ESP_FAIL                        -1
+#define ESP_ERR_NVS_NOT_FOUND           0x1102
+#define ESP_ERR_NVS_READ_ONLY           0x1104
+#define ESP_ERR_NVS_KEY_TOO_LONG        0x1109
+#define ESP_ERR_NVS_INVALID_LENGTH      0x110c
+#define ESP_ERR_NVS_NO_FREE_PAGES       0x110d
+#define ESP_ERR_NVS_NEW_VERSION_FOUND   0x1110
+
+#define ESP_ERROR_CHECK(x) (void)(x)
+
+const char* esp_err_to_name(esp_err_t code);
+
+#endif /* ESP_ERR_H */
@@ -0,0 +1,12 @@
+// ESP-IDF version of the NVS mock: NVS_MOCK_IDF_MAJOR=4 selects the iterator API of IDF 4.
+#ifndef ESP_IDF_VERSION_H
+#define ESP_IDF_VERSION_H
+
+#ifndef NVS_MOCK_IDF_MAJOR
+#define NVS_MOCK_IDF_MAJOR 5
+#endif
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(NVS_MOCK_IDF_MAJOR, 0, 0)
+
+#endif /* ESP_IDF_VERSION_H */
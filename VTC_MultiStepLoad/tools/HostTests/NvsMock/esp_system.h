@@ -0,0 +1,7 @@
+// NVS mock: not used by the settings beyond esp_err.h.
+#ifndef ESP_SYSTEM_H
+#define ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+#endif /* ESP_SYSTEM_H */
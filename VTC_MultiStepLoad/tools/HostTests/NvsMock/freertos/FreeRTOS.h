@@ -0,0 +1,5 @@
+// NVS mock: the settings include FreeRTOS without using it.
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#endif /* FREERTOS_H */
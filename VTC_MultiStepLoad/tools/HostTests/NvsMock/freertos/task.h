@@ -0,0 +1,7 @@
+// NVS mock: the settings include FreeRTOS without using it.
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+#endif /* FREERTOS_TASK_H */
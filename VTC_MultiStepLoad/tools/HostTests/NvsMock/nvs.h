@@ -0,0 +1,61 @@
+// NVS API of the ESP-IDF used by Settings/settingsNVS.cpp, implemented in memory by NvsMock.cpp.
+// The iterator API follows ESP_IDF_VERSION (esp_idf_version.h).
+#ifndef NVS_H
+#define NVS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_idf_version.h"
+
+#define NVS_DEFAULT_PART_NAME   "nvs"
+#define NVS_KEY_NAME_MAX_SIZE   16
+
+typedef uint32_t nvs_handle_t;
+typedef enum { NVS_READONLY, NVS_READWRITE } nvs_open_mode_t;
+
+typedef enum
+{
+    NVS_TYPE_U64 = 0x08,
+    NVS_TYPE_I64 = 0x18,
+    NVS_TYPE_STR = 0x21,
+    NVS_TYPE_BLOB = 0x42,
+    NVS_TYPE_ANY = 0xff
+} nvs_type_t;
+
+typedef struct
+{
+    char namespace_name[NVS_KEY_NAME_MAX_SIZE];
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    nvs_type_t type;
+} nvs_entry_info_t;
+
+typedef struct nvs_opaque_iterator_t* nvs_iterator_t;
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_erase_all(nvs_handle_t handle);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key);
+
+esp_err_t nvs_set_u64(nvs_handle_t handle, const char* key, uint64_t value);
+esp_err_t nvs_set_i64(nvs_handle_t handle, const char* key, int64_t value);
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length);
+esp_err_t nvs_get_u64(nvs_handle_t handle, const char* key, uint64_t* out_value);
+esp_err_t nvs_get_i64(nvs_handle_t handle, const char* key, int64_t* out_value);
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length);
+
+#if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0))
+esp_err_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type, nvs_iterator_t* output_iterator);
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator);
+esp_err_t nvs_entry_info(nvs_iterator_t iterator, nvs_entry_info_t* out_info);
+#else
+nvs_iterator_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type);
+nvs_iterator_t nvs_entry_next(nvs_iterator_t iterator);
+void nvs_entry_info(nvs_iterator_t iterator, nvs_entry_info_t* out_info);
+#endif
+void nvs_release_iterator(nvs_iterator_t iterator);
+
+#endif /* NVS_H */
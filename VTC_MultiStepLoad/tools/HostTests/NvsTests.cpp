@@ -0,0 +1,194 @@
+// Host tests of Settings/settingsNVS.cpp with the in-memory NVS of NvsMock/: values,
+// long section and key names, removal, section entries and the delayed nvs_commit().
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "HostTest.h"
+#include "NvsMock.h"
+#include "settings.h"
+
+static const int64_t s_msUs = 1000;
+
+struct SectionEntries
+{
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    size_t stopAfter;
+};
+
+static uint8_t collectEntry(const char key[], const char value[], void* context)
+{
+    SectionEntries* entries = static_cast<SectionEntries*>(context);
+    entries->keys.push_back(key);
+    entries->values.push_back(value);
+    return (entries->keys.size() < entries->stopAfter) ? 1U : 0U;
+}
+
+// nullptr: the key was not passed
+static const std::string* findEntry(const SectionEntries& entries, const char* key)
+{
+    for (size_t idx = 0U; idx < entries.keys.size(); ++idx)
+    {
+        if (entries.keys[idx] == key)
+        {
+            return &entries.values[idx];
+        }
+    }
+    return nullptr;
+}
+
+// First start: defaults are returned and not written; the VT login writes three values,
+// committed once after the quiet period.
+static void testFirstStart(void)
+{
+    HOST_CHECK(getX64("CF-A", "preferredVT", 0xFFFFFFFFFFFFFFFFULL) == 0xFFFFFFFFFFFFFFFFULL);
+    HOST_CHECK(getU8("CF-A", "bootTimeVT", 7U) == 7U);
+    HOST_CHECK(nvsMockWrites() == 0);
+
+    setX64("CF-A", "preferredVT", 0xA00084000C2A1234ULL);
+    setU8("CF-A", "bootTimeVT", 3U);
+    setU8("CF-A", "sourceAddress", 0x81U);
+    HOST_CHECK(nvsMockWrites() == 3);
+    nvsMockAdvanceUs(500 * s_msUs);
+    HOST_CHECK(nvsMockCommits() == 0);
+    nvsMockAdvanceUs(600 * s_msUs);
+    HOST_CHECK(nvsMockCommits() == 1);
+
+    HOST_CHECK(getX64("CF-A", "preferredVT", 0U) == 0xA00084000C2A1234ULL);
+    HOST_CHECK(getU8("CF-A", "bootTimeVT", 7U) == 3U);
+    HOST_CHECK(getU8("CF-A", "sourceAddress", 0x80U) == 0x81U);
+
+    // unchanged value: not written again
+    setU8("CF-A", "bootTimeVT", 3U);
+    HOST_CHECK(nvsMockWrites() == 3);
+}
+
+static void testValues(void)
+{
+    setS32("Values", "negative", -5);
+    HOST_CHECK(getS16("Values", "negative", 0) == -5);
+    HOST_CHECK(getU8("Values", "negative", 9U) == 9U);
+    setU16("Values", "positive", 300U);
+    HOST_CHECK(getS64("Values", "positive", 0) == 300);
+    HOST_CHECK(getU8("Values", "positive", 9U) == 9U);
+
+    char text[32];
+    setString("Values", "text", "hello");
+    getString("Values", "text", "default", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "hello") == 0);
+
+    uint8_t blob[512];
+    uint8_t readBack[512];
+    memset(blob, 0x5A, sizeof(blob));
+    memset(readBack, 0, sizeof(readBack));
+    setBlob("Values", "blob", blob, sizeof(blob));
+    HOST_CHECK(getBlob("Values", "blob", readBack, 10U) == sizeof(blob));
+    HOST_CHECK((readBack[9] == 0x5AU) && (readBack[10] == 0U));
+    HOST_CHECK(getBlob("Values", "blob", readBack, sizeof(readBack)) == sizeof(blob));
+    HOST_CHECK(memcmp(blob, readBack, sizeof(blob)) == 0);
+}
+
+// Names longer than 15 characters are stored under a shortened name with a hash.
+static void testLongNames(void)
+{
+    char text[32];
+    setString("AVeryLongSectionNameForAux", "AnEvenLongerKeyNameThanFifteen", "hello");
+    getString("AVeryLongSectionNameForAux", "AnEvenLongerKeyNameThanFifteen", "default", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "hello") == 0);
+    getString("AVeryLongSectionNameForAux", "AnEvenLongerKeyNameThanFifteeN", "default", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "default") == 0);
+    getString("AVeryLongSectionNameForAuX", "AnEvenLongerKeyNameThanFifteen", "default", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "default") == 0);
+
+    char small[3];
+    getString("AVeryLongSectionNameForAux", "AnEvenLongerKeyNameThanFifteen", "d", small, sizeof(small));
+    HOST_CHECK(strcmp(small, "he") == 0);
+}
+
+static void testRemoval(void)
+{
+    char text[32];
+    setString("Removal", "first", "1");
+    setString("Removal", "second", "2");
+    setString("Removal", "first", nullptr);
+    getString("Removal", "first", "none", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "none") == 0);
+    getString("Removal", "second", "none", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "2") == 0);
+
+    clearSection("Removal");
+    getString("Removal", "second", "none", text, sizeof(text));
+    HOST_CHECK(strcmp(text, "none") == 0);
+    HOST_CHECK(getSectionEntries("Removal", &collectEntry, nullptr) == 0U);
+}
+
+static void testSectionEntries(void)
+{
+    const uint8_t record[24] = { 0x01U, 0x02U, 0xABU, 0xCDU };
+    setU16("Entries", "number", 4711U);
+    setS8("Entries", "negative", -3);
+    setString("Entries", "text", "value");
+    setString("Entries", "tooLong", std::string(200U, 'x').c_str());
+    setBlob("Entries", "record", record, sizeof(record));
+
+    SectionEntries entries;
+    entries.stopAfter = 100U;
+    HOST_CHECK(getSectionEntries("Entries", &collectEntry, &entries) == 4U);
+    HOST_CHECK(nvsMockOpenIterators() == 0);
+    HOST_CHECK((findEntry(entries, "number") != nullptr) && (*findEntry(entries, "number") == "4711"));
+    HOST_CHECK((findEntry(entries, "negative") != nullptr) && (*findEntry(entries, "negative") == "-3"));
+    HOST_CHECK((findEntry(entries, "text") != nullptr) && (*findEntry(entries, "text") == "value"));
+    HOST_CHECK((findEntry(entries, "record") != nullptr)
+        && (*findEntry(entries, "record") == std::string("0102ABCD") + std::string(40U, '0')));
+    HOST_CHECK(findEntry(entries, "tooLong") == nullptr);
+
+    // stopped by the callback: the iterator is released
+    SectionEntries first;
+    first.stopAfter = 1U;
+    HOST_CHECK(getSectionEntries("Entries", &collectEntry, &first) == 1U);
+    HOST_CHECK(nvsMockOpenIterators() == 0);
+
+    char section[256];
+    bool found = false;
+    HOST_CHECK(getSection("Entries", section, sizeof(section)) > 0U);
+    for (const char* entry = section; *entry != '\0'; entry += strlen(entry) + 1U)
+    {
+        found = found || (strcmp(entry, "number=4711") == 0);
+    }
+    HOST_CHECK(found);
+    HOST_CHECK(getSectionEntries("Missing", &collectEntry, &entries) == 0U);
+}
+
+// An update every 100 ms: committed at the latest FlushMaxDelayMs (10 s) after the first change.
+static void testCommits(void)
+{
+    settingsFlush();
+    int commits = nvsMockCommits();
+    int writes = nvsMockWrites();
+    for (int update = 0; update < 1000; ++update)
+    {
+        setU16("Aux", std::to_string(5000 + (update % 40)).c_str(), static_cast<uint16_t>(update));
+        nvsMockAdvanceUs(100 * s_msUs);
+    }
+    HOST_CHECK(nvsMockWrites() - writes == 1000);
+    HOST_CHECK((nvsMockCommits() - commits >= 9) && (nvsMockCommits() - commits <= 11));
+
+    setU16("Aux", "5000", 1U);
+    commits = nvsMockCommits();
+    settingsFlush();
+    HOST_CHECK(nvsMockCommits() == commits + 1);
+    settingsFlush();
+    HOST_CHECK(nvsMockCommits() == commits + 1);
+}
+
+int main()
+{
+    testFirstStart();
+    testValues();
+    testLongNames();
+    testRemoval();
+    testSectionEntries();
+    testCommits();
+    return hostTestResult("NvsTests");
+}
@@ -0,0 +1,335 @@
+// Host test of PreparePool: splits the MultiStepLoad pool and small synthetic pools and checks
+// - that every object of the source pool ends up in the derived pools (AuxiliaryFunction2 stubs added),
+// - that every reference of an object resolves in the pools uploaded up to the pool of the object,
+// - that a later definition of an object ID replaces the former one,
+// - that truncated objects are rejected,
+// - that diffPool() of identical pools is empty,
+// - that MultiStepLoad_split.h/.c have been generated from the current pool.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "PreparePool.h"
+#include "PoolStages.h"
+#include "IsoVtcApi.h"
+#include "HostTest.h"
+
+extern "C"
+{
+#include "MultiStepLoad/Output/MultiStepLoad.c.h"
+#include "MultiStepLoad_split.h"
+}
+
+static const iso_u16 s_nullID = 0xFFFFU;
+static const iso_u32 s_auxStubSize = 6U;    // AuxiliaryFunction2 with object count 0
+
+// object IDs and records of a pool in upload order
+struct PoolObject
+{
+    iso_u16 objectID;
+    const iso_u8* data;
+    iso_u32 size;
+};
+
+static std::vector<PoolObject> poolObjects(const std::vector<iso_u8>& pool)
+{
+    std::vector<PoolObject> objects;
+    iso_u32 offset = 0U;
+    while (offset < pool.size())
+    {
+        const iso_u8* data = &pool[offset];
+        PoolObject object = { static_cast<iso_u16>(data[0] + (data[1] << 8)), data, IsoPoolObjSize(data) };
+        if (object.size == 0U)
+        {
+            break;
+        }
+
+        objects.push_back(object);
+        offset += object.size;
+    }
+
+    return objects;
+}
+
+static bool containsID(const std::vector<PoolObject>& objects, iso_u16 objectID)
+{
+    for (const PoolObject& object : objects)
+    {
+        if (object.objectID == objectID)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// AuxiliaryFunction2 of the base pool without child objects, which are uploaded again with the secondary pool
+static iso_u32 countAuxStubs(const std::vector<iso_u8>& basePool, const std::vector<iso_u8>& secondaryPool)
+{
+    std::vector<PoolObject> secondaryObjects = poolObjects(secondaryPool);
+    iso_u32 count = 0U;
+    for (const PoolObject& object : poolObjects(basePool))
+    {
+        if ((object.data[2] == static_cast<iso_u8>(AuxiliaryFunction2)) && (object.size == s_auxStubSize)
+            && (containsID(secondaryObjects, object.objectID)))
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+// Each reference to an object of the source pool resolves in the pools loaded up to this pool.
+static void checkReferences(const std::vector<PoolObject>& sourceObjects,
+    const std::vector<PoolObject>& loadedObjects, const std::vector<iso_u8>& pool)
+{
+    std::vector<iso_u16> objectIDs;
+    for (const PoolObject& object : poolObjects(pool))
+    {
+        objectIDs.clear();
+        PreparePool::getObjectReferences(object.data, object.size, objectIDs);
+        for (iso_u16 objectID : objectIDs)
+        {
+            if ((objectID != s_nullID) && (containsID(sourceObjects, objectID)) && (!containsID(loadedObjects, objectID)))
+            {
+                printf("object %u references %u, which is not loaded\n", object.objectID, objectID);
+                HOST_CHECK(containsID(loadedObjects, objectID));
+            }
+        }
+    }
+}
+
+static void appendObjects(std::vector<PoolObject>& objects, const std::vector<iso_u8>& pool)
+{
+    std::vector<PoolObject> poolObjs = poolObjects(pool);
+    objects.insert(objects.end(), poolObjs.begin(), poolObjs.end());
+}
+
+static void testParsePool(void)
+{
+    //note: depending on the ISO Desigenr version the offset '1' is required.
+    const iso_u8* srcPool = isoOP_MultiStepLoad + 1;
+    const iso_u32 srcPoolSize = ISO_OP_MultiStepLoad_Size - 1;
+    std::vector<iso_u8> basePool;
+    std::vector<iso_u8> secondaryPool;
+    std::vector<iso_u8> gAuxPool;
+    HOST_CHECK(PreparePool::parsePool(srcPool, srcPoolSize, nullptr, 0, basePool, secondaryPool, gAuxPool));
+
+    std::vector<iso_u8> source(srcPool, srcPool + srcPoolSize);
+    std::vector<PoolObject> sourceObjects = poolObjects(source);
+    iso_u32 auxStubs = countAuxStubs(basePool, secondaryPool);
+    printf("base %u + secondary %u bytes, source %u bytes, %u AuxiliaryFunction2 stubs\n",
+        static_cast<unsigned>(basePool.size()), static_cast<unsigned>(secondaryPool.size()),
+        static_cast<unsigned>(srcPoolSize), static_cast<unsigned>(auxStubs));
+    HOST_CHECK((basePool.size() + secondaryPool.size()) == (srcPoolSize + (auxStubs * s_auxStubSize)));
+    HOST_CHECK((poolObjects(basePool).size() + poolObjects(secondaryPool).size()) == (sourceObjects.size() + auxStubs));
+
+    std::vector<PoolObject> loadedObjects = poolObjects(basePool);
+    checkReferences(sourceObjects, loadedObjects, basePool);
+    appendObjects(loadedObjects, secondaryPool);
+    checkReferences(sourceObjects, loadedObjects, secondaryPool);
+    checkReferences(sourceObjects, poolObjects(gAuxPool), gAuxPool);
+}
+
+static void testSplitPool(void)
+{
+    const iso_u8* srcPool = isoOP_MultiStepLoad + 1;
+    const iso_u32 srcPoolSize = ISO_OP_MultiStepLoad_Size - 1;
+    std::vector<std::vector<iso_u8>> stagePools;
+    HOST_CHECK(PreparePool::splitPool(srcPool, srcPoolSize, nullptr, 0,
+        s_poolStages, sizeof(s_poolStages) / sizeof(s_poolStages[0]), stagePools));
+    HOST_CHECK(!stagePools.empty());
+
+    std::vector<iso_u8> source(srcPool, srcPool + srcPoolSize);
+    std::vector<PoolObject> sourceObjects = poolObjects(source);
+    std::vector<iso_u8> secondaryPool;
+    std::vector<PoolObject> loadedObjects;
+    size_t totalSize = 0U;
+    for (size_t stage = 0U; stage < stagePools.size(); ++stage)
+    {
+        appendObjects(loadedObjects, stagePools[stage]);
+        checkReferences(sourceObjects, loadedObjects, stagePools[stage]);
+        totalSize += stagePools[stage].size();
+        if (stage > 0U)
+        {
+            secondaryPool.insert(secondaryPool.end(), stagePools[stage].begin(), stagePools[stage].end());
+        }
+    }
+
+    if (!stagePools.empty())
+    {
+        iso_u32 auxStubs = countAuxStubs(stagePools[0], secondaryPool);
+        HOST_CHECK(totalSize == (srcPoolSize + (auxStubs * s_auxStubSize)));
+    }
+}
+
+static void addU16(std::vector<iso_u8>& pool, iso_u16 value)
+{
+    pool.push_back(static_cast<iso_u8>(value));
+    pool.push_back(static_cast<iso_u8>(value >> 8));
+}
+
+// Table B.2 — Working Set attributes and record format, without objects
+static void addWorkingSet(std::vector<iso_u8>& pool)
+{
+    addU16(pool, 0U);
+    pool.push_back(static_cast<iso_u8>(WorkingSet));
+    pool.push_back(1U);                 // background colour
+    pool.push_back(1U);                 // selectable
+    addU16(pool, 1000U);                // active mask (not part of the pool)
+    pool.push_back(0U);                 // number of objects
+    pool.push_back(0U);                 // number of macros
+    pool.push_back(0U);                 // number of languages
+}
+
+// Table B.41 — Number Variable attributes and record format
+static void addNumberVariable(std::vector<iso_u8>& pool, iso_u16 objectID, iso_u8 value)
+{
+    addU16(pool, objectID);
+    pool.push_back(static_cast<iso_u8>(NumberVariable));
+    pool.push_back(value);
+    pool.push_back(0U);
+    pool.push_back(0U);
+    pool.push_back(0U);
+}
+
+static void testDuplicateIDs(void)
+{
+    std::vector<iso_u8> pool;
+    addWorkingSet(pool);
+    addNumberVariable(pool, 100U, 1U);
+    addNumberVariable(pool, 101U, 3U);
+    addNumberVariable(pool, 100U, 2U);
+
+    std::vector<iso_u8> basePool;
+    std::vector<iso_u8> secondaryPool;
+    std::vector<iso_u8> gAuxPool;
+    HOST_CHECK(PreparePool::parsePool(pool.data(), static_cast<iso_u32>(pool.size()), nullptr, 0,
+        basePool, secondaryPool, gAuxPool));
+
+    std::vector<PoolObject> objects = poolObjects(secondaryPool);
+    HOST_CHECK(objects.size() == 2U);
+    for (const PoolObject& object : objects)
+    {
+        if (object.objectID == 100U)
+        {
+            HOST_CHECK(object.data[3] == 2U);
+        }
+    }
+
+    std::vector<iso_u8> basePoolOnly;
+    addWorkingSet(basePoolOnly);
+    addNumberVariable(basePoolOnly, 100U, 2U);
+    std::vector<iso_u8> deltaPool;
+    HOST_CHECK(PreparePool::diffPool(basePoolOnly.data(), static_cast<iso_u32>(basePoolOnly.size()),
+        pool.data(), static_cast<iso_u32>(pool.size()), deltaPool));
+    objects = poolObjects(deltaPool);
+    HOST_CHECK((objects.size() == 1U) && (objects[0].objectID == 101U));
+}
+
+static void testReferences(void)
+{
+    // Scaled Graphic object: value (graphic object) and one macro
+    std::vector<iso_u8> scaledGraphic;
+    addU16(scaledGraphic, 300U);
+    scaledGraphic.push_back(static_cast<iso_u8>(48U));
+    addU16(scaledGraphic, 100U);        // width
+    addU16(scaledGraphic, 50U);         // height
+    scaledGraphic.push_back(0U);        // scale type
+    scaledGraphic.push_back(0U);        // options
+    addU16(scaledGraphic, 20000U);      // value
+    scaledGraphic.push_back(1U);        // number of macros
+    scaledGraphic.push_back(1U);        // event
+    scaledGraphic.push_back(5U);        // macro ID
+    std::vector<iso_u16> objectIDs;
+    HOST_CHECK(PreparePool::getObjectReferences(scaledGraphic.data(), static_cast<iso_u32>(scaledGraphic.size()), objectIDs));
+    HOST_CHECK((objectIDs.size() == 2U) && (objectIDs[0] == 20000U) && (objectIDs[1] == 5U));
+
+    // records shorter than the offsets of their layout
+    for (iso_u32 size = 3U; size < scaledGraphic.size(); ++size)
+    {
+        objectIDs.clear();
+        HOST_CHECK(!PreparePool::getObjectReferences(scaledGraphic.data(), size, objectIDs));
+    }
+
+    std::vector<iso_u8> workingSet;
+    addWorkingSet(workingSet);
+    objectIDs.clear();
+    HOST_CHECK(PreparePool::getObjectReferences(workingSet.data(), static_cast<iso_u32>(workingSet.size()), objectIDs));
+    HOST_CHECK(!PreparePool::getObjectReferences(workingSet.data(), static_cast<iso_u32>(workingSet.size() - 1U), objectIDs));
+
+    // the last object exceeds the pool
+    std::vector<iso_u8> pool(workingSet);
+    addNumberVariable(pool, 100U, 1U);
+    pool.pop_back();
+    std::vector<iso_u8> basePool;
+    std::vector<iso_u8> secondaryPool;
+    std::vector<iso_u8> gAuxPool;
+    HOST_CHECK(!PreparePool::parsePool(pool.data(), static_cast<iso_u32>(pool.size()), nullptr, 0,
+        basePool, secondaryPool, gAuxPool));
+    HOST_CHECK(basePool.empty() && secondaryPool.empty() && gAuxPool.empty());
+}
+
+static void testDiffPool(void)
+{
+    const iso_u8* srcPool = isoOP_MultiStepLoad + 1;
+    const iso_u32 srcPoolSize = ISO_OP_MultiStepLoad_Size - 1;
+    std::vector<iso_u8> deltaPool(1U, 0U);
+    HOST_CHECK(PreparePool::diffPool(srcPool, srcPoolSize, srcPool, srcPoolSize, deltaPool));
+    HOST_CHECK(deltaPool.empty());
+
+    // a changed object is the only object of the delta pool
+    std::vector<iso_u8> languagePool(srcPool, srcPool + srcPoolSize);
+    std::vector<PoolObject> objects = poolObjects(languagePool);
+    HOST_CHECK(objects.size() > 1U);
+    if (objects.size() > 1U)
+    {
+        iso_u8* data = &languagePool[static_cast<size_t>(objects[1].data - languagePool.data())];
+        data[objects[1].size - 1U] ^= 0x01U;
+        HOST_CHECK(PreparePool::diffPool(srcPool, srcPoolSize, languagePool.data(), srcPoolSize, deltaPool));
+        HOST_CHECK((deltaPool.size() == objects[1].size) && (memcmp(deltaPool.data(), data, deltaPool.size()) == 0));
+    }
+}
+
+static bool equalPool(const std::vector<iso_u8>& pool, const unsigned char* data, size_t size)
+{
+    return (pool.size() == size) && (memcmp(pool.data(), data, size) == 0);
+}
+
+// tools/PoolSplitter has to be run after each change of the ISO-Designer pool
+static void testSplitFiles(void)
+{
+    HOST_CHECK(PreparePool::poolHash(PreparePool::poolHashOffsetBasis, isoOP_MultiStepLoad, ISO_OP_MultiStepLoad_Size)
+        == MultiStepLoad_split_SourceHash);
+
+    const iso_u8* srcPool = isoOP_MultiStepLoad + 1;
+    const iso_u32 srcPoolSize = ISO_OP_MultiStepLoad_Size - 1;
+    std::vector<iso_u8> basePool;
+    std::vector<iso_u8> secondaryPool;
+    std::vector<iso_u8> gAuxPool;
+    std::vector<std::vector<iso_u8>> stagePools;
+    HOST_CHECK(PreparePool::parsePool(srcPool, srcPoolSize, nullptr, 0, basePool, secondaryPool, gAuxPool));
+    HOST_CHECK(PreparePool::splitPool(srcPool, srcPoolSize, nullptr, 0,
+        s_poolStages, sizeof(s_poolStages) / sizeof(s_poolStages[0]), stagePools));
+    HOST_CHECK(equalPool(basePool, MultiStepLoad_base, sizeof(MultiStepLoad_base)));
+    HOST_CHECK(equalPool(secondaryPool, MultiStepLoad_secondary, sizeof(MultiStepLoad_secondary)));
+    HOST_CHECK(equalPool(gAuxPool, MultiStepLoad_gAux, sizeof(MultiStepLoad_gAux)));
+    HOST_CHECK(stagePools.size() == MultiStepLoad_StageCount);
+    for (size_t stage = 0U; (stage < stagePools.size()) && (stage < MultiStepLoad_StageCount); ++stage)
+    {
+        HOST_CHECK(equalPool(stagePools[stage], MultiStepLoad_stages[stage], MultiStepLoad_stageSizes[stage]));
+    }
+}
+
+int main(void)
+{
+    testParsePool();
+    testSplitPool();
+    testDuplicateIDs();
+    testReferences();
+    testDiffPool();
+    testSplitFiles();
+    return hostTestResult("PoolTests");
+}
@@ -0,0 +1,170 @@
+// Host micro-benchmark: measures PreparePool::parsePool() on synthetic pools
+// of 1k to 60k objects, half of them AuxiliaryFunction2 objects.
+// Reports the upload stages of PoolStages.h with their estimated ETP transfer time.
+//
+// usage: PoolBenchmark [repetitions]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "PreparePool.h"
+#include "PoolStages.h"
+#include "IsoVtcApi.h"
+
+extern "C"
+{
+#include "MultiStepLoad/Output/MultiStepLoad.c.h"
+}
+
+// ETP transfer estimation
+static const double s_bitRate = 250000.0;       // bit/s
+static const double s_bitsPerFrame = 140.0;     // extended data frame, 8 bytes, incl. interframe space and stuff bits
+static const iso_u32 s_packetsPerCTS = 16U;     // packets granted by the VT per CTS
+static const iso_u32 s_framesPerCycle = 5U;     // iso_CoreTPRepeatSet() in App_Main.c
+static const double s_cycleTimeMs = 5.0;        // main loop cycle time
+
+static void printStages(void);
+
+static void addU16(std::vector<iso_u8>& pool, iso_u16 value)
+{
+    pool.push_back(static_cast<iso_u8>(value));
+    pool.push_back(static_cast<iso_u8>(value >> 8));
+}
+
+// Working set, one data mask and (numberOfObjects - 2) / 2 AuxiliaryFunction2
+// objects, each referencing its own number variable.
+static void createPool(iso_u32 numberOfObjects, std::vector<iso_u8>& pool)
+{
+    const iso_u16 dataMaskID = 1000U;
+    const iso_u16 firstAuxID = 2000U;
+    pool.clear();
+
+    // Table B.2 — Working Set attributes and record format
+    addU16(pool, 0U);
+    pool.push_back(static_cast<iso_u8>(WorkingSet));
+    pool.push_back(1U);                 // background colour
+    pool.push_back(1U);                 // selectable
+    addU16(pool, dataMaskID);           // active mask
+    pool.push_back(0U);                 // number of objects
+    pool.push_back(0U);                 // number of macros
+    pool.push_back(0U);                 // number of languages
+
+    // Table B.4 — Data mask attributes and record format
+    addU16(pool, dataMaskID);
+    pool.push_back(static_cast<iso_u8>(DataMask));
+    pool.push_back(1U);                 // background colour
+    addU16(pool, 0xFFFFU);              // soft key mask
+    pool.push_back(0U);                 // number of objects
+    pool.push_back(0U);                 // number of macros
+
+    iso_u16 objectID = firstAuxID;
+    for (iso_u32 idx = 2U; (idx + 1U) < numberOfObjects; idx += 2U)
+    {
+        // J.4.3     Auxiliary Function Type 2 object
+        addU16(pool, objectID);
+        pool.push_back(static_cast<iso_u8>(AuxiliaryFunction2));
+        pool.push_back(1U);             // background colour
+        pool.push_back(0U);             // function attributes
+        pool.push_back(1U);             // number of objects
+        addU16(pool, static_cast<iso_u16>(objectID + 1U));
+        addU16(pool, 0U);
+        addU16(pool, 0U);
+
+        // Table B.41 — Number Variable attributes and record format
+        addU16(pool, static_cast<iso_u16>(objectID + 1U));
+        pool.push_back(static_cast<iso_u8>(NumberVariable));
+        pool.push_back(0U);
+        pool.push_back(0U);
+        pool.push_back(0U);
+        pool.push_back(0U);
+        objectID = static_cast<iso_u16>(objectID + 2U);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    static const iso_u32 poolObjects[] = { 1000U, 2000U, 5000U, 10000U, 20000U, 40000U, 60000U };
+    int repetitions = (argc > 1) ? atoi(argv[1]) : 10;
+    if (repetitions <= 0)
+    {
+        repetitions = 1;
+    }
+
+    printf("%10s %10s %10s %14s\n", "objects", "aux2", "bytes", "parsePool[us]");
+    for (iso_u32 numberOfObjects : poolObjects)
+    {
+        std::vector<iso_u8> pool;
+        createPool(numberOfObjects, pool);
+
+        std::vector<iso_u8> basePool;
+        std::vector<iso_u8> secondaryPool;
+        std::vector<iso_u8> gAuxPool;
+        bool qRet = true;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep)
+        {
+            qRet = qRet && PreparePool::parsePool(pool.data(), static_cast<iso_u32>(pool.size()),
+                nullptr, 0,
+                basePool,
+                secondaryPool,
+                gAuxPool);
+        }
+
+        std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+        printf("%10u %10u %10u %14.1f%s\n",
+            static_cast<unsigned>(IsoGetNumofPoolObjs(pool.data(), static_cast<iso_s32>(pool.size()))),
+            static_cast<unsigned>((numberOfObjects - 2U) / 2U),
+            static_cast<unsigned>(pool.size()),
+            duration.count() / repetitions,
+            qRet ? "" : "  (failed)");
+    }
+
+    printStages();
+    return 0;
+}
+
+// Bus time and cycle limited time of an object pool transfer message (function 0x11 + pool data).
+static void estimateTransfer(iso_u32 poolSize, iso_u32* pFrames, double* pBusMs, double* pCycleMs)
+{
+    iso_u32 dataFrames = (poolSize + 1U + 6U) / 7U;
+    iso_u32 ctsCount = (dataFrames + s_packetsPerCTS - 1U) / s_packetsPerCTS;
+    iso_u32 controlFrames = 2U + (2U * ctsCount);   // RTS, CTS/DPO per burst, EOMA
+    *pFrames = dataFrames + controlFrames;
+    *pBusMs = (*pFrames * s_bitsPerFrame * 1000.0) / s_bitRate;
+    *pCycleMs = ((dataFrames + s_framesPerCycle - 1U) / s_framesPerCycle) * s_cycleTimeMs;
+}
+
+void printStages(void)
+{
+    std::vector<std::vector<iso_u8>> stagePools;
+    //note: depending on the ISO Desigenr version the offset '1' is required.
+    if (!PreparePool::splitPool(isoOP_MultiStepLoad + 1, ISO_OP_MultiStepLoad_Size - 1,
+        nullptr, 0,
+        s_poolStages, sizeof(s_poolStages) / sizeof(s_poolStages[0]),
+        stagePools))
+    {
+        printf("splitPool has failed.\n");
+        return;
+    }
+
+    printf("\nMultiStepLoad upload stages (%.0f kbit/s, %u packets per CTS, %u frames per %.0f ms cycle)\n",
+        s_bitRate / 1000.0, static_cast<unsigned>(s_packetsPerCTS), static_cast<unsigned>(s_framesPerCycle), s_cycleTimeMs);
+    printf("%6s %8s %8s %8s %10s %10s %10s\n", "stage", "objects", "bytes", "frames", "bus[ms]", "cycle[ms]", "total[ms]");
+    double totalMs = 0.0;
+    for (size_t stage = 0; stage < stagePools.size(); ++stage)
+    {
+        const std::vector<iso_u8>& pool = stagePools[stage];
+        iso_u32 frames = 0U;
+        double busMs = 0.0;
+        double cycleMs = 0.0;
+        estimateTransfer(static_cast<iso_u32>(pool.size()), &frames, &busMs, &cycleMs);
+        totalMs += (busMs > cycleMs) ? busMs : cycleMs;
+        printf("%6u %8u %8u %8u %10.1f %10.1f %10.1f\n",
+            static_cast<unsigned>(stage),
+            static_cast<unsigned>(IsoGetNumofPoolObjs(pool.data(), static_cast<iso_s32>(pool.size()))),
+            static_cast<unsigned>(pool.size()),
+            static_cast<unsigned>(frames),
+            busMs, cycleMs, totalMs);
+    }
+}
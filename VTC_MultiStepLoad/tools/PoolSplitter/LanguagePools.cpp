@@ -0,0 +1,442 @@
+// Host tool: generates the language delta pools from the ISO-Designer output at build time;
+// see AppIso/pools/Readme.txt.
+// Each language pool listed in the ISO-Designer configuration (JetViewERS.cfg) is compared with the
+// pool of the default language at object granularity; only added or changed objects are kept.
+//
+// usage: LanguagePools <output base name> <JetViewERS.cfg> [<language>=<fallback language> ...]
+//        writes <output base name>.h and <output base name>.c
+//        <language>=<fallback language> adds a VT language without pool, which uses the pool of
+//        the fallback language, e.g. sv=de; the fallback language may have a fallback itself.
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "PreparePool.h"
+#include "IsoVtcApi.h"
+
+struct LanguagePool
+{
+    std::string code;           // ISO 639-1 code of the VT language
+    std::string fallback;       // VT language whose pool is used instead; only if fileName is empty
+    std::string fileName;       // IOP file of ISO-Designer
+    bool isDefault;             // default language of the project; pool is the secondary pool
+    std::vector<iso_u8> pool;   // delta pool
+};
+
+static const unsigned noLanguage = 0xFFU;       // index of the default language within the registry
+static const unsigned languageIndexSize = 26U;  // letters of a language code
+
+static bool readFile(const std::string& fileName, std::string& content);
+static bool readConfig(const std::string& fileName, std::string& projectName, std::vector<LanguagePool>& languages);
+static std::string getElement(const std::string& text, const char* name);
+static std::string getArrayName(const std::string& projectName, const LanguagePool& language);
+static std::string getLanguageCode(const std::string& code);
+static bool getRegistry(const std::vector<LanguagePool>& languages, std::vector<const LanguagePool*>& registry,
+    std::vector<unsigned>& fallbacks);
+
+static bool writeHeader(const std::string& fileName, const std::string& guard,
+    const std::string& projectName, const std::vector<LanguagePool>& languages, size_t languageCount);
+
+static bool writeSource(const std::string& fileName, const std::string& headerName,
+    const std::string& projectName, const std::vector<const LanguagePool*>& registry,
+    const std::vector<unsigned>& fallbacks);
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <output base name> <JetViewERS.cfg> [<language>=<pool language> ...]\n", argv[0]);
+        return 1;
+    }
+
+    std::string configName(argv[2]);
+    std::string::size_type pos = configName.find_last_of("/\\");
+    std::string configDir = (pos == std::string::npos) ? std::string() : configName.substr(0, pos + 1);
+    std::string projectName;
+    std::vector<LanguagePool> languages;
+    if (!readConfig(configName, projectName, languages))
+    {
+        return 1;
+    }
+
+    for (int idx = 3; idx < argc; ++idx)
+    {
+        std::string alias(argv[idx]);
+        pos = alias.find('=');
+        if ((pos != 2U) || (alias.size() != 5U) || (getLanguageCode(alias.substr(0, 2)).empty()))
+        {
+            fprintf(stderr, "invalid fallback %s\n", alias.c_str());
+            return 1;
+        }
+
+        languages.push_back({ alias.substr(0, 2), alias.substr(3), std::string(), false, std::vector<iso_u8>() });
+    }
+
+    std::string basePool;
+    for (const LanguagePool& language : languages)
+    {
+        if ((language.isDefault) && (!readFile(configDir + language.fileName, basePool)))
+        {
+            return 1;
+        }
+    }
+
+    if (basePool.empty())
+    {
+        fprintf(stderr, "%s: no default language\n", configName.c_str());
+        return 1;
+    }
+
+    for (LanguagePool& language : languages)
+    {
+        std::string languagePool;
+        if ((language.isDefault) || (language.fileName.empty()))
+        {
+            continue;
+        }
+
+        if ((!readFile(configDir + language.fileName, languagePool))
+            || (!PreparePool::diffPool(reinterpret_cast<const iso_u8*>(basePool.data()), static_cast<iso_u32>(basePool.size()),
+                    reinterpret_cast<const iso_u8*>(languagePool.data()), static_cast<iso_u32>(languagePool.size()),
+                    language.pool)))
+        {
+            fprintf(stderr, "%s: pool parsing has failed.\n", language.fileName.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<const LanguagePool*> registry;
+    std::vector<unsigned> fallbacks;
+    if (!getRegistry(languages, registry, fallbacks))
+    {
+        return 1;
+    }
+
+    std::string baseName(argv[1]);
+    pos = baseName.find_last_of("/\\");
+    std::string headerName = (pos == std::string::npos) ? baseName : baseName.substr(pos + 1);
+    std::string guard;
+    for (char c : headerName)
+    {
+        guard += static_cast<char>(((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c);
+    }
+
+    headerName += ".h";
+    guard += "_H";
+    if ((!writeHeader(baseName + ".h", guard, projectName, languages, registry.size()))
+        || (!writeSource(baseName + ".c", headerName, projectName, registry, fallbacks)))
+    {
+        return 1;
+    }
+
+    for (const LanguagePool& language : languages)
+    {
+        if (language.fileName.empty())
+        {
+            printf("%s -> %s\n", language.code.c_str(), language.fallback.c_str());
+        }
+        else if (!language.isDefault)
+        {
+            printf("%-24s %6u bytes\n", getArrayName(projectName, language).c_str(), static_cast<unsigned>(language.pool.size()));
+        }
+    }
+
+    return 0;
+}
+
+bool readFile(const std::string& fileName, std::string& content)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    content.clear();
+    char buffer[4096];
+    size_t count = 0U;
+    while ((count = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+    {
+        content.append(buffer, count);
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Reads the project name and the <Language> entries of the ISO-Designer configuration.
+bool readConfig(const std::string& fileName, std::string& projectName, std::vector<LanguagePool>& languages)
+{
+    std::string config;
+    if (!readFile(fileName, config))
+    {
+        return false;
+    }
+
+    projectName = getElement(config, "ProjectName");
+    std::string::size_type begin = config.find("<Language>");
+    while (begin != std::string::npos)
+    {
+        std::string::size_type end = config.find("</Language>", begin);
+        std::string entry = config.substr(begin, end - begin);
+        std::string code = getElement(entry, "Code");
+        if (getLanguageCode(code).empty())
+        {
+            // the pool label provides two characters only
+            fprintf(stderr, "%s: language code %s is not supported\n", fileName.c_str(), code.c_str());
+            return false;
+        }
+
+        languages.push_back({ code, std::string(), getElement(entry, "FileName"), getElement(entry, "Default") == "1", std::vector<iso_u8>() });
+        begin = config.find("<Language>", end);
+    }
+
+    if (projectName.empty() || languages.empty())
+    {
+        fprintf(stderr, "%s: no project languages\n", fileName.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::string getElement(const std::string& text, const char* name)
+{
+    std::string beginTag = std::string("<") + name + ">";
+    std::string endTag = std::string("</") + name + ">";
+    std::string::size_type begin = text.find(beginTag);
+    if (begin == std::string::npos)
+    {
+        return std::string();
+    }
+
+    begin += beginTag.size();
+    return text.substr(begin, text.find(endTag, begin) - begin);
+}
+
+std::string getArrayName(const std::string& projectName, const LanguagePool& language)
+{
+    return projectName + "_lang_" + language.code;
+}
+
+// Returns the C expression of a two letter language code; empty if the code is not supported.
+std::string getLanguageCode(const std::string& code)
+{
+    if ((code.size() != 2U)
+        || (code[0] < 'a') || (code[0] > 'z')
+        || (code[1] < 'a') || (code[1] > 'z'))
+    {
+        return std::string();
+    }
+
+    return "(('" + code.substr(0, 1) + "' << 8) + '" + code.substr(1, 1) + "')";
+}
+
+// Collects all languages besides the default language and resolves their fallback languages.
+bool getRegistry(const std::vector<LanguagePool>& languages, std::vector<const LanguagePool*>& registry,
+    std::vector<unsigned>& fallbacks)
+{
+    std::string defaultCode;
+    for (const LanguagePool& language : languages)
+    {
+        if (language.isDefault)
+        {
+            defaultCode = language.code;
+        }
+        else
+        {
+            registry.push_back(&language);
+        }
+    }
+
+    if (registry.size() >= noLanguage)
+    {
+        fprintf(stderr, "too many languages\n");
+        return false;
+    }
+
+    for (const LanguagePool* language : registry)
+    {
+        unsigned fallback = noLanguage;
+        for (size_t idx = 0; idx < registry.size(); ++idx)
+        {
+            if ((registry[idx]->code == language->code) && (registry[idx] != language))
+            {
+                fprintf(stderr, "language %s is defined twice\n", language->code.c_str());
+                return false;
+            }
+
+            if (registry[idx]->code == language->fallback)
+            {
+                fallback = static_cast<unsigned>(idx);
+            }
+        }
+
+        if ((language->fileName.empty()) && (fallback == noLanguage) && (language->fallback != defaultCode))
+        {
+            fprintf(stderr, "language %s: fallback %s is not available\n", language->code.c_str(), language->fallback.c_str());
+            return false;
+        }
+
+        fallbacks.push_back(fallback);
+    }
+
+    // each fallback chain ends at a language with pool or at the default language
+    for (size_t idx = 0; idx < registry.size(); ++idx)
+    {
+        unsigned language = static_cast<unsigned>(idx);
+        size_t steps = 0U;
+        while ((language != noLanguage) && (registry[language]->fileName.empty()) && (steps <= registry.size()))
+        {
+            language = fallbacks[language];
+            steps++;
+        }
+
+        if (steps > registry.size())
+        {
+            fprintf(stderr, "language %s: fallback chain is cyclic\n", registry[idx]->code.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool writeHeader(const std::string& fileName, const std::string& guard,
+    const std::string& projectName, const std::vector<LanguagePool>& languages, size_t languageCount)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    fprintf(file, "// Generated by tools/PoolSplitter/LanguagePools from JetViewERS.cfg\n");
+    fprintf(file, "// Do not change!\n\n");
+    fprintf(file, "#ifndef %s\n", guard.c_str());
+    fprintf(file, "#define %s\n\n", guard.c_str());
+    for (const LanguagePool& language : languages)
+    {
+        if (language.isDefault)
+        {
+            fprintf(file, "// the default language is provided by the secondary pool\n");
+            fprintf(file, "#define %s_DefaultLanguage %s\n\n", projectName.c_str(), getLanguageCode(language.code).c_str());
+        }
+        else if (!language.fileName.empty())
+        {
+            std::string name = getArrayName(projectName, language);
+            fprintf(file, "#define %s_Size %u\n", name.c_str(), static_cast<unsigned>(language.pool.size()));
+            fprintf(file, "#define %s_NumObjs %u\n\n", name.c_str(),
+                static_cast<unsigned>(IsoGetNumofPoolObjs(language.pool.data(), static_cast<iso_s32>(language.pool.size()))));
+        }
+        else
+        {
+            // uses the pool of its fallback language
+        }
+    }
+
+    for (const LanguagePool& language : languages)
+    {
+        if ((!language.isDefault) && (!language.fileName.empty()))
+        {
+            std::string name = getArrayName(projectName, language);
+            fprintf(file, "extern const unsigned char %s[%s_Size];\n", name.c_str(), name.c_str());
+        }
+    }
+
+    fprintf(file, "\n// VT language besides the default language; its delta pool is loaded after the secondary pool.\n");
+    fprintf(file, "struct PoolLanguage\n{\n");
+    fprintf(file, "    unsigned short languageCode;        // VT language\n");
+    fprintf(file, "    unsigned char fallback;             // index of the language used instead; %s_NoLanguage: default language\n", projectName.c_str());
+    fprintf(file, "    const unsigned char* pool;          // delta pool; 0: the pool of the fallback language is used\n");
+    fprintf(file, "    unsigned long size;\n");
+    fprintf(file, "    unsigned short numObjs;\n");
+    fprintf(file, "};\n\n");
+    fprintf(file, "#define %s_LanguageCount %u\n", projectName.c_str(), static_cast<unsigned>(languageCount));
+    fprintf(file, "#define %s_NoLanguage 0x%02X\n\n", projectName.c_str(), noLanguage);
+    fprintf(file, "extern const struct PoolLanguage %s_languages[%s_LanguageCount];\n\n", projectName.c_str(), projectName.c_str());
+    fprintf(file, "// index of a language code within %s_languages; %s_NoLanguage: not supported\n",
+        projectName.c_str(), projectName.c_str());
+    fprintf(file, "// [first letter - 'a'][second letter - 'a']\n");
+    fprintf(file, "extern const unsigned char %s_languageIndex[%u][%u];\n\n", projectName.c_str(), languageIndexSize, languageIndexSize);
+    fprintf(file, "#endif\n");
+    return (fclose(file) == 0);
+}
+
+bool writeSource(const std::string& fileName, const std::string& headerName,
+    const std::string& projectName, const std::vector<const LanguagePool*>& registry,
+    const std::vector<unsigned>& fallbacks)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    fprintf(file, "// Generated by tools/PoolSplitter/LanguagePools from JetViewERS.cfg\n");
+    fprintf(file, "// Do not change!\n\n");
+    fprintf(file, "#include \"%s\"\n\n", headerName.c_str());
+    for (const LanguagePool* language : registry)
+    {
+        if (language->fileName.empty())
+        {
+            continue;
+        }
+
+        std::string name = getArrayName(projectName, *language);
+        fprintf(file, "const unsigned char %s[%s_Size] = {", name.c_str(), name.c_str());
+        for (size_t idx = 0; idx < language->pool.size(); ++idx)
+        {
+            fprintf(file, "%s0x%02x,", ((idx % 12) == 0) ? "\n    " : " ", language->pool[idx]);
+        }
+
+        fprintf(file, "\n}; // %s\n\n", name.c_str());
+    }
+
+    fprintf(file, "const struct PoolLanguage %s_languages[%s_LanguageCount] = {\n", projectName.c_str(), projectName.c_str());
+    for (size_t idx = 0; idx < registry.size(); ++idx)
+    {
+        const LanguagePool* language = registry[idx];
+        std::string name = getArrayName(projectName, *language);
+        if (language->fileName.empty())
+        {
+            fprintf(file, "    { %s, 0x%02X, 0, 0, 0 },  // %s -> %s\n",
+                getLanguageCode(language->code).c_str(), fallbacks[idx],
+                language->code.c_str(), language->fallback.c_str());
+        }
+        else
+        {
+            fprintf(file, "    { %s, 0x%02X, %s, %s_Size, %s_NumObjs },\n",
+                getLanguageCode(language->code).c_str(), noLanguage,
+                name.c_str(), name.c_str(), name.c_str());
+        }
+    }
+
+    fprintf(file, "};\n\nconst unsigned char %s_languageIndex[%u][%u] = {\n", projectName.c_str(), languageIndexSize, languageIndexSize);
+    for (unsigned first = 0U; first < languageIndexSize; ++first)
+    {
+        fprintf(file, "    {");
+        for (unsigned second = 0U; second < languageIndexSize; ++second)
+        {
+            unsigned index = noLanguage;
+            for (size_t idx = 0; idx < registry.size(); ++idx)
+            {
+                if ((registry[idx]->code[0] == static_cast<char>('a' + first))
+                    && (registry[idx]->code[1] == static_cast<char>('a' + second)))
+                {
+                    index = static_cast<unsigned>(idx);
+                }
+            }
+
+            fprintf(file, "%s0x%02X", (second == 0U) ? " " : ", ", index);
+        }
+
+        fprintf(file, " }, // %c\n", static_cast<char>('a' + first));
+    }
+
+    fprintf(file, "};\n");
+    return (fclose(file) == 0);
+}
@@ -0,0 +1,192 @@
+// Host tool: splits the ISO-Designer pool into the base, secondary and gAux pools
+// and into the upload stages of PoolStages.h at build time; see AppIso/pools/Readme.txt.
+//
+// usage: PoolSplitter <output base name>
+//        writes <output base name>.h and <output base name>.c
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "PreparePool.h"
+#include "PoolStages.h"
+#include "IsoVtcApi.h"
+
+extern "C"
+{
+#include "MultiStepLoad/Output/MultiStepLoad.c.h"
+}
+
+struct NamedPool
+{
+    std::string name;
+    const std::vector<iso_u8>* pool;
+};
+
+static bool writeHeader(const std::string& fileName, const std::string& guard,
+    const std::vector<NamedPool>& pools, size_t stageCount);
+
+static bool writeSource(const std::string& fileName, const std::string& headerName,
+    const std::vector<NamedPool>& pools, size_t stageCount);
+
+static void writeDefines(FILE* file, const NamedPool& pool);
+static void writeArray(FILE* file, const NamedPool& pool);
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output base name>\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<iso_u8> basePool;
+    std::vector<iso_u8> secondaryPool;
+    std::vector<iso_u8> gAuxPool;
+    std::vector<std::vector<iso_u8>> stagePools;
+
+    //note: depending on the ISO Desigenr version the offset '1' is required.
+    if ((!PreparePool::parsePool(isoOP_MultiStepLoad + 1, ISO_OP_MultiStepLoad_Size - 1,
+            nullptr, 0,
+            basePool,
+            secondaryPool,
+            gAuxPool))
+        || (!PreparePool::splitPool(isoOP_MultiStepLoad + 1, ISO_OP_MultiStepLoad_Size - 1,
+            nullptr, 0,
+            s_poolStages, sizeof(s_poolStages) / sizeof(s_poolStages[0]),
+            stagePools)))
+    {
+        fprintf(stderr, "pool parsing has failed.\n");
+        return 1;
+    }
+
+    std::vector<NamedPool> pools;
+    pools.push_back({ "MultiStepLoad_base", &basePool });
+    pools.push_back({ "MultiStepLoad_secondary", &secondaryPool });
+    pools.push_back({ "MultiStepLoad_gAux", &gAuxPool });
+    for (size_t stage = 0; stage < stagePools.size(); ++stage)
+    {
+        pools.push_back({ "MultiStepLoad_stage" + std::to_string(stage), &stagePools[stage] });
+    }
+
+    std::string baseName(argv[1]);
+    std::string::size_type pos = baseName.find_last_of("/\\");
+    std::string headerName = (pos == std::string::npos) ? baseName : baseName.substr(pos + 1);
+    std::string guard;
+    for (char c : headerName)
+    {
+        guard += static_cast<char>(((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c);
+    }
+
+    headerName += ".h";
+    guard += "_H";
+    if ((!writeHeader(baseName + ".h", guard, pools, stagePools.size()))
+        || (!writeSource(baseName + ".c", headerName, pools, stagePools.size())))
+    {
+        return 1;
+    }
+
+    for (const NamedPool& pool : pools)
+    {
+        printf("%-24s %6u bytes\n", pool.name.c_str(), static_cast<unsigned>(pool.pool->size()));
+    }
+
+    return 0;
+}
+
+bool writeHeader(const std::string& fileName, const std::string& guard,
+    const std::vector<NamedPool>& pools, size_t stageCount)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    fprintf(file, "// Generated by tools/PoolSplitter from MultiStepLoad.c\n");
+    fprintf(file, "// Do not change!\n\n");
+    fprintf(file, "#ifndef %s\n", guard.c_str());
+    fprintf(file, "#define %s\n\n", guard.c_str());
+    fprintf(file, "#define MultiStepLoad_split_SourceSize %u\n", static_cast<unsigned>(ISO_OP_MultiStepLoad_Size));
+    // checked by VTCPool.cpp against the pool it is linked with
+    fprintf(file, "#define MultiStepLoad_split_SourceHash 0x%016llXULL\n\n", static_cast<unsigned long long>(
+        PreparePool::poolHash(PreparePool::poolHashOffsetBasis, isoOP_MultiStepLoad, ISO_OP_MultiStepLoad_Size)));
+    for (const NamedPool& pool : pools)
+    {
+        writeDefines(file, pool);
+    }
+
+    for (const NamedPool& pool : pools)
+    {
+        fprintf(file, "extern const unsigned char %s[%s_Size];\n", pool.name.c_str(), pool.name.c_str());
+    }
+
+    fprintf(file, "\n// upload stages; see PoolStages.h\n");
+    fprintf(file, "#define MultiStepLoad_StageCount %u\n\n", static_cast<unsigned>(stageCount));
+    fprintf(file, "extern const unsigned char* const MultiStepLoad_stages[MultiStepLoad_StageCount];\n");
+    fprintf(file, "extern const unsigned long MultiStepLoad_stageSizes[MultiStepLoad_StageCount];\n");
+    fprintf(file, "extern const unsigned short MultiStepLoad_stageNumObjs[MultiStepLoad_StageCount];\n\n");
+    fprintf(file, "#endif\n");
+    return (fclose(file) == 0);
+}
+
+bool writeSource(const std::string& fileName, const std::string& headerName,
+    const std::vector<NamedPool>& pools, size_t stageCount)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    fprintf(file, "// Generated by tools/PoolSplitter from MultiStepLoad.c\n");
+    fprintf(file, "// Do not change!\n\n");
+    fprintf(file, "#include \"%s\"\n\n", headerName.c_str());
+    for (const NamedPool& pool : pools)
+    {
+        writeArray(file, pool);
+    }
+
+    // the stage pools are the last entries of pools
+    size_t firstStage = pools.size() - stageCount;
+    fprintf(file, "const unsigned char* const MultiStepLoad_stages[MultiStepLoad_StageCount] = {\n");
+    for (size_t idx = firstStage; idx < pools.size(); ++idx)
+    {
+        fprintf(file, "    %s,\n", pools[idx].name.c_str());
+    }
+
+    fprintf(file, "};\n\nconst unsigned long MultiStepLoad_stageSizes[MultiStepLoad_StageCount] = {\n");
+    for (size_t idx = firstStage; idx < pools.size(); ++idx)
+    {
+        fprintf(file, "    %s_Size,\n", pools[idx].name.c_str());
+    }
+
+    fprintf(file, "};\n\nconst unsigned short MultiStepLoad_stageNumObjs[MultiStepLoad_StageCount] = {\n");
+    for (size_t idx = firstStage; idx < pools.size(); ++idx)
+    {
+        fprintf(file, "    %s_NumObjs,\n", pools[idx].name.c_str());
+    }
+
+    fprintf(file, "};\n");
+    return (fclose(file) == 0);
+}
+
+void writeDefines(FILE* file, const NamedPool& pool)
+{
+    fprintf(file, "#define %s_Size %u\n", pool.name.c_str(), static_cast<unsigned>(pool.pool->size()));
+    fprintf(file, "#define %s_NumObjs %u\n\n", pool.name.c_str(),
+        static_cast<unsigned>(IsoGetNumofPoolObjs(pool.pool->data(), static_cast<iso_s32>(pool.pool->size()))));
+}
+
+void writeArray(FILE* file, const NamedPool& pool)
+{
+    const std::vector<iso_u8>& data = *pool.pool;
+    fprintf(file, "const unsigned char %s[%s_Size] = {", pool.name.c_str(), pool.name.c_str());
+    for (size_t idx = 0; idx < data.size(); ++idx)
+    {
+        fprintf(file, "%s0x%02x,", ((idx % 12) == 0) ? "\n    " : " ", data[idx]);
+    }
+
+    fprintf(file, "\n}; // %s\n\n", pool.name.c_str());
+}
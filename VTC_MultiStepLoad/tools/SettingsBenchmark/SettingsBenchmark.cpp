@@ -0,0 +1,157 @@
+// Host micro-benchmark of the settings (Settings/settings.h) with the backend of the build:
+// - time per call of the settings functions through the cache of settingsCache.cpp and of the
+//   backend functions (settingsBackend.h) they replace
+// - updateAuxAssignment() of 40 auxiliary functions in turn, followed by settingsFlush()
+//
+// usage: SettingsBenchmark [updates] [calls]
+//
+// The glib backend writes settings.ini in the working directory. Section [Settings] of
+// settings.ini sets the write-behind; FlushDelayMs=0 writes the file at each change:
+//    printf '[Settings]\nFlushDelayMs=0\n' > settings.ini && SettingsBenchmark
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "IsoDef.h"
+#include "AppMemAccess.h"
+#include "settings.h"
+#include "settingsBackend.h"
+
+static const char s_auxSection[] = "CF-A-AuxAssignment";
+static const iso_u16 s_auxFunctions = 40U;
+
+// ns per call since start
+static double nsPerCall(std::chrono::steady_clock::time_point start, int calls)
+{
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / calls;
+}
+
+static void benchmarkCalls(int calls)
+{
+    static const char section[] = "Benchmark";
+    volatile uint64_t sink = 0U;
+    uint64_t value = 0U;
+    double backendNs = 0.0;
+    double cacheNs = 0.0;
+    std::chrono::steady_clock::time_point start;
+
+    setU8(section, "u8", 1U);
+    setX64(section, "x64", 0xA00084000C2A1234ULL);
+    setU16(section, "u16", 0U);
+    settingsFlush();
+    printf("%-22s %12s %12s\n", "ns per call", "backend", "cache");
+
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        (void)settingsBackendGetU64(section, "u8", &value, 0U);
+        sink = sink + value;
+    }
+    backendNs = nsPerCall(start, calls);
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        sink = sink + getU8(section, "u8", 0U);
+    }
+    cacheNs = nsPerCall(start, calls);
+    printf("%-22s %12.0f %12.0f\n", "getU8", backendNs, cacheNs);
+
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        (void)settingsBackendGetU64(section, "x64", &value, 1U);
+        sink = sink + value;
+    }
+    backendNs = nsPerCall(start, calls);
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        sink = sink + getX64(section, "x64", 0U);
+    }
+    cacheNs = nsPerCall(start, calls);
+    printf("%-22s %12.0f %12.0f\n", "getX64", backendNs, cacheNs);
+
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        settingsBackendSetU64(section, "u8", 1U, 0U);
+    }
+    backendNs = nsPerCall(start, calls);
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        setU8(section, "u8", 1U);
+    }
+    cacheNs = nsPerCall(start, calls);
+    printf("%-22s %12.0f %12.0f\n", "setU8 same value", backendNs, cacheNs);
+
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        settingsBackendSetU64(section, "u16", static_cast<uint16_t>(call), 0U);
+    }
+    backendNs = nsPerCall(start, calls);
+    start = std::chrono::steady_clock::now();
+    for (int call = 0; call < calls; ++call)
+    {
+        setU16(section, "u16", static_cast<uint16_t>(call + 1));
+    }
+    cacheNs = nsPerCall(start, calls);
+    printf("%-22s %12.0f %12.0f\n", "setU16 new value", backendNs, cacheNs);
+
+    clearSection(section);
+    settingsFlush();
+    (void)sink;
+}
+
+static void benchmarkAuxUpdates(int updates)
+{
+    VT_AUXAPP_T sAuxAss;
+    memset(&sAuxAss, 0, sizeof(sAuxAss));
+    sAuxAss.eAuxType = static_cast<VTAUXTYP_e>(1);
+    sAuxAss.wManuCode = 69U;
+    sAuxAss.wModelIdentCode = 3U;
+    sAuxAss.qPrefAssign = ISO_TRUE;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int update = 0; update < updates; ++update)
+    {
+        sAuxAss.wObjID_Fun = static_cast<iso_u16>(5000U + (update % s_auxFunctions));
+        sAuxAss.wObjID_Input = static_cast<iso_u16>(20000U + update);
+        sAuxAss.baAuxName[0] = static_cast<iso_u8>(update);
+        updateAuxAssignment(s_auxSection, &sAuxAss);
+    }
+    std::chrono::steady_clock::time_point updated = std::chrono::steady_clock::now();
+    settingsFlush();
+    std::chrono::steady_clock::time_point flushed = std::chrono::steady_clock::now();
+
+    std::chrono::duration<double, std::milli> updateTime = updated - start;
+    std::chrono::duration<double, std::milli> flushTime = flushed - updated;
+    printf("%d updateAuxAssignment() (%u functions): %.1f ms, %.2f us per call, settingsFlush() %.2f ms\n",
+        updates, static_cast<unsigned>(s_auxFunctions), updateTime.count(),
+        (updateTime.count() * 1000.0) / updates, flushTime.count());
+}
+
+int main(int argc, char* argv[])
+{
+    int updates = (argc > 1) ? atoi(argv[1]) : 1000;
+    int calls = (argc > 2) ? atoi(argv[2]) : 100000;
+    if ((updates <= 0) || (calls <= 0))
+    {
+        printf("usage: SettingsBenchmark [updates] [calls]\n");
+        return 1;
+    }
+
+    // read from the backend, so that the default is not written to settings.ini
+    uint64_t flushDelayMs = 1000U;
+    (void)settingsBackendGetU64("Settings", "FlushDelayMs", &flushDelayMs, 0U);
+    printf("Settings.FlushDelayMs %u\n", static_cast<unsigned>(flushDelayMs));
+    clearSection(s_auxSection);
+    settingsFlush();
+
+    benchmarkCalls(calls);
+    benchmarkAuxUpdates(updates);
+    return 0;
+}
@@ -0,0 +1,275 @@
+// Implementation of AppHW.h for the VT simulator; replaces AppCommon/AppHW.cpp.
+
+#include <cstdio>
+#include "AppHW.h"
+#include "SimHW.h"
+
+static const int16_t s_errOverflow = -6;         // E_OVERFLOW
+static const uint64_t s_settleUs = 200000U;      // run time after the final mask has been activated
+
+static VirtualCanBus* s_bus = nullptr;
+static VtServer* s_vt = nullptr;
+static size_t s_ecuStation = 0U;
+static size_t s_vtStation = 0U;
+static uint64_t s_nowUs = 0U;
+static uint64_t s_stopUs = 0U;
+static bool s_verbose = false;
+static int16_t s_fixedFreeTxSlots = -1;
+static uint32_t s_txOverflows = 0U;
+
+void simHwSetup(VirtualCanBus* bus, size_t ecuStation, size_t vtStation, VtServer* vt, uint64_t stopUs, bool verbose)
+{
+    s_bus = bus;
+    s_ecuStation = ecuStation;
+    s_vtStation = vtStation;
+    s_vt = vt;
+    s_nowUs = 0U;
+    s_stopUs = stopUs;
+    s_verbose = verbose;
+}
+
+uint64_t simHwGetTimeUs(void)
+{
+    return s_nowUs;
+}
+
+void simHwSetFixedFreeTxSlots(int16_t fixedFreeTxSlots)
+{
+    s_fixedFreeTxSlots = fixedFreeTxSlots;
+}
+
+uint32_t simHwGetTxOverflows(void)
+{
+    return s_txOverflows;
+}
+
+// Runs the bus and the VT until untilUs or, with stopOnRx, until the ECU has received a frame.
+// Returns true if a frame is waiting for the ECU.
+static bool simHwAdvance(uint64_t untilUs, bool stopOnRx)
+{
+    for (;;)
+    {
+        if (stopOnRx && (s_bus->getRxPending(s_ecuStation, s_nowUs) > 0U))
+        {
+            return true;
+        }
+
+        // frames already waiting for the ECU are not events; they are read by the application
+        uint64_t nextUs = s_bus->getNextEventUs(s_vtStation);
+        uint64_t ecuRxUs = s_bus->getNextEventUs(s_ecuStation);
+        if ((ecuRxUs > s_nowUs) && (ecuRxUs < nextUs))
+        {
+            nextUs = ecuRxUs;
+        }
+
+        if (s_vt->getNextTimerUs() < nextUs)
+        {
+            nextUs = s_vt->getNextTimerUs();
+        }
+
+        if (nextUs > untilUs)
+        {
+            break;
+        }
+
+        if (nextUs > s_nowUs)
+        {
+            s_nowUs = nextUs;
+        }
+
+        s_bus->run(s_nowUs);
+        CanFrame frame;
+        while (s_bus->receive(s_vtStation, frame, s_nowUs))
+        {
+            s_vt->onFrame(frame, s_nowUs);
+        }
+
+        s_vt->onTimer(s_nowUs);
+    }
+
+    s_nowUs = untilUs;
+    s_bus->run(s_nowUs);
+    return (s_bus->getRxPending(s_ecuStation, s_nowUs) > 0U);
+}
+
+void hw_Init(void)
+{
+}
+
+void hw_Shutdown(void)
+{
+}
+
+uint8_t hw_PowerSwitchIsOn(void)
+{
+    bool qFinished = (s_vt->getFinalMaskUs() != UINT64_MAX) && (s_nowUs >= (s_vt->getFinalMaskUs() + s_settleUs))
+        && (!s_vt->isMeasuringKeys());
+    return ((qFinished) || (s_nowUs >= s_stopUs)) ? 0u : 1u;
+}
+
+void hw_DebugPrint(const char_t format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    hw_vDebugPrint(format, args);
+    va_end(args);
+}
+
+void hw_vDebugPrint(const char_t format[], va_list args)
+{
+    if (s_verbose)
+    {
+        printf("%8.1f ", static_cast<double>(s_nowUs) / 1000.0);
+        vprintf(format, args);
+    }
+}
+
+void hw_DebugTrace(const char_t format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    hw_vDebugPrint(format, args);
+    va_end(args);
+}
+
+void hw_vDebugTrace(const char_t format[], va_list args)
+{
+    hw_vDebugPrint(format, args);
+}
+
+void hw_DebugSetDeferred(uint8_t deferred_u8)
+{
+    // virtual time: the output is printed at once
+    (void)deferred_u8;
+}
+
+void hw_LogError(const char_t format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+}
+
+int32_t hw_GetTimeMs(void)
+{
+    return static_cast<int32_t>(s_nowUs / 1000U);
+}
+
+uint64_t hw_GetTimeUs(void)
+{
+    return s_nowUs;
+}
+
+void hw_CanInit(uint8_t maxCanNodes_u8)
+{
+    (void)maxCanNodes_u8;
+}
+
+void hw_CanClose(void)
+{
+}
+
+int16_t hw_CanSendMsg(uint8_t canNode_u8, uint32_t canId_u32, const uint8_t canData_au8[], uint8_t canDataLength_u8)
+{
+    if (canNode_u8 != 0u)
+    {
+        // further CAN nodes are not connected
+        return 0;
+    }
+
+    CanFrame frame;
+    frame.id = canId_u32 & 0x1FFFFFFFu;
+    frame.dlc = (canDataLength_u8 > 8u) ? 8u : canDataLength_u8;
+    for (uint8_t idx = 0u; idx < 8u; ++idx)
+    {
+        frame.data[idx] = (idx < frame.dlc) ? canData_au8[idx] : 0xFFu;
+    }
+
+    if (!s_bus->send(s_ecuStation, frame, s_nowUs))
+    {
+        ++s_txOverflows;
+        return s_errOverflow;
+    }
+
+    return 0;
+}
+
+void hw_CanFlushSendMsgs(uint8_t canNode_u8)
+{
+    (void)canNode_u8;
+}
+
+int16_t hw_CanReadMsg(uint8_t canNode_u8, uint32_t *canId_pu32, uint8_t canData_pau8[], uint8_t *canDataLength_pu8)
+{
+    CanFrame frame;
+    if ((canNode_u8 != 0u) || (!s_bus->receive(s_ecuStation, frame, s_nowUs)))
+    {
+        return 0;
+    }
+
+    *canId_pu32 = frame.id;
+    *canDataLength_pu8 = frame.dlc;
+    for (uint8_t idx = 0u; idx < frame.dlc; ++idx)
+    {
+        canData_pau8[idx] = frame.data[idx];
+    }
+
+    return 1;
+}
+
+int16_t hw_CanReadMsgs(uint8_t canNode_u8, hw_CanMsg_t canMsgs_as[], int16_t maxMsgs_s16)
+{
+    int16_t count = 0;
+    while ((count < maxMsgs_s16)
+        && (hw_CanReadMsg(canNode_u8, &canMsgs_as[count].canId_u32, canMsgs_as[count].canData_au8, &canMsgs_as[count].canDataLength_u8) > 0))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+int16_t hw_CanGetRxStatus(uint8_t canNode_u8, hw_CanRxStatus_t* rxStatus_ps)
+{
+    if (canNode_u8 != 0u)
+    {
+        return -1;
+    }
+
+    // the virtual bus does not lose frames
+    rxStatus_ps->pending_u32 = static_cast<uint32_t>(s_bus->getRxPending(s_ecuStation, s_nowUs));
+    rxStatus_ps->dropped_u32 = 0u;
+    return 0;
+}
+
+int16_t hw_CanGetFreeSendMsgBufferSize(uint8_t canNode_u8)
+{
+    if (canNode_u8 != 0u)
+    {
+        return 0;
+    }
+
+    return (s_fixedFreeTxSlots >= 0) ? s_fixedFreeTxSlots : static_cast<int16_t>(s_bus->getFreeTxSlots(s_ecuStation));
+}
+
+int16_t hw_CanWaitRx(uint32_t timeoutMs_u32)
+{
+    return simHwAdvance(s_nowUs + (static_cast<uint64_t>(timeoutMs_u32) * 1000U), true) ? 1 : 0;
+}
+
+void hw_SimDoSleep(uint32_t milliseconds)
+{
+    (void)simHwAdvance(s_nowUs + (static_cast<uint64_t>(milliseconds) * 1000U), false);
+}
+
+int_t hw_SimGetKbHit(void)
+{
+    return 0;
+}
+
+int_t hw_SimGetCharEx(uint8_t noEcho)
+{
+    (void)noEcho;
+    return 0;
+}
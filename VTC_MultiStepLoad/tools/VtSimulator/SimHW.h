@@ -0,0 +1,19 @@
+#ifndef SIM_HW_C36FCA404E774BADA460EC6010EDC239
+#define SIM_HW_C36FCA404E774BADA460EC6010EDC239
+
+#include <cstdint>
+#include "VirtualCanBus.h"
+#include "VtServer.h"
+
+// AppHW.h on simulated time: CAN node 0 of the application is a station of the virtual bus,
+// hw_SimDoSleep() advances the time and lets the VT process its frames.
+// hw_PowerSwitchIsOn() ends app_main() once the final mask is active or at stopUs.
+void simHwSetup(VirtualCanBus* bus, size_t ecuStation, size_t vtStation, VtServer* vt, uint64_t stopUs, bool verbose);
+uint64_t simHwGetTimeUs(void);
+
+// fixedFreeTxSlots >= 0: hw_CanGetFreeSendMsgBufferSize() always returns this value (no backpressure);
+// < 0: it returns the free slots of the transmit FIFO (default).
+void simHwSetFixedFreeTxSlots(int16_t fixedFreeTxSlots);
+uint32_t simHwGetTxOverflows(void);      // frames rejected by hw_CanSendMsg() because the FIFO was full
+
+#endif // SIM_HW_C36FCA404E774BADA460EC6010EDC239
@@ -0,0 +1,165 @@
+// Settings backend (Settings/settingsBackend.h) of the VT simulator; replaces settingsVoid.cpp.
+// The values are kept in memory and preset with --set <section>.<key>=<value> before the
+// application reads them (Settings/settingsCache.cpp caches the values).
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include "settingsBackend.h"
+#include "SimSettings.h"
+
+typedef std::map<std::string, std::string> Section;
+static std::map<std::string, Section> s_sections;
+
+bool simSettingsSet(const char* assignment)
+{
+    const char* dot = strchr(assignment, '.');
+    const char* equal = strchr(assignment, '=');
+    if ((dot == nullptr) || (equal == nullptr) || (dot > equal) || (dot == assignment) || ((dot + 1) == equal))
+    {
+        return false;
+    }
+
+    std::string section(assignment, static_cast<size_t>(dot - assignment));
+    std::string key(dot + 1, static_cast<size_t>(equal - dot - 1));
+    s_sections[section][key] = std::string(equal + 1);
+    return true;
+}
+
+// nullptr: not set
+static const std::string* findValue(const char section[], const char key[])
+{
+    std::map<std::string, Section>::const_iterator itSection = s_sections.find(section);
+    if (itSection == s_sections.end())
+    {
+        return nullptr;
+    }
+
+    Section::const_iterator itKey = itSection->second.find(key);
+    return (itKey != itSection->second.end()) ? &itKey->second : nullptr;
+}
+
+uint8_t settingsBackendGetS64(const char section[], const char key[], int64_t* value)
+{
+    const std::string* text = findValue(section, key);
+    if (text == nullptr)
+    {
+        return 0U;
+    }
+
+    *value = static_cast<int64_t>(strtoll(text->c_str(), nullptr, 0));
+    return 1U;
+}
+
+uint8_t settingsBackendGetU64(const char section[], const char key[], uint64_t* value, uint8_t hex)
+{
+    const std::string* text = findValue(section, key);
+    if (text == nullptr)
+    {
+        return 0U;
+    }
+
+    *value = static_cast<uint64_t>(strtoull(text->c_str(), nullptr, (hex != 0U) ? 16 : 0));
+    return 1U;
+}
+
+uint8_t settingsBackendGetString(const char section[], const char key[], char value[], size_t size)
+{
+    const std::string* text = findValue(section, key);
+    if ((text == nullptr) || (size == 0U))
+    {
+        return 0U;
+    }
+
+    snprintf(value, size, "%s", text->c_str());
+    return 1U;
+}
+
+// stored as hexadecimal text like the settings files
+uint8_t settingsBackendGetBlob(const char section[], const char key[], void* data, size_t size, size_t* storedSize)
+{
+    const std::string* text = findValue(section, key);
+    if ((text == nullptr) || ((text->size() / 2U) > size))
+    {
+        return 0U;
+    }
+
+    *storedSize = blobFromText(text->c_str(), data, size);
+    return (*storedSize != 0U) ? 1U : 0U;
+}
+
+void settingsBackendSetS64(const char section[], const char key[], int64_t value)
+{
+    s_sections[section][key] = std::to_string(static_cast<long long>(value));
+}
+
+void settingsBackendSetU64(const char section[], const char key[], uint64_t value, uint8_t hex)
+{
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), (hex != 0U) ? "%" PRIx64 : "%" PRIu64, value);
+    s_sections[section][key] = buffer;
+}
+
+void settingsBackendSetBlob(const char section[], const char key[], const void* data, size_t size)
+{
+    std::string text(size * 2U + 1U, '\0');
+    text.resize(blobToText(data, size, &text[0], text.size()));
+    s_sections[section][key] = text;
+}
+
+// key nullptr: removes the section; value nullptr: removes the key
+void settingsBackendSetString(const char section[], const char key[], const char value[])
+{
+    if (key == nullptr)
+    {
+        s_sections.erase(section);
+    }
+    else if (value == nullptr)
+    {
+        std::map<std::string, Section>::iterator itSection = s_sections.find(section);
+        if (itSection != s_sections.end())
+        {
+            itSection->second.erase(key);
+        }
+    }
+    else
+    {
+        s_sections[section][key] = value;
+    }
+}
+
+// iterates over a copy: entryCb may change the section
+size_t settingsBackendGetSectionEntries(const char section[], SettingsEntryCb_t entryCb, void* context)
+{
+    size_t calls = 0U;
+    std::map<std::string, Section>::const_iterator itSection = s_sections.find(section);
+    if (itSection == s_sections.end())
+    {
+        return 0U;
+    }
+
+    const Section entries = itSection->second;
+    for (const Section::value_type& entry : entries)
+    {
+        calls++;
+        if (entryCb(entry.first.c_str(), entry.second.c_str(), context) == 0U)
+        {
+            break;
+        }
+    }
+
+    return calls;
+}
+
+void settingsBackendFlush(void)
+{
+    // kept in memory only
+}
+
+uint8_t settingsBackendWritesDefaults(void)
+{
+    return 0U;
+}
@@ -0,0 +1,8 @@
+#ifndef SIM_SETTINGS_C36FCA404E774BADA460EC6010EDC239
+#define SIM_SETTINGS_C36FCA404E774BADA460EC6010EDC239
+
+// Presets a setting of the application: "<section>.<key>=<value>", e.g. "TpBurst.Adaptive=0".
+// Returns false if the assignment has no section, key or '='.
+bool simSettingsSet(const char* assignment);
+
+#endif // SIM_SETTINGS_C36FCA404E774BADA460EC6010EDC239
@@ -0,0 +1,150 @@
+#include "VirtualCanBus.h"
+
+// SOF, 29 bit identifier, SRR, IDE, RTR, r1, r0, DLC, CRC, delimiters, ACK, EOF and interframe space
+static const uint32_t s_frameOverheadBits = 67U;
+// stuff bits are inserted into SOF .. CRC (54 bits + data); half of the worst case on average
+static const uint32_t s_stuffedOverheadBits = 54U;
+
+VirtualCanBus::VirtualCanBus(uint32_t bitRate, uint32_t latencyUs, size_t txBufferSize)
+    : m_bitRate(bitRate)
+    , m_latencyUs(latencyUs)
+    , m_txBufferSize(txBufferSize)
+    , m_busFreeUs(0U)
+    , m_busyUs(0U)
+{
+}
+
+size_t VirtualCanBus::addStation(void)
+{
+    m_stations.push_back(Station());
+    m_stations.back().txFrames = 0U;
+    return m_stations.size() - 1U;
+}
+
+bool VirtualCanBus::send(size_t station, const CanFrame& frame, uint64_t nowUs)
+{
+    Station& sender = m_stations[station];
+    if (sender.tx.size() >= m_txBufferSize)
+    {
+        return false;
+    }
+
+    sender.tx.push_back(PendingFrame{ nowUs, frame });
+    return true;
+}
+
+size_t VirtualCanBus::getFreeTxSlots(size_t station) const
+{
+    return m_txBufferSize - m_stations[station].tx.size();
+}
+
+bool VirtualCanBus::receive(size_t station, CanFrame& frame, uint64_t nowUs)
+{
+    std::deque<PendingFrame>& rx = m_stations[station].rx;
+    if (rx.empty() || (rx.front().timeUs > nowUs))
+    {
+        return false;
+    }
+
+    frame = rx.front().frame;
+    rx.pop_front();
+    return true;
+}
+
+size_t VirtualCanBus::getRxPending(size_t station, uint64_t nowUs) const
+{
+    size_t count = 0U;
+    const std::deque<PendingFrame>& rx = m_stations[station].rx;
+    while ((count < rx.size()) && (rx[count].timeUs <= nowUs))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+void VirtualCanBus::run(uint64_t untilUs)
+{
+    size_t sender = 0U;
+    uint64_t endUs = 0U;
+    while (getNextTransmission(&sender, &endUs) && (endUs <= untilUs))
+    {
+        Station& station = m_stations[sender];
+        const CanFrame& frame = station.tx.front().frame;
+        for (size_t idx = 0U; idx < m_stations.size(); ++idx)
+        {
+            if (idx != sender)
+            {
+                m_stations[idx].rx.push_back(PendingFrame{ endUs + m_latencyUs, frame });
+            }
+        }
+
+        m_busyUs += getFrameTimeUs(frame.dlc);
+        m_busFreeUs = endUs;
+        station.tx.pop_front();
+        station.txFrames++;
+    }
+}
+
+uint64_t VirtualCanBus::getNextEventUs(size_t station) const
+{
+    size_t sender = 0U;
+    uint64_t nextUs = UINT64_MAX;
+    if (!getNextTransmission(&sender, &nextUs))
+    {
+        nextUs = UINT64_MAX;
+    }
+
+    const std::deque<PendingFrame>& rx = m_stations[station].rx;
+    if ((!rx.empty()) && (rx.front().timeUs < nextUs))
+    {
+        nextUs = rx.front().timeUs;
+    }
+
+    return nextUs;
+}
+
+uint32_t VirtualCanBus::getFrameTimeUs(uint8_t dlc) const
+{
+    uint32_t bits = s_frameOverheadBits + (8U * dlc) + ((s_stuffedOverheadBits + (8U * dlc)) / 8U);
+    return static_cast<uint32_t>((static_cast<uint64_t>(bits) * 1000000U + m_bitRate - 1U) / m_bitRate);
+}
+
+bool VirtualCanBus::getNextTransmission(size_t* pStation, uint64_t* pEndUs) const
+{
+    // the bus starts with the next frame as soon as it is idle and a frame is pending
+    uint64_t startUs = UINT64_MAX;
+    for (const Station& station : m_stations)
+    {
+        if ((!station.tx.empty()) && (station.tx.front().timeUs < startUs))
+        {
+            startUs = station.tx.front().timeUs;
+        }
+    }
+
+    if (startUs == UINT64_MAX)
+    {
+        return false;
+    }
+
+    if (startUs < m_busFreeUs)
+    {
+        startUs = m_busFreeUs;
+    }
+
+    // arbitration between all frames pending at the start of the transmission
+    bool qFound = false;
+    for (size_t idx = 0U; idx < m_stations.size(); ++idx)
+    {
+        const std::deque<PendingFrame>& tx = m_stations[idx].tx;
+        if ((!tx.empty()) && (tx.front().timeUs <= startUs)
+            && ((!qFound) || (tx.front().frame.id < m_stations[*pStation].tx.front().frame.id)))
+        {
+            *pStation = idx;
+            qFound = true;
+        }
+    }
+
+    *pEndUs = startUs + getFrameTimeUs(m_stations[*pStation].tx.front().frame.dlc);
+    return true;
+}
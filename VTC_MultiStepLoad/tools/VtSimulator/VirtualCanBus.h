@@ -0,0 +1,63 @@
+#ifndef VIRTUAL_CAN_BUS_C36FCA404E774BADA460EC6010EDC239
+#define VIRTUAL_CAN_BUS_C36FCA404E774BADA460EC6010EDC239
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// Extended data frame
+struct CanFrame
+{
+    uint32_t id;
+    uint8_t dlc;
+    uint8_t data[8];
+};
+
+// In-process CAN bus on simulated time (microseconds).
+// Each station has a transmit FIFO; the bus transmits one frame at a time, the lowest
+// identifier of all pending frames wins the arbitration. A transmitted frame is
+// received by all other stations after the configured latency.
+class VirtualCanBus
+{
+public:
+    VirtualCanBus(uint32_t bitRate, uint32_t latencyUs, size_t txBufferSize);
+
+    size_t addStation(void);                                    // returns the station index
+    bool send(size_t station, const CanFrame& frame, uint64_t nowUs);   // false: transmit FIFO is full
+    size_t getFreeTxSlots(size_t station) const;
+    bool receive(size_t station, CanFrame& frame, uint64_t nowUs);      // next frame received until nowUs
+    size_t getRxPending(size_t station, uint64_t nowUs) const;          // frames received until nowUs
+
+    void run(uint64_t untilUs);                                 // transmits all frames completed until untilUs
+    uint64_t getNextEventUs(size_t station) const;              // next completed transmission or reception; UINT64_MAX: none
+
+    uint32_t getFrameTimeUs(uint8_t dlc) const;
+    uint64_t getBusyUs(void) const { return m_busyUs; }
+    uint32_t getTxFrames(size_t station) const { return m_stations[station].txFrames; }
+
+private:
+    struct PendingFrame
+    {
+        uint64_t timeUs;    // enqueued (tx) or received (rx)
+        CanFrame frame;
+    };
+
+    struct Station
+    {
+        std::deque<PendingFrame> tx;
+        std::deque<PendingFrame> rx;
+        uint32_t txFrames;
+    };
+
+    bool getNextTransmission(size_t* pStation, uint64_t* pEndUs) const;
+
+    uint32_t m_bitRate;
+    uint32_t m_latencyUs;
+    size_t m_txBufferSize;
+    uint64_t m_busFreeUs;       // end of the last transmitted frame
+    uint64_t m_busyUs;          // sum of all frame times
+    std::vector<Station> m_stations;
+};
+
+#endif // VIRTUAL_CAN_BUS_C36FCA404E774BADA460EC6010EDC239
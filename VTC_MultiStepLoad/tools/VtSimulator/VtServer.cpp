@@ -0,0 +1,642 @@
+#include "VtServer.h"
+
+// parameter group numbers (ISO 11783-3, -5, -6)
+static const uint32_t s_pgnVtToEcu = 0xE600U;
+static const uint32_t s_pgnEcuToVt = 0xE700U;
+static const uint32_t s_pgnAcknowledgement = 0xE800U;
+static const uint32_t s_pgnRequest = 0xEA00U;
+static const uint32_t s_pgnTpDt = 0xEB00U;
+static const uint32_t s_pgnTpCm = 0xEC00U;
+static const uint32_t s_pgnEtpDt = 0xC700U;
+static const uint32_t s_pgnEtpCm = 0xC800U;
+static const uint32_t s_pgnAddressClaimed = 0xEE00U;
+static const uint32_t s_pgnLanguageCommand = 0xFE0FU;
+
+static const uint8_t s_globalAddress = 0xFFU;
+static const uint8_t s_nullAddress = 0xFEU;
+static const uint64_t s_statusPeriodUs = 1000000U;
+static const uint64_t s_notYet = UINT64_MAX;
+static const size_t s_labelLength = 32U;
+static const size_t s_legacyLabelLength = 7U;
+static const uint64_t s_keyPeriodUs = 100000U;
+
+// error code of the version responses: version label not correct or unknown
+static const uint8_t s_errorUnknownVersion = 0x02U;
+
+static uint32_t getPgn(uint32_t id, uint8_t* pDestination)
+{
+    uint32_t pgn = (id >> 8) & 0x3FFFFU;
+    *pDestination = s_globalAddress;
+    if ((pgn & 0xFF00U) < 0xF000U)
+    {
+        // PDU1: PS is the destination address
+        *pDestination = static_cast<uint8_t>(pgn);
+        pgn &= 0x3FF00U;
+    }
+
+    return pgn;
+}
+
+static uint32_t getU24(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16);
+}
+
+static void setU24(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value);
+    data[1] = static_cast<uint8_t>(value >> 8);
+    data[2] = static_cast<uint8_t>(value >> 16);
+}
+
+VtServer::VtServer(VirtualCanBus& bus, size_t station, const Config& config)
+    : m_bus(bus)
+    , m_station(station)
+    , m_config(config)
+    , m_ecuAddress(s_nullAddress)
+    , m_activeMask(0xFFFFU)
+    , m_nextStatusUs(0U)
+    , m_firstMaskUs(s_notYet)
+    , m_finalMaskUs(s_notYet)
+    , m_transferPending(false)
+    , m_nextKeyUs(s_notYet)
+    , m_keySentUs(s_notYet)
+    , m_keysSent(0U)
+    , m_keysLost(0U)
+{
+    m_rx.active = false;
+    m_tx.active = false;
+}
+
+void VtServer::start(uint64_t nowUs)
+{
+    sendAddressClaim(nowUs);
+    sendLanguageCommand(nowUs);
+    sendStatus(nowUs);
+}
+
+void VtServer::onTimer(uint64_t nowUs)
+{
+    if (nowUs >= m_nextStatusUs)
+    {
+        sendStatus(nowUs);
+    }
+
+    if (nowUs >= m_nextKeyUs)
+    {
+        if (m_keySentUs != s_notYet)
+        {
+            ++m_keysLost;
+            m_keySentUs = s_notYet;
+        }
+
+        // the last timer only checks the response of the last activation
+        m_nextKeyUs = s_notYet;
+        if (m_keysSent < m_config.keyMessages)
+        {
+            sendSoftKey(nowUs);
+            m_nextKeyUs = nowUs + s_keyPeriodUs;
+        }
+    }
+}
+
+bool VtServer::isMeasuringKeys(void) const
+{
+    return (m_config.keyMessages > 0U) && ((m_keysSent < m_config.keyMessages) || (m_keySentUs != s_notYet));
+}
+
+void VtServer::sendSoftKey(uint64_t nowUs)
+{
+    // soft key activation: key activation code (1: pressed, 0: released), key object, parent data mask, key number
+    uint8_t code = ((m_keysSent % 2U) == 0U) ? 1U : 0U;
+    std::vector<uint8_t> message = { 0x00U, code, static_cast<uint8_t>(m_config.softKey), static_cast<uint8_t>(m_config.softKey >> 8),
+        static_cast<uint8_t>(m_activeMask), static_cast<uint8_t>(m_activeMask >> 8), 0x00U, 0xFFU };
+    sendToEcu(message, nowUs);
+    m_keySentUs = nowUs;
+    ++m_keysSent;
+}
+
+void VtServer::onFrame(const CanFrame& frame, uint64_t nowUs)
+{
+    uint8_t destination = s_globalAddress;
+    uint32_t pgn = getPgn(frame.id, &destination);
+    uint8_t source = static_cast<uint8_t>(frame.id);
+    if ((destination != m_config.address) && (destination != s_globalAddress))
+    {
+        return;
+    }
+
+    switch (pgn)
+    {
+    case s_pgnEcuToVt:
+        if ((destination == m_config.address) && (frame.dlc > 0U))
+        {
+            m_ecuAddress = source;
+            onMessage(std::vector<uint8_t>(frame.data, frame.data + frame.dlc), nowUs, nowUs);
+        }
+        break;
+    case s_pgnRequest:
+        onRequest(frame, source, nowUs);
+        break;
+    case s_pgnTpCm:
+    case s_pgnEtpCm:
+        if (destination == m_config.address)
+        {
+            m_ecuAddress = source;
+            onTransportCm(frame, (pgn == s_pgnEtpCm), nowUs);
+        }
+        break;
+    case s_pgnTpDt:
+    case s_pgnEtpDt:
+        if (destination == m_config.address)
+        {
+            onTransportDt(frame, (pgn == s_pgnEtpDt), nowUs);
+        }
+        break;
+    default:
+        // address claims, working set master/maintenance broadcasts, ...
+        break;
+    }
+}
+
+void VtServer::sendFrame(uint32_t pgn, uint8_t destination, uint8_t priority, const uint8_t* data, uint8_t dlc, uint64_t nowUs)
+{
+    CanFrame frame;
+    if ((pgn & 0xFF00U) < 0xF000U)
+    {
+        pgn |= destination;
+    }
+
+    frame.id = (static_cast<uint32_t>(priority) << 26) | (pgn << 8) | m_config.address;
+    frame.dlc = dlc;
+    for (uint8_t idx = 0U; idx < 8U; ++idx)
+    {
+        frame.data[idx] = (idx < dlc) ? data[idx] : 0xFFU;
+    }
+
+    (void)m_bus.send(m_station, frame, nowUs);
+}
+
+void VtServer::sendToEcu(const std::vector<uint8_t>& message, uint64_t nowUs)
+{
+    if (message.size() <= 8U)
+    {
+        uint8_t data[8] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+        for (size_t idx = 0U; idx < message.size(); ++idx)
+        {
+            data[idx] = message[idx];
+        }
+
+        sendFrame(s_pgnVtToEcu, m_ecuAddress, 5U, data, 8U, nowUs);
+    }
+    else
+    {
+        m_txQueue.push_back(message);
+        if (!m_tx.active)
+        {
+            sendNextTxMessage(nowUs);
+        }
+    }
+}
+
+void VtServer::sendStatus(uint64_t nowUs)
+{
+    // VT status message: working set master of the active pool, visible data mask, soft key mask, busy codes
+    uint8_t activeWorkingSet = (m_firstMaskUs != s_notYet) ? m_ecuAddress : s_globalAddress;
+    const uint8_t data[8] = { 0xFEU, activeWorkingSet,
+        static_cast<uint8_t>(m_activeMask), static_cast<uint8_t>(m_activeMask >> 8),
+        0xFFU, 0xFFU, 0x00U, 0xFFU };
+    sendFrame(s_pgnVtToEcu, s_globalAddress, 5U, data, 8U, nowUs);
+    m_nextStatusUs = nowUs + s_statusPeriodUs;
+}
+
+void VtServer::sendAddressClaim(uint64_t nowUs)
+{
+    // NAME: self-configurable, agricultural industry group, function 29 (virtual terminal)
+    const uint64_t name = 0x1C5U | (29ULL << 40) | (2ULL << 60) | (1ULL << 63);
+    uint8_t data[8];
+    for (uint8_t idx = 0U; idx < 8U; ++idx)
+    {
+        data[idx] = static_cast<uint8_t>(name >> (8U * idx));
+    }
+
+    sendFrame(s_pgnAddressClaimed, s_globalAddress, 6U, data, 8U, nowUs);
+}
+
+void VtServer::sendLanguageCommand(uint64_t nowUs)
+{
+    // comma, 24 h, ddmmyyyy, metric units
+    const uint8_t data[8] = { static_cast<uint8_t>(m_config.language[0]), static_cast<uint8_t>(m_config.language[1]),
+        0x0FU, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU };
+    sendFrame(s_pgnLanguageCommand, s_globalAddress, 6U, data, 8U, nowUs);
+}
+
+void VtServer::sendNextTxMessage(uint64_t nowUs)
+{
+    m_tx.active = false;
+    if (m_txQueue.empty() || (m_ecuAddress == s_nullAddress))
+    {
+        return;
+    }
+
+    m_tx.data = m_txQueue.front();
+    m_tx.active = true;
+    m_txQueue.pop_front();
+
+    uint32_t packets = static_cast<uint32_t>((m_tx.data.size() + 6U) / 7U);
+    uint8_t data[8] = { 0x10U, static_cast<uint8_t>(m_tx.data.size()), static_cast<uint8_t>(m_tx.data.size() >> 8),
+        static_cast<uint8_t>(packets), 0xFFU, 0U, 0U, 0U };
+    setU24(&data[5], s_pgnVtToEcu);
+    sendFrame(s_pgnTpCm, m_ecuAddress, 7U, data, 8U, nowUs);
+}
+
+void VtServer::onRequest(const CanFrame& frame, uint8_t source, uint64_t nowUs)
+{
+    uint8_t destination = s_globalAddress;
+    (void)getPgn(frame.id, &destination);
+    uint32_t requestedPgn = (frame.dlc >= 3U) ? getU24(frame.data) : 0U;
+    if (requestedPgn == s_pgnAddressClaimed)
+    {
+        sendAddressClaim(nowUs);
+    }
+    else if (requestedPgn == s_pgnLanguageCommand)
+    {
+        sendLanguageCommand(nowUs);
+    }
+    else if (destination == m_config.address)
+    {
+        // negative acknowledgement
+        uint8_t data[8] = { 0x01U, 0xFFU, 0xFFU, 0xFFU, source, 0U, 0U, 0U };
+        setU24(&data[5], requestedPgn);
+        sendFrame(s_pgnAcknowledgement, s_globalAddress, 6U, data, 8U, nowUs);
+    }
+    else
+    {
+        // not supported by the simulation
+    }
+}
+
+void VtServer::onTransportCm(const CanFrame& frame, bool extended, uint64_t nowUs)
+{
+    const uint8_t* data = frame.data;
+    switch (data[0])
+    {
+    case 0x10U:     // TP.CM_RTS
+    case 0x14U:     // ETP.CM_RTS
+        m_rx.active = (getU24(&data[5]) == s_pgnEcuToVt);
+        m_rx.extended = extended;
+        m_rx.pgn = getU24(&data[5]);
+        m_rx.size = extended ? (getU24(&data[1]) | (static_cast<uint32_t>(data[4]) << 24))
+                             : (static_cast<uint32_t>(data[1]) | (static_cast<uint32_t>(data[2]) << 8));
+        m_rx.packets = (m_rx.size + 6U) / 7U;
+        m_rx.nextPacket = 1U;
+        m_rx.offset = 0U;
+        m_rx.startUs = nowUs;
+        m_rx.data.clear();
+        m_rx.data.reserve(m_rx.size);
+        if (m_rx.active)
+        {
+            sendCts(nowUs);
+        }
+        else
+        {
+            uint8_t abort[8] = { 0xFFU, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0U, 0U, 0U };
+            setU24(&abort[5], m_rx.pgn);
+            sendFrame(extended ? s_pgnEtpCm : s_pgnTpCm, m_ecuAddress, 7U, abort, 8U, nowUs);
+        }
+        break;
+    case 0x16U:     // ETP.CM_DPO
+        m_rx.offset = getU24(&data[2]);
+        break;
+    case 0x11U:     // TP.CM_CTS of a message sent to the ECU
+        onTransportCts(frame, extended, nowUs);
+        break;
+    case 0x13U:     // TP.CM_EndOfMsgACK of a message sent to the ECU
+        sendNextTxMessage(nowUs);
+        break;
+    case 0xFFU:     // Conn_Abort
+        if (m_rx.active && (m_rx.pgn == getU24(&data[5])))
+        {
+            m_rx.active = false;
+        }
+        else if (m_tx.active)
+        {
+            sendNextTxMessage(nowUs);
+        }
+        else
+        {
+            // no session
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void VtServer::onTransportDt(const CanFrame& frame, bool extended, uint64_t nowUs)
+{
+    uint32_t packet = extended ? (m_rx.offset + frame.data[0]) : frame.data[0];
+    if ((!m_rx.active) || (m_rx.extended != extended) || (packet != m_rx.nextPacket))
+    {
+        return;
+    }
+
+    for (uint8_t idx = 1U; (idx < 8U) && (m_rx.data.size() < m_rx.size); ++idx)
+    {
+        m_rx.data.push_back(frame.data[idx]);
+    }
+
+    m_rx.nextPacket++;
+    if (m_rx.data.size() >= m_rx.size)
+    {
+        uint8_t data[8] = { 0x13U, static_cast<uint8_t>(m_rx.size), static_cast<uint8_t>(m_rx.size >> 8),
+            static_cast<uint8_t>(m_rx.packets), 0xFFU, 0U, 0U, 0U };
+        if (extended)
+        {
+            data[0] = 0x17U;
+            setU24(&data[1], m_rx.size);
+            data[4] = static_cast<uint8_t>(m_rx.size >> 24);
+        }
+
+        setU24(&data[5], m_rx.pgn);
+        sendFrame(extended ? s_pgnEtpCm : s_pgnTpCm, m_ecuAddress, 7U, data, 8U, nowUs);
+        m_rx.active = false;
+        onMessage(m_rx.data, m_rx.startUs, nowUs);
+    }
+    else if (packet == m_rx.windowEnd)
+    {
+        sendCts(nowUs);
+    }
+    else
+    {
+        // further packets of the granted window
+    }
+}
+
+void VtServer::onTransportCts(const CanFrame& frame, bool extended, uint64_t nowUs)
+{
+    if ((!m_tx.active) || extended)
+    {
+        return;
+    }
+
+    // a CTS with 0 packets holds the connection open
+    uint32_t nextPacket = frame.data[2];
+    for (uint32_t count = 0U; count < frame.data[1]; ++count, ++nextPacket)
+    {
+        uint8_t data[8] = { static_cast<uint8_t>(nextPacket), 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+        for (size_t idx = 0U; idx < 7U; ++idx)
+        {
+            size_t pos = ((nextPacket - 1U) * 7U) + idx;
+            if (pos < m_tx.data.size())
+            {
+                data[idx + 1U] = m_tx.data[pos];
+            }
+        }
+
+        sendFrame(s_pgnTpDt, m_ecuAddress, 7U, data, 8U, nowUs);
+    }
+}
+
+void VtServer::sendCts(uint64_t nowUs)
+{
+    uint32_t count = m_rx.packets - m_rx.nextPacket + 1U;
+    if (count > m_config.packetsPerCts)
+    {
+        count = m_config.packetsPerCts;
+    }
+
+    m_rx.windowEnd = m_rx.nextPacket + count - 1U;
+    uint8_t data[8] = { 0x11U, static_cast<uint8_t>(count), static_cast<uint8_t>(m_rx.nextPacket), 0xFFU, 0xFFU, 0U, 0U, 0U };
+    if (m_rx.extended)
+    {
+        data[0] = 0x15U;
+        setU24(&data[2], m_rx.nextPacket);
+    }
+
+    setU24(&data[5], m_rx.pgn);
+    sendFrame(m_rx.extended ? s_pgnEtpCm : s_pgnTpCm, m_ecuAddress, 7U, data, 8U, nowUs);
+}
+
+void VtServer::onMessage(const std::vector<uint8_t>& message, uint64_t startUs, uint64_t nowUs)
+{
+    std::vector<uint8_t> response;
+    switch (message[0])
+    {
+    case 0x11U:     // Object pool transfer
+        if (!m_transferPending)
+        {
+            m_poolTransfers.push_back(PoolTransfer{ startUs, s_notYet, 0U });
+            m_transferPending = true;
+        }
+
+        m_poolTransfers.back().bytes += static_cast<uint32_t>(message.size() - 1U);
+        break;
+    case 0x12U:     // End of object pool; the pool is accepted without parsing it
+        response = { 0x12U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0xFFU };
+        if (m_transferPending)
+        {
+            m_poolTransfers.back().endUs = nowUs;
+            m_transferPending = false;
+        }
+
+        activatePool(nowUs);
+        break;
+    case 0xC0U:     // Get memory: there can be enough memory
+        response = { 0xC0U, m_config.version, 0x00U };
+        break;
+    case 0xC1U:     // Get supported widechars: no ranges
+        response = { 0xC1U, message[1], message[2], message[3], message[4], message[5], 0x00U, 0x00U };
+        break;
+    case 0xC2U:     // Get number of soft keys
+        response = { 0xC2U, 0x00U, 0xFFU, 0xFFU, 60U, 60U, 64U, 6U };
+        break;
+    case 0xC3U:     // Get text font data: all sizes and attributes
+        response = { 0xC3U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x7FU, 0xFFU };
+        break;
+    case 0xC4U:     // Get window mask data
+        response = { 0xC4U, 0x00U, 0x00U };
+        break;
+    case 0xC5U:     // Get supported objects
+        response = { 0xC5U, 37U };
+        for (uint8_t objectType = 0U; objectType < 37U; ++objectType)
+        {
+            response.push_back(objectType);
+        }
+        break;
+    case 0xC7U:     // Get hardware: 256 colours, 480 x 480 pixels
+        response = { 0xC7U, 0xFFU, 0x02U, 0x0FU, 0xE0U, 0x01U, 0xE0U, 0x01U };
+        break;
+    case 0xD0U:
+    case 0xD1U:
+    case 0xD2U:
+    case 0xD3U:
+    case 0xD4U:
+    case 0xD5U:
+    case 0xD6U:
+    case 0xDFU:
+        onVersionCommand(message, nowUs);
+        break;
+    case 0x00U:     // Soft key activation response
+        if (m_keySentUs != s_notYet)
+        {
+            m_keyLatenciesUs.push_back(nowUs - m_keySentUs);
+            m_keySentUs = s_notYet;
+        }
+        break;
+    case 0xFFU:     // Working set maintenance
+        break;
+    default:
+        if ((message[0] >= 0x92U) && (message[0] <= 0xBFU))
+        {
+            onRuntimeCommand(message, nowUs);
+        }
+        break;
+    }
+
+    if (!response.empty())
+    {
+        sendToEcu(response, nowUs);
+    }
+}
+
+void VtServer::onVersionCommand(const std::vector<uint8_t>& message, uint64_t nowUs)
+{
+    uint8_t function = message[0];
+    std::vector<uint8_t> response;
+    if ((function == 0xDFU) || (function == 0xD3U))
+    {
+        // (Extended) get versions response
+        size_t length = (function == 0xD3U) ? s_labelLength : s_legacyLabelLength;
+        response = { (function == 0xD3U) ? static_cast<uint8_t>(0xD3U) : static_cast<uint8_t>(0xE0U),
+            static_cast<uint8_t>(m_versions.size()) };
+        for (const std::string& label : m_versions)
+        {
+            response.insert(response.end(), label.begin(), label.begin() + length);
+        }
+
+        sendToEcu(response, nowUs);
+        return;
+    }
+
+    std::string label = getLabel(message);
+    std::vector<std::string>::iterator version = m_versions.begin();
+    while ((version != m_versions.end()) && (*version != label))
+    {
+        ++version;
+    }
+
+    uint8_t error = 0x00U;
+    switch (function)
+    {
+    case 0xD0U:     // Store version
+    case 0xD4U:     // Extended store version
+        if (version == m_versions.end())
+        {
+            m_versions.push_back(label);
+        }
+        break;
+    case 0xD1U:     // Load version
+    case 0xD5U:     // Extended load version
+        if (version == m_versions.end())
+        {
+            error = s_errorUnknownVersion;
+        }
+        else
+        {
+            activatePool(nowUs);
+        }
+        break;
+    default:        // (Extended) delete version
+        if (version == m_versions.end())
+        {
+            error = s_errorUnknownVersion;
+        }
+        else
+        {
+            m_versions.erase(version);
+        }
+        break;
+    }
+
+    response = { function, 0xFFU, 0xFFU, 0xFFU, 0xFFU, error, 0xFFU, 0xFFU };
+    sendToEcu(response, nowUs);
+}
+
+void VtServer::onRuntimeCommand(const std::vector<uint8_t>& message, uint64_t nowUs)
+{
+    std::vector<uint8_t> request(message);
+    request.resize(8U, 0xFFU);
+    std::vector<uint8_t> response;
+    switch (request[0])
+    {
+    case 0xA8U:     // Change numeric value
+        response = { 0xA8U, request[1], request[2], 0x00U, request[4], request[5], request[6], request[7] };
+        break;
+    case 0xADU:     // Change active mask
+        m_activeMask = static_cast<uint16_t>(request[3] | (request[4] << 8));
+        if ((m_activeMask == m_config.finalMask) && (m_finalMaskUs == s_notYet))
+        {
+            m_finalMaskUs = nowUs;
+            if (m_config.keyMessages > 0U)
+            {
+                m_nextKeyUs = nowUs + s_keyPeriodUs;
+            }
+        }
+
+        response = { 0xADU, request[3], request[4], 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+        break;
+    case 0xAEU:     // Change soft key mask
+        response = { 0xAEU, request[2], request[3], request[4], request[5], 0x00U, 0xFFU, 0xFFU };
+        break;
+    case 0xB3U:     // Change string value
+        response = { 0xB3U, 0xFFU, 0xFFU, request[1], request[2], 0x00U, 0xFFU, 0xFFU };
+        break;
+    default:
+    {
+        // object ID (and the first parameter) are echoed, followed by the error code "no error"
+        size_t errorIndex = 3U;
+        if ((request[0] == 0xA0U) || (request[0] == 0xA1U) || (request[0] == 0xA7U)
+            || (request[0] == 0xAFU) || (request[0] == 0xB9U))
+        {
+            errorIndex = 4U;
+        }
+        else if ((request[0] == 0xA6U) || (request[0] == 0xB4U))
+        {
+            errorIndex = 5U;
+        }
+        else
+        {
+            // object ID only
+        }
+
+        response.assign(request.begin(), request.begin() + errorIndex);
+        response.push_back(0x00U);
+        response.resize(8U, 0xFFU);
+        break;
+    }
+    }
+
+    sendToEcu(response, nowUs);
+}
+
+std::string VtServer::getLabel(const std::vector<uint8_t>& message) const
+{
+    bool extended = (message[0] >= 0xD4U);
+    size_t length = extended ? s_labelLength : s_legacyLabelLength;
+    std::string label(s_labelLength, ' ');
+    for (size_t idx = 0U; (idx < length) && ((idx + 1U) < message.size()); ++idx)
+    {
+        label[idx] = static_cast<char>(message[idx + 1U]);
+    }
+
+    return label;
+}
+
+void VtServer::activatePool(uint64_t nowUs)
+{
+    if (m_firstMaskUs == s_notYet)
+    {
+        m_firstMaskUs = nowUs;
+    }
+}
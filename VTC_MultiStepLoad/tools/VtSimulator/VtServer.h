@@ -0,0 +1,117 @@
+#ifndef VT_SERVER_C36FCA404E774BADA460EC6010EDC239
+#define VT_SERVER_C36FCA404E774BADA460EC6010EDC239
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "VirtualCanBus.h"
+
+// Simulated virtual terminal (ISO 11783-6) serving one working set.
+// It implements the VT side of the login (VT status, language command, technical data,
+// (extended) get/store/load/delete version), the object pool transfer with TP and ETP
+// and the responses to the runtime commands. Pools are not parsed; only their size
+// and the time of the transfer are recorded.
+// After the final mask it optionally sends soft key activations (alternately pressed and
+// released) and records the time until the soft key activation response of the ECU.
+class VtServer
+{
+public:
+    struct Config
+    {
+        uint8_t address;            // source address of the VT
+        uint8_t version;            // VT version (3 .. 6); >= 5: extended version labels
+        char language[2];           // ISO 639-1 code sent with the language command
+        uint8_t packetsPerCts;      // packets granted per CTS
+        uint16_t finalMask;         // data mask activated by the ECU when the final language is active
+        uint16_t softKey;           // object ID of the soft key activated after the final mask
+        uint16_t keyMessages;       // soft key activation messages to be sent; 0: none
+    };
+
+    // Object pool transfers until an end of object pool message
+    struct PoolTransfer
+    {
+        uint64_t startUs;           // first object pool transfer message
+        uint64_t endUs;             // end of object pool response
+        uint32_t bytes;             // pool data without function code
+    };
+
+    VtServer(VirtualCanBus& bus, size_t station, const Config& config);
+
+    void start(uint64_t nowUs);                     // address claim, language command and first VT status
+    void onFrame(const CanFrame& frame, uint64_t nowUs);
+    void onTimer(uint64_t nowUs);
+    uint64_t getNextTimerUs(void) const { return (m_nextKeyUs < m_nextStatusUs) ? m_nextKeyUs : m_nextStatusUs; }
+
+    std::vector<std::string>& getVersions(void) { return m_versions; }     // stored version labels (32 characters)
+    const std::vector<PoolTransfer>& getPoolTransfers(void) const { return m_poolTransfers; }
+    uint64_t getFirstMaskUs(void) const { return m_firstMaskUs; }    // UINT64_MAX: not yet
+    uint64_t getFinalMaskUs(void) const { return m_finalMaskUs; }    // UINT64_MAX: not yet
+    bool isMeasuringKeys(void) const;                                   // soft key activations outstanding
+    const std::vector<uint64_t>& getKeyLatenciesUs(void) const { return m_keyLatenciesUs; }
+    uint32_t getKeysLost(void) const { return m_keysLost; }            // no response until the next activation
+
+private:
+    // receive session of a (extended) transport protocol message from the ECU
+    struct RxSession
+    {
+        bool active;
+        bool extended;
+        uint32_t pgn;
+        uint32_t size;
+        uint32_t packets;           // total number of packets
+        uint32_t nextPacket;        // 1 based
+        uint32_t windowEnd;         // last packet granted by the CTS
+        uint32_t offset;            // ETP: data packet offset of the DPO
+        uint64_t startUs;           // RTS
+        std::vector<uint8_t> data;
+    };
+
+    // send session of a transport protocol message to the ECU
+    struct TxSession
+    {
+        bool active;
+        std::vector<uint8_t> data;
+    };
+
+    void sendFrame(uint32_t pgn, uint8_t destination, uint8_t priority, const uint8_t* data, uint8_t dlc, uint64_t nowUs);
+    void sendToEcu(const std::vector<uint8_t>& message, uint64_t nowUs);
+    void sendStatus(uint64_t nowUs);
+    void sendAddressClaim(uint64_t nowUs);
+    void sendLanguageCommand(uint64_t nowUs);
+    void sendNextTxMessage(uint64_t nowUs);
+
+    void onRequest(const CanFrame& frame, uint8_t source, uint64_t nowUs);
+    void onTransportCm(const CanFrame& frame, bool extended, uint64_t nowUs);
+    void onTransportDt(const CanFrame& frame, bool extended, uint64_t nowUs);
+    void onTransportCts(const CanFrame& frame, bool extended, uint64_t nowUs);
+    void sendCts(uint64_t nowUs);
+    void onMessage(const std::vector<uint8_t>& message, uint64_t startUs, uint64_t nowUs);
+    void onVersionCommand(const std::vector<uint8_t>& message, uint64_t nowUs);
+    void onRuntimeCommand(const std::vector<uint8_t>& message, uint64_t nowUs);
+    std::string getLabel(const std::vector<uint8_t>& message) const;
+    void activatePool(uint64_t nowUs);
+    void sendSoftKey(uint64_t nowUs);
+
+    VirtualCanBus& m_bus;
+    size_t m_station;
+    Config m_config;
+    uint8_t m_ecuAddress;                   // 0xFE: no working set connected
+    uint16_t m_activeMask;                  // sent with the VT status
+    uint64_t m_nextStatusUs;
+    uint64_t m_firstMaskUs;
+    uint64_t m_finalMaskUs;
+    RxSession m_rx;
+    TxSession m_tx;
+    std::deque<std::vector<uint8_t>> m_txQueue;     // multi packet messages waiting for m_tx
+    std::vector<std::string> m_versions;
+    std::vector<PoolTransfer> m_poolTransfers;
+    bool m_transferPending;                 // object pool transfer without end of object pool
+    uint64_t m_nextKeyUs;                   // next soft key activation; UINT64_MAX: none
+    uint64_t m_keySentUs;                   // soft key activation without response; UINT64_MAX: none
+    uint16_t m_keysSent;
+    uint32_t m_keysLost;
+    std::vector<uint64_t> m_keyLatenciesUs;
+};
+
+#endif // VT_SERVER_C36FCA404E774BADA460EC6010EDC239
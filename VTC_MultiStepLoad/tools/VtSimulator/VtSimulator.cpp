@@ -0,0 +1,281 @@
+// Host simulation of the multi-step load: runs app_main() against a simulated VT
+// on a virtual CAN bus and reports the time to the first mask (first pool accepted
+// by the VT) and to the final language (final mask activated by the ECU).
+// The simulated time only depends on the options, so each run is reproducible.
+//
+// usage: VtSimulator [--bitrate <bit/s>] [--latency <us>] [--language <xx>] [--vt-version <3..6>]
+//                    [--packets <packets per CTS>] [--final-mask <object ID>] [--timeout <s>]
+//                    [--tx-queue <frames>] [--fixed-free-tx <frames>] [--versions <file>]
+//                    [--key-messages <n>] [--soft-key <object ID>] [--set <section>.<key>=<value>] ... [--verbose]
+//
+// --versions reads the version labels stored on the VT from the file and writes them
+// back at the end; a second run measures the start-up with stored pools.
+// --tx-queue sets the transmit FIFO of the ECU (tx_queue_len of the ESP32 driver).
+// --fixed-free-tx reports a constant number of free transmit slots to the ISOBUS driver
+// instead of the FIFO state; it measures the pool upload without backpressure.
+// --set presets a setting of the application, e.g. --set TpBurst.Adaptive=0 for the fixed
+// (E)TP repeat count. CanDriver.Bitrate is preset with --bitrate.
+// --key-messages sends soft key activations (default key 5104) every 100 ms after the
+// final mask and prints the time until the response of the ECU, e.g. with
+// --set MainLoop.EventDriven=0 and =1.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "SimHW.h"
+#include "SimSettings.h"
+#include "VirtualCanBus.h"
+#include "VtServer.h"
+
+extern "C" void app_main(void);
+
+static const size_t s_txBufferSize = 150U;      // default: tx_queue_len of CanDriverEsp32.cpp
+
+static bool readVersions(const std::string& fileName, std::vector<std::string>& versions)
+{
+    FILE* file = fopen(fileName.c_str(), "r");
+    if (file == nullptr)
+    {
+        // no pools stored yet
+        return true;
+    }
+
+    char line[80];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        std::string label(line, strcspn(line, "\r\n"));
+        if (!label.empty())
+        {
+            label.resize(32U, ' ');
+            versions.push_back(label);
+        }
+    }
+
+    return (fclose(file) == 0);
+}
+
+static bool writeVersions(const std::string& fileName, const std::vector<std::string>& versions)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName.c_str());
+        return false;
+    }
+
+    for (const std::string& label : versions)
+    {
+        fprintf(file, "%s\n", label.c_str());
+    }
+
+    return (fclose(file) == 0);
+}
+
+static double toMs(uint64_t timeUs)
+{
+    return static_cast<double>(timeUs) / 1000.0;
+}
+
+static void printTime(const char* text, uint64_t timeUs)
+{
+    if (timeUs != UINT64_MAX)
+    {
+        printf("%-24s%10.1f ms\n", text, toMs(timeUs));
+    }
+    else
+    {
+        printf("%-24s%10s\n", text, "-");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t bitRate = 250000U;
+    uint32_t latencyUs = 0U;
+    uint32_t timeoutS = 300U;
+    size_t txBufferSize = s_txBufferSize;
+    int16_t fixedFreeTxSlots = -1;
+    bool verbose = false;
+    std::string versionsFile;
+    std::vector<std::string> settings;
+    VtServer::Config config;
+    config.address = 0x26U;
+    config.version = 5U;
+    config.language[0] = 'd';
+    config.language[1] = 'e';
+    config.packetsPerCts = 16U;
+    config.finalMask = 1001U;
+    config.softKey = 5104U;
+    config.keyMessages = 0U;
+
+    for (int idx = 1; idx < argc; ++idx)
+    {
+        std::string option(argv[idx]);
+        const char* value = ((idx + 1) < argc) ? argv[idx + 1] : nullptr;
+        if (option == "--verbose")
+        {
+            verbose = true;
+            continue;
+        }
+
+        if (value == nullptr)
+        {
+            fprintf(stderr, "missing value of %s\n", option.c_str());
+            return 1;
+        }
+
+        ++idx;
+        if (option == "--bitrate")
+        {
+            bitRate = static_cast<uint32_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--latency")
+        {
+            latencyUs = static_cast<uint32_t>(strtoul(value, nullptr, 0));
+        }
+        else if ((option == "--language") && (strlen(value) == 2U))
+        {
+            config.language[0] = value[0];
+            config.language[1] = value[1];
+        }
+        else if (option == "--vt-version")
+        {
+            config.version = static_cast<uint8_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--packets")
+        {
+            config.packetsPerCts = static_cast<uint8_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--final-mask")
+        {
+            config.finalMask = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--timeout")
+        {
+            timeoutS = static_cast<uint32_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--tx-queue")
+        {
+            txBufferSize = static_cast<size_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--fixed-free-tx")
+        {
+            fixedFreeTxSlots = static_cast<int16_t>(strtol(value, nullptr, 0));
+        }
+        else if (option == "--key-messages")
+        {
+            config.keyMessages = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--soft-key")
+        {
+            config.softKey = static_cast<uint16_t>(strtoul(value, nullptr, 0));
+        }
+        else if (option == "--set")
+        {
+            settings.push_back(value);
+        }
+        else if (option == "--versions")
+        {
+            versionsFile = value;
+        }
+        else
+        {
+            fprintf(stderr, "unknown option %s %s\n", option.c_str(), value);
+            return 1;
+        }
+    }
+
+    if ((bitRate == 0U) || (config.packetsPerCts == 0U) || (config.version < 3U) || (config.version > 6U) || (txBufferSize == 0U))
+    {
+        fprintf(stderr, "invalid bit rate, packets per CTS, VT version or transmit queue\n");
+        return 1;
+    }
+
+    settings.insert(settings.begin(), "CanDriver.Bitrate=" + std::to_string(bitRate));
+    for (const std::string& setting : settings)
+    {
+        if (!simSettingsSet(setting.c_str()))
+        {
+            fprintf(stderr, "invalid setting %s\n", setting.c_str());
+            return 1;
+        }
+    }
+
+    VirtualCanBus bus(bitRate, latencyUs, txBufferSize);
+    size_t ecuStation = bus.addStation();
+    size_t vtStation = bus.addStation();
+    VtServer vt(bus, vtStation, config);
+    if ((!versionsFile.empty()) && (!readVersions(versionsFile, vt.getVersions())))
+    {
+        fprintf(stderr, "cannot read %s\n", versionsFile.c_str());
+        return 1;
+    }
+
+    size_t storedVersions = vt.getVersions().size();
+    simHwSetup(&bus, ecuStation, vtStation, &vt, static_cast<uint64_t>(timeoutS) * 1000000U, verbose);
+    simHwSetFixedFreeTxSlots(fixedFreeTxSlots);
+    vt.start(0U);
+    app_main();
+
+    printf("\nMultiStepLoad on simulated VT%u (%.0f kbit/s, latency %u us, %u packets per CTS, language %c%c, %u stored versions)\n",
+        static_cast<unsigned>(config.version), bitRate / 1000.0, static_cast<unsigned>(latencyUs),
+        static_cast<unsigned>(config.packetsPerCts), config.language[0], config.language[1],
+        static_cast<unsigned>(storedVersions));
+    if (fixedFreeTxSlots >= 0)
+    {
+        printf("transmit FIFO %u frames, %d free slots reported (no backpressure)\n",
+            static_cast<unsigned>(txBufferSize), static_cast<int>(fixedFreeTxSlots));
+    }
+    else
+    {
+        printf("transmit FIFO %u frames, free slots reported\n", static_cast<unsigned>(txBufferSize));
+    }
+
+    printf("%8s %10s %10s %10s %10s\n", "pool", "start[ms]", "end[ms]", "bytes", "kbyte/s");
+    for (size_t idx = 0; idx < vt.getPoolTransfers().size(); ++idx)
+    {
+        const VtServer::PoolTransfer& transfer = vt.getPoolTransfers()[idx];
+        bool finished = (transfer.endUs != UINT64_MAX) && (transfer.endUs > transfer.startUs);
+        printf("%8u %10.1f %10.1f %10u %10.1f\n", static_cast<unsigned>(idx + 1U),
+            toMs(transfer.startUs), finished ? toMs(transfer.endUs) : -1.0, static_cast<unsigned>(transfer.bytes),
+            finished ? (transfer.bytes / toMs(transfer.endUs - transfer.startUs)) : 0.0);
+    }
+
+    uint64_t endUs = simHwGetTimeUs();
+    printTime("time to first mask:", vt.getFirstMaskUs());
+    printTime("time to final language:", vt.getFinalMaskUs());
+    printf("frames ECU / VT:        %10u / %u\n", static_cast<unsigned>(bus.getTxFrames(ecuStation)),
+        static_cast<unsigned>(bus.getTxFrames(vtStation)));
+    printf("transmit overflows:     %10u\n", static_cast<unsigned>(simHwGetTxOverflows()));
+    if (config.keyMessages > 0U)
+    {
+        const std::vector<uint64_t>& latencies = vt.getKeyLatenciesUs();
+        uint64_t minUs = UINT64_MAX;
+        uint64_t maxUs = 0U;
+        uint64_t sumUs = 0U;
+        for (uint64_t latencyUs : latencies)
+        {
+            minUs = (latencyUs < minUs) ? latencyUs : minUs;
+            maxUs = (latencyUs > maxUs) ? latencyUs : maxUs;
+            sumUs += latencyUs;
+        }
+
+        printf("soft key response:      %10u responses, %u lost\n", static_cast<unsigned>(latencies.size()),
+            static_cast<unsigned>(vt.getKeysLost()));
+        if (!latencies.empty())
+        {
+            printf("  min / avg / max:      %10.2f / %.2f / %.2f ms\n", toMs(minUs),
+                toMs(sumUs) / static_cast<double>(latencies.size()), toMs(maxUs));
+        }
+    }
+    printf("bus load:               %10.1f %%\n", (endUs > 0U) ? (100.0 * bus.getBusyUs()) / endUs : 0.0);
+
+    if ((!versionsFile.empty()) && (!writeVersions(versionsFile, vt.getVersions())))
+    {
+        return 1;
+    }
+
+    return (vt.getFinalMaskUs() != UINT64_MAX) ? 0 : 2;
+}